@@ -4,6 +4,10 @@
 #include "Engine/Core/Core.h"
 #include "Engine/EngineApplication.h"
 #include "Engine/Core/Logging/Log.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/FrameAllocator.h"
+#include "Engine/Core/Math/MathDispatch.h"
+#include "Engine/Core/Math/MathBatch.h"
 
 #include "Engine/LayerSystem/Layer.h"
 #include "Engine/ImGui/ImGuiLayer.h"
@@ -29,6 +29,7 @@
 // Core Folder Includes
 #include "Core/Memory/MemoryIncludes.h"
 #include "Core/Containers/ContainersIncludes.h"
+#include "Core/Strings/StringsIncludes.h"
 #include "Core/Math/MathIncludes.h"
 
 #include "Core/Containers/TempSTDContainers.h"
\ No newline at end of file
@@ -1,229 +1,226 @@
 #pragma once
 
 #include "Memory/MemoryIncludes.h"
+#include "Memory/MemoryOps.h"
+#include "Threading/ParallelFor.h"
+
+#include <functional>
+#include <type_traits>
+
+/*
+* Ranges this small are finished with an Insertion Sort by IntroSort.
+*/
+#define INTROSORT_INSERTION_THRESHOLD 16
+/*
+* Runs this small are Insertion Sorted by StableSort before merging.
+*/
+#define STABLESORT_INSERTION_THRESHOLD 32
+/*
+* Arrays this small are Insertion Sorted by RadixSort, the histogram passes cost more than they save.
+*/
+#define RADIXSORT_INSERTION_THRESHOLD 64
+/*
+* Arrays smaller than this are sorted on the calling thread by ParallelSort.
+*/
+#define PARALLELSORT_MIN_SIZE 32768
 
 namespace AAEngine {
 namespace Algorithms {
 
 	/*
 	* Swaps the Values in A and B by reference
-	* 
+	*
 	* @param A - reference to the Value to be swapped
 	* @param B - reference to the other Value to be swapped
 	*/
 	template<typename T>
 	static void Swap(T& A, T& B)
 	{
-		T Temp = A;
-		A = B;
-		B = Temp;
+		T Temp = Move(A);
+		A = Move(B);
+		B = Move(Temp);
 	}
 
 	/*
-	* Merge Sort Helper Recursive function that uses an Auxilary Array to store merged sub arrays
-	* Slow (O(2 * n * log(n)))
-	* 
+	* Insertion Sort, stable.
+	* O(n^2), fastest for small or almost sorted ranges.
+	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param AuxArray - The Auxillary Array used to sort merged sub arrays
-	* @param Left - The Left Index of the Sub Array to be MergeSorted.
-	* @param Right - The Right Index of the Sub Array to be MergeSorted.
+	* @param Size - Size of the Array
+	* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
+	*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
 	*/
-	template<typename T>
-	static void MergeSortHelperTempArray(T* InArray, T* AuxArray, size_t Left, size_t Right)
+	template<typename T, typename Predicate>
+	static void InsertionSort(T* InArray, size_t Size, Predicate Pred)
 	{
-		if (Right - Left <= 1)
+		for (size_t i = 1; i < Size; i++)
 		{
-			return;
-		}
-		if (Right - Left == 2)
-		{
-			if (InArray[Left] > InArray[Right - 1])
+			if (Pred(InArray[i], InArray[i - 1]))
 			{
-				Swap(InArray[Right - 1], InArray[Left]);
+				T Temp = Move(InArray[i]);
+				size_t j = i;
+				do
+				{
+					InArray[j] = Move(InArray[j - 1]);
+					j--;
+				} while (j > 0 && Pred(Temp, InArray[j - 1]));
+				InArray[j] = Move(Temp);
 			}
-			return;
 		}
+	}
 
-		size_t Center = Left + (Right - Left) >> 1;
-
-		MergeSortHelperTempArray(InArray, AuxArray, Left, Center + 1);
-		MergeSortHelperTempArray(InArray, AuxArray, Center + 1, Right);
-
-		size_t LeftI = Left;
-		size_t RightI = Center + 1;
-
-		size_t Index = Left;
-		while (LeftI <= Center && RightI < Right)
+	/*
+	* Moves the element at Root down the max heap of Size elements until both its children are smaller.
+	*/
+	template<typename T, typename Predicate>
+	static void SiftDown(T* InArray, size_t Root, size_t Size, Predicate Pred)
+	{
+		T Value = Move(InArray[Root]);
+		size_t Child = 2 * Root + 1;
+		while (Child < Size)
 		{
-			if (InArray[LeftI] > InArray[RightI])
+			if (Child + 1 < Size && Pred(InArray[Child], InArray[Child + 1]))
 			{
-				AuxArray[Index] = InArray[RightI];
-				RightI++;
+				Child++;
 			}
-			else
+			if (!Pred(Value, InArray[Child]))
 			{
-				AuxArray[Index] = InArray[LeftI];
-				LeftI++;
+				break;
 			}
-			Index++;
-		}
-
-		while (LeftI <= Center)
-		{
-			AuxArray[Index] = InArray[LeftI];
-			LeftI++;
-			Index++;
+			InArray[Root] = Move(InArray[Child]);
+			Root = Child;
+			Child = 2 * Root + 1;
 		}
-
-		while (RightI < Right)
-		{
-			AuxArray[Index] = InArray[RightI];
-			RightI++;
-			Index++;
-		}
-
-		FMemory::MemMove(InArray + Left, AuxArray + Left, (Right - Left) * sizeof(T));
+		InArray[Root] = Move(Value);
 	}
 
 	/*
-	* Merge Sort Helper Recursive function that uses an Auxilary Array to store merged sub arrays
-	* Slow (O(2 * n * log(n)))
+	* Heap Sort, not stable.
+	* O(n * log(n)) Worst Case, used by IntroSort when Quick Sort keeps picking bad pivots.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param AuxArray - The Auxillary Array used to sort merged sub arrays
-	* @param Left - The Left Index of the Sub Array to be MergeSorted.
-	* @param Right - The Right Index of the Sub Array to be MergeSorted.
+	* @param Size - Size of the Array
 	* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
 	*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
 	*/
 	template<typename T, typename Predicate>
-	static void MergeSortHelperTempArray(T* InArray, T* AuxArray, size_t Left, size_t Right, Predicate Pred)
+	static void HeapSort(T* InArray, size_t Size, Predicate Pred)
 	{
-		if (Right - Left <= 1)
+		for (size_t i = Size / 2; i > 0; i--)
 		{
-			return;
+			SiftDown(InArray, i - 1, Size, Pred);
 		}
-		if (Right - Left == 2)
+		for (size_t i = Size - 1; i > 0; i--)
 		{
-			if (Pred(InArray[Right - 1], InArray[Left]))
-			{
-				Swap(InArray[Right - 1], InArray[Left]);
-			}
-			return;
+			Swap(InArray[0], InArray[i]);
+			SiftDown(InArray, 0, i, Pred);
 		}
+	}
 
-		size_t Center = Left + (Right - Left) >> 1;
-
-		MergeSortHelperTempArray(InArray, AuxArray, Left, Center + 1);
-		MergeSortHelperTempArray(InArray, AuxArray, Center + 1, Right);
-
-		size_t LeftI = Left;
-		size_t RightI = Center + 1;
-
-		size_t Index = Left;
-		while (LeftI <= Center && RightI < Right)
+	/*
+	* Moves the median of A, B, C into Result.
+	*/
+	template<typename T, typename Predicate>
+	static void MoveMedianToFirst(T* Result, T* A, T* B, T* C, Predicate Pred)
+	{
+		if (Pred(*A, *B))
 		{
-			if (Pred(InArray[RightI], InArray[LeftI]))
+			if (Pred(*B, *C))
+			{
+				Swap(*Result, *B);
+			}
+			else if (Pred(*A, *C))
 			{
-				AuxArray[Index] = InArray[RightI];
-				RightI++;
+				Swap(*Result, *C);
 			}
 			else
 			{
-				AuxArray[Index] = InArray[LeftI];
-				LeftI++;
+				Swap(*Result, *A);
 			}
-			Index++;
 		}
-
-		while (LeftI <= Center)
+		else if (Pred(*A, *C))
 		{
-			AuxArray[Index] = InArray[LeftI];
-			LeftI++;
-			Index++;
+			Swap(*Result, *A);
 		}
-
-		while (RightI < Right)
+		else if (Pred(*B, *C))
 		{
-			AuxArray[Index] = InArray[RightI];
-			RightI++;
-			Index++;
+			Swap(*Result, *C);
+		}
+		else
+		{
+			Swap(*Result, *B);
 		}
-
-		FMemory::MemMove(InArray + Left, AuxArray + Left, (Right - Left) * sizeof(T));
 	}
 
 	/*
-	* DON'T USE!! NOOB FUNCTION!!
-	* Merge Sort Helper Recursive function that sorts the Array in-place
-	* n^2 because every element we try to arrange in the sorted array, we need to shift the rest of the left subarray with O(n)
-	* Incredibly Slow O(n^2 * log(n))
+	* Partitions the Array around the median of its first, middle and last elements.
+	* The median pivot guarantees both scans stop inside the Array, so they don't need bounds checks.
 	*
-	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Left - The Left Index of the Sub Array to be MergeSorted.
-	* @param Right - The Right Index of the Sub Array to be MergeSorted.
+	* @returns Index of the first element of the right partition, every element before it is <= every element from it on.
 	*/
-	template<typename T>
-	static void MergeSortHelperInPlace(T* InArray, size_t Left, size_t Right)
+	template<typename T, typename Predicate>
+	static size_t PartitionMedianOfThree(T* InArray, size_t Size, Predicate Pred)
 	{
-		if (Right - Left <= 1)
-		{
-			return;
-		}
-		if (Right - Left == 2)
+		MoveMedianToFirst(InArray, InArray + 1, InArray + Size / 2, InArray + Size - 1, Pred);
+
+		T* Left = InArray + 1;
+		T* Right = InArray + Size;
+		while (true)
 		{
-			if (InArray[Left] > InArray[Right - 1])
+			while (Pred(*Left, *InArray))
 			{
-				Swap(InArray[Right - 1], InArray[Left]);
+				Left++;
 			}
-			return;
-		}
-
-		size_t Center = Left + (Right - Left) >> 1;
-
-		MergeSortHelperInPlace(InArray, Left, Center + 1);
-		MergeSortHelperInPlace(InArray, Center + 1, Right);
-
-		size_t LeftI = Left;
-		size_t RightI = Center + 1;
-
-		while (LeftI <= Center && RightI < Right)
-		{
-			if (InArray[LeftI] > InArray[RightI])
+			Right--;
+			while (Pred(*InArray, *Right))
 			{
-				T Temp = InArray[RightI];
-				for (size_t i = RightI; i > LeftI; i--)
-				{
-					InArray[i] = InArray[i - 1];
-				}
-				InArray[LeftI] = Temp;
-				RightI++;
-				LeftI++;
-				Center++;
+				Right--;
 			}
-			else
+			if (!(Left < Right))
 			{
-				LeftI++;
+				return Left - InArray;
 			}
+			Swap(*Left, *Right);
+			Left++;
 		}
 	}
 
 	/*
-	* Merge Sort Recursive Function that calls the MergeSortHelper functions to sort the Array.
-	* 
-	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Size - Size of the Array
+	* Intro Sort Helper, Quick Sorts until the partitions are small or the depth limit is reached.
+	* Recurses into the smaller partition and loops on the larger one, so the stack stays O(log(n)).
 	*/
-	template<typename T>
-	static void MergeSortRecursive(T* InArray, size_t Size)
+	template<typename T, typename Predicate>
+	static void IntroSortHelper(T* InArray, size_t Size, size_t DepthLimit, Predicate Pred)
 	{
-		T* TempArray = new T[Size];
-		MergeSortHelperTempArray(InArray, TempArray, 0, Size);
-		delete[] TempArray;
+		while (Size > INTROSORT_INSERTION_THRESHOLD)
+		{
+			if (DepthLimit == 0)
+			{
+				HeapSort(InArray, Size, Pred);
+				return;
+			}
+			DepthLimit--;
+
+			const size_t Cut = PartitionMedianOfThree(InArray, Size, Pred);
+			if (Cut < Size - Cut)
+			{
+				IntroSortHelper(InArray, Cut, DepthLimit, Pred);
+				InArray += Cut;
+				Size -= Cut;
+			}
+			else
+			{
+				IntroSortHelper(InArray + Cut, Size - Cut, DepthLimit, Pred);
+				Size = Cut;
+			}
+		}
+		InsertionSort(InArray, Size, Pred);
 	}
 
 	/*
-	* Merge Sort Recursive Function that calls the MergeSortHelper functions to sort the Array.
+	* Intro Sort, not stable, in place.
+	* Quick Sort with a Median of Three Pivot, falls back to Heap Sort after 2 * log2(n) levels so the Worst Case stays O(n * log(n)),
+	* and finishes small partitions with Insertion Sort.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
 	* @param Size - Size of the Array
@@ -231,217 +228,348 @@ namespace Algorithms {
 	*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
 	*/
 	template<typename T, typename Predicate>
-	static void MergeSortRecursive(T* InArray, size_t Size, Predicate Pred)
+	static void IntroSort(T* InArray, size_t Size, Predicate Pred)
+	{
+		size_t DepthLimit = 0;
+		for (size_t i = Size; i > 1; i >>= 1)
+		{
+			DepthLimit += 2;
+		}
+		IntroSortHelper(InArray, Size, DepthLimit, Pred);
+	}
+
+	template<typename T>
+	static void IntroSort(T* InArray, size_t Size)
 	{
-		T* TempArray = new T[Size];
-		MergeSortHelperTempArray(InArray, TempArray, 0, Size, Pred);
-		delete[] TempArray;
+		IntroSort(InArray, Size, std::less{});
 	}
 
 	/*
-	* Merge Sort Helper Recursive function that finds a Median Pivot and then sorts the Sub-Arrays
-	* O (n * log(n)) Average Case with a Median Pivot Point
-	* Faster than Merge Sort.
+	* Merge Sort Helper Recursive function, Insertion Sorts small runs and merges the halves through Scratch.
+	* Only the left half is moved out into Scratch, the merge writes straight back into InArray.
 	*
-	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Left - The Left Index of the Sub Array to be QuickSorted.
-	* @param Right - The Right Index of the Sub Array to be QuickSorted.
+	* @param Scratch - Uninitialized memory for at least Size / 2 elements
 	*/
-	template<typename T>
-	static void QuickSortHelper(T* InArray, size_t Left, size_t Right)
+	template<typename T, typename Predicate>
+	static void StableSortHelper(T* InArray, size_t Size, T* Scratch, Predicate Pred)
 	{
-		if (Right - Left <= 1)
+		if (Size <= STABLESORT_INSERTION_THRESHOLD)
 		{
+			InsertionSort(InArray, Size, Pred);
 			return;
 		}
-		else if (Right - Left == 2)
+
+		const size_t Mid = Size / 2;
+		StableSortHelper(InArray, Mid, Scratch, Pred);
+		StableSortHelper(InArray + Mid, Size - Mid, Scratch, Pred);
+
+		// Halves are already in order
+		if (!Pred(InArray[Mid], InArray[Mid - 1]))
 		{
-			if (InArray[Right - 1] < InArray[Left])
-			{
-				Swap(InArray[Right - 1], InArray[Left]);
-			}
 			return;
 		}
-		// O(1) - 2-3 Comparisions
-		// Right - 1 = Last Element
-		size_t PivotIndex = FindMedianPivot(InArray, Left, Right - 1);
-		
-		T PivotValue = InArray[PivotIndex];
 
-		size_t LeftStart = Left;
-		size_t RightStart = Right - 1;
+		MoveConstructItems(Scratch, InArray, Mid);
 
-		// O(n)
-		while (RightStart >= LeftStart && RightStart >= Left && LeftStart < Right)
+		size_t LeftI = 0;
+		size_t RightI = Mid;
+		size_t Index = 0;
+		while (LeftI < Mid && RightI < Size)
 		{
-			while (InArray[LeftStart] < PivotValue)
-			{
-				LeftStart++;
-			}
-			while (InArray[RightStart] > PivotValue)
+			if (Pred(InArray[RightI], Scratch[LeftI]))
 			{
-				RightStart--;
+				InArray[Index++] = Move(InArray[RightI++]);
 			}
-			if (RightStart >= LeftStart)
+			else
 			{
-				Swap(InArray[LeftStart], InArray[RightStart]);
-				LeftStart++;
-				RightStart--;
+				InArray[Index++] = Move(Scratch[LeftI++]);
 			}
 		}
+		while (LeftI < Mid)
+		{
+			InArray[Index++] = Move(Scratch[LeftI++]);
+		}
 
-		QuickSortHelper(InArray, Left, LeftStart);
-		QuickSortHelper(InArray, LeftStart, Right);
+		DestructItems(Scratch, Mid);
 	}
 
 	/*
-	* Merge Sort Helper Recursive function that finds a Median Pivot and then sorts the Sub-Arrays
-	* O (n * log(n)) Average Case with a Median Pivot Point
-	* Faster than Merge Sort.
+	* Stable Sort, equal elements keep their order.
+	* Merge Sort with Insertion Sorted runs, allocates a single scratch buffer of n / 2 elements for the whole sort.
+	* O(n * log(n)), O(n) for already sorted input.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Left - The Left Index of the Sub Array to be QuickSorted.
-	* @param Right - The Right Index of the Sub Array to be QuickSorted.
+	* @param Size - Size of the Array
 	* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
 	*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
 	*/
 	template<typename T, typename Predicate>
-	static void QuickSortHelper(T* InArray, size_t Left, size_t Right, Predicate Pred)
+	static void StableSort(T* InArray, size_t Size, Predicate Pred)
 	{
-		if (Right - Left <= 1)
+		if (Size <= STABLESORT_INSERTION_THRESHOLD)
 		{
+			InsertionSort(InArray, Size, Pred);
 			return;
 		}
-		else if (Right - Left == 2)
+
+		T* Scratch = (T*)FMemory::Malloc((Size / 2) * sizeof(T), alignof(T), EMemoryTag::Containers);
+		StableSortHelper(InArray, Size, Scratch, Pred);
+		FMemory::Free(Scratch);
+	}
+
+	template<typename T>
+	static void StableSort(T* InArray, size_t Size)
+	{
+		StableSort(InArray, Size, std::less{});
+	}
+
+	/*
+	* Maps a numeric key to an unsigned integer of the same size whose unsigned order matches the key's order.
+	* Signed integers get their sign bit flipped, floats get every bit flipped when negative and the sign bit flipped otherwise.
+	*
+	* @param Key - Integer or floating point key.
+	*
+	* @returns Unsigned integer to sort by.
+	*/
+	template<typename KeyType>
+	FORCEINLINE auto ToRadixKey(KeyType Key) noexcept
+	{
+		static_assert(std::is_arithmetic<KeyType>::value, "Radix Sort keys must be integers or floating point numbers!");
+
+		if constexpr (std::is_floating_point<KeyType>::value)
+		{
+			using BitsType = std::conditional_t<sizeof(KeyType) == 4, uint32_t, uint64_t>;
+			static_assert(sizeof(KeyType) == sizeof(BitsType), "Unsupported floating point type for Radix Sort!");
+
+			BitsType Bits;
+			FMemory::MemCopy(&Bits, &Key, sizeof(Bits));
+			const BitsType SignBit = BitsType(1) << (sizeof(BitsType) * 8 - 1);
+			return (Bits & SignBit) ? (BitsType)~Bits : (BitsType)(Bits | SignBit);
+		}
+		else if constexpr (std::is_signed<KeyType>::value)
 		{
-			if (Pred(InArray[Right - 1], InArray[Left]))
-			{
-				Swap(InArray[Right - 1], InArray[Left]);
-			}
-			return;
+			using BitsType = std::make_unsigned_t<KeyType>;
+			return (BitsType)((BitsType)Key ^ (BitsType(1) << (sizeof(BitsType) * 8 - 1)));
+		}
+		else
+		{
+			return Key;
 		}
-		// O(1) - 2-3 Comparisions
-		// Right - 1 = Last Element
-		size_t PivotIndex = FindMedianPivot(InArray, Left, Right - 1, Pred);
+	}
 
-		T PivotValue = InArray[PivotIndex];
+	/*
+	* LSD Radix Sort by a numeric key, stable.
+	* One pass over the Array builds the histograms of every byte of the key, then one scatter pass per byte
+	* (skipped when every key has the same byte). O(n * sizeof(Key)), no comparisons.
+	* Meant for large Arrays with integer / float keys, e.g. Render Keys.
+	*
+	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
+	* @param Size - Size of the Array
+	* @param KeyFunc - Callable returning the integer / float key of an element, called several times per element.
+	*/
+	template<typename T, typename KeyFuncType>
+	static void RadixSort(T* InArray, size_t Size, KeyFuncType KeyFunc)
+	{
+		using RadixType = decltype(ToRadixKey(KeyFunc(*InArray)));
+		constexpr size_t NumPasses = sizeof(RadixType);
 
-		size_t LeftStart = Left;
-		size_t RightStart = Right - 1;
+		if (Size <= RADIXSORT_INSERTION_THRESHOLD)
+		{
+			InsertionSort(InArray, Size, [&KeyFunc](const T& A, const T& B) { return ToRadixKey(KeyFunc(A)) < ToRadixKey(KeyFunc(B)); });
+			return;
+		}
+
+		size_t Histograms[NumPasses][256] = {};
+		for (size_t i = 0; i < Size; i++)
+		{
+			const RadixType Key = ToRadixKey(KeyFunc(InArray[i]));
+			for (size_t Pass = 0; Pass < NumPasses; Pass++)
+			{
+				Histograms[Pass][(Key >> (Pass * 8)) & 0xFF]++;
+			}
+		}
 
-		// O(n)
-		while (RightStart >= LeftStart && RightStart >= Left && LeftStart < Right)
+		T* Scratch = (T*)FMemory::Malloc(Size * sizeof(T), alignof(T), EMemoryTag::Containers);
+		T* Source = InArray;
+		T* Dest = Scratch;
+		for (size_t Pass = 0; Pass < NumPasses; Pass++)
 		{
-			while (Pred(InArray[LeftStart], PivotValue))
+			size_t* Offsets = Histograms[Pass];
+			if (Offsets[(ToRadixKey(KeyFunc(Source[0])) >> (Pass * 8)) & 0xFF] == Size)
 			{
-				LeftStart++;
+				continue;
 			}
-			while (Pred(PivotValue, InArray[RightStart]))
+
+			size_t Offset = 0;
+			for (size_t Digit = 0; Digit < 256; Digit++)
 			{
-				RightStart--;
+				const size_t Count = Offsets[Digit];
+				Offsets[Digit] = Offset;
+				Offset += Count;
 			}
-			if (RightStart >= LeftStart)
+
+			for (size_t i = 0; i < Size; i++)
 			{
-				Swap(InArray[LeftStart], InArray[RightStart]);
-				LeftStart++;
-				RightStart--;
+				const size_t Digit = (ToRadixKey(KeyFunc(Source[i])) >> (Pass * 8)) & 0xFF;
+				RelocateConstructItems(Dest + Offsets[Digit]++, Source + i, 1);
 			}
+
+			T* Temp = Source;
+			Source = Dest;
+			Dest = Temp;
 		}
 
-		QuickSortHelper(InArray, Left, LeftStart, Pred);
-		QuickSortHelper(InArray, LeftStart, Right, Pred);
+		if (Source != InArray)
+		{
+			RelocateConstructItems(InArray, Source, Size);
+		}
+		FMemory::Free(Scratch);
 	}
 
 	/*
-	* Finds a Median Pivot - Median of Left Value, Right Value, Center Value from the InArray
-	* 
+	* LSD Radix Sort of integers / floats, stable.
+	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Left - The Left Index of the Sub Array to be QuickSorted.
-	* @param Right - The Right Index of the Sub Array to be QuickSorted.
+	* @param Size - Size of the Array
 	*/
 	template<typename T>
-	static size_t FindMedianPivot(T* InArray, size_t Left, size_t Right)
+	static void RadixSort(T* InArray, size_t Size)
 	{
-		size_t Center = Left + ((Right - Left) >> 1);
-		if (InArray[Right] > InArray[Left])
-		{
-			if (InArray[Center] > InArray[Right])
-			{
-				return Right;
-			}
-			else if (InArray[Center] < InArray[Left])
-			{
-				return Left;
-			}
-			else
-			{
-				return Center;
-			}
-		}
-		else
+		RadixSort(InArray, Size, [](const T& Value) { return Value; });
+	}
+
+	/*
+	* Merges the sorted ranges A and B into the uninitialized memory at Dest, A and B are left as uninitialized memory.
+	* Ties take from A first.
+	*/
+	template<typename T, typename Predicate>
+	static void RelocateMerge(T* A, size_t SizeA, T* B, size_t SizeB, T* Dest, Predicate Pred)
+	{
+		size_t AI = 0;
+		size_t BI = 0;
+		while (AI < SizeA && BI < SizeB)
 		{
-			if (InArray[Center] < InArray[Right])
-			{
-				return Right;
-			}
-			else if (InArray[Center] > InArray[Left])
+			if (Pred(B[BI], A[AI]))
 			{
-				return Left;
+				RelocateConstructItems(Dest++, B + BI++, 1);
 			}
 			else
 			{
-				return Center;
+				RelocateConstructItems(Dest++, A + AI++, 1);
 			}
 		}
+		RelocateConstructItems(Dest, A + AI, SizeA - AI);
+		RelocateConstructItems(Dest + (SizeA - AI), B + BI, SizeB - BI);
 	}
-	
+
 	/*
-	* Finds a Median Pivot - Median of Left Value, Right Value, Center Value from the InArray
+	* Parallel Sort, not stable.
+	* Splits the Array into one chunk per thread, Intro Sorts the chunks in parallel and merges them pairwise in parallel,
+	* each merge itself split into independent pieces so every thread has work until the last level.
+	* Arrays below PARALLELSORT_MIN_SIZE are Intro Sorted on the calling thread.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
-	* @param Left - The Left Index of the Sub Array to be QuickSorted.
-	* @param Right - The Right Index of the Sub Array to be QuickSorted.
+	* @param Size - Size of the Array
 	* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
 	*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
+	*				Called from several threads at once.
 	*/
 	template<typename T, typename Predicate>
-	static size_t FindMedianPivot(T* InArray, size_t Left, size_t Right, Predicate Pred)
+	static void ParallelSort(T* InArray, size_t Size, Predicate Pred)
 	{
-		size_t Center = Left + ((Right - Left) >> 1);
-		if (Pred(InArray[Left], InArray[Right]))
+		const size_t NumThreads = GetNumParallelThreads();
+		if (Size < PARALLELSORT_MIN_SIZE || NumThreads == 1)
 		{
-			if (Pred(InArray[Right], InArray[Center]))
-			{
-				return Right;
-			}
-			else if (Pred(InArray[Center], InArray[Left]))
-			{
-				return Left;
-			}
-			else
-			{
-				return Center;
-			}
+			IntroSort(InArray, Size, Pred);
+			return;
 		}
-		else
+
+		// Power of two chunks so they merge pairwise
+		size_t NumChunks = 2;
+		while (NumChunks * 2 <= NumThreads)
 		{
-			if (Pred(InArray[Center], InArray[Right]))
-			{
-				return Right;
-			}
-			else if (Pred(InArray[Left], InArray[Center]))
-			{
-				return Left;
-			}
-			else
+			NumChunks *= 2;
+		}
+		auto ChunkStart = [Size, NumChunks](size_t Chunk) { return Size * Chunk / NumChunks; };
+
+		ParallelFor(NumChunks, [&](size_t Chunk)
+		{
+			IntroSort(InArray + ChunkStart(Chunk), ChunkStart(Chunk + 1) - ChunkStart(Chunk), Pred);
+		});
+
+		T* Scratch = (T*)FMemory::Malloc(Size * sizeof(T), alignof(T), EMemoryTag::Containers);
+		T* Source = InArray;
+		T* Dest = Scratch;
+		for (size_t Width = 1; Width < NumChunks; Width *= 2)
+		{
+			const size_t NumMerges = NumChunks / (Width * 2);
+			const size_t PiecesPerMerge = (NumThreads + NumMerges - 1) / NumMerges;
+
+			ParallelFor(NumMerges * PiecesPerMerge, [&](size_t Task)
 			{
-				return Center;
-			}
+				const size_t Merge = Task / PiecesPerMerge;
+				const size_t Piece = Task % PiecesPerMerge;
+				const size_t Start = ChunkStart(Merge * Width * 2);
+				const size_t Mid = ChunkStart(Merge * Width * 2 + Width);
+				const size_t End = ChunkStart((Merge + 1) * Width * 2);
+
+				// Piece covers [AFirst, ALast) of the left run and every element of the right run that goes between them
+				const size_t SizeA = Mid - Start;
+				const size_t AFirst = SizeA * Piece / PiecesPerMerge;
+				const size_t ALast = SizeA * (Piece + 1) / PiecesPerMerge;
+				auto RightSplit = [&](size_t AIndex)
+				{
+					if (AIndex == 0)
+					{
+						return Mid;
+					}
+					if (AIndex == SizeA)
+					{
+						return End;
+					}
+					// First element of the right run that isn't less than the left run's element => it goes after it
+					size_t Low = Mid;
+					size_t High = End;
+					while (Low < High)
+					{
+						const size_t Center = Low + (High - Low) / 2;
+						if (Pred(Source[Center], Source[Start + AIndex]))
+						{
+							Low = Center + 1;
+						}
+						else
+						{
+							High = Center;
+						}
+					}
+					return Low;
+				};
+				const size_t BFirst = RightSplit(AFirst);
+				const size_t BLast = RightSplit(ALast);
+
+				RelocateMerge(Source + Start + AFirst, ALast - AFirst, Source + BFirst, BLast - BFirst, Dest + Start + AFirst + (BFirst - Mid), Pred);
+			});
+
+			T* Temp = Source;
+			Source = Dest;
+			Dest = Temp;
+		}
+
+		if (Source != InArray)
+		{
+			RelocateConstructItems(InArray, Source, Size);
 		}
+		FMemory::Free(Scratch);
+	}
+
+	template<typename T>
+	static void ParallelSort(T* InArray, size_t Size)
+	{
+		ParallelSort(InArray, Size, std::less{});
 	}
 
 	/*
-	* Quick Sort Recursive Function that calls the QuickSortHelper functions to sort the Array.
+	* Quick Sort, kept for existing callers => Intro Sort.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
 	* @param Size - Size of the Array
@@ -449,11 +577,11 @@ namespace Algorithms {
 	template<typename T>
 	static void QuickSort(T* InArray, size_t Size)
 	{
-		QuickSortHelper(InArray, 0, Size, std::less{});
+		IntroSort(InArray, Size, std::less{});
 	}
 
 	/*
-	* Quick Sort Recursive Function that calls the QuickSortHelper functions to sort the Array.
+	* Quick Sort, kept for existing callers => Intro Sort.
 	*
 	* @param InArray - Pointer to the Start of the Array that needs to be sorted.
 	* @param Size - Size of the Array
@@ -463,7 +591,7 @@ namespace Algorithms {
 	template<typename T, typename Predicate>
 	static void QuickSort(T* InArray, size_t Size, Predicate Pred)
 	{
-		QuickSortHelper(InArray, 0, Size, Pred);
+		IntroSort(InArray, Size, Pred);
 	}
 }
-}
\ No newline at end of file
+}
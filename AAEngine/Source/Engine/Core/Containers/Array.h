@@ -4,7 +4,9 @@
 
 #include "Templates/AATemplates.h"
 #include "Memory/Memory.h"
+#include "Memory/MemoryOps.h"
 #include "Algorithms.h"
+#include "ContainerAllocators.h"
 
 namespace AAEngine {
 
@@ -224,7 +226,13 @@ namespace AAEngine {
 		PtrType Pointer;
 	};
 
-	template<typename T>
+	/*
+	* Dynamic Array class
+	*
+	* @tparam T - The type of elements stored in the array
+	* @tparam AllocatorType - Allocator policy the array gets its memory from (see ContainerAllocators.h)
+	*/
+	template<typename T, typename AllocatorType = FHeapAllocator>
 	class AA_ENGINE_API TArray
 	{
 #define DEFAULT_RESIZE_MULTIPLIER 2
@@ -232,6 +240,7 @@ namespace AAEngine {
 	public:
 		using Iterator = DynArrayIterator<T>;
 		using ConstIterator = DynArrayIterator<const T>;
+		using ElementAllocatorType = typename AllocatorType::template TForElementType<T>;
 
 		/*
 		* Default constructor for TArray.
@@ -247,7 +256,7 @@ namespace AAEngine {
 		* @param InitialCapacity - Initial Capacity for the Array
 		*/
 		FORCEINLINE constexpr TArray(size_t InitialCapacity) noexcept
-			: Size(0), Capacity(InitialCapacity)
+			: Size(0), Capacity(0)
 		{
 			ReallocateArray(InitialCapacity);
 		}
@@ -261,38 +270,40 @@ namespace AAEngine {
 		FORCEINLINE constexpr TArray(const TArray& NewArray) noexcept
 		{
 			ReallocateArray(NewArray.Capacity);
-			for (size_t i = 0; i < NewArray.Size; i++)
-			{
-				new(&InArray[i]) T(NewArray[i]);
-			}
+			CopyConstructItems(InArray, NewArray.InArray, NewArray.Size);
 			Size = NewArray.Size;
 		}
 
+		/*
+		* Copy constructor for TArray from an array using a different allocator.
+		* Used to keep data from a temporary (arena / inline) array around.
+		*
+		* @param NewArray - The array to copy from.
+		*/
+		template<typename OtherAllocatorType>
+		FORCEINLINE constexpr explicit TArray(const TArray<T, OtherAllocatorType>& NewArray) noexcept
+		{
+			ReallocateArray(NewArray.Num());
+			CopyConstructItems(InArray, NewArray.Data(), NewArray.Num());
+			Size = NewArray.Num();
+		}
+
 		/*
 		* Move constructor for TArray.
-		* Moves elements from the given NewArray to the current array.
+		* Takes the allocation of the given NewArray and leaves it empty.
 		*
 		* @param NewArray - The array to move from.
 		*/
 		FORCEINLINE constexpr TArray(TArray&& NewArray) noexcept
 		{
-			ReallocateArray(NewArray.Capacity);
-			for (size_t i = 0; i < NewArray.Size; i++)
-			{
-				new(&InArray[i]) T(Move(NewArray[i]));
-			}
-			Size = NewArray.Size;
+			AssignArray(Move(NewArray));
 		}
 
 		FORCEINLINE constexpr TArray(const std::initializer_list<T>& InitList) noexcept
 		{
 			ReallocateArray(InitList.size());
-
-			for (T Elem : InitList)
-			{
-				new(&InArray[Size]) T(Elem);
-				Size++;
-			}
+			CopyConstructItems(InArray, InitList.begin(), InitList.size());
+			Size = InitList.size();
 		}
 
 		/*
@@ -332,7 +343,7 @@ namespace AAEngine {
 			Clear();
 			if (InArray)
 			{
-				::operator delete(InArray, Capacity * sizeof(T));
+				Allocator.Deallocate(InArray, Capacity);
 			}
 		}
 
@@ -404,7 +415,7 @@ namespace AAEngine {
 			}
 			else
 			{
-				FMemory::MemCopy(InArray + Position + 1, InArray + Position, sizeof(T) * (Size - Position));
+				RelocateConstructItems(InArray + Position + 1, InArray + Position, Size - Position);
 				new(&InArray[Position]) T(Forward<DirectArgs>(Args)...);
 				Size++;
 				return InArray[Position];
@@ -437,7 +448,7 @@ namespace AAEngine {
 			}
 			else
 			{
-				FMemory::MemCopy(It.Get() + 1, It.Get(), sizeof(T) * (end() - It));
+				RelocateConstructItems(It.Get() + 1, It.Get(), end() - It);
 				new(It.Get()) T(Forward<DirectArgs>(Args)...);
 				Size++;
 				return MakeIterator(It.Get());
@@ -465,7 +476,7 @@ namespace AAEngine {
 			}
 			else
 			{
-				FMemory::MemCopy(InArray + Position + 1, InArray + Position, sizeof(T) * (Size - Position));
+				RelocateConstructItems(InArray + Position + 1, InArray + Position, Size - Position);
 				new(&InArray[Position]) T(Element);
 			}
 			Size++;
@@ -492,7 +503,7 @@ namespace AAEngine {
 			}
 			else
 			{
-				FMemory::MemCopy(InArray + Position + 1, InArray + Position, sizeof(T) * (Size - Position));
+				RelocateConstructItems(InArray + Position + 1, InArray + Position, Size - Position);
 				new(&InArray[Position]) T(Move(Element));
 			}
 			Size++;
@@ -524,8 +535,148 @@ namespace AAEngine {
 			return Emplace(It, Move(Element));
 		}
 
+		/*
+		* Inserts copies of Count elements starting at Elements at the specified position in the array.
+		* Elements must not point into this array.
+		*
+		* @param Position - The position where the first element should be inserted.
+		* @param Elements - Pointer to the first element to insert.
+		* @param Count - Number of elements to insert.
+		*/
+		FORCEINLINE constexpr void InsertAt(size_t Position, const T* Elements, size_t Count) noexcept
+		{
+			AA_CORE_ASSERT(int(Elements + Count <= InArray || Elements >= InArray + Capacity), "InsertAt: Elements point into the array");
+
+			// Should we clamp?
+			Position = Position >= Size ? Size : Position;
+			ReserveForGrowth(Size + Count);
+
+			RelocateConstructItems(InArray + Position + Count, InArray + Position, Size - Position);
+			CopyConstructItems(InArray + Position, Elements, Count);
+			Size += Count;
+		}
+
+		/*
+		* Inserts copies of the elements in the range [First, Last) at the position specified by the iterator.
+		* The range must not come from this array.
+		*
+		* @param It - The iterator pointing to the position to insert the elements.
+		* @param First - Iterator to the first element to insert.
+		* @param Last - Iterator past the last element to insert.
+		*
+		* @returns Iterator pointing to the first inserted element.
+		*/
+		template<typename InputIterator>
+		FORCEINLINE constexpr Iterator InsertAt(Iterator It, InputIterator First, InputIterator Last) noexcept
+		{
+			size_t Position = It.Get() ? (size_t)(It - begin()) : 0;
+			Position = Position >= Size ? Size : Position;
+
+			size_t Count = 0;
+			for (InputIterator Counter = First; Counter != Last; ++Counter)
+			{
+				Count++;
+			}
+			ReserveForGrowth(Size + Count);
+
+			RelocateConstructItems(InArray + Position + Count, InArray + Position, Size - Position);
+			T* Dest = InArray + Position;
+			for (; First != Last; ++First)
+			{
+				new(Dest++) T(*First);
+			}
+			Size += Count;
+
+			return MakeIterator(InArray + Position);
+		}
+
+		/*
+		* Appends copies of Count elements starting at Elements to the end of the array.
+		* Trivially copyable types are copied with a single MemCopy.
+		*
+		* @param Elements - Pointer to the first element to append.
+		* @param Count - Number of elements to append.
+		*/
+		FORCEINLINE constexpr void Append(const T* Elements, size_t Count) noexcept
+		{
+			if (Size + Count > Capacity)
+			{
+				// Appending part of ourselves, find the elements again after the reallocation
+				const bool bIsFromThisArray = InArray && Elements >= InArray && Elements < InArray + Size;
+				const size_t Offset = bIsFromThisArray ? Elements - InArray : 0;
+
+				ReserveForGrowth(Size + Count);
+				Elements = bIsFromThisArray ? InArray + Offset : Elements;
+			}
+
+			CopyConstructItems(InArray + Size, Elements, Count);
+			Size += Count;
+		}
+
+		/*
+		* Appends copies of all the elements of another array to the end of the array.
+		*
+		* @param Other - The array to append.
+		*/
+		template<typename OtherAllocatorType>
+		FORCEINLINE constexpr void Append(const TArray<T, OtherAllocatorType>& Other) noexcept
+		{
+			Append(Other.Data(), Other.Num());
+		}
+
+		/*
+		* Adds Count uninitialized elements to the end of the array.
+		* Used to write elements straight into the array's storage, every added element has to be constructed / written before it is used.
+		*
+		* @param Count - Number of elements to add.
+		*
+		* @returns Index of the first added element.
+		*/
+		FORCEINLINE constexpr size_t AddUninitialized(size_t Count) noexcept
+		{
+			const size_t FirstIndex = Size;
+			ReserveForGrowth(Size + Count);
+			Size += Count;
+			return FirstIndex;
+		}
+
+		/*
+		* Adds Count elements with all their bytes set to zero to the end of the array.
+		*
+		* @param Count - Number of elements to add.
+		*
+		* @returns Index of the first added element.
+		*/
+		FORCEINLINE constexpr size_t AddZeroed(size_t Count) noexcept
+		{
+			const size_t FirstIndex = AddUninitialized(Count);
+			if (Count > 0)
+			{
+				FMemory::MemSet(InArray + FirstIndex, 0, sizeof(T) * Count);
+			}
+			return FirstIndex;
+		}
 
-		/**
+		/*
+		* Resizes the array to NewNum elements.
+		* Added elements are left uninitialized, removed elements are destroyed.
+		*
+		* @param NewNum - The new number of elements.
+		*/
+		FORCEINLINE constexpr void SetNumUninitialized(size_t NewNum) noexcept
+		{
+			if (NewNum > Size)
+			{
+				AddUninitialized(NewNum - Size);
+			}
+			else
+			{
+				DestructItems(InArray + NewNum, Size - NewNum);
+				Size = NewNum;
+			}
+		}
+
+		/*
 		* Removes an element from the specified position in the array.
 		*
 		* @param Position - The position of the element to remove.
@@ -543,12 +694,40 @@ namespace AAEngine {
 			}
 			else
 			{
-				FMemory::MemCopy(InArray + Position, InArray + Position + 1, sizeof(T) * (Size - Position - 1));
 				InArray[Position].~T();
+				RelocateConstructItems(InArray + Position, InArray + Position + 1, Size - Position - 1);
 				Size--;
 			}
 		}
 
+		/*
+		* Removes Count elements starting at the specified position in the array, keeping the order of the rest.
+		*
+		* @param Position - The position of the first element to remove.
+		* @param Count - Number of elements to remove.
+		*/
+		FORCEINLINE constexpr void RemoveAt(size_t Position, size_t Count) noexcept
+		{
+			AA_CORE_ASSERT(Position + Count <= Size, "Removing elements [%d, %d) when Size is %d", Position, Position + Count, Size);
+			DestructItems(InArray + Position, Count);
+			RelocateConstructItems(InArray + Position, InArray + Position + Count, Size - Position - Count);
+			Size -= Count;
+		}
+
+		/*
+		* Removes Count elements starting at the specified position without destroying them, keeping the order of the rest.
+		* For callers that already destroyed those elements (e.g. TQueue's consumed front).
+		*
+		* @param Position - The position of the first element to remove.
+		* @param Count - Number of elements to remove.
+		*/
+		FORCEINLINE constexpr void RemoveAtUninitialized(size_t Position, size_t Count) noexcept
+		{
+			AA_CORE_ASSERT(Position + Count <= Size, "Removing elements [%d, %d) when Size is %d", Position, Position + Count, Size);
+			RelocateConstructItems(InArray + Position, InArray + Position + Count, Size - Position - Count);
+			Size -= Count;
+		}
+
 		/*
 		* Removes an element from the specified iterator position in the array.
 		*
@@ -602,10 +781,7 @@ namespace AAEngine {
 		*/
 		FORCEINLINE constexpr void Clear() noexcept
 		{
-			for (size_t i = 0; i < Size; i++)
-			{
-				InArray[i].~T();
-			}
+			DestructItems(InArray, Size);
 			Size = 0;
 		}
 
@@ -661,6 +837,16 @@ namespace AAEngine {
 			return Size;
 		}
 
+		/*
+		* Returns the number of elements the array can hold without reallocating.
+		*
+		* @return size_t - Capacity of the array.
+		*/
+		FORCEINLINE constexpr size_t GetCapacity() const noexcept
+		{
+			return Capacity;
+		}
+
 		/*
 		* Checks if the array is empty.
 		*
@@ -736,17 +922,17 @@ namespace AAEngine {
 		}
 
 		/*
-		* Sorts the elements in the Array
-		* Uses Quick Sort
+		* Sorts the elements in the Array, not stable
+		* Uses Intro Sort
 		*/
 		FORCEINLINE constexpr void Sort() noexcept
 		{
-			Algorithms::QuickSort(InArray, Size);
+			Algorithms::IntroSort(InArray, Size);
 		}
 
 		/*
-		* Sorts the elements in the Array
-		* Uses Quick Sort
+		* Sorts the elements in the Array, not stable
+		* Uses Intro Sort
 		* 
 		* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
 		*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
@@ -754,7 +940,73 @@ namespace AAEngine {
 		template<class Predicate>
 		FORCEINLINE constexpr void Sort(Predicate Pred) noexcept
 		{
-			Algorithms::QuickSort(InArray, Size, Pred);
+			Algorithms::IntroSort(InArray, Size, Pred);
+		}
+
+		/*
+		* Sorts the elements in the Array, equal elements keep their order
+		* Uses Merge Sort, allocates a scratch buffer of Num() / 2 elements
+		*/
+		FORCEINLINE constexpr void StableSort() noexcept
+		{
+			Algorithms::StableSort(InArray, Size);
+		}
+
+		/*
+		* Sorts the elements in the Array, equal elements keep their order
+		* Uses Merge Sort, allocates a scratch buffer of Num() / 2 elements
+		*
+		* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
+		*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
+		*/
+		template<class Predicate>
+		FORCEINLINE constexpr void StableSort(Predicate Pred) noexcept
+		{
+			Algorithms::StableSort(InArray, Size, Pred);
+		}
+
+		/*
+		* Sorts the integer / float elements in the Array, stable
+		* Uses LSD Radix Sort, allocates a scratch buffer of Num() elements
+		*/
+		FORCEINLINE constexpr void RadixSort() noexcept
+		{
+			Algorithms::RadixSort(InArray, Size);
+		}
+
+		/*
+		* Sorts the elements in the Array by an integer / float key, stable
+		* Uses LSD Radix Sort, allocates a scratch buffer of Num() elements
+		*
+		* @param KeyFunc - Callable taking a const T& and returning its integer / float key, e.g. a Render Key.
+		*/
+		template<class KeyFuncType>
+		FORCEINLINE constexpr void RadixSort(KeyFuncType KeyFunc) noexcept
+		{
+			Algorithms::RadixSort(InArray, Size, KeyFunc);
+		}
+
+		/*
+		* Sorts the elements in the Array across all hardware threads, not stable
+		* Falls back to Sort() for Arrays smaller than PARALLELSORT_MIN_SIZE
+		*/
+		FORCEINLINE constexpr void ParallelSort() noexcept
+		{
+			Algorithms::ParallelSort(InArray, Size);
+		}
+
+		/*
+		* Sorts the elements in the Array across all hardware threads, not stable
+		* Falls back to Sort(Pred) for Arrays smaller than PARALLELSORT_MIN_SIZE
+		*
+		* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
+		*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
+		*				Called from several threads at once.
+		*/
+		template<class Predicate>
+		FORCEINLINE constexpr void ParallelSort(Predicate Pred) noexcept
+		{
+			Algorithms::ParallelSort(InArray, Size, Pred);
 		}
 
 		/*
@@ -798,33 +1050,41 @@ namespace AAEngine {
 		*/
 		size_t Capacity{ 0 };
 
+		/*
+		* Allocator the array gets its memory from.
+		*/
+		AA_NO_UNIQUE_ADDRESS ElementAllocatorType Allocator;
+
 		/*
 		* Reallocates the array with the specified capacity.
-		* Moves existing elements if the new capacity is less than the current size.
+		* Elements past the new capacity are destroyed, the rest are relocated unless the allocator can resize in place.
 		*
 		* @param NewCapacity - The new capacity for the array.
 		*/
 		FORCEINLINE constexpr void ReallocateArray(size_t NewCapacity) noexcept
 		{
-			T* NewArray = (T*)::operator new(NewCapacity * sizeof(T));
-
 			if (NewCapacity < Size)
 			{
+				DestructItems(InArray + NewCapacity, Size - NewCapacity);
 				Size = NewCapacity;
 			}
 
-			for (size_t i = 0; i < Size; i++)
+			if (InArray && Allocator.TryResizeInPlace(InArray, Capacity, NewCapacity))
 			{
-				new(&NewArray[i]) T(Move(InArray[i]));
+				Capacity = NewCapacity;
+				return;
 			}
 
-			for (size_t i = 0; i < Size; i++)
+			T* NewArray = NewCapacity > 0 ? Allocator.Allocate(NewCapacity) : nullptr;
+			AA_CHECK_ALIGNED(NewArray, alignof(T));
+
+			RelocateConstructItems(NewArray, InArray, Size);
+
+			if (InArray)
 			{
-				InArray[i].~T();
+				Allocator.Deallocate(InArray, Capacity);
 			}
 
-			::operator delete(InArray, Size * sizeof(T));
-
 			InArray = NewArray;
 			Capacity = NewCapacity;
 		}
@@ -836,71 +1096,71 @@ namespace AAEngine {
 		*/
 		FORCEINLINE constexpr void AssignArray(const TArray& EqualsArray) noexcept
 		{
-			if (EqualsArray.Capacity != Capacity)
+			if (this == &EqualsArray)
 			{
-				T* NewArray = (T*)::operator new(EqualsArray.Capacity * sizeof(T));
-
-				for (size_t i = 0; i < EqualsArray.Size; i++)
-				{
-					new(&NewArray[i]) T(EqualsArray[i]);
-				}
-
-				for (size_t i = 0; i < Size; i++)
-				{
-					InArray[i].~T();
-				}
+				return;
+			}
 
-				::operator delete(InArray, Size * sizeof(T));
+			Clear();
+			Reserve(EqualsArray.Capacity);
 
-				InArray = NewArray;
-				Capacity = EqualsArray.Capacity;
-			}
-			else
-			{
-				for (size_t i = 0; i < EqualsArray.Size; i++)
-				{
-					new(&InArray[i]) T(EqualsArray[i]);
-				}
-			}
+			CopyConstructItems(InArray, EqualsArray.InArray, EqualsArray.Size);
 
 			Size = EqualsArray.Size;
 		}
 
 		/*
 		* Assigns the array to be equal to another array using move semantics.
+		* Takes the allocation of EqualsArray and leaves it empty.
 		*
 		* @param EqualsArray - The array to be assigned (using move semantics).
 		*/
 		FORCEINLINE constexpr void AssignArray(TArray&& EqualsArray) noexcept
 		{
-			if (EqualsArray.Capacity != Capacity)
+			if (this == &EqualsArray)
 			{
-				T* NewArray = (T*)::operator new(EqualsArray.Capacity * sizeof(T));
-
-				for (size_t i = 0; i < EqualsArray.Size; i++)
-				{
-					new(&NewArray[i]) T(Move(EqualsArray[i]));
-				}
-
-				for (size_t i = 0; i < Size; i++)
-				{
-					InArray[i].~T();
-				}
+				return;
+			}
 
-				::operator delete(InArray, Size * sizeof(T));
+			Clear();
 
-				InArray = NewArray;
-				Capacity = EqualsArray.Capacity;
+			if constexpr (!std::is_copy_constructible<ElementAllocatorType>::value)
+			{
+				// Allocators with storage inside the container (TInlineAllocator) can't hand it over, move the elements instead
+				Reserve(EqualsArray.Size);
+				RelocateConstructItems(InArray, EqualsArray.InArray, EqualsArray.Size);
+				Size = EqualsArray.Size;
+				EqualsArray.Size = 0;
+				return;
 			}
-			else
+
+			if (InArray)
 			{
-				for (size_t i = 0; i < EqualsArray.Size; i++)
-				{
-					new(&InArray[i]) T(Move(EqualsArray[i]));
-				}
+				Allocator.Deallocate(InArray, Capacity);
 			}
 
+			InArray = EqualsArray.InArray;
 			Size = EqualsArray.Size;
+			Capacity = EqualsArray.Capacity;
+
+			EqualsArray.InArray = nullptr;
+			EqualsArray.Size = 0;
+			EqualsArray.Capacity = 0;
+		}
+
+		/*
+		* Makes sure the array can hold RequiredCapacity elements.
+		* Grows by at least DEFAULT_RESIZE_MULTIPLIER so repeated bulk adds stay amortized O(1).
+		*
+		* @param RequiredCapacity - The capacity the array needs.
+		*/
+		FORCEINLINE constexpr void ReserveForGrowth(size_t RequiredCapacity) noexcept
+		{
+			if (RequiredCapacity > Capacity)
+			{
+				const size_t GrownCapacity = NEW_RESIZE_CAPACITY;
+				ReallocateArray(RequiredCapacity > GrownCapacity ? RequiredCapacity : GrownCapacity);
+			}
 		}
 
 		/*
@@ -924,6 +1184,13 @@ namespace AAEngine {
 		FORCEINLINE ConstIterator		end() const			{ return ConstIterator(InArray, Size); }
 	};
 
+	/*
+	* Dynamic Array whose storage starts on an Alignment byte boundary.
+	* e.g. TAlignedArray<float, AA_AVX_ALIGNMENT> for 8-wide aligned loads, TAlignedArray<FMatrix44f, AA_CACHE_LINE_SIZE> for batches split across threads.
+	*/
+	template<typename T, size_t Alignment>
+	using TAlignedArray = TArray<T, TAlignedHeapAllocator<Alignment>>;
+
 	/*
 	* Finds an element within a range defined by start and end iterators.
 	*
@@ -951,4 +1218,10 @@ namespace AAEngine {
 
 		return it;
 	}
-}
\ No newline at end of file
+}
+/*
+* TArray only holds a pointer to its heap storage, so it can be relocated with a memcpy.
+* Not true for allocators with inline storage, those keep the default.
+*/
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::TArray<T, AAEngine::FHeapAllocator>> { enum { Value = true }; };
+template<typename T, size_t Alignment> struct TIsTriviallyRelocatable<AAEngine::TArray<T, AAEngine::TAlignedHeapAllocator<Alignment>>> { enum { Value = true }; };
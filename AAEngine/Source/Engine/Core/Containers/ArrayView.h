@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/Containers/Array.h"
+#include "Core/Containers/StaticArray.h"
+#include "Templates/EnableIf.h"
+
+#include <initializer_list>
+#include <type_traits>
+
+namespace AAEngine {
+
+	/*
+	* Non-owning view of contiguous elements: a pointer and a count.
+	* Functions that only read (or write in place) an array should take a view by value instead of a const TArray&,
+	* so callers can pass any TArray (whatever its allocator), a TStaticArray, a C array or a pointer and count without copying.
+	* NOTE: The view doesn't keep the elements alive, it must not outlive the array it was made from.
+	*
+	* @tparam T - Type of the elements, const T for a read-only view (see TConstArrayView).
+	*/
+	template<typename T>
+	class TArrayView
+	{
+	public:
+		using ElementType = T;
+
+		/*
+		* Default constructor, an empty view.
+		*/
+		FORCEINLINE constexpr TArrayView() noexcept
+			: InData(nullptr), Size(0)
+		{
+		}
+
+		/*
+		* Constructor for a view of Count elements starting at Data.
+		*/
+		FORCEINLINE constexpr TArrayView(T* Data, size_t Count) noexcept
+			: InData(Data), Size(Count)
+		{
+		}
+
+		/*
+		* Constructor for a view of a C array.
+		*/
+		template<size_t Count>
+		FORCEINLINE constexpr TArrayView(T (&Array)[Count]) noexcept
+			: InData(Array), Size(Count)
+		{
+		}
+
+		/*
+		* Constructor for a view of a TArray, a view of const elements can be made from a const TArray.
+		*/
+		template<typename OtherType, typename AllocatorType, typename = typename TEnableIf<std::is_convertible<OtherType(*)[], T(*)[]>::value>::Type>
+		FORCEINLINE constexpr TArrayView(TArray<OtherType, AllocatorType>& Array) noexcept
+			: InData(Array.Data()), Size(Array.Num())
+		{
+		}
+
+		template<typename OtherType, typename AllocatorType, typename = typename TEnableIf<std::is_convertible<const OtherType(*)[], T(*)[]>::value>::Type>
+		FORCEINLINE constexpr TArrayView(const TArray<OtherType, AllocatorType>& Array) noexcept
+			: InData(Array.Data()), Size(Array.Num())
+		{
+		}
+
+		/*
+		* Constructor for a view of a TStaticArray.
+		*/
+		template<typename OtherType, size_t Count, size_t Alignment, typename = typename TEnableIf<std::is_convertible<OtherType(*)[], T(*)[]>::value>::Type>
+		FORCEINLINE constexpr TArrayView(TStaticArray<OtherType, Count, Alignment>& Array) noexcept
+			: InData(Array.Data()), Size(Count)
+		{
+		}
+
+		template<typename OtherType, size_t Count, size_t Alignment, typename = typename TEnableIf<std::is_convertible<const OtherType(*)[], T(*)[]>::value>::Type>
+		FORCEINLINE constexpr TArrayView(const TStaticArray<OtherType, Count, Alignment>& Array) noexcept
+			: InData(Array.Data()), Size(Count)
+		{
+		}
+
+		/*
+		* Constructor for a read-only view of an initializer list, e.g. Function({ 1, 2, 3 }).
+		* NOTE: The list only lives until the end of the full expression, don't store the view.
+		*/
+		template<typename U = T, typename = typename TEnableIf<std::is_const<U>::value>::Type>
+		FORCEINLINE constexpr TArrayView(std::initializer_list<typename std::remove_const<U>::type> InitList) noexcept
+			: InData(InitList.begin()), Size(InitList.size())
+		{
+		}
+
+		/*
+		* Conversion from a view of mutable elements to a view of const elements.
+		*/
+		template<typename OtherType, typename = typename TEnableIf<!std::is_same<OtherType, T>::value && std::is_convertible<OtherType(*)[], T(*)[]>::value>::Type>
+		FORCEINLINE constexpr TArrayView(const TArrayView<OtherType>& Other) noexcept
+			: InData(Other.Data()), Size(Other.Num())
+		{
+		}
+
+		/*
+		* @returns Pointer to the first element.
+		*/
+		FORCEINLINE constexpr T* Data() const noexcept { return InData; }
+
+		/*
+		* @returns Number of elements in the view.
+		*/
+		FORCEINLINE constexpr size_t Num() const noexcept { return Size; }
+
+		/*
+		* @returns Size of the viewed elements in bytes.
+		*/
+		FORCEINLINE constexpr size_t NumBytes() const noexcept { return Size * sizeof(T); }
+
+		/*
+		* @returns true if the view has no elements.
+		*/
+		FORCEINLINE constexpr bool IsEmpty() const noexcept { return Size == 0; }
+
+		/*
+		* @returns true if Index is within the view.
+		*/
+		FORCEINLINE constexpr bool IsValidIndex(size_t Index) const noexcept { return Index < Size; }
+
+		FORCEINLINE constexpr T& operator[](size_t Index) const noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "TArrayView index out of range!");
+			return InData[Index];
+		}
+
+		/*
+		* @returns View of Count elements starting at Offset, clamped to the view.
+		*/
+		FORCEINLINE constexpr TArrayView Slice(size_t Offset, size_t Count) const noexcept
+		{
+			Offset = Offset < Size ? Offset : Size;
+			Count = Count < Size - Offset ? Count : Size - Offset;
+			return TArrayView(InData + Offset, Count);
+		}
+
+		/*
+		* @returns View of the first Count elements.
+		*/
+		FORCEINLINE constexpr TArrayView Left(size_t Count) const noexcept { return Slice(0, Count); }
+
+		/*
+		* @returns View without the first Count elements.
+		*/
+		FORCEINLINE constexpr TArrayView RightChop(size_t Count) const noexcept { return Slice(Count, Size); }
+
+		/*
+		* Iterators for range based for loops.
+		*/
+		FORCEINLINE constexpr T* begin() const noexcept { return InData; }
+		FORCEINLINE constexpr T* end() const noexcept { return InData + Size; }
+
+	private:
+		/*
+		* First viewed element.
+		*/
+		T* InData;
+
+		/*
+		* Number of viewed elements.
+		*/
+		size_t Size;
+	};
+
+	/*
+	* Read-only view, what functions taking an array to read should use.
+	*/
+	template<typename T>
+	using TConstArrayView = TArrayView<const T>;
+
+	/*
+	* @returns A view of Count elements starting at Data.
+	*/
+	template<typename T>
+	FORCEINLINE constexpr TArrayView<T> MakeArrayView(T* Data, size_t Count) noexcept
+	{
+		return TArrayView<T>(Data, Count);
+	}
+}
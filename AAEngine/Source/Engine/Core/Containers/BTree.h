@@ -0,0 +1,1401 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Templates/AATemplates.h"
+#include "Templates/AATypeTraits.h"
+#include "Memory/MemoryOps.h"
+#include "KeyValuePair.h"
+#include "Array.h"
+
+#include <functional>
+#include <new>
+
+/*
+* Nodes are aligned to (and sized in multiples of) a cache line.
+*/
+#define BTREE_NODE_ALIGNMENT 64
+/*
+* Size in bytes the B-Tree aims for when picking how many elements / keys fit in a node (8 cache lines).
+*/
+#define BTREE_TARGET_NODE_SIZE 512
+
+namespace AAEngine {
+
+	/*
+	* Element slot of a B-Tree leaf.
+	* Wraps the value so iterators look like the Red Black Tree ones => "It->Value".
+	*
+	* @tparam T - Type of the value.
+	*/
+	template<typename T>
+	struct TBTreeEntry
+	{
+		/*
+		* Constructs the value inplace.
+		*
+		* @param InArgs - Arguments for the value's constructor.
+		*/
+		template<typename... Args>
+		FORCEINLINE constexpr explicit TBTreeEntry(Args&&... InArgs) noexcept
+			: Value(Forward<Args>(InArgs)...)
+		{
+		}
+
+		TBTreeEntry(const TBTreeEntry&) = default;
+		TBTreeEntry(TBTreeEntry&&) = default;
+
+		/*
+		* Value of the entry
+		*/
+		T Value;
+	};
+
+	/*
+	* Iterator used to iterate over the B-Tree values.
+	* Walks the linked list of leaves, so going to the next element never touches the inner nodes.
+	*
+	* @tparam EntryType - TBTreeEntry<T>, const for const iteration.
+	* @tparam LeafType - Leaf node of the tree, const for const iteration.
+	*/
+	template<typename EntryType, typename LeafType>
+	class TBTreeIterator
+	{
+	public:
+		using ValType = EntryType;
+		using PtrType = ValType*;
+		using RefType = ValType&;
+		using PtrDiffType = ptrdiff_t;
+
+		/*
+		* Default constructor for TBTreeIterator => end().
+		*/
+		FORCEINLINE constexpr TBTreeIterator() noexcept
+			: Leaf(nullptr), Index(0)
+		{
+		}
+
+		/*
+		* Constructor for TBTreeIterator.
+		*
+		* @param InLeaf - Leaf of the element, nullptr for end().
+		* @param InIndex - Index of the element in the leaf.
+		*/
+		FORCEINLINE constexpr TBTreeIterator(LeafType* InLeaf, uint32_t InIndex) noexcept
+			: Leaf(InLeaf), Index(InIndex)
+		{
+		}
+
+		/*
+		* Dereferencing operator to get the entry at the iterator.
+		*
+		* @returns Reference to the entry at the iterator.
+		*/
+		FORCEINLINE constexpr RefType operator*() const noexcept
+		{
+			return Leaf->GetEntries()[Index];
+		}
+
+		/*
+		* Member access operator to access the Value of the entry at the iterator.
+		*
+		* @returns Pointer to the entry at the iterator.
+		*/
+		FORCEINLINE constexpr PtrType operator->() const noexcept
+		{
+			return &Leaf->GetEntries()[Index];
+		}
+
+		/*
+		* Pre-increment operator: Moves the iterator to the next element in the Tree => Next element greater that this.
+		*
+		* @returns Reference to the updated iterator.
+		*/
+		FORCEINLINE constexpr TBTreeIterator& operator++() noexcept
+		{
+			if (Leaf != nullptr && ++Index >= Leaf->Count)
+			{
+				Leaf = Leaf->Next;
+				Index = 0;
+			}
+			return *this;
+		}
+
+		/*
+		* Post-increment operator: Creates a copy of the current iterator, moves the original to the next element, and returns the copy.
+		*
+		* @returns Copy of the current iterator before increment.
+		*/
+		FORCEINLINE constexpr TBTreeIterator operator++(int) noexcept
+		{
+			TBTreeIterator It = *this;
+			++*this;
+			return It;
+		}
+
+		/*
+		* Pre-decrement operator: Moves the iterator to the previous element in the Tree => Next element less that this.
+		*
+		* @returns Reference to the updated iterator.
+		*/
+		FORCEINLINE constexpr TBTreeIterator& operator--() noexcept
+		{
+			if (Leaf != nullptr)
+			{
+				if (Index > 0)
+				{
+					Index--;
+				}
+				else
+				{
+					Leaf = Leaf->Prev;
+					Index = Leaf != nullptr ? Leaf->Count - 1 : 0;
+				}
+			}
+			return *this;
+		}
+
+		/*
+		* Post-decrement operator: Creates a copy of the current iterator, moves the original to the previous element, and returns the copy.
+		*
+		* @returns Copy of the current iterator before decrement.
+		*/
+		FORCEINLINE constexpr TBTreeIterator operator--(int) noexcept
+		{
+			TBTreeIterator It = *this;
+			--*this;
+			return It;
+		}
+
+		/*
+		* Equality operator for iterators: Checks if two iterators are pointing to the same location.
+		*
+		* @param Other - The iterator to compare.
+		*
+		* @returns True if the iterators are pointing to the same location, false otherwise.
+		*/
+		FORCEINLINE constexpr bool operator==(const TBTreeIterator& Other) const noexcept
+		{
+			return Leaf == Other.Leaf && Index == Other.Index;
+		}
+
+		/*
+		* Inequality operator for iterators: Checks if two iterators are not pointing to the same location.
+		*
+		* @param Other - The iterator to compare.
+		*
+		* @returns True if the iterators are not pointing to the same location, false otherwise.
+		*/
+		FORCEINLINE constexpr bool operator!=(const TBTreeIterator& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+
+		/*
+		* Function to retrieve the entry the iterator points at.
+		*
+		* @returns Pointer to the entry, nullptr for end().
+		*/
+		FORCEINLINE constexpr PtrType Get() const noexcept
+		{
+			return Leaf != nullptr ? &Leaf->GetEntries()[Index] : nullptr;
+		}
+
+		/*
+		* @returns Leaf of the element, nullptr for end().
+		*/
+		FORCEINLINE constexpr LeafType* GetLeaf() const noexcept
+		{
+			return Leaf;
+		}
+
+		/*
+		* @returns Index of the element in its leaf.
+		*/
+		FORCEINLINE constexpr uint32_t GetIndex() const noexcept
+		{
+			return Index;
+		}
+
+	private:
+		/*
+		* Leaf of the element.
+		*/
+		LeafType* Leaf;
+		/*
+		* Index of the element in the leaf.
+		*/
+		uint32_t Index;
+	};
+
+	/*
+	* Templated class for representing a B+ Tree, drop-in alternative to TRedBlackTree.
+	*
+	* @tparam - T - Type of the Values stored in the B-Tree.
+	* @tparam - Predicate - The way for compare 2 keys
+	* @tparam - KeyFuncs - Which part of a Value is its key (see KeyValuePair.h), the whole Value by default.
+	*
+	* Values live in the leaves, sorted, many per cache line aligned node. The leaves form a linked list for iteration.
+	* Inner nodes only hold copies of keys (separators) and child pointers, so a lookup touches a handful of nodes
+	* instead of following ~log2(N) Red Black Tree nodes scattered through memory.
+	*
+	* Inner node with keys K0..Kn-1 and children C0..Cn => every key k in Ci satisfies Ki-1 <= k < Ki.
+	*
+	* Insertions
+	* - Insert into the leaf in order. A full leaf is split in half and the first key of the new leaf goes up into the parent,
+	*   which is split the same way when full. The tree only grows in height when the root splits.
+	* Removals
+	* - Remove from the leaf. A leaf (or inner node) left under half full borrows from a sibling, or is merged with it when
+	*   the sibling can't spare anything. The tree only shrinks in height when the root is left with a single child.
+	*
+	* NOTE: Unlike TRedBlackTree, inserting / removing moves other elements, which invalidates iterators and references.
+	* NOTE: KeyType must be copyable, the inner nodes keep copies of keys.
+	*/
+	template<typename T, typename Predicate = std::less<T>, typename KeyFuncs = TIdentityKeyFuncs<T>>
+	class TBTreeSet
+	{
+	public:
+		using KeyType = typename KeyFuncs::KeyType;
+		using EntryType = TBTreeEntry<T>;
+
+	private:
+		struct FInner;
+
+		/*
+		* Shared part of leaf and inner nodes
+		*/
+		struct FNode
+		{
+			/*
+			* Parent node, nullptr for the Root
+			*/
+			FInner* Parent;
+			/*
+			* Number of entries in a leaf, number of keys in an inner node
+			*/
+			uint32_t Count;
+			/*
+			* Whether the node is a leaf
+			*/
+			bool bIsLeaf;
+		};
+
+	public:
+		/*
+		* Max number of elements in a leaf
+		*/
+		static constexpr uint32_t LeafCapacity = (BTREE_TARGET_NODE_SIZE - sizeof(FNode) - 2 * sizeof(void*)) / sizeof(EntryType) > 4
+			? (BTREE_TARGET_NODE_SIZE - sizeof(FNode) - 2 * sizeof(void*)) / sizeof(EntryType) : 4;
+		/*
+		* Max number of keys in an inner node, it has one child more
+		*/
+		static constexpr uint32_t InnerCapacity = (BTREE_TARGET_NODE_SIZE - sizeof(FNode) - sizeof(void*)) / (sizeof(KeyType) + sizeof(void*)) > 3
+			? (BTREE_TARGET_NODE_SIZE - sizeof(FNode) - sizeof(void*)) / (sizeof(KeyType) + sizeof(void*)) : 3;
+
+	private:
+		/*
+		* Min number of elements in a leaf other than the Root
+		*/
+		static constexpr uint32_t MinLeafCount = LeafCapacity / 2;
+		/*
+		* Min number of keys in an inner node other than the Root
+		*/
+		static constexpr uint32_t MinInnerCount = (InnerCapacity - 1) / 2;
+
+		/*
+		* Leaf node, holds the values
+		*/
+		struct alignas(BTREE_NODE_ALIGNMENT) FLeaf : FNode
+		{
+			FORCEINLINE EntryType* GetEntries() noexcept					{ return (EntryType*)Storage; }
+			FORCEINLINE const EntryType* GetEntries() const noexcept		{ return (const EntryType*)Storage; }
+
+			/*
+			* Previous leaf in order
+			*/
+			FLeaf* Prev;
+			/*
+			* Next leaf in order
+			*/
+			FLeaf* Next;
+			/*
+			* Uninitialized memory for the entries, the first Count are alive
+			*/
+			alignas(EntryType) uint8_t Storage[LeafCapacity * sizeof(EntryType)];
+		};
+
+		/*
+		* Inner node, holds separator keys and children
+		*/
+		struct alignas(BTREE_NODE_ALIGNMENT) FInner : FNode
+		{
+			FORCEINLINE KeyType* GetKeys() noexcept						{ return (KeyType*)KeyStorage; }
+			FORCEINLINE const KeyType* GetKeys() const noexcept			{ return (const KeyType*)KeyStorage; }
+
+			/*
+			* Children, the first Count + 1 are valid
+			*/
+			FNode* Children[InnerCapacity + 1];
+			/*
+			* Uninitialized memory for the keys, the first Count are alive
+			*/
+			alignas(KeyType) uint8_t KeyStorage[InnerCapacity * sizeof(KeyType)];
+		};
+
+	public:
+		// Const and Non-Const Iterators
+		using Iterator = TBTreeIterator<EntryType, FLeaf>;
+		using ConstIterator = TBTreeIterator<const EntryType, const FLeaf>;
+
+		/*
+		* Default constructor initializes Root to nullptr => No Elements
+		*/
+		FORCEINLINE constexpr TBTreeSet() noexcept
+			: Root(nullptr), Head(nullptr), Size(0)
+		{
+		}
+
+		/*
+		* Constructor for an empty B-Tree ordered by a stateful Predicate
+		*
+		* @param InPred - Predicate used to compare keys
+		*/
+		FORCEINLINE constexpr explicit TBTreeSet(const Predicate& InPred) noexcept
+			: Root(nullptr), Head(nullptr), Size(0), Pred(InPred)
+		{
+		}
+
+		/*
+		* Copy Constructor copies every element and the Predicate of Other
+		*
+		* @param Other - const L Value ref to Other BTree
+		*/
+		FORCEINLINE TBTreeSet(const TBTreeSet& Other) noexcept
+			: Root(nullptr), Head(nullptr), Size(0), Pred(Other.Pred)
+		{
+			CopyTree(Other);
+		}
+
+		/*
+		* Move Constructor takes the nodes of Other, leaving it empty, and copies its Predicate
+		*
+		* @param Other - R Value ref to Other BTree
+		*/
+		FORCEINLINE TBTreeSet(TBTreeSet&& Other) noexcept
+			: Root(Other.Root), Head(Other.Head), Size(Other.Size), Pred(Other.Pred)
+		{
+			Other.Root = nullptr;
+			Other.Head = nullptr;
+			Other.Size = 0;
+		}
+
+		/*
+		* Copy Assignment Operator copies every element and the Predicate of Other
+		*
+		* @param Other - const L Value ref to Other BTree
+		*/
+		FORCEINLINE TBTreeSet& operator=(const TBTreeSet& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				Pred = Other.Pred;
+				CopyTree(Other);
+			}
+			return *this;
+		}
+
+		/*
+		* Move Assignment Operator takes the nodes of Other, leaving it empty, and copies its Predicate
+		*
+		* @param Other - R Value ref to Other BTree
+		*/
+		FORCEINLINE TBTreeSet& operator=(TBTreeSet&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				Pred = Other.Pred;
+				Root = Other.Root;
+				Head = Other.Head;
+				Size = Other.Size;
+				Other.Root = nullptr;
+				Other.Head = nullptr;
+				Other.Size = 0;
+			}
+			return *this;
+		}
+
+		/*
+		* Destructor that frees every node
+		*/
+		FORCEINLINE ~TBTreeSet()
+		{
+			Clear();
+		}
+
+		/*
+		* Inserts a value into the B-Tree, does nothing if a Value with the same key exists
+		*
+		* @param NewVal - const L Value Ref to the Value to be inserted into the BTree
+		*/
+		FORCEINLINE void Insert(const T& NewVal) noexcept
+		{
+			FInsertPosition Position = FindInsertPosition(KeyFuncs::GetKey(NewVal));
+			if (Position.Existing == nullptr)
+			{
+				InsertAtPosition(Position, NewVal);
+			}
+		}
+
+		/*
+		* Inserts a value into the B-Tree, does nothing if a Value with the same key exists
+		*
+		* @param NewVal - R Value Ref to the Value to be inserted into the BTree
+		*/
+		FORCEINLINE void Insert(T&& NewVal) noexcept
+		{
+			FInsertPosition Position = FindInsertPosition(KeyFuncs::GetKey(NewVal));
+			if (Position.Existing == nullptr)
+			{
+				InsertAtPosition(Position, Move(NewVal));
+			}
+		}
+
+		/*
+		* Replaces the content of the tree with sorted values, much faster than inserting them one by one.
+		* Leaves are filled completely, so the first insertions afterwards split them.
+		* Values with the same key as the value before them are skipped.
+		*
+		* @param SortedValues - Values sorted by Predicate.
+		* @param Count - Number of values.
+		*/
+		FORCEINLINE void BulkLoad(const T* SortedValues, size_t Count) noexcept
+		{
+			Clear();
+
+			size_t UniqueCount = Count > 0 ? 1 : 0;
+			for (size_t i = 1; i < Count; i++)
+			{
+				UniqueCount += Pred(KeyFuncs::GetKey(SortedValues[i - 1]), KeyFuncs::GetKey(SortedValues[i]));
+			}
+
+			size_t Next = 0;
+			BuildFromSorted(UniqueCount, [&](EntryType* Dest)
+			{
+				while (Next > 0 && !Pred(KeyFuncs::GetKey(SortedValues[Next - 1]), KeyFuncs::GetKey(SortedValues[Next])))
+				{
+					Next++;
+				}
+				new(Dest) EntryType(SortedValues[Next]);
+				Next++;
+			});
+		}
+
+		/*
+		* Removes a value from the B-Tree
+		*
+		* @param Key - Key of the Value to be removed from the BTree
+		*
+		* @returns true if Value with Key has been removed, false if it doesn't exist
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE bool Remove(const K& Key) noexcept
+		{
+			Iterator It = Find(Key);
+			if (It == end())
+			{
+				return false;
+			}
+			RemoveAt(It.GetLeaf(), It.GetIndex());
+			return true;
+		}
+
+		/*
+		* Removes the value an iterator points at
+		*
+		* @param It - Iterator to a valid value
+		*
+		* @returns Iterator to the next value
+		*/
+		FORCEINLINE Iterator Remove(Iterator It) noexcept
+		{
+			FLeaf* Leaf = It.GetLeaf();
+			const uint32_t Index = It.GetIndex();
+
+			if (Size == 1)
+			{
+				RemoveAt(Leaf, Index);
+				return end();
+			}
+			if (Leaf->Count > MinLeafCount || Leaf == Root)
+			{
+				// No rebalancing, the next value just shifts into the removed slot
+				RemoveAt(Leaf, Index);
+				return Index < Leaf->Count ? Iterator(Leaf, Index) : (Leaf->Next != nullptr ? Iterator(Leaf->Next, 0) : end());
+			}
+
+			// Rebalancing moves values around, look the next one up again
+			Iterator Next = It;
+			++Next;
+			if (Next == end())
+			{
+				RemoveAt(Leaf, Index);
+				return end();
+			}
+			KeyType NextKey = KeyFuncs::GetKey(Next->Value);
+			RemoveAt(Leaf, Index);
+			return Find(NextKey);
+		}
+
+		/*
+		* Searches a value in the B-Tree
+		*
+		* @param Key - Key of the Value to be searched for in the BTree
+		*
+		* @returns true if Value of Key exists, false otherwise
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE bool Search(const K& Key) const noexcept
+		{
+			return FindNode(Key) != nullptr;
+		}
+
+		/*
+		* Finds the value with the given key
+		*
+		* @param Key - Key to look for
+		*
+		* @returns Iterator to the value or end() if there is none
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator Find(const K& Key) noexcept
+		{
+			if (Root == nullptr)
+			{
+				return end();
+			}
+			FLeaf* Leaf = FindLeaf(Key);
+			const uint32_t Index = LeafLowerBound(Leaf, Key);
+			return Index < Leaf->Count && !Pred(Key, KeyFuncs::GetKey(Leaf->GetEntries()[Index].Value)) ? Iterator(Leaf, Index) : end();
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator Find(const K& Key) const noexcept
+		{
+			Iterator It = const_cast<TBTreeSet*>(this)->Find(Key);
+			return ConstIterator(It.GetLeaf(), It.GetIndex());
+		}
+
+		/*
+		* Finds the first value whose key is not less than Key
+		*
+		* @param Key - Key to compare with
+		*
+		* @returns Iterator to the value or end() if every key is less than Key
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator LowerBound(const K& Key) noexcept
+		{
+			if (Root == nullptr)
+			{
+				return end();
+			}
+			FLeaf* Leaf = FindLeaf(Key);
+			return MakeIterator(Leaf, LeafLowerBound(Leaf, Key));
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator LowerBound(const K& Key) const noexcept
+		{
+			Iterator It = const_cast<TBTreeSet*>(this)->LowerBound(Key);
+			return ConstIterator(It.GetLeaf(), It.GetIndex());
+		}
+
+		/*
+		* Finds the first value whose key is greater than Key
+		*
+		* @param Key - Key to compare with
+		*
+		* @returns Iterator to the value or end() if no key is greater than Key
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator UpperBound(const K& Key) noexcept
+		{
+			if (Root == nullptr)
+			{
+				return end();
+			}
+			FLeaf* Leaf = FindLeaf(Key);
+			return MakeIterator(Leaf, LeafUpperBound(Leaf, Key));
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator UpperBound(const K& Key) const noexcept
+		{
+			Iterator It = const_cast<TBTreeSet*>(this)->UpperBound(Key);
+			return ConstIterator(It.GetLeaf(), It.GetIndex());
+		}
+
+		/*
+		* Counts the number of values in the B-Tree
+		*
+		* @returns Count of the number of values in the B-Tree
+		*/
+		FORCEINLINE constexpr size_t Num() const noexcept
+		{
+			return Size;
+		}
+
+		/*
+		* Checks if the B-Tree has no values
+		*
+		* @returns true if the tree is empty
+		*/
+		FORCEINLINE constexpr bool IsEmpty() const noexcept
+		{
+			return Size == 0;
+		}
+
+		/*
+		* Height of the B-Tree, every leaf is at the same depth
+		*
+		* @returns Number of node levels, 0 for an empty tree
+		*/
+		FORCEINLINE size_t Height() const noexcept
+		{
+			size_t Levels = 0;
+			for (const FNode* Node = Root; Node != nullptr; Node = Node->bIsLeaf ? nullptr : ((const FInner*)Node)->Children[0])
+			{
+				Levels++;
+			}
+			return Levels;
+		}
+
+		/*
+		* Prints the values in order, one leaf per line
+		*/
+		FORCEINLINE void InOrderPrint() const noexcept
+		{
+			for (const FLeaf* Leaf = Head; Leaf != nullptr; Leaf = Leaf->Next)
+			{
+				std::cout << "[CORE]";
+				for (uint32_t i = 0; i < Leaf->Count; i++)
+				{
+					std::cout << " " << Leaf->GetEntries()[i].Value;
+				}
+				std::cout << "\n";
+			}
+			std::cout << "\n";
+		}
+
+		/*
+		* Clear Function that frees every node and sets the Root to nullptr
+		*/
+		FORCEINLINE void Clear() noexcept
+		{
+			if (Root != nullptr)
+			{
+				FreeSubTree(Root);
+			}
+			Root = nullptr;
+			Head = nullptr;
+			Size = 0;
+		}
+
+	protected:
+		/*
+		* Where a new key goes in the tree, result of FindInsertPosition
+		*/
+		struct FInsertPosition
+		{
+			/*
+			* Entry that already has the key, nullptr if the key is new
+			*/
+			EntryType* Existing;
+			/*
+			* Leaf the new entry goes into, nullptr if the tree is empty
+			*/
+			FLeaf* Leaf;
+			/*
+			* Index in the leaf for the new entry
+			*/
+			uint32_t Index;
+		};
+
+		/*
+		* Walks down the tree to find where a key is or would be inserted
+		*
+		* @param Key - Key to look for
+		*
+		* @returns The existing entry with the key, or the position for a new entry
+		*/
+		template<typename K>
+		FORCEINLINE FInsertPosition FindInsertPosition(const K& Key) const noexcept
+		{
+			if (Root == nullptr)
+			{
+				return FInsertPosition{ nullptr, nullptr, 0 };
+			}
+			FLeaf* Leaf = FindLeaf(Key);
+			const uint32_t Index = LeafLowerBound(Leaf, Key);
+			EntryType* Existing = Index < Leaf->Count && !Pred(Key, KeyFuncs::GetKey(Leaf->GetEntries()[Index].Value)) ? &Leaf->GetEntries()[Index] : nullptr;
+			return FInsertPosition{ Existing, Leaf, Index };
+		}
+
+		/*
+		* Constructs a new entry at a position returned by FindInsertPosition, splitting nodes on the way up if needed
+		*
+		* @param Position - Position for the new entry, must not have an Existing entry
+		* @param Args - Arguments to construct the Value inplace
+		*
+		* @returns The new entry
+		*/
+		template<typename... Args>
+		FORCEINLINE EntryType* InsertAtPosition(const FInsertPosition& Position, Args&&... InArgs) noexcept
+		{
+			FLeaf* Leaf = Position.Leaf;
+			uint32_t Index = Position.Index;
+
+			if (Leaf == nullptr)
+			{
+				Leaf = AllocateLeaf();
+				Root = Leaf;
+				Head = Leaf;
+			}
+			else if (Leaf->Count == LeafCapacity)
+			{
+				// Move the upper half into a new leaf, the new entry goes into whichever half it belongs to
+				const uint32_t Mid = LeafCapacity / 2;
+				FLeaf* NewLeaf = SplitLeaf(Leaf, Mid);
+				if (Index > Mid)
+				{
+					Leaf = NewLeaf;
+					Index -= Mid;
+				}
+				InsertIntoParent(Position.Leaf, KeyType(KeyFuncs::GetKey(NewLeaf->GetEntries()[0].Value)), NewLeaf);
+			}
+
+			EntryType* Entries = Leaf->GetEntries();
+			RelocateConstructItems(Entries + Index + 1, Entries + Index, Leaf->Count - Index);
+			new(&Entries[Index]) EntryType(Forward<Args>(InArgs)...);
+			Leaf->Count++;
+			Size++;
+			return &Entries[Index];
+		}
+
+		/*
+		* Finds the entry with the given key
+		*
+		* @param Key - Key to look for
+		*
+		* @returns The entry or nullptr if there is none
+		*/
+		template<typename K>
+		FORCEINLINE EntryType* FindNode(const K& Key) const noexcept
+		{
+			return FindInsertPosition(Key).Existing;
+		}
+
+	private:
+		/*
+		* Walks down the inner nodes to the leaf that holds (or would hold) Key
+		*/
+		template<typename K>
+		FORCEINLINE FLeaf* FindLeaf(const K& Key) const noexcept
+		{
+			FNode* Node = Root;
+			while (!Node->bIsLeaf)
+			{
+				FInner* Inner = (FInner*)Node;
+				Node = Inner->Children[InnerUpperBound(Inner, Key)];
+			}
+			return (FLeaf*)Node;
+		}
+
+		/*
+		* @returns Index of the first separator greater than Key => Index of the child to descend into
+		*/
+		template<typename K>
+		FORCEINLINE uint32_t InnerUpperBound(const FInner* Inner, const K& Key) const noexcept
+		{
+			const KeyType* Keys = Inner->GetKeys();
+			uint32_t Low = 0;
+			uint32_t High = Inner->Count;
+			while (Low < High)
+			{
+				const uint32_t Mid = (Low + High) / 2;
+				if (Pred(Key, Keys[Mid]))
+				{
+					High = Mid;
+				}
+				else
+				{
+					Low = Mid + 1;
+				}
+			}
+			return Low;
+		}
+
+		/*
+		* @returns Index of the first entry in the leaf whose key is not less than Key
+		*/
+		template<typename K>
+		FORCEINLINE uint32_t LeafLowerBound(const FLeaf* Leaf, const K& Key) const noexcept
+		{
+			const EntryType* Entries = Leaf->GetEntries();
+			uint32_t Low = 0;
+			uint32_t High = Leaf->Count;
+			while (Low < High)
+			{
+				const uint32_t Mid = (Low + High) / 2;
+				if (Pred(KeyFuncs::GetKey(Entries[Mid].Value), Key))
+				{
+					Low = Mid + 1;
+				}
+				else
+				{
+					High = Mid;
+				}
+			}
+			return Low;
+		}
+
+		/*
+		* @returns Index of the first entry in the leaf whose key is greater than Key
+		*/
+		template<typename K>
+		FORCEINLINE uint32_t LeafUpperBound(const FLeaf* Leaf, const K& Key) const noexcept
+		{
+			const EntryType* Entries = Leaf->GetEntries();
+			uint32_t Low = 0;
+			uint32_t High = Leaf->Count;
+			while (Low < High)
+			{
+				const uint32_t Mid = (Low + High) / 2;
+				if (Pred(Key, KeyFuncs::GetKey(Entries[Mid].Value)))
+				{
+					High = Mid;
+				}
+				else
+				{
+					Low = Mid + 1;
+				}
+			}
+			return Low;
+		}
+
+		/*
+		* @returns Iterator to Index in Leaf, moving on to the next leaf if Index is past the last entry
+		*/
+		FORCEINLINE Iterator MakeIterator(FLeaf* Leaf, uint32_t Index) noexcept
+		{
+			if (Index < Leaf->Count)
+			{
+				return Iterator(Leaf, Index);
+			}
+			return Leaf->Next != nullptr ? Iterator(Leaf->Next, 0) : end();
+		}
+
+		/*
+		* @returns Index of Child in its Parent's children
+		*/
+		FORCEINLINE uint32_t ChildIndex(const FInner* Parent, const FNode* Child) const noexcept
+		{
+			uint32_t Index = 0;
+			while (Parent->Children[Index] != Child)
+			{
+				Index++;
+			}
+			return Index;
+		}
+
+		/*
+		* Allocates an empty, unlinked leaf, its entries are left unconstructed
+		*
+		* @returns New leaf, owned by the caller until it's linked into the tree, then by the tree until FreeNode / FreeSubTree
+		*/
+		FORCEINLINE static FLeaf* AllocateLeaf() noexcept
+		{
+			FLeaf* Leaf = (FLeaf*)::operator new(sizeof(FLeaf), std::align_val_t(alignof(FLeaf)));
+			Leaf->Parent = nullptr;
+			Leaf->Count = 0;
+			Leaf->bIsLeaf = true;
+			Leaf->Prev = nullptr;
+			Leaf->Next = nullptr;
+			return Leaf;
+		}
+
+		/*
+		* Allocates an empty, unlinked inner node, its keys and children are left unset
+		*
+		* @returns New inner node, owned by the caller until it's linked into the tree, then by the tree until FreeNode / FreeSubTree
+		*/
+		FORCEINLINE static FInner* AllocateInner() noexcept
+		{
+			FInner* Inner = (FInner*)::operator new(sizeof(FInner), std::align_val_t(alignof(FInner)));
+			Inner->Parent = nullptr;
+			Inner->Count = 0;
+			Inner->bIsLeaf = false;
+			return Inner;
+		}
+
+		/*
+		* Frees the memory of a node from AllocateLeaf / AllocateInner, its entries / keys must already be destroyed
+		*/
+		FORCEINLINE static void FreeNode(FNode* Node) noexcept
+		{
+			if (Node->bIsLeaf)
+			{
+				::operator delete(Node, std::align_val_t(alignof(FLeaf)));
+			}
+			else
+			{
+				::operator delete(Node, std::align_val_t(alignof(FInner)));
+			}
+		}
+
+		/*
+		* Moves the entries from Mid onwards into a new leaf linked after Leaf
+		*
+		* @returns The new leaf
+		*/
+		FORCEINLINE FLeaf* SplitLeaf(FLeaf* Leaf, uint32_t Mid) noexcept
+		{
+			FLeaf* NewLeaf = AllocateLeaf();
+			RelocateConstructItems(NewLeaf->GetEntries(), Leaf->GetEntries() + Mid, Leaf->Count - Mid);
+			NewLeaf->Count = Leaf->Count - Mid;
+			Leaf->Count = Mid;
+
+			NewLeaf->Prev = Leaf;
+			NewLeaf->Next = Leaf->Next;
+			if (Leaf->Next != nullptr)
+			{
+				Leaf->Next->Prev = NewLeaf;
+			}
+			Leaf->Next = NewLeaf;
+			return NewLeaf;
+		}
+
+		/*
+		* Adds Separator and NewNode right after Node in Node's parent, splitting the parent (and further up) when full
+		*
+		* @param Node - Node that was split
+		* @param Separator - First key of NewNode's subtree
+		* @param NewNode - Upper half of Node
+		*/
+		void InsertIntoParent(FNode* Node, KeyType&& Separator, FNode* NewNode) noexcept
+		{
+			FInner* Parent = Node->Parent;
+			if (Parent == nullptr)
+			{
+				// Root split, the tree grows by one level
+				FInner* NewRoot = AllocateInner();
+				new(&NewRoot->GetKeys()[0]) KeyType(Move(Separator));
+				NewRoot->Children[0] = Node;
+				NewRoot->Children[1] = NewNode;
+				NewRoot->Count = 1;
+				Node->Parent = NewRoot;
+				NewNode->Parent = NewRoot;
+				Root = NewRoot;
+				return;
+			}
+
+			uint32_t Index = ChildIndex(Parent, Node);
+			if (Parent->Count == InnerCapacity)
+			{
+				// Keys before Mid stay, Mid goes up, keys after Mid move to the new inner node
+				const uint32_t Mid = InnerCapacity / 2;
+				FInner* NewInner = AllocateInner();
+				KeyType* Keys = Parent->GetKeys();
+				RelocateConstructItems(NewInner->GetKeys(), Keys + Mid + 1, Parent->Count - Mid - 1);
+				for (uint32_t i = Mid + 1; i <= Parent->Count; i++)
+				{
+					NewInner->Children[i - Mid - 1] = Parent->Children[i];
+					Parent->Children[i]->Parent = NewInner;
+				}
+				NewInner->Count = Parent->Count - Mid - 1;
+				Parent->Count = Mid;
+
+				KeyType UpSeparator(Move(Keys[Mid]));
+				Keys[Mid].~KeyType();
+
+				if (Index > Mid)
+				{
+					Index -= Mid + 1;
+					InsertIntoInner(NewInner, Index, Move(Separator), NewNode);
+				}
+				else
+				{
+					InsertIntoInner(Parent, Index, Move(Separator), NewNode);
+				}
+				InsertIntoParent(Parent, Move(UpSeparator), NewInner);
+				return;
+			}
+
+			InsertIntoInner(Parent, Index, Move(Separator), NewNode);
+		}
+
+		/*
+		* Adds Separator at Index and NewNode at Index + 1 in an inner node with room for them
+		*/
+		FORCEINLINE void InsertIntoInner(FInner* Inner, uint32_t Index, KeyType&& Separator, FNode* NewNode) noexcept
+		{
+			KeyType* Keys = Inner->GetKeys();
+			RelocateConstructItems(Keys + Index + 1, Keys + Index, Inner->Count - Index);
+			new(&Keys[Index]) KeyType(Move(Separator));
+			FMemory::MemMove(&Inner->Children[Index + 2], &Inner->Children[Index + 1], (Inner->Count - Index) * sizeof(FNode*));
+			Inner->Children[Index + 1] = NewNode;
+			NewNode->Parent = Inner;
+			Inner->Count++;
+		}
+
+		/*
+		* Removes Key Index and Child Index + 1 from an inner node
+		*/
+		FORCEINLINE void RemoveFromInner(FInner* Inner, uint32_t Index) noexcept
+		{
+			KeyType* Keys = Inner->GetKeys();
+			Keys[Index].~KeyType();
+			RelocateConstructItems(Keys + Index, Keys + Index + 1, Inner->Count - Index - 1);
+			FMemory::MemMove(&Inner->Children[Index + 1], &Inner->Children[Index + 2], (Inner->Count - Index - 1) * sizeof(FNode*));
+			Inner->Count--;
+		}
+
+		/*
+		* Destroys the entry at Index and rebalances the tree if the leaf is left under half full
+		* Cases for an under full node (mirrored when there is only a Left sibling)
+		*	1) Left sibling can spare a value / key	=> Rotate its last one over (through the parent for inner nodes)
+		*	2) Right sibling can spare a value / key	=> Rotate its first one over
+		*	3) Neither can								=> Merge with a sibling, the parent loses a key and may become under full too
+		*/
+		void RemoveAt(FLeaf* Leaf, uint32_t Index) noexcept
+		{
+			EntryType* Entries = Leaf->GetEntries();
+			Entries[Index].~EntryType();
+			RelocateConstructItems(Entries + Index, Entries + Index + 1, Leaf->Count - Index - 1);
+			Leaf->Count--;
+			Size--;
+
+			if (Leaf == Root)
+			{
+				if (Leaf->Count == 0)
+				{
+					FreeNode(Leaf);
+					Root = nullptr;
+					Head = nullptr;
+				}
+				return;
+			}
+			if (Leaf->Count >= MinLeafCount)
+			{
+				return;
+			}
+
+			FInner* Parent = Leaf->Parent;
+			const uint32_t ChildIdx = ChildIndex(Parent, Leaf);
+			FLeaf* Left = ChildIdx > 0 ? (FLeaf*)Parent->Children[ChildIdx - 1] : nullptr;
+			FLeaf* Right = ChildIdx < Parent->Count ? (FLeaf*)Parent->Children[ChildIdx + 1] : nullptr;
+
+			if (Left != nullptr && Left->Count > MinLeafCount)
+			{
+				RelocateConstructItems(Entries + 1, Entries, Leaf->Count);
+				RelocateConstructItems(Entries, Left->GetEntries() + Left->Count - 1, 1);
+				Left->Count--;
+				Leaf->Count++;
+				Parent->GetKeys()[ChildIdx - 1] = KeyFuncs::GetKey(Entries[0].Value);
+			}
+			else if (Right != nullptr && Right->Count > MinLeafCount)
+			{
+				EntryType* RightEntries = Right->GetEntries();
+				RelocateConstructItems(Entries + Leaf->Count, RightEntries, 1);
+				RelocateConstructItems(RightEntries, RightEntries + 1, Right->Count - 1);
+				Right->Count--;
+				Leaf->Count++;
+				Parent->GetKeys()[ChildIdx] = KeyFuncs::GetKey(RightEntries[0].Value);
+			}
+			else if (Left != nullptr)
+			{
+				MergeLeaves(Left, Leaf, ChildIdx - 1);
+			}
+			else
+			{
+				MergeLeaves(Leaf, Right, ChildIdx);
+			}
+		}
+
+		/*
+		* Moves every entry of Right into Left and removes Right from the tree
+		*
+		* @param SeparatorIndex - Index of the key between Left and Right in their parent
+		*/
+		FORCEINLINE void MergeLeaves(FLeaf* Left, FLeaf* Right, uint32_t SeparatorIndex) noexcept
+		{
+			RelocateConstructItems(Left->GetEntries() + Left->Count, Right->GetEntries(), Right->Count);
+			Left->Count += Right->Count;
+
+			Left->Next = Right->Next;
+			if (Right->Next != nullptr)
+			{
+				Right->Next->Prev = Left;
+			}
+
+			FInner* Parent = Left->Parent;
+			FreeNode(Right);
+			RemoveFromInner(Parent, SeparatorIndex);
+			RebalanceInner(Parent);
+		}
+
+		/*
+		* Fixes an inner node after it lost a key, same cases as RemoveAt
+		*/
+		void RebalanceInner(FInner* Inner) noexcept
+		{
+			if (Inner == Root)
+			{
+				if (Inner->Count == 0)
+				{
+					// The tree shrinks by one level
+					Root = Inner->Children[0];
+					Root->Parent = nullptr;
+					FreeNode(Inner);
+				}
+				return;
+			}
+			if (Inner->Count >= MinInnerCount)
+			{
+				return;
+			}
+
+			FInner* Parent = Inner->Parent;
+			const uint32_t ChildIdx = ChildIndex(Parent, Inner);
+			FInner* Left = ChildIdx > 0 ? (FInner*)Parent->Children[ChildIdx - 1] : nullptr;
+			FInner* Right = ChildIdx < Parent->Count ? (FInner*)Parent->Children[ChildIdx + 1] : nullptr;
+			KeyType* Keys = Inner->GetKeys();
+			KeyType* ParentKeys = Parent->GetKeys();
+
+			if (Left != nullptr && Left->Count > MinInnerCount)
+			{
+				// Parent key comes down in front, Left's last key goes up
+				KeyType* LeftKeys = Left->GetKeys();
+				RelocateConstructItems(Keys + 1, Keys, Inner->Count);
+				new(&Keys[0]) KeyType(Move(ParentKeys[ChildIdx - 1]));
+				ParentKeys[ChildIdx - 1] = Move(LeftKeys[Left->Count - 1]);
+				LeftKeys[Left->Count - 1].~KeyType();
+
+				FMemory::MemMove(&Inner->Children[1], &Inner->Children[0], (Inner->Count + 1) * sizeof(FNode*));
+				Inner->Children[0] = Left->Children[Left->Count];
+				Inner->Children[0]->Parent = Inner;
+
+				Left->Count--;
+				Inner->Count++;
+			}
+			else if (Right != nullptr && Right->Count > MinInnerCount)
+			{
+				// Parent key comes down at the end, Right's first key goes up
+				KeyType* RightKeys = Right->GetKeys();
+				new(&Keys[Inner->Count]) KeyType(Move(ParentKeys[ChildIdx]));
+				ParentKeys[ChildIdx] = Move(RightKeys[0]);
+				RightKeys[0].~KeyType();
+				RelocateConstructItems(RightKeys, RightKeys + 1, Right->Count - 1);
+
+				Inner->Children[Inner->Count + 1] = Right->Children[0];
+				Inner->Children[Inner->Count + 1]->Parent = Inner;
+				FMemory::MemMove(&Right->Children[0], &Right->Children[1], Right->Count * sizeof(FNode*));
+
+				Right->Count--;
+				Inner->Count++;
+			}
+			else if (Left != nullptr)
+			{
+				MergeInners(Left, Inner, ChildIdx - 1);
+			}
+			else
+			{
+				MergeInners(Inner, Right, ChildIdx);
+			}
+		}
+
+		/*
+		* Moves the separator and every key / child of Right into Left and removes Right from the tree
+		*
+		* @param SeparatorIndex - Index of the key between Left and Right in their parent
+		*/
+		FORCEINLINE void MergeInners(FInner* Left, FInner* Right, uint32_t SeparatorIndex) noexcept
+		{
+			FInner* Parent = Left->Parent;
+			KeyType* LeftKeys = Left->GetKeys();
+
+			new(&LeftKeys[Left->Count]) KeyType(Move(Parent->GetKeys()[SeparatorIndex]));
+			RelocateConstructItems(LeftKeys + Left->Count + 1, Right->GetKeys(), Right->Count);
+			for (uint32_t i = 0; i <= Right->Count; i++)
+			{
+				Left->Children[Left->Count + 1 + i] = Right->Children[i];
+				Right->Children[i]->Parent = Left;
+			}
+			Left->Count += Right->Count + 1;
+
+			FreeNode(Right);
+			RemoveFromInner(Parent, SeparatorIndex);
+			RebalanceInner(Parent);
+		}
+
+		/*
+		* Nodes of one level while building the tree bottom up, with the smallest key under each node
+		*/
+		struct FLevel
+		{
+			FORCEINLINE void Reserve(size_t Count) noexcept
+			{
+				Nodes.Reserve(Count);
+				MinKeys.Reserve(Count);
+			}
+
+			FORCEINLINE void Add(FNode* Node, const KeyType* MinKey) noexcept
+			{
+				Nodes.PushBack(Node);
+				MinKeys.PushBack(MinKey);
+			}
+
+			FORCEINLINE size_t Num() const noexcept { return Nodes.Num(); }
+
+			TArray<FNode*> Nodes;
+			TArray<const KeyType*> MinKeys;
+		};
+
+		/*
+		* Builds the tree bottom up from Count sorted, unique entries
+		*
+		* @param Count - Number of entries
+		* @param Fill - Called with uninitialized memory for each entry in order, constructs it there
+		*/
+		template<typename FillFunc>
+		void BuildFromSorted(size_t Count, FillFunc&& Fill) noexcept
+		{
+			if (Count == 0)
+			{
+				return;
+			}
+
+			// Spread the entries evenly so no leaf ends up under half full
+			size_t NodeCount = (Count + LeafCapacity - 1) / LeafCapacity;
+			FLevel Level;
+			Level.Reserve(NodeCount);
+			FLeaf* Prev = nullptr;
+			for (size_t i = 0; i < NodeCount; i++)
+			{
+				FLeaf* Leaf = AllocateLeaf();
+				const uint32_t LeafCount = (uint32_t)(Count * (i + 1) / NodeCount - Count * i / NodeCount);
+				for (uint32_t j = 0; j < LeafCount; j++)
+				{
+					Fill(&Leaf->GetEntries()[j]);
+				}
+				Leaf->Count = LeafCount;
+				Leaf->Prev = Prev;
+				if (Prev != nullptr)
+				{
+					Prev->Next = Leaf;
+				}
+				else
+				{
+					Head = Leaf;
+				}
+				Prev = Leaf;
+				Level.Add(Leaf, &KeyFuncs::GetKey(Leaf->GetEntries()[0].Value));
+			}
+
+			// Group the nodes of each level under inner nodes until a single node is left
+			while (Level.Num() > 1)
+			{
+				const size_t ChildCount = Level.Num();
+				NodeCount = (ChildCount + InnerCapacity) / (InnerCapacity + 1);
+				FLevel Parents;
+				Parents.Reserve(NodeCount);
+				for (size_t i = 0; i < NodeCount; i++)
+				{
+					FInner* Inner = AllocateInner();
+					const size_t First = ChildCount * i / NodeCount;
+					const size_t Last = ChildCount * (i + 1) / NodeCount;
+					for (size_t j = First; j < Last; j++)
+					{
+						Inner->Children[j - First] = Level.Nodes[j];
+						Level.Nodes[j]->Parent = Inner;
+						if (j > First)
+						{
+							new(&Inner->GetKeys()[j - First - 1]) KeyType(*Level.MinKeys[j]);
+						}
+					}
+					Inner->Count = (uint32_t)(Last - First - 1);
+					Parents.Add(Inner, Level.MinKeys[First]);
+				}
+				Level = Move(Parents);
+			}
+
+			Root = Level.Nodes[0];
+			Size = Count;
+		}
+
+		/*
+		* Copies every entry of Other into this empty tree
+		*/
+		FORCEINLINE void CopyTree(const TBTreeSet& Other) noexcept
+		{
+			ConstIterator It = Other.begin();
+			BuildFromSorted(Other.Size, [&](EntryType* Dest)
+			{
+				new(Dest) EntryType(It->Value);
+				++It;
+			});
+		}
+
+		/*
+		* Destroys the entries / keys of a subtree and frees its nodes
+		*/
+		void FreeSubTree(FNode* Node) noexcept
+		{
+			if (Node->bIsLeaf)
+			{
+				DestructItems(((FLeaf*)Node)->GetEntries(), Node->Count);
+			}
+			else
+			{
+				FInner* Inner = (FInner*)Node;
+				for (uint32_t i = 0; i <= Inner->Count; i++)
+				{
+					FreeSubTree(Inner->Children[i]);
+				}
+				DestructItems(Inner->GetKeys(), Inner->Count);
+			}
+			FreeNode(Node);
+		}
+
+	private:
+		/*
+		* Root Node for the Tree, a leaf while everything fits in one
+		*/
+		FNode* Root{ nullptr };
+		/*
+		* First leaf, where iteration starts
+		*/
+		FLeaf* Head{ nullptr };
+		/*
+		* Number of values in the tree
+		*/
+		size_t Size{ 0 };
+		/*
+		* Predicate function used to compare keys
+		*/
+		Predicate Pred;
+
+	public:
+		// Functions for Tree Iteration
+		FORCEINLINE Iterator			begin()				{ return Iterator(Head, 0); }
+		FORCEINLINE ConstIterator		begin() const		{ return ConstIterator(Head, 0); }
+		FORCEINLINE Iterator			end()				{ return Iterator(); }
+		FORCEINLINE ConstIterator		end() const			{ return ConstIterator(); }
+	};
+}
+
+/*
+* B-Tree entries are relocated with a memmove when nodes split / merge, whenever the value itself can be.
+*/
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::TBTreeEntry<T>> { enum { Value = TIsTriviallyRelocatable<T>::Value }; };
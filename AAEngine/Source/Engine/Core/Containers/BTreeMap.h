@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Containers/BTree.h"
+#include "Containers/OrderedMap.h"
+
+namespace AAEngine {
+
+	/*
+	* Ordered Key - Value map on top of TBTreeSet (see TOrderedMapBase), same interface as TOrderedMap.
+	* Faster lookups and iteration than TOrderedMap since many pairs share a cache line aligned node.
+	* NOTE: Unlike TOrderedMap, adding / removing pairs moves other pairs, which invalidates iterators and references.
+	*
+	* @tparam KeyType - Type of the keys, must be copyable.
+	* @tparam ValueType - Type of the values.
+	* @tparam Predicate - Strict weak ordering of the keys, two keys are equal when neither is less than the other.
+	*/
+	template<typename KeyType, typename ValueType, typename Predicate = std::less<KeyType>>
+	class TBTreeMap : public TOrderedMapBase<TBTreeSet<TPair<KeyType, ValueType>, Predicate, TPairKeyFuncs<KeyType, ValueType>>, KeyType, ValueType>
+	{
+		using MapBase = TOrderedMapBase<TBTreeSet<TPair<KeyType, ValueType>, Predicate, TPairKeyFuncs<KeyType, ValueType>>, KeyType, ValueType>;
+
+	public:
+		using typename MapBase::ElementType;
+
+		using MapBase::MapBase;
+
+		/*
+		* Replaces the content of the map with pairs sorted by key, much faster than adding them one by one.
+		* Pairs with the same key as the pair before them are skipped.
+		*
+		* @param SortedPairs - Pairs sorted by key.
+		* @param Count - Number of pairs.
+		*/
+		FORCEINLINE void BulkLoad(const ElementType* SortedPairs, size_t Count) noexcept
+		{
+			MapBase::Super::BulkLoad(SortedPairs, Count);
+		}
+	};
+}
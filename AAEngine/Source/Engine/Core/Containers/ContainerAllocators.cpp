@@ -0,0 +1,11 @@
+#include "AA_PreCompiledHeaders.h"
+#include "ContainerAllocators.h"
+
+namespace AAEngine {
+
+	FAllocatorStats& FHeapAllocator::GetStats()
+	{
+		static FAllocatorStats HeapStats;
+		return HeapStats;
+	}
+}
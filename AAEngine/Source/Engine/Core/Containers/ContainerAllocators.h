@@ -0,0 +1,315 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "CoreContainers.h"
+
+#include "Memory/Memory.h"
+#include "Memory/AllocatorStats.h"
+#include "Memory/LinearArena.h"
+#include "Memory/FixedBlockPool.h"
+
+/*
+* ALLOCATOR POLICIES
+*
+* Containers take an allocator policy as a template parameter and store a Policy::TForElementType<T> instance.
+* Every TForElementType<T> provides:
+*	T*		Allocate(size_t Count)									- Memory for Count elements (Count > 0)
+*	void	Deallocate(T* Pointer, size_t Count)					- Gives back memory returned by Allocate with the same Count
+*	bool	TryResizeInPlace(T* Pointer, size_t Old, size_t New)	- Grows / shrinks an allocation without moving it, false if not possible
+*
+* Every policy also has a static GetStats() returning the FAllocatorStats of the memory it hands out.
+*/
+
+namespace AAEngine {
+
+	/*
+	* Default allocator policy.
+	* Allocates from FMemory, counted under EMemoryTag::Containers unless an FMemoryTagScope is active.
+	*/
+	struct AA_ENGINE_API FHeapAllocator
+	{
+		template<typename T>
+		class TForElementType
+		{
+		public:
+			FORCEINLINE T* Allocate(size_t Count) noexcept
+			{
+				GetStats().TrackAllocation(Count * sizeof(T));
+				return (T*)FMemory::Malloc(Count * sizeof(T), alignof(T), EMemoryTag::Containers);
+			}
+
+			FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+			{
+				GetStats().TrackFree(Count * sizeof(T));
+				FMemory::Free(Pointer);
+			}
+
+			FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+			{
+				return false;
+			}
+		};
+
+		/*
+		* @returns Counters for every container allocation made from the heap.
+		*/
+		static FAllocatorStats& GetStats();
+	};
+
+	/*
+	* Heap allocator policy with a minimum alignment for the whole allocation, e.g. 32 for AVX loads or AA_CACHE_LINE_SIZE
+	* for batches split across threads. Over-aligned element types keep their own alignment if it is bigger.
+	* Shares the counters of FHeapAllocator.
+	*
+	* @tparam Alignment - Power of two alignment of the first element.
+	*/
+	template<size_t Alignment>
+	struct AA_ENGINE_API TAlignedHeapAllocator
+	{
+		static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "TAlignedHeapAllocator alignment must be a power of two!");
+
+		template<typename T>
+		class TForElementType
+		{
+		public:
+			FORCEINLINE T* Allocate(size_t Count) noexcept
+			{
+				GetStats().TrackAllocation(Count * sizeof(T));
+				T* Pointer = (T*)FMemory::Malloc(Count * sizeof(T), ElementAlignment, EMemoryTag::Containers);
+				AA_CHECK_ALIGNED(Pointer, ElementAlignment);
+				return Pointer;
+			}
+
+			FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+			{
+				GetStats().TrackFree(Count * sizeof(T));
+				FMemory::Free(Pointer);
+			}
+
+			FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+			{
+				return false;
+			}
+
+		private:
+			/*
+			* Alignment the memory is requested with.
+			*/
+			static constexpr size_t ElementAlignment = alignof(T) > Alignment ? alignof(T) : Alignment;
+		};
+
+		/*
+		* @returns Counters of the heap, the same as FHeapAllocator::GetStats().
+		*/
+		static FAllocatorStats& GetStats() { return FHeapAllocator::GetStats(); }
+	};
+
+	/*
+	* Allocator policy that bumps out of the engine frame arena (CLinearArena::GetFrameArena()).
+	* Containers using it must not outlive the frame they are created in.
+	* Falls back to the heap if the arena runs out of space, the overflow is counted by the arena.
+	*/
+	struct AA_ENGINE_API FFrameArenaAllocator
+	{
+		template<typename T>
+		class TForElementType
+		{
+		public:
+			FORCEINLINE TForElementType() noexcept
+				: Arena(&CLinearArena::GetFrameArena())
+			{
+			}
+
+			FORCEINLINE T* Allocate(size_t Count) noexcept
+			{
+				void* Pointer = Arena->Allocate(Count * sizeof(T), alignof(T) > DEFAULT_ARENA_ALIGNMENT ? alignof(T) : DEFAULT_ARENA_ALIGNMENT);
+				return Pointer ? (T*)Pointer : Fallback.Allocate(Count);
+			}
+
+			FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+			{
+				if (Arena->Owns(Pointer))
+				{
+					Arena->Free(Pointer, Count * sizeof(T));
+				}
+				else
+				{
+					Fallback.Deallocate(Pointer, Count);
+				}
+			}
+
+			FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+			{
+				return Arena->Owns(Pointer) && Arena->TryResize(Pointer, OldCount * sizeof(T), NewCount * sizeof(T));
+			}
+
+		private:
+			/*
+			* Arena captured at construction.
+			*/
+			CLinearArena* Arena;
+
+			/*
+			* Used when the arena is full.
+			*/
+			AA_NO_UNIQUE_ADDRESS FHeapAllocator::TForElementType<T> Fallback;
+		};
+
+		/*
+		* @returns Counters of the frame arena.
+		*/
+		static FAllocatorStats& GetStats() { return CLinearArena::GetFrameArena().GetStats(); }
+	};
+
+	/*
+	* Allocator policy that serves allocations of up to BlockBytes from a shared CFixedBlockPool.
+	* Bigger allocations go to the heap.
+	* NOTE: The pool is shared by every container using the same BlockBytes and is not thread-safe.
+	*
+	* @tparam BlockBytes - Size of each pooled block in bytes.
+	* @tparam BlocksPerChunk - Number of blocks the pool reserves at a time.
+	*/
+	template<size_t BlockBytes, size_t BlocksPerChunk = 64>
+	struct AA_ENGINE_API TFixedBlockAllocator
+	{
+		template<typename T>
+		class TForElementType
+		{
+		public:
+			FORCEINLINE T* Allocate(size_t Count) noexcept
+			{
+				return FitsInBlock(Count) ? (T*)GetPool().Allocate() : Fallback.Allocate(Count);
+			}
+
+			FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+			{
+				if (FitsInBlock(Count))
+				{
+					GetPool().Free(Pointer);
+				}
+				else
+				{
+					Fallback.Deallocate(Pointer, Count);
+				}
+			}
+
+			FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+			{
+				return FitsInBlock(OldCount) && FitsInBlock(NewCount);
+			}
+
+		private:
+			/*
+			* Checks if Count elements can be served by one pool block.
+			*/
+			static FORCEINLINE constexpr bool FitsInBlock(size_t Count) noexcept
+			{
+				return alignof(T) <= 16 && Count * sizeof(T) <= BlockBytes;
+			}
+
+			/*
+			* Used for allocations bigger than a block.
+			*/
+			AA_NO_UNIQUE_ADDRESS FHeapAllocator::TForElementType<T> Fallback;
+		};
+
+		/*
+		* @returns The pool shared by all containers using this policy.
+		*/
+		static CFixedBlockPool& GetPool()
+		{
+			static CFixedBlockPool Pool(BlockBytes, BlocksPerChunk);
+			return Pool;
+		}
+
+		/*
+		* @returns Counters of the shared pool.
+		*/
+		static FAllocatorStats& GetStats() { return GetPool().GetStats(); }
+	};
+
+	/*
+	* Allocator policy with storage for NumInlineElements inside the container itself.
+	* Only goes to the secondary allocator once the container grows past the inline storage.
+	*
+	* @tparam NumInlineElements - Number of elements that fit in the inline storage.
+	* @tparam SecondaryAllocator - Policy used once the inline storage is too small.
+	*/
+	template<size_t NumInlineElements, typename SecondaryAllocator = FHeapAllocator>
+	struct AA_ENGINE_API TInlineAllocator
+	{
+		template<typename T>
+		class TForElementType
+		{
+		public:
+			FORCEINLINE TForElementType() noexcept
+			{
+			}
+
+			// Inline storage can't be shared, containers copy / move the elements instead.
+			TForElementType(const TForElementType&) = delete;
+			TForElementType& operator=(const TForElementType&) = delete;
+
+			FORCEINLINE T* Allocate(size_t Count) noexcept
+			{
+				if (Count <= NumInlineElements)
+				{
+					GetStats().TrackAllocation(Count * sizeof(T));
+					return GetInlineData();
+				}
+				return Secondary.Allocate(Count);
+			}
+
+			FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+			{
+				if (Pointer == GetInlineData())
+				{
+					GetStats().TrackFree(Count * sizeof(T));
+				}
+				else
+				{
+					Secondary.Deallocate(Pointer, Count);
+				}
+			}
+
+			FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+			{
+				if (Pointer == GetInlineData())
+				{
+					if (NewCount > NumInlineElements)
+					{
+						return false;
+					}
+					GetStats().TrackResize(OldCount * sizeof(T), NewCount * sizeof(T));
+					return true;
+				}
+				return Secondary.TryResizeInPlace(Pointer, OldCount, NewCount);
+			}
+
+		private:
+			FORCEINLINE T* GetInlineData() noexcept
+			{
+				return (T*)InlineData;
+			}
+
+			/*
+			* Raw storage for the inline elements.
+			*/
+			alignas(T) uint8_t InlineData[NumInlineElements * sizeof(T)];
+
+			/*
+			* Used once the inline storage is too small.
+			*/
+			AA_NO_UNIQUE_ADDRESS typename SecondaryAllocator::template TForElementType<T> Secondary;
+		};
+
+		/*
+		* @returns Counters of the inline storage in use, spills are counted by SecondaryAllocator.
+		*/
+		static FAllocatorStats& GetStats()
+		{
+			static FAllocatorStats Stats;
+			return Stats;
+		}
+	};
+}
@@ -1,7 +1,21 @@
 #pragma once
 
 #include "Core/Containers/CoreContainers.h"
+#include "Core/Containers/ContainerAllocators.h"
 
 #include "Core/Containers/StaticArray.h"
 #include "Core/Containers/Array.h"
-#include "Core/Containers/BinarySearchTree.h"
\ No newline at end of file
+#include "Core/Containers/ArrayView.h"
+#include "Core/Containers/SoAArray.h"
+#include "Core/Containers/ResourcePool.h"
+#include "Core/Containers/BinarySearchTree.h"
+#include "Core/Containers/RedBlackTree.h"
+#include "Core/Containers/OrderedMap.h"
+#include "Core/Containers/BTree.h"
+#include "Core/Containers/BTreeMap.h"
+#include "Core/Containers/HashMap.h"
+#include "Core/Containers/HashSet.h"
+#include "Core/Containers/Stack.h"
+#include "Core/Containers/Queue.h"
+#include "Core/Containers/SpscRingBuffer.h"
+#include "Core/Containers/MpmcQueue.h"
\ No newline at end of file
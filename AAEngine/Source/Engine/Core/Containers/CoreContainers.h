@@ -1,2 +1,17 @@
 #pragma once
 
+#include "Core/Core.h"
+
+/*
+* Lets stateless allocator policies take up no space inside the containers that own them.
+*/
+#ifdef AA_PLATFORM_WINDOWS
+	#define AA_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+	#error AA Engine only supports Windows!
+#endif
+
+/*
+* Size of a CPU cache line, data written by different threads is padded to this so they don't false share.
+*/
+#define AA_CACHE_LINE_SIZE 64
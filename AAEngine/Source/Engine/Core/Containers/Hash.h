@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+/*
+* Hashing and key comparison functors used by the hash containers (TMap / TSet).
+*
+* Functors that declare "using is_transparent = void;" (same convention as the standard library) allow heterogeneous lookup,
+* e.g. Find("Name") on a TMap<std::string, ...> without building a temporary std::string.
+*/
+
+namespace AAEngine {
+
+	/*
+	* Default hasher.
+	* Forwards to std::hash, the hash containers mix the result so identity hashes of integers / enums / pointers are fine.
+	*
+	* @tparam T - Type of the key to hash.
+	*/
+	template<typename T>
+	struct THash
+	{
+		FORCEINLINE size_t operator()(const T& Key) const noexcept
+		{
+			return std::hash<T>()(Key);
+		}
+	};
+
+	/*
+	* String hasher, hashes anything convertible to std::string_view (std::string, const char*, string literals).
+	*/
+	template<>
+	struct THash<std::string>
+	{
+		using is_transparent = void;
+
+		FORCEINLINE size_t operator()(std::string_view Key) const noexcept
+		{
+			return std::hash<std::string_view>()(Key);
+		}
+	};
+
+	/*
+	* Default key comparison.
+	*
+	* @tparam T - Type of the keys to compare.
+	*/
+	template<typename T>
+	struct TKeyEqual
+	{
+		FORCEINLINE bool operator()(const T& Left, const T& Right) const noexcept
+		{
+			return Left == Right;
+		}
+	};
+
+	/*
+	* String comparison, compares anything convertible to std::string_view.
+	*/
+	template<>
+	struct TKeyEqual<std::string>
+	{
+		using is_transparent = void;
+
+		FORCEINLINE bool operator()(std::string_view Left, std::string_view Right) const noexcept
+		{
+			return Left == Right;
+		}
+	};
+
+	/*
+	* Scrambles a hash value so every bit of the input affects the high and low bits of the output.
+	* Finalizer of MurmurHash3.
+	*
+	* @param Hash - Hash value to mix.
+	*
+	* @returns Mixed hash value.
+	*/
+	FORCEINLINE constexpr uint64_t MixHash(uint64_t Hash) noexcept
+	{
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdULL;
+		Hash ^= Hash >> 33;
+		Hash *= 0xc4ceb9fe1a85ec53ULL;
+		Hash ^= Hash >> 33;
+		return Hash;
+	}
+}
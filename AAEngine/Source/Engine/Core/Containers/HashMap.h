@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "HashTable.h"
+#include "KeyValuePair.h"
+
+namespace AAEngine {
+
+	/*
+	* Unordered Key - Value map (see HashTable.h).
+	* Elements are TPair<KeyType, ValueType>, iterate with "for (auto& Pair : Map)" and use Pair.Key / Pair.Value.
+	* NOTE: Adding elements may rehash, which invalidates every iterator and reference into the map.
+	* NOTE: Never change the Key of an element through an iterator.
+	*
+	* @tparam KeyType - Type of the keys.
+	* @tparam ValueType - Type of the values.
+	* @tparam HasherType - Hash functor for KeyType, transparent hashers enable heterogeneous lookup (see Hash.h).
+	* @tparam KeyEqualType - Key comparison functor (see Hash.h).
+	* @tparam AllocatorType - Allocator policy the map gets its memory from (see ContainerAllocators.h).
+	*/
+	template<typename KeyType, typename ValueType, typename HasherType = THash<KeyType>, typename KeyEqualType = TKeyEqual<KeyType>, typename AllocatorType = FHeapAllocator>
+	class AA_ENGINE_API TMap : public THashTable<TPair<KeyType, ValueType>, KeyType, TPairKeyFuncs<KeyType, ValueType>, HasherType, KeyEqualType, AllocatorType>
+	{
+		using Super = THashTable<TPair<KeyType, ValueType>, KeyType, TPairKeyFuncs<KeyType, ValueType>, HasherType, KeyEqualType, AllocatorType>;
+
+	public:
+		using ElementType = TPair<KeyType, ValueType>;
+		using typename Super::Iterator;
+		using typename Super::ConstIterator;
+
+		/*
+		* Default constructor for TMap.
+		*/
+		FORCEINLINE TMap() noexcept
+		{
+		}
+
+		/*
+		* Constructor for TMap that reserves space.
+		*
+		* @param InitialNum - Number of elements that can be added without rehashing.
+		*/
+		FORCEINLINE explicit TMap(size_t InitialNum) noexcept
+			: Super(InitialNum)
+		{
+		}
+
+		/*
+		* Constructor for TMap from a list of pairs, later duplicates overwrite earlier ones.
+		*
+		* @param InitList - Key - Value pairs to add.
+		*/
+		FORCEINLINE TMap(const std::initializer_list<ElementType>& InitList) noexcept
+			: Super(InitList.size())
+		{
+			for (const ElementType& Element : InitList)
+			{
+				Add(Element.Key, Element.Value);
+			}
+		}
+
+		/*
+		* Adds a Key - Value pair, overwriting the value if the key is already in the map.
+		*
+		* @param Key - Key to add.
+		* @param Value - Value for the key.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		FORCEINLINE ValueType& Add(const KeyType& Key, const ValueType& Value) noexcept		{ return AddImpl(Key, Value); }
+		FORCEINLINE ValueType& Add(const KeyType& Key, ValueType&& Value) noexcept			{ return AddImpl(Key, Move(Value)); }
+		FORCEINLINE ValueType& Add(KeyType&& Key, const ValueType& Value) noexcept			{ return AddImpl(Move(Key), Value); }
+		FORCEINLINE ValueType& Add(KeyType&& Key, ValueType&& Value) noexcept				{ return AddImpl(Move(Key), Move(Value)); }
+
+		/*
+		* Constructs a value from Args for a key that isn't in the map yet.
+		* If the key is already in the map nothing is constructed and the existing value is kept.
+		*
+		* @param Key - Key to add.
+		* @param Args - Arguments for the value's constructor.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE ValueType& Emplace(const KeyType& Key, ArgsType&&... Args) noexcept
+		{
+			return EmplaceImpl(Key, Forward<ArgsType>(Args)...);
+		}
+
+		template<typename... ArgsType>
+		FORCEINLINE ValueType& Emplace(KeyType&& Key, ArgsType&&... Args) noexcept
+		{
+			return EmplaceImpl(Move(Key), Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Finds the value of a key, adding a default constructed value if the key isn't in the map.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		FORCEINLINE ValueType& FindOrAdd(const KeyType& Key) noexcept		{ return EmplaceImpl(Key); }
+		FORCEINLINE ValueType& FindOrAdd(KeyType&& Key) noexcept			{ return EmplaceImpl(Move(Key)); }
+
+		FORCEINLINE ValueType& operator[](const KeyType& Key) noexcept		{ return EmplaceImpl(Key); }
+		FORCEINLINE ValueType& operator[](KeyType&& Key) noexcept			{ return EmplaceImpl(Move(Key)); }
+
+		/*
+		* Finds the value of a key.
+		*
+		* @param Key - Key to look for, any type the hasher accepts if the hasher is transparent.
+		*
+		* @returns Pointer to the value or nullptr if the key isn't in the map.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE ValueType* FindValue(const K& Key) noexcept
+		{
+			Iterator It = this->Find(Key);
+			return It != this->end() ? &It->Value : nullptr;
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE const ValueType* FindValue(const K& Key) const noexcept
+		{
+			ConstIterator It = this->Find(Key);
+			return It != this->end() ? &It->Value : nullptr;
+		}
+
+	private:
+		template<typename InKeyType, typename InValueType>
+		FORCEINLINE ValueType& AddImpl(InKeyType&& Key, InValueType&& Value) noexcept
+		{
+			typename Super::FInsertResult Result = this->FindOrPrepareInsert(Key);
+			if (Result.bIsNew)
+			{
+				new(&this->Slots[Result.Index]) ElementType(Forward<InKeyType>(Key), Forward<InValueType>(Value));
+			}
+			else
+			{
+				this->Slots[Result.Index].Value = Forward<InValueType>(Value);
+			}
+			return this->Slots[Result.Index].Value;
+		}
+
+		template<typename InKeyType, typename... ArgsType>
+		FORCEINLINE ValueType& EmplaceImpl(InKeyType&& Key, ArgsType&&... Args) noexcept
+		{
+			typename Super::FInsertResult Result = this->FindOrPrepareInsert(Key);
+			if (Result.bIsNew)
+			{
+				new(&this->Slots[Result.Index]) ElementType(Forward<InKeyType>(Key), ValueType(Forward<ArgsType>(Args)...));
+			}
+			return this->Slots[Result.Index].Value;
+		}
+	};
+}
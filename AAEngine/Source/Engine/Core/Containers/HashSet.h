@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "HashTable.h"
+
+namespace AAEngine {
+
+	/*
+	* Unordered set of unique elements (see HashTable.h).
+	* NOTE: Adding elements may rehash, which invalidates every iterator and reference into the set.
+	* NOTE: Never change an element through an iterator in a way that changes its hash.
+	*
+	* @tparam ElementType - Type of the elements.
+	* @tparam HasherType - Hash functor for ElementType, transparent hashers enable heterogeneous lookup (see Hash.h).
+	* @tparam KeyEqualType - Element comparison functor (see Hash.h).
+	* @tparam AllocatorType - Allocator policy the set gets its memory from (see ContainerAllocators.h).
+	*/
+	template<typename ElementType, typename HasherType = THash<ElementType>, typename KeyEqualType = TKeyEqual<ElementType>, typename AllocatorType = FHeapAllocator>
+	class AA_ENGINE_API TSet : public THashTable<ElementType, ElementType, TIdentityKeyFuncs<ElementType>, HasherType, KeyEqualType, AllocatorType>
+	{
+		using Super = THashTable<ElementType, ElementType, TIdentityKeyFuncs<ElementType>, HasherType, KeyEqualType, AllocatorType>;
+
+	public:
+		using typename Super::Iterator;
+		using typename Super::ConstIterator;
+
+		/*
+		* Default constructor for TSet.
+		*/
+		FORCEINLINE TSet() noexcept
+		{
+		}
+
+		/*
+		* Constructor for TSet that reserves space.
+		*
+		* @param InitialNum - Number of elements that can be added without rehashing.
+		*/
+		FORCEINLINE explicit TSet(size_t InitialNum) noexcept
+			: Super(InitialNum)
+		{
+		}
+
+		/*
+		* Constructor for TSet from a list of elements, duplicates are skipped.
+		*
+		* @param InitList - Elements to add.
+		*/
+		FORCEINLINE TSet(const std::initializer_list<ElementType>& InitList) noexcept
+			: Super(InitList.size())
+		{
+			for (const ElementType& Element : InitList)
+			{
+				Add(Element);
+			}
+		}
+
+		/*
+		* Adds an element if there is no equal element in the set yet.
+		*
+		* @param Element - Element to add.
+		*
+		* @returns true if the element was added, false if it was already in the set.
+		*/
+		FORCEINLINE bool Add(const ElementType& Element) noexcept		{ return AddImpl(Element); }
+		FORCEINLINE bool Add(ElementType&& Element) noexcept			{ return AddImpl(Move(Element)); }
+
+		/*
+		* Constructs an element from Args and adds it if there is no equal element in the set yet.
+		*
+		* @param Args - Arguments for the element's constructor.
+		*
+		* @returns true if the element was added, false if it was already in the set.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE bool Emplace(ArgsType&&... Args) noexcept
+		{
+			return AddImpl(ElementType(Forward<ArgsType>(Args)...));
+		}
+
+	private:
+		template<typename InElementType>
+		FORCEINLINE bool AddImpl(InElementType&& Element) noexcept
+		{
+			typename Super::FInsertResult Result = this->FindOrPrepareInsert(Element);
+			if (Result.bIsNew)
+			{
+				new(&this->Slots[Result.Index]) ElementType(Forward<InElementType>(Element));
+			}
+			return Result.bIsNew;
+		}
+	};
+}
@@ -0,0 +1,941 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Templates/AATemplates.h"
+#include "Memory/Memory.h"
+#include "Memory/MemoryOps.h"
+#include "ContainerAllocators.h"
+#include "Hash.h"
+#include "KeyValuePair.h"
+
+#include <emmintrin.h>
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+/*
+* HASH TABLE
+*
+* Flat open addressing hash table in the style of Swiss tables, shared by TMap and TSet.
+*
+* Elements live directly in one slot array, next to it is an array of one control byte per slot:
+*	Empty	(0x80)			- Slot was never used since the last rehash, ends every probe
+*	Deleted	(0xFE)			- Tombstone of a removed element, probes continue past it
+*	Full	(0x00 - 0x7F)	- Slot holds an element, the byte stores the low 7 bits of the element's hash (H2)
+*
+* Lookups start at the slot picked by the rest of the hash (H1) and compare 16 control bytes at once with SSE2,
+* so the key itself is usually only compared for the one slot that actually holds it.
+* The first HASH_GROUP_WIDTH control bytes are mirrored after the last one so a group can always be loaded without wrapping.
+*/
+
+/*
+* Number of control bytes probed at once.
+*/
+#define HASH_GROUP_WIDTH 16
+
+/*
+* Smallest capacity a hash table allocates, must be a power of two and at least HASH_GROUP_WIDTH.
+*/
+#define HASH_MIN_CAPACITY 16
+
+namespace AAEngine {
+
+	/*
+	* Special control byte values, anything >= 0 is a full slot.
+	*/
+	enum EHashControl : int8_t
+	{
+		HC_Empty = -128,
+		HC_Deleted = -2
+	};
+
+	/*
+	* @returns Index of the lowest set bit of a non zero mask.
+	*/
+	FORCEINLINE uint32_t HashCountTrailingZeros(uint32_t Mask) noexcept
+	{
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanForward(&Index, Mask);
+		return Index;
+#else
+		return __builtin_ctz(Mask);
+#endif
+	}
+
+	/*
+	* @returns Number of zero bits above the highest set bit of a non zero 16 bit mask.
+	*/
+	FORCEINLINE uint32_t HashCountLeadingZeros16(uint32_t Mask) noexcept
+	{
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanReverse(&Index, Mask);
+		return 15 - Index;
+#else
+		return __builtin_clz(Mask) - 16;
+#endif
+	}
+
+	/*
+	* HASH_GROUP_WIDTH control bytes loaded into one SSE register.
+	* Every Match function returns a bit mask with bit i set if control byte i matches.
+	*/
+	struct FHashGroup
+	{
+		FORCEINLINE explicit FHashGroup(const int8_t* Pos) noexcept
+			: Control(_mm_loadu_si128((const __m128i*)Pos))
+		{
+		}
+
+		/*
+		* @returns Mask of the full slots whose H2 equals the given one.
+		*/
+		FORCEINLINE uint32_t Match(int8_t H2) const noexcept
+		{
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(H2), Control));
+		}
+
+		/*
+		* @returns Mask of the empty slots.
+		*/
+		FORCEINLINE uint32_t MatchEmpty() const noexcept
+		{
+			return Match(HC_Empty);
+		}
+
+		/*
+		* @returns Mask of the empty or deleted slots, i.e. every slot an element can be inserted into.
+		*/
+		FORCEINLINE uint32_t MatchEmptyOrDeleted() const noexcept
+		{
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Control));
+		}
+
+		/*
+		* @returns Mask of the full slots.
+		*/
+		FORCEINLINE uint32_t MatchFull() const noexcept
+		{
+			return ~(uint32_t)_mm_movemask_epi8(Control) & 0xFFFF;
+		}
+
+		/*
+		* The loaded control bytes.
+		*/
+		__m128i Control;
+	};
+
+	/*
+	* Detects whether a hasher / key comparison pair allows lookups with keys of another type.
+	* K is only there so the check is done at the point of use and can fail without a hard error.
+	*/
+	template<typename HasherType, typename KeyEqualType, typename K, typename = void>
+	struct TIsTransparentHash												{ enum { Value = false }; };
+	template<typename HasherType, typename KeyEqualType, typename K>
+	struct TIsTransparentHash<HasherType, KeyEqualType, K, std::void_t<typename HasherType::is_transparent, typename KeyEqualType::is_transparent>>
+																			{ enum { Value = true }; };
+
+	/*
+	* Iterator for THashTable, walks the full slots in slot order.
+	*/
+	template<typename InElementType>
+	class AA_ENGINE_API THashTableIterator
+	{
+	public:
+		using ValType = InElementType;
+		using PtrType = ValType*;
+		using RefType = ValType&;
+
+		/*
+		* Default constructor for THashTableIterator.
+		*/
+		FORCEINLINE THashTableIterator() noexcept
+			: Control(nullptr), Slots(nullptr), Index(0), Capacity(0)
+		{
+		}
+
+		/*
+		* Constructor for THashTableIterator.
+		*
+		* @param InControl - Control bytes of the table.
+		* @param InSlots - Slots of the table.
+		* @param InIndex - Slot to start at, moved forward to the first full slot.
+		* @param InCapacity - Number of slots in the table.
+		*/
+		FORCEINLINE THashTableIterator(const int8_t* InControl, PtrType InSlots, size_t InIndex, size_t InCapacity) noexcept
+			: Control(InControl), Slots(InSlots), Index(InIndex), Capacity(InCapacity)
+		{
+			SkipToFull();
+		}
+
+		/*
+		* Conversion to a const iterator.
+		*/
+		FORCEINLINE operator THashTableIterator<const ValType>() const noexcept
+		{
+			return THashTableIterator<const ValType>(Control, Slots, Index, Capacity);
+		}
+
+		FORCEINLINE RefType operator*() const noexcept
+		{
+			return Slots[Index];
+		}
+
+		FORCEINLINE PtrType operator->() const noexcept
+		{
+			return &Slots[Index];
+		}
+
+		FORCEINLINE THashTableIterator& operator++() noexcept
+		{
+			Index++;
+			SkipToFull();
+			return *this;
+		}
+
+		FORCEINLINE THashTableIterator operator++(int) noexcept
+		{
+			THashTableIterator Temp = *this;
+			++(*this);
+			return Temp;
+		}
+
+		FORCEINLINE bool operator==(const THashTableIterator& Other) const noexcept
+		{
+			return Index == Other.Index && Slots == Other.Slots;
+		}
+
+		FORCEINLINE bool operator!=(const THashTableIterator& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+
+		/*
+		* @returns Slot index the iterator points at.
+		*/
+		FORCEINLINE size_t GetIndex() const noexcept
+		{
+			return Index;
+		}
+
+	private:
+		/*
+		* Moves Index forward to the next full slot, or to Capacity if there is none.
+		*/
+		FORCEINLINE void SkipToFull() noexcept
+		{
+			while (Index < Capacity)
+			{
+				uint32_t FullMask = FHashGroup(Control + Index).MatchFull();
+				if (FullMask)
+				{
+					Index += HashCountTrailingZeros(FullMask);
+					if (Index >= Capacity)
+					{
+						// Hit a mirrored control byte
+						Index = Capacity;
+					}
+					return;
+				}
+				Index += HASH_GROUP_WIDTH;
+			}
+			Index = Capacity;
+		}
+
+		/*
+		* Control bytes of the table.
+		*/
+		const int8_t* Control;
+
+		/*
+		* Slots of the table.
+		*/
+		PtrType Slots;
+
+		/*
+		* Current slot.
+		*/
+		size_t Index;
+
+		/*
+		* Number of slots in the table.
+		*/
+		size_t Capacity;
+	};
+
+	/*
+	* Open addressing hash table, base of TMap and TSet.
+	*
+	* @tparam ElementType - Type stored in the slots.
+	* @tparam KeyType - Type the elements are looked up with.
+	* @tparam KeyFuncs - Which part of an element is its key (see KeyValuePair.h).
+	* @tparam HasherType - Hash functor for KeyType (see Hash.h).
+	* @tparam KeyEqualType - Key comparison functor (see Hash.h).
+	* @tparam AllocatorType - Allocator policy the slots are allocated from (see ContainerAllocators.h).
+	*/
+	template<typename ElementType, typename KeyType, typename KeyFuncs, typename HasherType, typename KeyEqualType, typename AllocatorType>
+	class AA_ENGINE_API THashTable
+	{
+		static_assert(alignof(ElementType) <= 16, "Hash table elements can't be aligned to more than 16 bytes!");
+
+		/*
+		* Unit the table storage is allocated in, keeps slots 16 byte aligned with every allocator policy.
+		*/
+		struct alignas(16) FStorageUnit
+		{
+			uint8_t Bytes[16];
+		};
+
+	public:
+		using Iterator = THashTableIterator<ElementType>;
+		using ConstIterator = THashTableIterator<const ElementType>;
+		using ElementAllocatorType = typename AllocatorType::template TForElementType<FStorageUnit>;
+
+		/*
+		* Enables the heterogeneous overloads of the lookup functions.
+		*/
+		template<typename K>
+		using TEnableIfTransparent = typename std::enable_if<TIsTransparentHash<HasherType, KeyEqualType, K>::Value>::type;
+
+		/*
+		* Default constructor for THashTable.
+		* Does not allocate until the first element is added.
+		*/
+		FORCEINLINE THashTable() noexcept
+			: Slots(nullptr), Control(nullptr), Capacity(0), Size(0), GrowthLeft(0)
+		{
+		}
+
+		/*
+		* Constructor for THashTable that reserves space.
+		*
+		* @param InitialNum - Number of elements that can be added without rehashing.
+		*/
+		FORCEINLINE explicit THashTable(size_t InitialNum) noexcept
+			: THashTable()
+		{
+			Reserve(InitialNum);
+		}
+
+		/*
+		* Copy constructor for THashTable.
+		*
+		* @param Other - Table to copy.
+		*/
+		FORCEINLINE THashTable(const THashTable& Other) noexcept
+			: THashTable()
+		{
+			CopyFrom(Other);
+		}
+
+		/*
+		* Move constructor for THashTable.
+		*
+		* @param Other - Table to move from, left empty.
+		*/
+		FORCEINLINE THashTable(THashTable&& Other) noexcept
+			: THashTable()
+		{
+			MoveFrom(Other);
+		}
+
+		FORCEINLINE THashTable& operator=(const THashTable& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				CopyFrom(Other);
+			}
+			return *this;
+		}
+
+		FORCEINLINE THashTable& operator=(THashTable&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Empty();
+				MoveFrom(Other);
+			}
+			return *this;
+		}
+
+		/*
+		* Destructor for THashTable.
+		*/
+		FORCEINLINE ~THashTable()
+		{
+			Empty();
+		}
+
+		/*
+		* Makes sure NewNum elements fit without a rehash.
+		*
+		* @param NewNum - Number of elements to make space for.
+		*/
+		FORCEINLINE void Reserve(size_t NewNum) noexcept
+		{
+			if (NewNum > Size + GrowthLeft)
+			{
+				size_t NewCapacity = HASH_MIN_CAPACITY;
+				while (MaxLoad(NewCapacity) < NewNum)
+				{
+					NewCapacity *= 2;
+				}
+				Rehash(NewCapacity);
+			}
+		}
+
+		/*
+		* Destroys every element, keeps the allocated slots.
+		*/
+		FORCEINLINE void Clear() noexcept
+		{
+			if (Capacity == 0)
+			{
+				return;
+			}
+			DestroyElements();
+			FMemory::MemSet(Control, HC_Empty, Capacity + HASH_GROUP_WIDTH);
+			Size = 0;
+			GrowthLeft = MaxLoad(Capacity);
+		}
+
+		/*
+		* Destroys every element and frees the slots.
+		*/
+		FORCEINLINE void Empty() noexcept
+		{
+			if (Capacity == 0)
+			{
+				return;
+			}
+			DestroyElements();
+			Allocator.Deallocate((FStorageUnit*)Slots, StorageUnits(Capacity));
+			Slots = nullptr;
+			Control = nullptr;
+			Capacity = 0;
+			Size = 0;
+			GrowthLeft = 0;
+		}
+
+		/*
+		* Finds the element with the given key.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Iterator to the element or end() if there is none.
+		*/
+		FORCEINLINE Iterator Find(const KeyType& Key) noexcept
+		{
+			return MakeIterator(FindIndex(Key));
+		}
+
+		FORCEINLINE ConstIterator Find(const KeyType& Key) const noexcept
+		{
+			return MakeIterator(FindIndex(Key));
+		}
+
+		/*
+		* Heterogeneous Find, only available if HasherType and KeyEqualType are transparent.
+		*/
+		template<typename K, typename = TEnableIfTransparent<K>>
+		FORCEINLINE Iterator Find(const K& Key) noexcept
+		{
+			return MakeIterator(FindIndex(Key));
+		}
+
+		template<typename K, typename = TEnableIfTransparent<K>>
+		FORCEINLINE ConstIterator Find(const K& Key) const noexcept
+		{
+			return MakeIterator(FindIndex(Key));
+		}
+
+		/*
+		* Checks if an element with the given key is in the table.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns true if the key is in the table.
+		*/
+		FORCEINLINE bool Contains(const KeyType& Key) const noexcept
+		{
+			return FindIndex(Key) != INDEX_NONE;
+		}
+
+		template<typename K, typename = TEnableIfTransparent<K>>
+		FORCEINLINE bool Contains(const K& Key) const noexcept
+		{
+			return FindIndex(Key) != INDEX_NONE;
+		}
+
+		/*
+		* Removes the element with the given key.
+		*
+		* @param Key - Key of the element to remove.
+		*
+		* @returns true if an element was removed.
+		*/
+		FORCEINLINE bool Remove(const KeyType& Key) noexcept
+		{
+			return RemoveIndex(FindIndex(Key));
+		}
+
+		template<typename K, typename = TEnableIfTransparent<K>>
+		FORCEINLINE bool Remove(const K& Key) noexcept
+		{
+			return RemoveIndex(FindIndex(Key));
+		}
+
+		/*
+		* Removes the element an iterator points at.
+		* Other iterators stay valid, the removed slot is never reused before the next rehash unless it can be marked empty.
+		*
+		* @param It - Iterator to a valid element.
+		*
+		* @returns Iterator to the next element.
+		*/
+		FORCEINLINE Iterator Remove(Iterator It) noexcept
+		{
+			size_t Index = It.GetIndex();
+			RemoveIndex(Index);
+			return MakeIterator(Index + 1);
+		}
+
+		/*
+		* @returns Number of elements in the table.
+		*/
+		FORCEINLINE size_t Num() const noexcept
+		{
+			return Size;
+		}
+
+		/*
+		* @returns true if the table has no elements.
+		*/
+		FORCEINLINE bool IsEmpty() const noexcept
+		{
+			return Size == 0;
+		}
+
+		/*
+		* @returns Number of allocated slots.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept
+		{
+			return Capacity;
+		}
+
+		FORCEINLINE Iterator			begin()				{ return MakeIterator(0); }
+		FORCEINLINE ConstIterator		begin() const		{ return MakeIterator(0); }
+		FORCEINLINE Iterator			end()				{ return MakeIterator(Capacity); }
+		FORCEINLINE ConstIterator		end() const			{ return MakeIterator(Capacity); }
+
+	protected:
+		/*
+		* Index returned when a key isn't found.
+		*/
+		static constexpr size_t INDEX_NONE = ~(size_t)0;
+
+		/*
+		* Result of FindOrPrepareInsert.
+		*/
+		struct FInsertResult
+		{
+			/*
+			* Slot of the existing element, or uninitialized slot to construct the new element in.
+			*/
+			size_t Index;
+
+			/*
+			* true if the slot is new and the caller has to construct the element.
+			*/
+			bool bIsNew;
+		};
+
+		/*
+		* Hashes a key.
+		*/
+		template<typename K>
+		FORCEINLINE uint64_t HashKey(const K& Key) const noexcept
+		{
+			return MixHash((uint64_t)Hasher(Key));
+		}
+
+		/*
+		* Finds the slot of the element with the given key.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Slot index or INDEX_NONE.
+		*/
+		template<typename K>
+		FORCEINLINE size_t FindIndex(const K& Key) const noexcept
+		{
+			if (Size == 0)
+			{
+				return INDEX_NONE;
+			}
+
+			uint64_t Hash = HashKey(Key);
+			int8_t H2 = GetH2(Hash);
+			size_t Mask = Capacity - 1;
+			size_t Pos = GetH1(Hash) & Mask;
+			size_t Step = 0;
+
+			while (true)
+			{
+				FHashGroup Group(Control + Pos);
+				for (uint32_t Matches = Group.Match(H2); Matches; Matches &= Matches - 1)
+				{
+					size_t Index = (Pos + HashCountTrailingZeros(Matches)) & Mask;
+					if (KeyEqual(KeyFuncs::GetKey(Slots[Index]), Key))
+					{
+						return Index;
+					}
+				}
+
+				if (Group.MatchEmpty())
+				{
+					return INDEX_NONE;
+				}
+
+				Step += HASH_GROUP_WIDTH;
+				Pos = (Pos + Step) & Mask;
+			}
+		}
+
+		/*
+		* Finds the element with the given key or reserves a slot for it.
+		* If the slot is new the caller must construct an element with an equal key in it before using the table again.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Slot index and whether the slot is new.
+		*/
+		template<typename K>
+		FORCEINLINE FInsertResult FindOrPrepareInsert(const K& Key) noexcept
+		{
+			size_t Index = FindIndex(Key);
+			if (Index != INDEX_NONE)
+			{
+				return { Index, false };
+			}
+			return { PrepareInsert(HashKey(Key)), true };
+		}
+
+		/*
+		* Reserves a slot for a new element with the given hash, growing the table if needed.
+		*
+		* @param Hash - Hash of the new element's key.
+		*
+		* @returns Slot index to construct the new element in.
+		*/
+		FORCEINLINE size_t PrepareInsert(uint64_t Hash) noexcept
+		{
+			size_t Index = Capacity ? FindFirstNonFull(Hash) : 0;
+			if (GrowthLeft == 0 && (Capacity == 0 || Control[Index] != HC_Deleted))
+			{
+				Grow();
+				Index = FindFirstNonFull(Hash);
+			}
+
+			GrowthLeft -= Control[Index] == HC_Empty;
+			SetControl(Index, GetH2(Hash));
+			Size++;
+			return Index;
+		}
+
+		/*
+		* Destroys the element in a slot.
+		*
+		* @param Index - Slot index, INDEX_NONE is ignored.
+		*
+		* @returns true if an element was removed.
+		*/
+		FORCEINLINE bool RemoveIndex(size_t Index) noexcept
+		{
+			if (Index == INDEX_NONE)
+			{
+				return false;
+			}
+
+			DestructItems(&Slots[Index], 1);
+			Size--;
+
+			if (WasNeverFull(Index))
+			{
+				SetControl(Index, HC_Empty);
+				GrowthLeft++;
+			}
+			else
+			{
+				SetControl(Index, HC_Deleted);
+			}
+			return true;
+		}
+
+		FORCEINLINE Iterator MakeIterator(size_t Index) noexcept
+		{
+			return Iterator(Control, Slots, Index == INDEX_NONE ? Capacity : Index, Capacity);
+		}
+
+		FORCEINLINE ConstIterator MakeIterator(size_t Index) const noexcept
+		{
+			return ConstIterator(Control, Slots, Index == INDEX_NONE ? Capacity : Index, Capacity);
+		}
+
+		/*
+		* Slot array.
+		*/
+		ElementType* Slots;
+
+	private:
+		/*
+		* Rest of the hash, picks the first slot to probe.
+		*/
+		static FORCEINLINE size_t GetH1(uint64_t Hash) noexcept
+		{
+			return (size_t)(Hash >> 7);
+		}
+
+		/*
+		* Low 7 bits of the hash, stored in the control byte.
+		*/
+		static FORCEINLINE int8_t GetH2(uint64_t Hash) noexcept
+		{
+			return (int8_t)(Hash & 0x7F);
+		}
+
+		/*
+		* Maximum number of used (full or deleted) slots for a capacity, a load factor of 7/8.
+		*/
+		static FORCEINLINE constexpr size_t MaxLoad(size_t InCapacity) noexcept
+		{
+			return InCapacity - InCapacity / 8;
+		}
+
+		/*
+		* Number of storage units for the slots and control bytes of a capacity.
+		*/
+		static FORCEINLINE constexpr size_t StorageUnits(size_t InCapacity) noexcept
+		{
+			return (InCapacity * sizeof(ElementType) + InCapacity + HASH_GROUP_WIDTH + sizeof(FStorageUnit) - 1) / sizeof(FStorageUnit);
+		}
+
+		/*
+		* Writes a control byte and its mirror.
+		*/
+		FORCEINLINE void SetControl(size_t Index, int8_t Value) noexcept
+		{
+			Control[Index] = Value;
+			if (Index < HASH_GROUP_WIDTH)
+			{
+				Control[Capacity + Index] = Value;
+			}
+		}
+
+		/*
+		* Finds the first empty or deleted slot on the probe sequence of a hash.
+		*/
+		FORCEINLINE size_t FindFirstNonFull(uint64_t Hash) const noexcept
+		{
+			size_t Mask = Capacity - 1;
+			size_t Pos = GetH1(Hash) & Mask;
+			size_t Step = 0;
+
+			while (true)
+			{
+				uint32_t Free = FHashGroup(Control + Pos).MatchEmptyOrDeleted();
+				if (Free)
+				{
+					return (Pos + HashCountTrailingZeros(Free)) & Mask;
+				}
+
+				Step += HASH_GROUP_WIDTH;
+				Pos = (Pos + Step) & Mask;
+			}
+		}
+
+		/*
+		* Checks whether a removed slot can go straight back to empty instead of becoming a tombstone.
+		* That is the case when every group containing the slot also contains an empty slot,
+		* since no probe can then have passed over this slot to reach an element further along.
+		*/
+		FORCEINLINE bool WasNeverFull(size_t Index) const noexcept
+		{
+			if (Capacity <= HASH_GROUP_WIDTH)
+			{
+				// Every probe looks at the whole table
+				return true;
+			}
+
+			size_t IndexBefore = (Index - HASH_GROUP_WIDTH) & (Capacity - 1);
+			uint32_t EmptyAfter = FHashGroup(Control + Index).MatchEmpty();
+			uint32_t EmptyBefore = FHashGroup(Control + IndexBefore).MatchEmpty();
+
+			return EmptyBefore && EmptyAfter && HashCountTrailingZeros(EmptyAfter) + HashCountLeadingZeros16(EmptyBefore) < HASH_GROUP_WIDTH;
+		}
+
+		/*
+		* Called when there is no room left for a new element.
+		* Doubles the table, or only clears the tombstones if at least half of the used slots are deleted.
+		*/
+		FORCEINLINE void Grow() noexcept
+		{
+			if (Capacity == 0)
+			{
+				Rehash(HASH_MIN_CAPACITY);
+			}
+			else if (Size * 2 <= MaxLoad(Capacity))
+			{
+				Rehash(Capacity);
+			}
+			else
+			{
+				Rehash(Capacity * 2);
+			}
+		}
+
+		/*
+		* Moves every element into a new slot array.
+		*
+		* @param NewCapacity - Power of two number of slots, big enough for Size elements.
+		*/
+		void Rehash(size_t NewCapacity) noexcept
+		{
+			ElementType* OldSlots = Slots;
+			int8_t* OldControl = Control;
+			size_t OldCapacity = Capacity;
+
+			Slots = (ElementType*)Allocator.Allocate(StorageUnits(NewCapacity));
+			Control = (int8_t*)(Slots + NewCapacity);
+			Capacity = NewCapacity;
+			GrowthLeft = MaxLoad(NewCapacity) - Size;
+			FMemory::MemSet(Control, HC_Empty, NewCapacity + HASH_GROUP_WIDTH);
+
+			for (size_t i = 0; i < OldCapacity; i++)
+			{
+				if (OldControl[i] >= 0)
+				{
+					uint64_t Hash = HashKey(KeyFuncs::GetKey(OldSlots[i]));
+					size_t Index = FindFirstNonFull(Hash);
+					SetControl(Index, GetH2(Hash));
+					RelocateConstructItems(&Slots[Index], &OldSlots[i], 1);
+				}
+			}
+
+			if (OldCapacity)
+			{
+				Allocator.Deallocate((FStorageUnit*)OldSlots, StorageUnits(OldCapacity));
+			}
+		}
+
+		/*
+		* Destroys the elements in every full slot.
+		*/
+		FORCEINLINE void DestroyElements() noexcept
+		{
+			if constexpr (!TIsTriviallyDestructible<ElementType>::Value)
+			{
+				for (size_t i = 0; i < Capacity; i++)
+				{
+					if (Control[i] >= 0)
+					{
+						Slots[i].~ElementType();
+					}
+				}
+			}
+		}
+
+		/*
+		* Copies every element of Other into this (empty) table.
+		*/
+		FORCEINLINE void CopyFrom(const THashTable& Other) noexcept
+		{
+			Reserve(Other.Size);
+			for (size_t i = 0; i < Other.Capacity; i++)
+			{
+				if (Other.Control[i] >= 0)
+				{
+					size_t Index = PrepareInsert(HashKey(KeyFuncs::GetKey(Other.Slots[i])));
+					new(&Slots[Index]) ElementType(Other.Slots[i]);
+				}
+			}
+		}
+
+		/*
+		* Takes the storage of Other, this table must not own any storage.
+		*/
+		FORCEINLINE void MoveFrom(THashTable& Other) noexcept
+		{
+			if (Other.Capacity == 0)
+			{
+				return;
+			}
+
+			if constexpr (!std::is_copy_constructible<ElementAllocatorType>::value)
+			{
+				// Allocators with storage inside the container (TInlineAllocator) can't hand it over, move the elements instead
+				Reserve(Other.Size);
+				for (ElementType& Element : Other)
+				{
+					size_t Index = PrepareInsert(HashKey(KeyFuncs::GetKey(Element)));
+					RelocateConstructItems(&Slots[Index], &Element, 1);
+				}
+				FMemory::MemSet(Other.Control, HC_Empty, Other.Capacity + HASH_GROUP_WIDTH);
+				Other.Size = 0;
+				Other.GrowthLeft = MaxLoad(Other.Capacity);
+				return;
+			}
+
+			Slots = Other.Slots;
+			Control = Other.Control;
+			Capacity = Other.Capacity;
+			Size = Other.Size;
+			GrowthLeft = Other.GrowthLeft;
+
+			Other.Slots = nullptr;
+			Other.Control = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+			Other.GrowthLeft = 0;
+		}
+
+		/*
+		* Control bytes, Capacity + HASH_GROUP_WIDTH of them, stored right after the slots.
+		*/
+		int8_t* Control;
+
+		/*
+		* Number of slots, zero or a power of two.
+		*/
+		size_t Capacity;
+
+		/*
+		* Number of elements.
+		*/
+		size_t Size;
+
+		/*
+		* Number of empty slots that can still be filled before the table has to grow.
+		*/
+		size_t GrowthLeft;
+
+		/*
+		* Hash functor.
+		*/
+		AA_NO_UNIQUE_ADDRESS HasherType Hasher;
+
+		/*
+		* Key comparison functor.
+		*/
+		AA_NO_UNIQUE_ADDRESS KeyEqualType KeyEqual;
+
+		/*
+		* Allocator the storage comes from.
+		*/
+		AA_NO_UNIQUE_ADDRESS ElementAllocatorType Allocator;
+	};
+}
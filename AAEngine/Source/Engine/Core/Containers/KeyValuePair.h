@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Templates/AATemplates.h"
 
 namespace AAEngine {
 
@@ -9,43 +10,38 @@ namespace AAEngine {
 	{
 	public:
 		FORCEINLINE constexpr TKeyValuePair() noexcept
+			: Key(), Value()
 		{
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(const TKeyValuePair& Pair) noexcept
+			: Key(Pair.Key), Value(Pair.Value)
 		{
-			Key = Pair.Key;
-			Value = Pair.Value;
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(TKeyValuePair&& Pair) noexcept
+			: Key(Move(Pair.Key)), Value(Move(Pair.Value))
 		{
-			Key = Move(Pair.Key);
-			Value = Move(Pair.Value);
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(const KeyType& InKey, const ValueType& InValue) noexcept
+			: Key(InKey), Value(InValue)
 		{
-			Key = InKey;
-			Value = InValue;
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(KeyType&& InKey, const ValueType& InValue) noexcept
+			: Key(Move(InKey)), Value(InValue)
 		{
-			Key = Move(InKey);
-			Value = InValue;
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(const KeyType& InKey, ValueType&& InValue) noexcept
+			: Key(InKey), Value(Move(InValue))
 		{
-			Key = InKey;
-			Value = Move(InValue);
 		}
 
 		FORCEINLINE constexpr TKeyValuePair(KeyType&& InKey, ValueType&& InValue) noexcept
+			: Key(Move(InKey)), Value(Move(InValue))
 		{
-			Key = Move(InKey);
-			Value = Move(InValue);
 		}
 
 		FORCEINLINE constexpr TKeyValuePair& operator=(const TKeyValuePair& Pair) noexcept
@@ -62,7 +58,7 @@ namespace AAEngine {
 			return *this;
 		}
 
-		FORCEINLINE constexpr bool operator==(const TKeyValuePair& Pair) noexcept
+		FORCEINLINE constexpr bool operator==(const TKeyValuePair& Pair) const noexcept
 		{
 			return Key == Pair.Key && Value == Pair.Value;
 		}
@@ -96,4 +92,38 @@ namespace AAEngine {
 
 	template<typename InKey, typename InValue>
 	using TPair = TKeyValuePair<InKey, InValue>;
+
+	/*
+	* KEY FUNCS
+	* Tell the associative containers (hash tables, trees) which part of an element is its key.
+	* Every KeyFuncs has a KeyType and a static GetKey(const ElementType&) returning a reference to the key.
+	*/
+
+	/*
+	* Key extraction for sets, the element is its own key.
+	*/
+	template<typename ElementType>
+	struct TIdentityKeyFuncs
+	{
+		using KeyType = ElementType;
+
+		static FORCEINLINE const KeyType& GetKey(const ElementType& Element) noexcept
+		{
+			return Element;
+		}
+	};
+
+	/*
+	* Key extraction for maps, the key of a TPair.
+	*/
+	template<typename InKeyType, typename ValueType>
+	struct TPairKeyFuncs
+	{
+		using KeyType = InKeyType;
+
+		static FORCEINLINE const KeyType& GetKey(const TPair<KeyType, ValueType>& Element) noexcept
+		{
+			return Element.Key;
+		}
+	};
 }
\ No newline at end of file
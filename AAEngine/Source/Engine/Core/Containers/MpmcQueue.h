@@ -0,0 +1,227 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "CoreContainers.h"
+#include "Memory/MemoryOps.h"
+
+#include <atomic>
+#include <new>
+
+namespace AAEngine {
+
+	/*
+	* Bounded lock-free Multi Producer Multi Consumer Queue, e.g. worker threads posting events back to the game thread.
+	* Every slot has a Sequence number telling which lap of the ring it is ready for: a producer may fill slot
+	* Index & Mask when its Sequence is Index, a consumer may empty it when its Sequence is Index + 1.
+	* Producers and Consumers only contend on their own (cache line padded) index, never on a lock.
+	*
+	* @tparam T - Type of the elements.
+	*/
+	template<typename T>
+	class AA_ENGINE_API TMpmcQueue
+	{
+	public:
+		/*
+		* Constructor for TMpmcQueue.
+		*
+		* @param InCapacity - Minimum number of elements the queue holds, rounded up to a power of two.
+		*/
+		FORCEINLINE explicit TMpmcQueue(size_t InCapacity) noexcept
+		{
+			size_t Capacity = 2;
+			while (Capacity < InCapacity)
+			{
+				Capacity *= 2;
+			}
+			Mask = Capacity - 1;
+			Cells = (FCell*)::operator new(Capacity * sizeof(FCell), std::align_val_t(alignof(FCell) > AA_CACHE_LINE_SIZE ? alignof(FCell) : AA_CACHE_LINE_SIZE));
+			for (size_t Index = 0; Index < Capacity; Index++)
+			{
+				new(&Cells[Index].Sequence) std::atomic<size_t>(Index);
+			}
+		}
+
+		TMpmcQueue(const TMpmcQueue&) = delete;
+		TMpmcQueue& operator=(const TMpmcQueue&) = delete;
+
+		/*
+		* Destroys the elements still in the queue, no other thread may be using it.
+		*/
+		FORCEINLINE ~TMpmcQueue()
+		{
+			const size_t Tail = EnqueueIndex.Value.load(std::memory_order_relaxed);
+			for (size_t Index = DequeueIndex.Value.load(std::memory_order_relaxed); Index != Tail; Index++)
+			{
+				Cells[Index & Mask].GetElement().~T();
+			}
+			::operator delete(Cells, std::align_val_t(alignof(FCell) > AA_CACHE_LINE_SIZE ? alignof(FCell) : AA_CACHE_LINE_SIZE));
+		}
+
+		/*
+		* Adds an element to the back of the queue, any thread.
+		*
+		* @param Element - Element to add.
+		*
+		* @returns false if the queue is full, Element is left untouched.
+		*/
+		FORCEINLINE bool TryPush(const T& Element) noexcept		{ return TryEmplace(Element); }
+		FORCEINLINE bool TryPush(T&& Element) noexcept			{ return TryEmplace(Move(Element)); }
+
+		/*
+		* Constructs an element at the back of the queue, any thread.
+		*
+		* @param Args - Arguments for the element's constructor.
+		*
+		* @returns false if the queue is full, nothing is constructed.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE bool TryEmplace(ArgsType&&... Args) noexcept
+		{
+			FCell* Cell;
+			size_t Index = EnqueueIndex.Value.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell = &Cells[Index & Mask];
+				const ptrdiff_t Lap = (ptrdiff_t)(Cell->Sequence.load(std::memory_order_acquire) - Index);
+				if (Lap == 0)
+				{
+					// Slot is free for this lap, claim the Index
+					if (EnqueueIndex.Value.compare_exchange_weak(Index, Index + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (Lap < 0)
+				{
+					// Slot still holds the element from the previous lap => full
+					return false;
+				}
+				else
+				{
+					// Another producer took Index
+					Index = EnqueueIndex.Value.load(std::memory_order_relaxed);
+				}
+			}
+
+			new(Cell->Storage) T(Forward<ArgsType>(Args)...);
+			Cell->Sequence.store(Index + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Moves the element at the front of the queue into OutElement and removes it, any thread.
+		*
+		* @param OutElement - Set to the front element if there is one.
+		*
+		* @returns false if the queue is empty.
+		*/
+		FORCEINLINE bool TryPop(T& OutElement) noexcept
+		{
+			FCell* Cell;
+			size_t Index = DequeueIndex.Value.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell = &Cells[Index & Mask];
+				const ptrdiff_t Lap = (ptrdiff_t)(Cell->Sequence.load(std::memory_order_acquire) - (Index + 1));
+				if (Lap == 0)
+				{
+					// Slot is filled for this lap, claim the Index
+					if (DequeueIndex.Value.compare_exchange_weak(Index, Index + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (Lap < 0)
+				{
+					// Slot not filled yet => empty
+					return false;
+				}
+				else
+				{
+					// Another consumer took Index
+					Index = DequeueIndex.Value.load(std::memory_order_relaxed);
+				}
+			}
+
+			T& Element = Cell->GetElement();
+			OutElement = Move(Element);
+			Element.~T();
+			// Free the slot for the producer of the next lap
+			Cell->Sequence.store(Index + Mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* NOTE: Only a snapshot while other threads are running.
+		*
+		* @returns Approximate number of elements in the queue.
+		*/
+		FORCEINLINE size_t Num() const noexcept
+		{
+			const size_t Head = DequeueIndex.Value.load(std::memory_order_acquire);
+			const size_t Tail = EnqueueIndex.Value.load(std::memory_order_acquire);
+			return Tail > Head ? Tail - Head : 0;
+		}
+
+		/*
+		* NOTE: Only a snapshot while other threads are running.
+		*
+		* @returns true if the queue has no elements.
+		*/
+		FORCEINLINE bool IsEmpty() const noexcept	{ return Num() == 0; }
+
+		/*
+		* @returns Number of elements the queue holds.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept	{ return Mask + 1; }
+
+	private:
+		/*
+		* Slot of the queue.
+		*/
+		struct FCell
+		{
+			/*
+			* Lap the slot is ready for, see TMpmcQueue.
+			*/
+			std::atomic<size_t> Sequence;
+
+			/*
+			* Element, constructed while Sequence is Index + 1.
+			*/
+			alignas(T) uint8_t Storage[sizeof(T)];
+
+			FORCEINLINE T& GetElement() noexcept	{ return *reinterpret_cast<T*>(Storage); }
+		};
+
+		/*
+		* Index on its own cache line, so producers and consumers don't invalidate each other's line.
+		*/
+		struct alignas(AA_CACHE_LINE_SIZE) FPaddedIndex
+		{
+			std::atomic<size_t> Value{ 0 };
+		};
+
+	private:
+		/*
+		* Slots of the queue, Capacity cells.
+		*/
+		alignas(AA_CACHE_LINE_SIZE) FCell* Cells;
+
+		/*
+		* Capacity - 1.
+		*/
+		size_t Mask;
+
+		/*
+		* Index of the next element to push.
+		*/
+		FPaddedIndex EnqueueIndex;
+
+		/*
+		* Index of the next element to pop.
+		*/
+		FPaddedIndex DequeueIndex;
+	};
+}
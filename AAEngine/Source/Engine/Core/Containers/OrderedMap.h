@@ -1,14 +1,358 @@
 #pragma once
 
+#include "Core/Core.h"
+
 #include "Containers/RedBlackTree.h"
 #include "Containers/KeyValuePair.h"
 
 namespace AAEngine {
 
-	template<typename KeyType, typename ValueType, typename Predicate = std::less<KeyType>, typename KeyCompare = std::equal_to<KeyType>>
-	class TOrderedMap : private TRedBlackTree<TPair<KeyType, ValueType>, Predicate>
+	/*
+	* Iterator over the Key - Value pairs of an ordered map, in key order.
+	* Wraps the tree iterator and dereferences to the pair stored in the node / entry.
+	*
+	* @tparam InNodeIterator - Iterator of the tree, its elements hold the pair in a Value member.
+	* @tparam PairType - TPair<K, V>, const for const iteration.
+	*/
+	template<typename InNodeIterator, typename PairType>
+	class TOrderedMapIterator
+	{
+	public:
+		using NodeIterator = InNodeIterator;
+
+		/*
+		* Default constructor for TOrderedMapIterator.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator() noexcept
+		{
+		}
+
+		/*
+		* Constructor for TOrderedMapIterator.
+		*
+		* @param InIt - Tree iterator to wrap.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator(NodeIterator InIt) noexcept
+			: It(InIt)
+		{
+		}
+
+		/*
+		* Dereferencing operator to get the pair at the iterator.
+		*
+		* @returns Reference to the pair at the iterator.
+		*/
+		FORCEINLINE constexpr PairType& operator*() const noexcept
+		{
+			return It->Value;
+		}
+
+		/*
+		* Member access operator to access Key / Value of the pair at the iterator.
+		*
+		* @returns Pointer to the pair at the iterator.
+		*/
+		FORCEINLINE constexpr PairType* operator->() const noexcept
+		{
+			return &It->Value;
+		}
+
+		/*
+		* Pre-increment operator: Moves to the pair with the next greater key.
+		*
+		* @returns Reference to the updated iterator.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator& operator++() noexcept
+		{
+			++It;
+			return *this;
+		}
+
+		/*
+		* Post-increment operator: Moves to the pair with the next greater key and returns the iterator before the increment.
+		*
+		* @returns Copy of the current iterator before increment.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator operator++(int) noexcept
+		{
+			TOrderedMapIterator Temp = *this;
+			++It;
+			return Temp;
+		}
+
+		/*
+		* Pre-decrement operator: Moves to the pair with the next lesser key.
+		*
+		* @returns Reference to the updated iterator.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator& operator--() noexcept
+		{
+			--It;
+			return *this;
+		}
+
+		/*
+		* Post-decrement operator: Moves to the pair with the next lesser key and returns the iterator before the decrement.
+		*
+		* @returns Copy of the current iterator before decrement.
+		*/
+		FORCEINLINE constexpr TOrderedMapIterator operator--(int) noexcept
+		{
+			TOrderedMapIterator Temp = *this;
+			--It;
+			return Temp;
+		}
+
+		FORCEINLINE constexpr bool operator==(const TOrderedMapIterator& Other) const noexcept		{ return It == Other.It; }
+		FORCEINLINE constexpr bool operator!=(const TOrderedMapIterator& Other) const noexcept		{ return It != Other.It; }
+
+		/*
+		* @returns The wrapped tree iterator.
+		*/
+		FORCEINLINE constexpr NodeIterator GetNodeIterator() const noexcept
+		{
+			return It;
+		}
+
+	private:
+		/*
+		* Wrapped tree iterator.
+		*/
+		NodeIterator It;
+	};
+
+	/*
+	* Key - Value map interface shared by the ordered maps, iteration visits the pairs in key order.
+	* Elements are TPair<KeyType, ValueType>, iterate with "for (auto& Pair : Map)" and use Pair.Key / Pair.Value.
+	* NOTE: Never change the Key of an element through an iterator.
+	*
+	* @tparam TreeType - Ordered tree of TPair<KeyType, ValueType> keyed with TPairKeyFuncs (TRedBlackTree, TBTreeSet).
+	* @tparam KeyType - Type of the keys.
+	* @tparam ValueType - Type of the values.
+	*/
+	template<typename TreeType, typename KeyType, typename ValueType>
+	class TOrderedMapBase : protected TreeType
+	{
+	protected:
+		using Super = TreeType;
+
+	public:
+		using ElementType = TPair<KeyType, ValueType>;
+		using Iterator = TOrderedMapIterator<typename Super::Iterator, ElementType>;
+		using ConstIterator = TOrderedMapIterator<typename Super::ConstIterator, const ElementType>;
+
+		/*
+		* Default constructor for TOrderedMapBase.
+		*/
+		FORCEINLINE TOrderedMapBase() noexcept
+		{
+		}
+
+		/*
+		* Constructor from a list of pairs, later duplicates overwrite earlier ones.
+		*
+		* @param InitList - Key - Value pairs to add.
+		*/
+		FORCEINLINE TOrderedMapBase(const std::initializer_list<ElementType>& InitList) noexcept
+		{
+			for (const ElementType& Element : InitList)
+			{
+				Add(Element.Key, Element.Value);
+			}
+		}
+
+		/*
+		* Adds a Key - Value pair, overwriting the value if the key is already in the map.
+		*
+		* @param Key - Key to add.
+		* @param Value - Value for the key.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		FORCEINLINE ValueType& Add(const KeyType& Key, const ValueType& Value) noexcept		{ return AddImpl(Key, Value); }
+		FORCEINLINE ValueType& Add(const KeyType& Key, ValueType&& Value) noexcept			{ return AddImpl(Key, Move(Value)); }
+		FORCEINLINE ValueType& Add(KeyType&& Key, const ValueType& Value) noexcept			{ return AddImpl(Move(Key), Value); }
+		FORCEINLINE ValueType& Add(KeyType&& Key, ValueType&& Value) noexcept				{ return AddImpl(Move(Key), Move(Value)); }
+
+		/*
+		* Constructs a value from Args for a key that isn't in the map yet.
+		* If the key is already in the map nothing is constructed and the existing value is kept.
+		*
+		* @param Key - Key to add.
+		* @param Args - Arguments for the value's constructor.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE ValueType& Emplace(const KeyType& Key, ArgsType&&... Args) noexcept
+		{
+			return EmplaceImpl(Key, Forward<ArgsType>(Args)...);
+		}
+
+		template<typename... ArgsType>
+		FORCEINLINE ValueType& Emplace(KeyType&& Key, ArgsType&&... Args) noexcept
+		{
+			return EmplaceImpl(Move(Key), Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Finds the value of a key, adding a default constructed value if the key isn't in the map.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Reference to the value in the map.
+		*/
+		FORCEINLINE ValueType& FindOrAdd(const KeyType& Key) noexcept		{ return EmplaceImpl(Key); }
+		FORCEINLINE ValueType& FindOrAdd(KeyType&& Key) noexcept			{ return EmplaceImpl(Move(Key)); }
+
+		FORCEINLINE ValueType& operator[](const KeyType& Key) noexcept		{ return EmplaceImpl(Key); }
+		FORCEINLINE ValueType& operator[](KeyType&& Key) noexcept			{ return EmplaceImpl(Move(Key)); }
+
+		/*
+		* Finds the pair of a key.
+		*
+		* @param Key - Key to look for, any type the predicate can compare with KeyType.
+		*
+		* @returns Iterator to the pair or end() if the key isn't in the map.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator Find(const K& Key) noexcept						{ return Iterator(Super::Find(Key)); }
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator Find(const K& Key) const noexcept			{ return ConstIterator(Super::Find(Key)); }
+
+		/*
+		* Finds the value of a key.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns Pointer to the value or nullptr if the key isn't in the map.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE ValueType* FindValue(const K& Key) noexcept
+		{
+			auto* Node = this->FindNode(Key);
+			return Node != nullptr ? &Node->Value.Value : nullptr;
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE const ValueType* FindValue(const K& Key) const noexcept
+		{
+			const auto* Node = this->FindNode(Key);
+			return Node != nullptr ? &Node->Value.Value : nullptr;
+		}
+
+		/*
+		* Checks if a key is in the map.
+		*
+		* @param Key - Key to look for.
+		*
+		* @returns true if the key is in the map.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE bool Contains(const K& Key) const noexcept
+		{
+			return this->FindNode(Key) != nullptr;
+		}
+
+		/*
+		* Finds the first pair whose key is not less than Key.
+		* Iterating from LowerBound(A) to UpperBound(B) visits every pair with a key in [A, B].
+		*
+		* @param Key - Key to compare with.
+		*
+		* @returns Iterator to the pair or end() if every key is less than Key.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator LowerBound(const K& Key) noexcept				{ return Iterator(Super::LowerBound(Key)); }
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator LowerBound(const K& Key) const noexcept	{ return ConstIterator(Super::LowerBound(Key)); }
+
+		/*
+		* Finds the first pair whose key is greater than Key.
+		*
+		* @param Key - Key to compare with.
+		*
+		* @returns Iterator to the pair or end() if no key is greater than Key.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE Iterator UpperBound(const K& Key) noexcept				{ return Iterator(Super::UpperBound(Key)); }
+		template<typename K = KeyType>
+		FORCEINLINE ConstIterator UpperBound(const K& Key) const noexcept	{ return ConstIterator(Super::UpperBound(Key)); }
+
+		/*
+		* Removes the pair of a key.
+		*
+		* @param Key - Key to remove.
+		*
+		* @returns true if the key was in the map and has been removed.
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE bool Remove(const K& Key) noexcept
+		{
+			return Super::Remove(Key);
+		}
+
+		/*
+		* Removes the pair an iterator points at.
+		*
+		* @param It - Iterator to a pair in the map.
+		*
+		* @returns Iterator to the pair with the next greater key.
+		*/
+		FORCEINLINE Iterator Remove(Iterator It) noexcept
+		{
+			return Iterator(Super::Remove(It.GetNodeIterator()));
+		}
+
+		using Super::Num;
+		using Super::IsEmpty;
+		using Super::Clear;
+
+		// Functions for Map Iteration
+		FORCEINLINE Iterator			begin()				{ return Iterator(Super::begin()); }
+		FORCEINLINE ConstIterator		begin() const		{ return ConstIterator(Super::begin()); }
+		FORCEINLINE Iterator			end()				{ return Iterator(Super::end()); }
+		FORCEINLINE ConstIterator		end() const			{ return ConstIterator(Super::end()); }
+
+	private:
+		template<typename InKeyType, typename InValueType>
+		FORCEINLINE ValueType& AddImpl(InKeyType&& Key, InValueType&& Value) noexcept
+		{
+			typename Super::FInsertPosition Position = this->FindInsertPosition(Key);
+			if (Position.Existing != nullptr)
+			{
+				Position.Existing->Value.Value = Forward<InValueType>(Value);
+				return Position.Existing->Value.Value;
+			}
+			return this->InsertAtPosition(Position, Forward<InKeyType>(Key), Forward<InValueType>(Value))->Value.Value;
+		}
+
+		template<typename InKeyType, typename... ArgsType>
+		FORCEINLINE ValueType& EmplaceImpl(InKeyType&& Key, ArgsType&&... Args) noexcept
+		{
+			typename Super::FInsertPosition Position = this->FindInsertPosition(Key);
+			if (Position.Existing != nullptr)
+			{
+				return Position.Existing->Value.Value;
+			}
+			return this->InsertAtPosition(Position, Forward<InKeyType>(Key), ValueType(Forward<ArgsType>(Args)...))->Value.Value;
+		}
+	};
+
+	/*
+	* Ordered Key - Value map on top of TRedBlackTree (see TOrderedMapBase).
+	* Unlike TMap, adding and removing elements never invalidates iterators or references to other elements.
+	*
+	* @tparam KeyType - Type of the keys.
+	* @tparam ValueType - Type of the values.
+	* @tparam Predicate - Strict weak ordering of the keys, two keys are equal when neither is less than the other.
+	*/
+	template<typename KeyType, typename ValueType, typename Predicate = std::less<KeyType>>
+	class TOrderedMap : public TOrderedMapBase<TRedBlackTree<TPair<KeyType, ValueType>, Predicate, TPairKeyFuncs<KeyType, ValueType>>, KeyType, ValueType>
 	{
-		using MapType = TPair<const KeyType, ValueType>;
+		using MapBase = TOrderedMapBase<TRedBlackTree<TPair<KeyType, ValueType>, Predicate, TPairKeyFuncs<KeyType, ValueType>>, KeyType, ValueType>;
 
+	public:
+		using MapBase::MapBase;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Array.h"
+
+/*
+* TQueue only compacts once at least this many consumed elements sit at the front of its storage.
+*/
+#define QUEUE_MIN_COMPACT_NUM 32
+
+namespace AAEngine {
+
+	/*
+	* First In First Out Queue for a single thread, elements are stored contiguously in a TArray.
+	* Enqueue appends to the back of the storage, Dequeue destroys the front element and moves a Head index forward. The consumed front is removed
+	* in one go once it's at least half of the storage, so both stay amortized O(1) and the storage is reused
+	* instead of reallocated while the Queue is drained and refilled (e.g. once per frame).
+	* NOTE: For handing elements between threads use TSpscRingBuffer / TMpmcQueue.
+	*
+	* @tparam T - Type of the elements.
+	* @tparam AllocatorType - Allocator policy the queue gets its memory from (see ContainerAllocators.h).
+	*/
+	template<typename T, typename AllocatorType = FHeapAllocator>
+	class AA_ENGINE_API TQueue
+	{
+	public:
+		/*
+		* Default constructor for TQueue.
+		*/
+		FORCEINLINE constexpr TQueue() noexcept
+			: Head(0)
+		{
+		}
+
+		/*
+		* Constructor for TQueue that reserves space.
+		*
+		* @param InitialCapacity - Number of elements that can be enqueued without reallocating.
+		*/
+		FORCEINLINE constexpr explicit TQueue(size_t InitialCapacity) noexcept
+			: InternalQueue(InitialCapacity), Head(0)
+		{
+		}
+
+		/*
+		* Copy constructor for TQueue, only copies the elements still in the Queue.
+		*
+		* @param Other - The Queue to copy from.
+		*/
+		FORCEINLINE constexpr TQueue(const TQueue& Other) noexcept
+			: Head(0)
+		{
+			InternalQueue.Append(Other.InternalQueue.Data() + Other.Head, Other.Num());
+		}
+
+		/*
+		* Move constructor for TQueue, takes the storage of Other and leaves it empty.
+		*
+		* @param Other - The Queue to move from.
+		*/
+		FORCEINLINE constexpr TQueue(TQueue&& Other) noexcept
+			: InternalQueue(Move(Other.PrepareMove())), Head(Other.Head)
+		{
+			Other.Head = 0;
+		}
+
+		/*
+		* Destructor for TQueue, destroys the elements still in the Queue.
+		*/
+		FORCEINLINE ~TQueue()
+		{
+			Clear();
+		}
+
+		/*
+		* Copy assignment operator for TQueue, only copies the elements still in the Queue.
+		*
+		* @param Other - The Queue to copy from.
+		*
+		* @returns Reference to this Queue.
+		*/
+		FORCEINLINE constexpr TQueue& operator=(const TQueue& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				InternalQueue.Append(Other.InternalQueue.Data() + Other.Head, Other.Num());
+			}
+			return *this;
+		}
+
+		/*
+		* Move assignment operator for TQueue, takes the storage of Other and leaves it empty.
+		*
+		* @param Other - The Queue to move from.
+		*
+		* @returns Reference to this Queue.
+		*/
+		FORCEINLINE constexpr TQueue& operator=(TQueue&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				InternalQueue = Move(Other.PrepareMove());
+				Head = Other.Head;
+				Other.Head = 0;
+			}
+			return *this;
+		}
+
+		/*
+		* Adds an element to the back of the Queue.
+		*
+		* @param Element - Element to add.
+		*/
+		FORCEINLINE constexpr void Enqueue(const T& Element) noexcept	{ PrepareGrowth(); InternalQueue.PushBack(Element); }
+		FORCEINLINE constexpr void Enqueue(T&& Element) noexcept		{ PrepareGrowth(); InternalQueue.PushBack(Move(Element)); }
+
+		/*
+		* Constructs an element at the back of the Queue.
+		*
+		* @param Args - Arguments for the element's constructor.
+		*
+		* @returns Reference to the new element.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE constexpr T& Emplace(ArgsType&&... Args) noexcept
+		{
+			PrepareGrowth();
+			return InternalQueue.EmplaceBack(Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Destroys the element at the front of the Queue.
+		*/
+		FORCEINLINE constexpr void Pop() noexcept
+		{
+			AA_CORE_ASSERT(!IsEmpty(), "Pop called on an empty Queue!");
+			DestructItems(&InternalQueue[Head], 1);
+			Head++;
+			Compact();
+		}
+
+		/*
+		* Moves the element at the front of the Queue into OutElement and removes it.
+		*
+		* @param OutElement - Set to the front element if there is one.
+		*
+		* @returns false if the Queue was empty.
+		*/
+		FORCEINLINE constexpr bool Dequeue(T& OutElement) noexcept
+		{
+			if (IsEmpty())
+			{
+				return false;
+			}
+			OutElement = Move(InternalQueue[Head]);
+			DestructItems(&InternalQueue[Head], 1);
+			Head++;
+			Compact();
+			return true;
+		}
+
+		/*
+		* @returns Reference to the front element (next to be dequeued), the Queue must not be empty.
+		*/
+		FORCEINLINE constexpr T& Peek() noexcept				{ return InternalQueue[Head]; }
+		FORCEINLINE constexpr const T& Peek() const noexcept	{ return InternalQueue[Head]; }
+
+		/*
+		* @returns Number of elements in the Queue.
+		*/
+		FORCEINLINE constexpr size_t Num() const noexcept		{ return InternalQueue.Num() - Head; }
+
+		/*
+		* @returns true if the Queue has no elements.
+		*/
+		FORCEINLINE constexpr bool IsEmpty() const noexcept		{ return Head == InternalQueue.Num(); }
+
+		/*
+		* Reserves memory for at least NewCapacity elements.
+		*
+		* @param NewCapacity - The new capacity to reserve.
+		*/
+		FORCEINLINE constexpr void Reserve(size_t NewCapacity) noexcept
+		{
+			if (Head + NewCapacity > InternalQueue.GetCapacity())
+			{
+				DropConsumed();
+			}
+			InternalQueue.Reserve(NewCapacity);
+		}
+
+		/*
+		* Destroys every element, keeps the memory.
+		*/
+		FORCEINLINE constexpr void Clear() noexcept
+		{
+			DestructItems(InternalQueue.Data() + Head, Num());
+			InternalQueue.RemoveAtUninitialized(0, InternalQueue.Num());
+			Head = 0;
+		}
+
+	private:
+		/*
+		* An inline allocator makes TArray move the elements one by one, the destroyed slots in front of Head must go first.
+		*
+		* @returns The storage to move from.
+		*/
+		FORCEINLINE constexpr TArray<T, AllocatorType>& PrepareMove() noexcept
+		{
+			if constexpr (!std::is_copy_constructible<typename AllocatorType::template TForElementType<T>>::value)
+			{
+				DropConsumed();
+			}
+			return InternalQueue;
+		}
+
+		/*
+		* Drops the consumed (already destroyed) slots in front of Head once there are enough of them.
+		*/
+		FORCEINLINE constexpr void Compact() noexcept
+		{
+			if (Head == InternalQueue.Num() || (Head >= QUEUE_MIN_COMPACT_NUM && Head * 2 >= InternalQueue.Num()))
+			{
+				DropConsumed();
+			}
+		}
+
+		/*
+		* Growing the storage relocates all of it, the destroyed slots in front of Head must go first.
+		*/
+		FORCEINLINE constexpr void PrepareGrowth() noexcept
+		{
+			if (Head > 0 && InternalQueue.Num() == InternalQueue.GetCapacity())
+			{
+				DropConsumed();
+			}
+		}
+
+		/*
+		* Removes the destroyed slots in front of Head from the storage, without destroying them again.
+		*/
+		FORCEINLINE constexpr void DropConsumed() noexcept
+		{
+			InternalQueue.RemoveAtUninitialized(0, Head);
+			Head = 0;
+		}
+
+	private:
+		/*
+		* Storage of the Queue, [0, Head) are destroyed slots of dequeued elements, [Head, Num) the elements in the Queue.
+		*/
+		TArray<T, AllocatorType> InternalQueue;
+
+		/*
+		* Index of the front element in InternalQueue.
+		*/
+		size_t Head;
+	};
+}
@@ -2,6 +2,9 @@
 
 #include "Core/Core.h"
 #include "Math/Math.h"
+#include "Templates/AATemplates.h"
+#include "Memory/FixedBlockPool.h"
+#include "KeyValuePair.h"
 
 #include <functional>
 
@@ -302,9 +305,8 @@ namespace AAEngine {
 		*/
 		template<typename... Args>
 		FORCEINLINE constexpr TRBNode(TRBNode<T>* InLeft, TRBNode<T>* InRight, TRBNode<T>* InParent, bool bInIsBlack, Args&&... InArgs) noexcept
-			: Left(InLeft), Right(InRight), Parent(InParent), bIsBlack(bInIsBlack)
+			: Parent(InParent), Left(InLeft), Right(InRight), Value(Forward<Args>(InArgs)...), bIsBlack(bInIsBlack)
 		{
-			new(&Value) T(Forward<Args>(InArgs)...);
 		}
 
 		/*
@@ -313,12 +315,8 @@ namespace AAEngine {
 		* @param Other - const L Value ref to the Other Node
 		*/
 		FORCEINLINE constexpr TRBNode(const TRBNode& Other) noexcept
+			: Parent(Other.Parent), Left(Other.Left), Right(Other.Right), Value(Other.Value), bIsBlack(Other.bIsBlack)
 		{
-			new(&Value) T(Other.Value);
-			Left = Other.Left;
-			Right = Other.Right;
-			Parent = Other.Parent;
-			bIsBlack = Other.bIsBlack;
 		}
 
 		/*
@@ -327,12 +325,8 @@ namespace AAEngine {
 		* @param Other - R Value ref to the Other Node
 		*/
 		FORCEINLINE constexpr TRBNode(TRBNode&& Other) noexcept
+			: Parent(Other.Parent), Left(Other.Left), Right(Other.Right), Value(Move(Other.Value)), bIsBlack(Other.bIsBlack)
 		{
-			new(&Value) T(Move(Other.Value));
-			Left = Other.Left;
-			Right = Other.Right;
-			Parent = Other.Parent;
-			bIsBlack = Other.bIsBlack;
 		}
 
 		/*
@@ -342,7 +336,7 @@ namespace AAEngine {
 		*/
 		FORCEINLINE constexpr TRBNode& operator=(const TRBNode& Other) noexcept
 		{
-			new(&Value) T(Other.Value);
+			Value = Other.Value;
 			Left = Other.Left;
 			Right = Other.Right;
 			Parent = Other.Parent;
@@ -357,7 +351,7 @@ namespace AAEngine {
 		*/
 		FORCEINLINE constexpr TRBNode& operator=(TRBNode&& Other) noexcept
 		{
-			new(&Value) T(Move(Other.Value));
+			Value = Move(Other.Value);
 			Left = Other.Left;
 			Right = Other.Right;
 			Parent = Other.Parent;
@@ -410,15 +404,14 @@ namespace AAEngine {
 		*
 		* @tparam Args - Variadic Arguments used to construct the Value inplace
 		*
+		* @param EmplaceTo - Set to the New Node
 		* @param Left - Pointer to the Left node for the New Node
 		* @param Right - Pointer to the Right node for the New Node
 		* @param Parent - Pointer to the Parent node for the New Node
 		* @param Val - Variadic Arguments used to construct the Value inplace
-		*
-		* @returns Pointer to the New Node
 		*/
 		template<typename... Args>
-		FORCEINLINE constexpr static void EmplaceNewNode(TRBNode<T>* EmplaceTo, TRBNode<T>* Left, TRBNode<T>* Right, TRBNode<T>* Parent, bool bIsBlack, Args&&... Val) noexcept
+		FORCEINLINE constexpr static void EmplaceNewNode(TRBNode<T>*& EmplaceTo, TRBNode<T>* Left, TRBNode<T>* Right, TRBNode<T>* Parent, bool bIsBlack, Args&&... Val) noexcept
 		{
 			EmplaceTo = (TRBNode<T>*)::operator new(sizeof(TRBNode<T>));
 			new(EmplaceTo) TRBNode<T>(Left, Right, Parent, bIsBlack, Forward<Args>(Val)...);
@@ -451,11 +444,16 @@ namespace AAEngine {
 		bool bIsNil = false;
 	};
 
+
 	/*
 	* Templated class for representing a Red Black Tree
 	*
 	* @tparam - T - Type of the Values stored in the Red Black Tree.
-	* @tparam - Predicate - The way for compare 2 values
+	* @tparam - Predicate - The way for compare 2 keys
+	* @tparam - KeyFuncs - Which part of a Value is its key (see KeyValuePair.h), the whole Value by default.
+	* 
+	* Nodes are allocated from a CFixedBlockPool owned by the tree, so they sit next to each other in memory
+	* and inserting / removing never goes to the global heap once the pool has warmed up.
 	* 
 	* Red Black Tree Rules
 	* 1) Nodes are Red or Black
@@ -466,6 +464,7 @@ namespace AAEngine {
 	* Additional notes:
 	* 1) Shortest Path => All Black
 	*	 Longest Path => Alternate between red and black
+	* 2) Every leaf points to the tree's single Nil node, the Root's Parent is nullptr.
 	* 
 	* Left Rotation						      |  Right Rotation					
 	* - Rotating Node - P				      |  - Rotating Node - P			
@@ -482,122 +481,224 @@ namespace AAEngine {
 	* - Insert and Color Red and then
 	*	1) Z is root						=> Color Z Black
 	*	2) Z's Uncle is Red					=> Recolor Z's Parent = Black, GrandParent = Red, Uncle = Black
-	*	3) Z's Uncle is Black (Triangle)	=> Rotate Z's GrandParent.	(Z's Parent = Left then Right Rotate and vice-versa)
+	*	3) Z's Uncle is Black (Triangle)	=> Rotate Z's Parent to form a Line.	(Z = Right Child then Left Rotate and vice-versa)
 	*	4) Z's Uncle is Black (Line)		=> Rotate Z's GrandParent and recolor Parent = Black and GrandParent = Red.	(Z's Parent = Left then Right Rotate and vice-versa)
 	*/
-	template<typename T, typename Predicate = std::less<T>>
+	template<typename T, typename Predicate = std::less<T>, typename KeyFuncs = TIdentityKeyFuncs<T>>
 	class TRedBlackTree
 	{
-	private:
+#define RB_NODES_PER_CHUNK 128
+		static_assert(alignof(TRBNode<T>) <= 16, "Red Black Tree nodes can't be aligned to more than 16 bytes!");
+
 	public:
+		using KeyType = typename KeyFuncs::KeyType;
+		using NodeType = TRBNode<T>;
+
+		// Const and Non-Const Iterators
+		using Iterator = TRedBlackIterator<TRBNode<T>>;
+		using ConstIterator = TRedBlackIterator<const TRBNode<T>>;
+
 		/*
 		* Default constructor initializes Root to nullptr => No Elements
+		* The node pool is only created with the first insertion.
 		*/
 		FORCEINLINE constexpr TRedBlackTree() noexcept
-			: Root(nullptr)
+			: Root(nullptr), Nil(nullptr), NodePool(nullptr), Size(0)
 		{
-			Nil = TRBNode<T>::MakeNewNode(T(), nullptr, nullptr, nullptr, true);
-			Nil->bIsNil = true;
 		}
 
 		/*
-		* Copy Constructor initializes Root to Other.Root
+		* Copy Constructor copies every node and the Predicate of Other
 		*
 		* @param Other - const L Value ref to Other RBTree
 		*/
-		FORCEINLINE constexpr TRedBlackTree(const TRedBlackTree& Other) noexcept
-			: Root(Other.Root)
+		FORCEINLINE TRedBlackTree(const TRedBlackTree& Other) noexcept
+			: Root(nullptr), Nil(nullptr), NodePool(nullptr), Size(0), Pred(Other.Pred)
 		{
+			CopyTree(Other);
 		}
 
 		/*
-		* Move Constructor initializes Root to Other.Root
+		* Move Constructor takes the nodes and node pool of Other, leaving it empty, and copies its Predicate
 		*
 		* @param Other - R Value ref to Other RBTree
 		*/
-		FORCEINLINE constexpr TRedBlackTree(TRedBlackTree&& Other) noexcept
-			: Root(Move(Other.Root))
+		FORCEINLINE TRedBlackTree(TRedBlackTree&& Other) noexcept
+			: Root(nullptr), Nil(nullptr), NodePool(nullptr), Size(0), Pred(Other.Pred)
 		{
+			StealTree(Other);
 		}
 
 		/*
-		* Copy Assignment Operator initializes Root to Other.Root
+		* Copy Assignment Operator copies every node and the Predicate of Other
 		*
 		* @param Other - const L Value ref to Other RBTree
 		*/
-		FORCEINLINE constexpr TRedBlackTree& operator=(const TRedBlackTree& Other) noexcept
+		FORCEINLINE TRedBlackTree& operator=(const TRedBlackTree& Other) noexcept
 		{
-			Root = Other.Root;
+			if (this != &Other)
+			{
+				Clear();
+				Pred = Other.Pred;
+				CopyTree(Other);
+			}
 			return *this;
 		}
 
 		/*
-		* Move Assignment Operator initializes Root to Other.Root
+		* Move Assignment Operator takes the nodes and node pool of Other, leaving it empty, and copies its Predicate
 		*
 		* @param Other - R Value ref to Other RBTree
 		*/
-		FORCEINLINE constexpr TRedBlackTree& operator=(TRedBlackTree&& Other) noexcept
+		FORCEINLINE TRedBlackTree& operator=(TRedBlackTree&& Other) noexcept
 		{
-			Root = Move(Other.Root);
+			if (this != &Other)
+			{
+				FreeTree();
+				Pred = Other.Pred;
+				StealTree(Other);
+			}
 			return *this;
 		}
 
 		/*
-		* Inserts a node into the Red Black Tree
+		* Destructor that frees memory from the Red Black Tree and sets the Root to nullptr
+		*/
+		FORCEINLINE ~TRedBlackTree()
+		{
+			FreeTree();
+		}
+
+		/*
+		* Inserts a node into the Red Black Tree, does nothing if a Value with the same key exists
 		*
 		* @param NewVal - const L Value Ref to the Value to be inserted into the RBTree
 		*/
 		FORCEINLINE constexpr void Insert(const T& NewVal) noexcept
 		{
-			TRBNode<T>* InsertedNode = InsertHelper(Root, NewVal);
-			if (InsertedNode != nullptr)
+			FInsertPosition Position = FindInsertPosition(KeyFuncs::GetKey(NewVal));
+			if (Position.Existing == nullptr)
 			{
-				InsertedNode->Left = Nil;
-				InsertedNode->Right = Nil;
-				FixInsertions(InsertedNode);
+				InsertAtPosition(Position, NewVal);
 			}
 		}
 
 		/*
-		* Inserts a node into the Red Black Tree
+		* Inserts a node into the Red Black Tree, does nothing if a Value with the same key exists
 		*
 		* @param NewVal - R Value Ref to the Value to be inserted into the RBTree
 		*/
 		FORCEINLINE constexpr void Insert(T&& NewVal) noexcept
 		{
-			TRBNode<T>* InsertedNode = InsertHelper(Root, Move(NewVal));
-			if (InsertedNode != nullptr)
+			FInsertPosition Position = FindInsertPosition(KeyFuncs::GetKey(NewVal));
+			if (Position.Existing == nullptr)
 			{
-				InsertedNode->Left = Nil;
-				InsertedNode->Right = Nil;
-				FixInsertions(InsertedNode);
+				InsertAtPosition(Position, Move(NewVal));
 			}
 		}
 
 		/*
 		* Removes a node from the Red Black Tree
 		*
-		* @param NewVal - const L Value Ref to the Value to be removed from the RBTree
+		* @param Key - Key of the Value to be removed from the RBTree
 		*
-		* @returns true if Node with NewVal has been removed, false if Node doesn't exist and hasn't been removed
-		* TO DO: Add Remove with Move Value (R Value Ref)??
+		* @returns true if Node with Key has been removed, false if Node doesn't exist and hasn't been removed
 		*/
-		FORCEINLINE constexpr bool Remove(const T& NewVal) noexcept
+		template<typename K = KeyType>
+		FORCEINLINE constexpr bool Remove(const K& Key) noexcept
 		{
-			return RemoveHelper(Root, NewVal);
+			TRBNode<T>* Node = FindNode(Key);
+			if (Node == nullptr)
+			{
+				return false;
+			}
+			RemoveNode(Node);
+			return true;
+		}
+
+		/*
+		* Removes the node an iterator points at
+		*
+		* @param It - Iterator to a valid node
+		*
+		* @returns Iterator to the next node
+		*/
+		FORCEINLINE constexpr Iterator Remove(Iterator It) noexcept
+		{
+			Iterator Next = It;
+			++Next;
+			RemoveNode(It.Get());
+			return Next;
 		}
 
 		/*
 		* Searches a node into the Red Black Tree
 		*
-		* @param NewVal - const L Value Ref to the Value to be inserted into the RBTree
+		* @param Key - Key of the Value to be searched for in the RBTree
+		*
+		* @returns true if Node of Key exists, false otherwise
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE constexpr bool Search(const K& Key) const noexcept
+		{
+			return FindNode(Key) != nullptr;
+		}
+
+		/*
+		* Finds the node with the given key
+		*
+		* @param Key - Key to look for
+		*
+		* @returns Iterator to the node or end() if there is none
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE constexpr Iterator Find(const K& Key) noexcept
+		{
+			return Iterator(FindNode(Key));
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE constexpr ConstIterator Find(const K& Key) const noexcept
+		{
+			return ConstIterator(FindNode(Key));
+		}
+
+		/*
+		* Finds the first node whose key is not less than Key
 		*
-		* @returns true if Node of NewVal exists, false otherwise
-		* TO DO: Add Search with Move Value (R Value Ref)??
+		* @param Key - Key to compare with
+		*
+		* @returns Iterator to the node or end() if every key is less than Key
 		*/
-		FORCEINLINE constexpr bool Search(const T& NewVal) noexcept
+		template<typename K = KeyType>
+		FORCEINLINE constexpr Iterator LowerBound(const K& Key) noexcept
+		{
+			return Iterator(LowerBoundNode(Key));
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE constexpr ConstIterator LowerBound(const K& Key) const noexcept
 		{
-			return SearchHelper(Root, NewVal);
+			return ConstIterator(LowerBoundNode(Key));
+		}
+
+		/*
+		* Finds the first node whose key is greater than Key
+		*
+		* @param Key - Key to compare with
+		*
+		* @returns Iterator to the node or end() if no key is greater than Key
+		*/
+		template<typename K = KeyType>
+		FORCEINLINE constexpr Iterator UpperBound(const K& Key) noexcept
+		{
+			return Iterator(UpperBoundNode(Key));
+		}
+
+		template<typename K = KeyType>
+		FORCEINLINE constexpr ConstIterator UpperBound(const K& Key) const noexcept
+		{
+			return ConstIterator(UpperBoundNode(Key));
 		}
 
 		/*
@@ -607,12 +708,17 @@ namespace AAEngine {
 		*/
 		FORCEINLINE constexpr size_t Num() const noexcept
 		{
-			size_t Count = 0;
-			for (const auto& Node : *this)
-			{
-				Count++;
-			}
-			return Count;
+			return Size;
+		}
+
+		/*
+		* Checks if the Red Black Tree has no nodes
+		*
+		* @returns true if the tree is empty
+		*/
+		FORCEINLINE constexpr bool IsEmpty() const noexcept
+		{
+			return Size == 0;
 		}
 
 		/*
@@ -662,158 +768,342 @@ namespace AAEngine {
 		}
 
 		/*
-		* Destructor that frees memory from the Red Black Tree and sets the Root to nullptr
+		* Clear Function that destroys every node and sets the Root to nullptr
+		* The node pool is kept so the tree can be refilled without allocating.
 		*/
-		FORCEINLINE ~TRedBlackTree()
+		FORCEINLINE constexpr void Clear() noexcept
 		{
 			FreeRBTreeHelper(Root);
-			delete Nil;
 			Root = nullptr;
-			Nil = nullptr;
+			Size = 0;
 		}
 
+	protected:
 		/*
-		* Clear Function that frees memory from the Red Black Tree and sets the Root to nullptr
+		* Where a new key goes in the tree, result of FindInsertPosition
 		*/
-		FORCEINLINE constexpr void Clear() noexcept
+		struct FInsertPosition
 		{
-			FreeRBTreeHelper(Root);
-			delete Nil;
-			Root = nullptr;
-			Nil = nullptr;
+			/*
+			* Node that already has the key, nullptr if the key is new
+			*/
+			TRBNode<T>* Existing;
+			/*
+			* Node the new node is attached to, nullptr if the tree is empty
+			*/
+			TRBNode<T>* Parent;
+			/*
+			* Whether the new node becomes the Left or Right child of Parent
+			*/
+			bool bIsLeft;
+		};
+
+		/*
+		* Walks down the tree to find where a key is or would be inserted
+		*
+		* @param Key - Key to look for
+		*
+		* @returns The existing node with the key, or the position for a new node
+		*/
+		template<typename K>
+		FORCEINLINE constexpr FInsertPosition FindInsertPosition(const K& Key) const noexcept
+		{
+			FInsertPosition Position{ nullptr, nullptr, false };
+			TRBNode<T>* Current = Root;
+			while (Current != nullptr && !Current->bIsNil)
+			{
+				Position.Parent = Current;
+				if (Pred(Key, KeyFuncs::GetKey(Current->Value)))
+				{
+					Position.bIsLeft = true;
+					Current = Current->Left;
+				}
+				else if (Pred(KeyFuncs::GetKey(Current->Value), Key))
+				{
+					Position.bIsLeft = false;
+					Current = Current->Right;
+				}
+				else
+				{
+					Position.Existing = Current;
+					return Position;
+				}
+			}
+			return Position;
 		}
 
-	private:
 		/*
-		* Height Helper that gets the height of the Red Black Tree recursively
+		* Constructs a new node at a position returned by FindInsertPosition and rebalances the tree
 		*
-		* @param Current - Currently looked at node to perform Height getting opertation
-		* @return Height of the Red Black Tree
+		* @param Position - Position for the new node, must not have an Existing node
+		* @param Args - Arguments to construct the Value inplace
+		*
+		* @returns The new node
 		*/
-		FORCEINLINE constexpr size_t HeightHelper(TRBNode<T>* Current) noexcept
+		template<typename... Args>
+		FORCEINLINE constexpr TRBNode<T>* InsertAtPosition(const FInsertPosition& Position, Args&&... InArgs) noexcept
 		{
-			if (Current == nullptr)
+			if (NodePool == nullptr)
 			{
-				return 0;
+				CreateNodePool();
 			}
 
-			size_t LeftHeight = 0, RightHeight = 0;
-			if (Current->Left != nullptr && !Current->Left->bIsNil)
+			TRBNode<T>* NewNode = new(NodePool->Allocate()) TRBNode<T>(Nil, Nil, Position.Parent, false, Forward<Args>(InArgs)...);
+			if (Position.Parent == nullptr)
+			{
+				Root = NewNode;
+			}
+			else if (Position.bIsLeft)
 			{
-				LeftHeight = HeightHelper(Current->Left);
+				Position.Parent->Left = NewNode;
 			}
-			if (Current->Right != nullptr && !Current->Right->bIsNil)
+			else
 			{
-				RightHeight = HeightHelper(Current->Right);
+				Position.Parent->Right = NewNode;
 			}
 
-			return FMath::Max(LeftHeight, RightHeight) + 1;
+			Size++;
+			FixInsertions(NewNode);
+			return NewNode;
 		}
 
 		/*
-		* Insert Helper that Inserts a node into the Red Black Tree recursively
+		* Finds the node with the given key
 		*
-		* @param Current - Currently looked at node to perform insertion
-		* @param NewVal - const L Value Ref to the Value to be inserted into the RBTree
-		* 
-		* @returns Inserted Node for fixing and balancing the tree.
+		* @param Key - Key to look for
+		*
+		* @returns The node or nullptr if there is none
 		*/
-		FORCEINLINE constexpr TRBNode<T>* InsertHelper(TRBNode<T>* Current, const T& NewVal) noexcept
+		template<typename K>
+		FORCEINLINE constexpr TRBNode<T>* FindNode(const K& Key) const noexcept
 		{
-			if (Current == Root)
+			TRBNode<T>* Current = Root;
+			while (Current != nullptr && !Current->bIsNil)
 			{
-				// If Tree is empty insert at root.
-				if (Root == nullptr)
+				if (Pred(Key, KeyFuncs::GetKey(Current->Value)))
 				{
-					Root = TRBNode<T>::MakeNewNode(NewVal);
-					return Root;
+					Current = Current->Left;
+				}
+				else if (Pred(KeyFuncs::GetKey(Current->Value), Key))
+				{
+					Current = Current->Right;
+				}
+				else
+				{
+					return Current;
 				}
 			}
+			return nullptr;
+		}
 
-			if (NewVal == Current->Value)
-			{
-				// Dont insert value
-				return nullptr;
-			}
-			else if (Pred(NewVal, Current->Value))
+		/*
+		* @returns The first node whose key is not less than Key, nullptr if there is none
+		*/
+		template<typename K>
+		FORCEINLINE constexpr TRBNode<T>* LowerBoundNode(const K& Key) const noexcept
+		{
+			TRBNode<T>* Result = nullptr;
+			TRBNode<T>* Current = Root;
+			while (Current != nullptr && !Current->bIsNil)
 			{
-				// Look to the Left
-				if (Current->Left == nullptr || Current->Left->bIsNil)
+				if (!Pred(KeyFuncs::GetKey(Current->Value), Key))
 				{
-					Current->Left = TRBNode<T>::MakeNewNode(NewVal, nullptr, nullptr, Current);
-					return Current->Left;
+					Result = Current;
+					Current = Current->Left;
 				}
 				else
 				{
-					return InsertHelper(Current->Left, NewVal);
+					Current = Current->Right;
 				}
 			}
-			else if (Pred(Current->Value, NewVal))
+			return Result;
+		}
+
+		/*
+		* @returns The first node whose key is greater than Key, nullptr if there is none
+		*/
+		template<typename K>
+		FORCEINLINE constexpr TRBNode<T>* UpperBoundNode(const K& Key) const noexcept
+		{
+			TRBNode<T>* Result = nullptr;
+			TRBNode<T>* Current = Root;
+			while (Current != nullptr && !Current->bIsNil)
 			{
-				// Look to the Right
-				if (Current->Right == nullptr || Current->Right->bIsNil)
+				if (Pred(Key, KeyFuncs::GetKey(Current->Value)))
 				{
-					Current->Right = TRBNode<T>::MakeNewNode(NewVal, nullptr, nullptr, Current);
-					return Current->Right;
+					Result = Current;
+					Current = Current->Left;
 				}
 				else
 				{
-					return InsertHelper(Current->Right, NewVal);
+					Current = Current->Right;
 				}
 			}
-			return nullptr;
+			return Result;
 		}
 
 		/*
-		* Insert Helper that Inserts a node into the Red Black Tree recursively
+		* Unlinks a node from the tree, rebalances it and gives the node back to the pool
+		* Cases for Removal
+		* - Node has at most one child					=> Replace the Node with that child (or Nil)
+		* - Node has two children						=> Replace the Node with its successor (min of the Right subtree),
+		*												   the successor is replaced by its Right child.
+		* - If the node taken out of its place was Black => RemoveFixUp starting at the node that replaced it.
 		*
-		* @param Current - Currently looked at node to perform insertion
-		* @param NewVal - R Value Ref to the Value to be inserted into the RBTree
+		* @param Node - Node to remove
 		*/
-		FORCEINLINE constexpr TRBNode<T>* InsertHelper(TRBNode<T>* Current, T&& NewVal) noexcept
+		FORCEINLINE constexpr void RemoveNode(TRBNode<T>* Node) noexcept
 		{
-			if (Current == Root)
+			TRBNode<T>* FixUpNode = nullptr;
+			bool bRemovedBlack = Node->bIsBlack;
+
+			if (Node->Left->bIsNil)
 			{
-				// If Tree is empty insert at root.
-				if (Root == nullptr)
-				{
-					Root = TRBNode<T>::MakeNewNode(Move(NewVal));
-					return Root;
-				}
+				FixUpNode = Node->Right;
+				Transplant(Node, Node->Right);
 			}
-
-			if (NewVal == Current->Value)
+			else if (Node->Right->bIsNil)
 			{
-				// Dont insert value
-				return nullptr;
+				FixUpNode = Node->Left;
+				Transplant(Node, Node->Left);
 			}
-			else if (Pred(NewVal, Current->Value))
+			else
 			{
-				// Look to the Left
-				if (Current->Left == nullptr || Current->Left->bIsNil)
+				TRBNode<T>* Successor = FindMinInSubTree(Node->Right);
+				bRemovedBlack = Successor->bIsBlack;
+				FixUpNode = Successor->Right;
+
+				if (Successor->Parent == Node)
 				{
-					Current->Left = TRBNode<T>::MakeNewNode(Move(NewVal), nullptr, nullptr, Current);
-					return Current->Left;
+					// FixUpNode might be Nil, its Parent is needed by RemoveFixUp
+					FixUpNode->Parent = Successor;
 				}
 				else
 				{
-					return InsertHelper(Current->Left, Move(NewVal));
+					Transplant(Successor, Successor->Right);
+					Successor->Right = Node->Right;
+					Successor->Right->Parent = Successor;
 				}
+
+				Transplant(Node, Successor);
+				Successor->Left = Node->Left;
+				Successor->Left->Parent = Successor;
+				Successor->bIsBlack = Node->bIsBlack;
 			}
-			else if (Pred(Current->Value, NewVal))
+
+			if (bRemovedBlack)
 			{
-				// Look to the Right
-				if (Current->Right == nullptr || Current->Right->bIsNil)
-				{
-					Current->Right = TRBNode<T>::MakeNewNode(Move(NewVal), nullptr, nullptr, Current);
-					return Current->Right;
-				}
-				else
-				{
-					return InsertHelper(Current->Right, Move(NewVal));
-				}
+				RemoveFixUp(FixUpNode);
 			}
-			return nullptr;
+
+			if (Root->bIsNil)
+			{
+				Root = nullptr;
+			}
+			Nil->Parent = nullptr;
+
+			Node->~TRBNode<T>();
+			NodePool->Free(Node);
+			Size--;
+		}
+
+	private:
+		/*
+		* Creates the node pool and the Nil node
+		*/
+		FORCEINLINE void CreateNodePool() noexcept
+		{
+			NodePool = new CFixedBlockPool(sizeof(TRBNode<T>), RB_NODES_PER_CHUNK);
+
+			// The Nil node's Value is never constructed or read
+			Nil = (TRBNode<T>*)NodePool->Allocate();
+			Nil->Parent = nullptr;
+			Nil->Left = nullptr;
+			Nil->Right = nullptr;
+			Nil->bIsBlack = true;
+			Nil->bIsNil = true;
+		}
+
+		/*
+		* Destroys every node and frees the node pool
+		*/
+		FORCEINLINE void FreeTree() noexcept
+		{
+			FreeRBTreeHelper(Root);
+			delete NodePool;
+			Root = nullptr;
+			Nil = nullptr;
+			NodePool = nullptr;
+			Size = 0;
+		}
+
+		/*
+		* Takes the nodes and node pool of Other, this tree must be empty and own no pool
+		*/
+		FORCEINLINE void StealTree(TRedBlackTree& Other) noexcept
+		{
+			Root = Other.Root;
+			Nil = Other.Nil;
+			NodePool = Other.NodePool;
+			Size = Other.Size;
+
+			Other.Root = nullptr;
+			Other.Nil = nullptr;
+			Other.NodePool = nullptr;
+			Other.Size = 0;
+		}
+
+		/*
+		* Copies every node of Other into this empty tree, keeping Other's shape and colors
+		*/
+		FORCEINLINE void CopyTree(const TRedBlackTree& Other) noexcept
+		{
+			if (Other.Root == nullptr)
+			{
+				return;
+			}
+			if (NodePool == nullptr)
+			{
+				CreateNodePool();
+			}
+			Root = CopySubTree(Other.Root, nullptr);
+			Size = Other.Size;
+		}
+
+		/*
+		* Copies a subtree recursively
+		*
+		* @param OtherNode - Root of the subtree to copy
+		* @param Parent - Parent for the copied root
+		*
+		* @returns Copied subtree root
+		*/
+		TRBNode<T>* CopySubTree(const TRBNode<T>* OtherNode, TRBNode<T>* Parent) noexcept
+		{
+			if (OtherNode->bIsNil)
+			{
+				return Nil;
+			}
+			TRBNode<T>* NewNode = new(NodePool->Allocate()) TRBNode<T>(Nil, Nil, Parent, OtherNode->bIsBlack, OtherNode->Value);
+			NewNode->Left = CopySubTree(OtherNode->Left, NewNode);
+			NewNode->Right = CopySubTree(OtherNode->Right, NewNode);
+			return NewNode;
+		}
+
+		/*
+		* Height Helper that gets the height of the Red Black Tree recursively
+		*
+		* @param Current - Currently looked at node to perform Height getting opertation
+		* @return Height of the Red Black Tree
+		*/
+		FORCEINLINE constexpr size_t HeightHelper(TRBNode<T>* Current) const noexcept
+		{
+			if (Current == nullptr || Current->bIsNil)
+			{
+				return 0;
+			}
+
+			return Math::FMath::Max(HeightHelper(Current->Left), HeightHelper(Current->Right)) + 1;
 		}
 
 		/*
@@ -822,7 +1112,7 @@ namespace AAEngine {
 		* - If Parent is Red
 		*	1) Z is root						=> Color Z Black
 		*	2) Z's Uncle is Red					=> Recolor Z's Parent = Black, GrandParent = Red, Uncle = Black
-		*	3) Z's Uncle is Black (Triangle)	=> Rotate Z's GrandParent.	(Z's Parent = Left then Right Rotate and vice-versa)
+		*	3) Z's Uncle is Black (Triangle)	=> Rotate Z's Parent to form a Line.	(Z = Right Child then Left Rotate and vice-versa)
 		*	4) Z's Uncle is Black (Line)		=> Rotate Z's GrandParent and recolor Parent = Black and GrandParent = Red.	(Z's Parent = Left then Right Rotate and vice-versa)
 		* 
 		* @param NodeToFix - The Node whose position needs to be fixed
@@ -832,72 +1122,69 @@ namespace AAEngine {
 			constexpr bool Black = true;
 			constexpr bool Red = false;
 
-			while (NodeToFix->Parent && NodeToFix->Parent->bIsBlack == Red)
+			// A Red Parent is never the Root, so the GrandParent always exists
+			while (NodeToFix->Parent != nullptr && NodeToFix->Parent->bIsBlack == Red)
 			{
-				if (NodeToFix->Parent->Parent != nullptr)
+				TRBNode<T>* Parent = NodeToFix->Parent;
+				TRBNode<T>* GrandParent = Parent->Parent;
+
+				if (Parent == GrandParent->Left)
 				{
-					if (NodeToFix->Parent == NodeToFix->Parent->Parent->Left)
+					// Node's Parent is Left Child
+					TRBNode<T>* Uncle = GrandParent->Right;
+					if (Uncle->bIsBlack == Red)
 					{
-						// Node's Parent is Left Child
-						if (NodeToFix->Parent->Parent->Right->bIsBlack == Red)
-						{
-							// Uncle is Red
-							NodeToFix->Parent->bIsBlack = Black;
-							NodeToFix->Parent->Parent->Right->bIsBlack = Black;
-							NodeToFix->Parent->Parent->bIsBlack = Red;
-							NodeToFix = NodeToFix->Parent->Parent;
-						}
-						else
-						{
-							// Uncle is Black or Nil
-							if (NodeToFix->Parent->Right == NodeToFix)
-							{
-								// Triangle
-								NodeToFix = NodeToFix->Parent;
-								RotateLeft(NodeToFix);
-							}
-							// On Left Rotation will form a Line
-							NodeToFix->Parent->bIsBlack = Black;
-							NodeToFix->Parent->Parent->bIsBlack = Red;
-							RotateRight(NodeToFix->Parent->Parent);
-						}
+						// Uncle is Red
+						Parent->bIsBlack = Black;
+						Uncle->bIsBlack = Black;
+						GrandParent->bIsBlack = Red;
+						NodeToFix = GrandParent;
 					}
-					else if (NodeToFix->Parent == NodeToFix->Parent->Parent->Right)
+					else
 					{
-						// Node's Parent is Right Child
-						if (NodeToFix->Parent->Parent->Left->bIsBlack == Red)
-						{
-							// Uncle is Red
-							NodeToFix->Parent->bIsBlack = Black;
-							NodeToFix->Parent->Parent->Left->bIsBlack = Black;
-							NodeToFix->Parent->Parent->bIsBlack = Red;
-							NodeToFix = NodeToFix->Parent->Parent;
-						}
-						else
+						// Uncle is Black or Nil
+						if (NodeToFix == Parent->Right)
 						{
-							// Uncle is Black or Nil
-							if (NodeToFix->Parent->Left == NodeToFix)
-							{
-								// Triangle
-								NodeToFix = NodeToFix->Parent;
-								RotateRight(NodeToFix);
-							}
-							// On Right Rotation will form a Line
-							NodeToFix->Parent->bIsBlack = Black;
-							NodeToFix->Parent->Parent->bIsBlack = Red;
-							RotateLeft(NodeToFix->Parent->Parent);
+							// Triangle
+							NodeToFix = Parent;
+							RotateLeft(NodeToFix);
+							Parent = NodeToFix->Parent;
 						}
+						// On Left Rotation will form a Line
+						Parent->bIsBlack = Black;
+						GrandParent->bIsBlack = Red;
+						RotateRight(GrandParent);
 					}
 				}
-				if (NodeToFix == Root)
+				else
 				{
-					break;
+					// Node's Parent is Right Child
+					TRBNode<T>* Uncle = GrandParent->Left;
+					if (Uncle->bIsBlack == Red)
+					{
+						// Uncle is Red
+						Parent->bIsBlack = Black;
+						Uncle->bIsBlack = Black;
+						GrandParent->bIsBlack = Red;
+						NodeToFix = GrandParent;
+					}
+					else
+					{
+						// Uncle is Black or Nil
+						if (NodeToFix == Parent->Left)
+						{
+							// Triangle
+							NodeToFix = Parent;
+							RotateRight(NodeToFix);
+							Parent = NodeToFix->Parent;
+						}
+						// On Right Rotation will form a Line
+						Parent->bIsBlack = Black;
+						GrandParent->bIsBlack = Red;
+						RotateLeft(GrandParent);
+					}
 				}
 			}
-			/*while (Root->Parent != nullptr)
-			{
-				Root = Root->Parent;
-			}*/
 			Root->bIsBlack = Black;
 		}
 
@@ -905,662 +1192,180 @@ namespace AAEngine {
 		* Function to Rotate Left on the Node.
 		* Adjusts the pointers on Node and nearby Nodes to perform a Rotate Left 
 		* 
-		* @param Node - Node on which the rotation happens
+		* @param Node - Node on which the rotation happens, its Right child must not be Nil
 		*/
 		FORCEINLINE constexpr void RotateLeft(TRBNode<T>* Node) noexcept
 		{
-			if (Node == nullptr)
-			{
-				return;
-			}
-			if (Node == Root)
+			TRBNode<T>* NodeR = Node->Right;
+			TRBNode<T>* NodeRL = NodeR->Left;
+
+			Node->Right = NodeRL;
+			if (!NodeRL->bIsNil)
 			{
-				if (Node->Right != nullptr)
-				{
-					Root = Node->Right;
-					TRBNode<T>* NodeRL = Node->Right->Left;
-					Node->Right->Parent = nullptr;
-
-					Node->Right->Left = Node;
-					Node->Parent = Node->Right;
-					Node->Right = NodeRL;
-					if (NodeRL != nullptr && !NodeRL->bIsNil)
-					{
-						NodeRL->Parent = Node;
-					}
-					Root = Node->Parent;
-					Root->Left = Node;
-					Root->Right = Node->Parent->Right;
-				}
-			}
-			else
-			{
-				if (Node->Right != nullptr)
-				{
-					TRBNode<T>* NodeRL = Node->Right->Left;
-					Node->Right->Parent = Node->Parent;
-					if (Node->Parent->Right == Node)
-					{
-						Node->Parent->Right = Node->Right;
-					}
-					else if (Node->Parent->Left == Node)
-					{
-						Node->Parent->Left = Node->Right;
-					}
-					Node->Right->Left = Node;
-					Node->Parent = Node->Right;
-					Node->Right = NodeRL;
-					if (NodeRL != nullptr && !NodeRL->bIsNil)
-					{
-						NodeRL->Parent = Node;
-					}
-				}
+				NodeRL->Parent = Node;
 			}
+
+			NodeR->Parent = Node->Parent;
+			ReconnectParent(Node, NodeR);
+
+			NodeR->Left = Node;
+			Node->Parent = NodeR;
 		}
 
 		/*
 		* Function to Rotate Right on the Node.
 		* Adjusts the pointers on Node and nearby Nodes to perform a Rotate Right
 		*
-		* @param Node - Node on which the rotation happens
+		* @param Node - Node on which the rotation happens, its Left child must not be Nil
 		*/
 		FORCEINLINE constexpr void RotateRight(TRBNode<T>* Node) noexcept
 		{
-			if (Node == nullptr)
-			{
-				return;
-			}
-			if (Node == Root)
-			{
-				if (Node->Left != nullptr)
-				{
-					TRBNode<T>* NodeRL = Node->Left->Right;
-					Node->Left->Parent = nullptr;
+			TRBNode<T>* NodeL = Node->Left;
+			TRBNode<T>* NodeLR = NodeL->Right;
 
-					Node->Left->Right = Node;
-					Node->Parent = Node->Left;
-					Node->Left = NodeRL;
-					if (NodeRL != nullptr && !NodeRL->bIsNil)
-					{
-						NodeRL->Parent = Node;
-					}
-					Root = Node->Parent;
-					Root->Right = Node;
-					Root->Left = Node->Parent->Left;
-				}
-			}
-			else
+			Node->Left = NodeLR;
+			if (!NodeLR->bIsNil)
 			{
-				if (Node->Left != nullptr)
-				{
-					TRBNode<T>* NodeRL = Node->Left->Right;
-					Node->Left->Parent = Node->Parent;
-					if (Node->Parent->Right == Node)
-					{
-						Node->Parent->Right = Node->Left;
-					}
-					else if (Node->Parent->Left == Node)
-					{
-						Node->Parent->Left = Node->Left;
-					}
-					Node->Left->Right = Node;
-					Node->Parent = Node->Left;
-					Node->Left = NodeRL;
-					if (NodeRL != nullptr && !NodeRL->bIsNil)
-					{
-						NodeRL->Parent = Node;
-					}
-				}
+				NodeLR->Parent = Node;
 			}
+
+			NodeL->Parent = Node->Parent;
+			ReconnectParent(Node, NodeL);
+
+			NodeL->Right = Node;
+			Node->Parent = NodeL;
 		}
 
 		/*
-		* Remove Helper that Removes a node from the Red Black Tree recursively
+		* Puts NewConnection in the place of Current under Current's Parent (or as the Root)
 		*
-		* @param Current - Currently looked at node to perform deletion
-		* @param NewVal - const L Value Ref to the Value to be removed from the RBTree
-		*
-		* @returns true if Node with NewVal has been removed, false if Node doesn't exist and hasn't been removed
+		* @param Current - Node being replaced
+		* @param NewConnection - Node taking its place
 		*/
-		FORCEINLINE constexpr bool RemoveHelper(TRBNode<T>* Current, const T& NewVal) noexcept
-		{
-			if (Current == nullptr)
-			{
-				return false;
-			}
-			else
-			{
-				if (NewVal == Current->Value)
-				{
-					if (Current == Nil)
-					{
-						return false;
-					}
-					if (Current->Left->bIsNil && Current->Right->bIsNil)
-					{
-						if (Current == Root)
-						{
-							Root = nullptr;
-						}
-						else
-						{
-							if (Current->Parent->Left == Current)
-							{
-								Current->Parent->Left = Nil;
-							}
-							else
-							{
-								Current->Parent->Right = Nil;
-							}
-							RemoveRecolor(Current, Nil);
-						}
-					}
-					else if (Current->Left->bIsNil && !Current->Right->bIsNil)
-					{
-						if (Current == Root)
-						{
-							Root = Current->Right;
-							Current->Right->Parent = nullptr;
-						}
-						else
-						{
-							if (Current->Parent->Left == Current)
-							{
-								Current->Parent->Left = Current->Right;
-							}
-							else
-							{
-								Current->Parent->Right = Current->Right;
-							}
-							Current->Right->Parent = Current->Parent;
-							RemoveRecolor(Current, Current->Right);
-						}
-					}
-					else if (!Current->Left->bIsNil && Current->Right->bIsNil)
-					{
-						if (Current == Root)
-						{
-							Root = Current->Left;
-							Current->Left->Parent = nullptr;
-						}
-						else
-						{
-							if (Current->Parent->Left = Current)
-							{
-								Current->Parent->Left = Current->Left;
-							}
-							else
-							{
-								Current->Parent->Right = Current->Left;
-							}
-							Current->Left->Parent = Current->Parent;
-							RemoveRecolor(Current, Current->Left);
-						}
-					}
-					else
-					{
-						TRBNode<T>* MinNodeInRightSubTree = FindMinInSubTree(Current->Right);
-						TRBNode<T>* FixUpNode = MinNodeInRightSubTree->Right; // X
-						TRBNode<T>* FixUpParent;
-						
-						// If successor's parent is Current, then Successor is Current->Right
-						if (MinNodeInRightSubTree->Parent == Current)
-						{
-							FixUpParent = MinNodeInRightSubTree;
-							// If FixUp node is Nil, then set Parent's Right to Nil, otherwise properly replace
-							// This is because, we have only one Nil reference we use for every leaf node.
-							if (FixUpNode->bIsNil)
-							{
-								MinNodeInRightSubTree->Parent->Right = Nil;
-							}
-							else
-							{
-								FixUpNode->Parent = MinNodeInRightSubTree->Parent;
-								FixUpNode->Parent->Right = FixUpNode;
-							}
-						}
-						// If successor's parent is not Current, then Successor->Left is Nil and Successor is a Left Child.
-						else
-						{
-							FixUpParent = MinNodeInRightSubTree->Parent;
-							// If FixUp node is Nil, then set Parent's Left to Nil, otherwise properly replace
-							// This is because, we have only one Nil reference we use for every leaf node.
-							if (FixUpNode->bIsNil)
-							{
-								MinNodeInRightSubTree->Parent->Left = Nil;
-							}
-							else
-							{
-								FixUpNode->Parent = MinNodeInRightSubTree->Parent;
-								FixUpNode->Parent->Left = FixUpNode;
-							}
-						}
-
-						// Replace Current with Replacement
-						if (Current->Parent != nullptr)
-						{
-							if (Current = Current->Parent->Right)
-							{
-								Current->Parent->Right = MinNodeInRightSubTree;
-							}
-							else
-							{
-								Current->Parent->Left = MinNodeInRightSubTree;
-							}
-						}
-						else
-						{
-							Root = MinNodeInRightSubTree;
-						}
-						MinNodeInRightSubTree->Parent = Current->Parent;
-						MinNodeInRightSubTree->Left = Current->Left;
-						MinNodeInRightSubTree->Left->Parent = MinNodeInRightSubTree;
-						MinNodeInRightSubTree->Right = Current->Right;
-						MinNodeInRightSubTree->Right->Parent = MinNodeInRightSubTree;
-
-						RemoveRecolor(Current, MinNodeInRightSubTree, FixUpNode, FixUpParent);
-					}
-					delete Current;
-					Current = nullptr;
-					// Make sure Root is not Nil.
-					// If it is, then set it to nullptr, If not, color it black.
-					if (Root != nullptr)
-					{
-						if (Root->bIsNil)
-						{
-							Root = nullptr;
-						}
-						else
-						{
-							Root->bIsBlack = true;
-						}
-					}
-					return true;
-				}
-				else if (Pred(NewVal, Current->Value))
-				{
-					// Look to the Left
-					if (Current->Left != nullptr && !Current->Left->bIsNil)
-					{
-						return RemoveHelper(Current->Left, NewVal);
-					}
-					else
-					{
-						return false;
-					}
-				}
-				else if (Pred(Current->Value, NewVal))
-				{
-					// Look to the Right
-					if (Current->Right != nullptr && !Current->Right->bIsNil)
-					{
-						return RemoveHelper(Current->Right, NewVal);
-					}
-					else
-					{
-						return false;
-					}
-				}
-				return false;
-			}
-		}
-
-		FORCEINLINE constexpr void RemoveRecolor(TRBNode<T>* RemovedNode, TRBNode<T>* ReplacementNode, TRBNode<T>* HelperX = nullptr, TRBNode<T>* FixUpParent = nullptr) noexcept
+		FORCEINLINE constexpr void ReconnectParent(TRBNode<T>* Current, TRBNode<T>* NewConnection) noexcept
 		{
-			if (!RemovedNode->bIsBlack)
+			if (Current->Parent == nullptr)
 			{
-				if (!ReplacementNode->bIsBlack || ReplacementNode->bIsNil)
-				{
-					return;
-				}
-				else
-				{
-					// Color replacement Red
-					ReplacementNode->bIsBlack = false;
-				}
+				Root = NewConnection;
 			}
-			else
+			else if (Current->Parent->Left == Current)
 			{
-				if (!ReplacementNode->bIsBlack)
-				{
-					// Color replacement Black
-					ReplacementNode->bIsBlack = true;
-					return;
-				}
-				else
-				{
-					if (Root == HelperX)
-					{
-						return;
-					}
-				}
-			}
-			if (HelperX == nullptr)
-			{
-				if (ReplacementNode->bIsNil)
-				{
-					RemoveFixUp(ReplacementNode, RemovedNode->Parent);
-				}
-				else
-				{
-					RemoveFixUp(ReplacementNode, ReplacementNode->Parent);
-				}
+				Current->Parent->Left = NewConnection;
 			}
 			else
 			{
-				RemoveFixUp(HelperX, FixUpParent);
+				Current->Parent->Right = NewConnection;
 			}
 		}
 
-		FORCEINLINE constexpr void RemoveFixUp(TRBNode<T>* FixUpNode, TRBNode<T>* ParentIfFixUpIsNil) noexcept
+		/*
+		* Replaces the subtree at Current with the subtree at NewConnection
+		* NewConnection's Parent is always set, even for Nil, so RemoveFixUp can walk up from it.
+		*/
+		FORCEINLINE constexpr void Transplant(TRBNode<T>* Current, TRBNode<T>* NewConnection) noexcept
 		{
-			constexpr bool BLACK = true;
-			constexpr bool RED = false;
+			ReconnectParent(Current, NewConnection);
+			NewConnection->Parent = Current->Parent;
+		}
 
-			// CASE 0
-			// If FixUp is Red, Color it black and return.
-			if (!FixUpNode->bIsBlack)
-			{
-				FixUpNode->bIsBlack = true;
-				return;
-			}
+		/*
+		* Restores the Red Black properties after a Black node was taken out of the tree
+		* FixUp (X) carries an extra Black, which is pushed up or resolved with rotations.
+		* Cases for FixUp as the Left Child (mirrored for the Right Child)
+		*	1) Sibling is Red								=> Color Sibling Black and Parent Red, Rotate Left on Parent
+		*	2) Sibling and both its children are Black		=> Color Sibling Red, move FixUp up to the Parent
+		*	3) Sibling Black, Left Red, Right Black			=> Color Sibling's Left Black and Sibling Red, Rotate Right on Sibling
+		*	4) Sibling Black, Right Red						=> Sibling takes Parent's Color, Parent and Sibling's Right are Black, Rotate Left on Parent
+		*
+		* @param FixUpNode - Node that took the place of the removed node, can be Nil
+		*/
+		FORCEINLINE constexpr void RemoveFixUp(TRBNode<T>* FixUpNode) noexcept
+		{
+			constexpr bool Black = true;
+			constexpr bool Red = false;
 
-			while (FixUpNode != Root && FixUpNode->bIsBlack)
+			while (FixUpNode != Root && FixUpNode->bIsBlack == Black)
 			{
-				// If FixUp is Black and Not the Root.
-				
-				// As Our Nil node's parents are not connected, so we need to make sure we we pass in the Right Parent.
-				// Set FixUpParent to the appropriate Parent.
-				// Nil ->		ParentIfFixUpIsNil
-				// Not-Nit ->	FixUpNode->Parent
-				TRBNode<T>* FixUpParent = nullptr;
-				if (FixUpNode->bIsNil)
-				{
-					FixUpParent = ParentIfFixUpIsNil;
-				}
-				else
-				{
-					FixUpParent = FixUpNode->Parent;
-				}
+				TRBNode<T>* FixUpParent = FixUpNode->Parent;
 
-				// If FixUp is the Left Child - The Rotations and Assignments Vary
 				if (FixUpNode == FixUpParent->Left)
 				{
-					// FixUp is left child
-					// Sibling becomes the Right Child.
 					TRBNode<T>* FixUpSibling = FixUpParent->Right;
 
 					// CASE 1
-					if (!FixUpSibling->bIsBlack)
+					if (FixUpSibling->bIsBlack == Red)
 					{
-						// If Sibling is Red
-						// Color Sibling Black and Parent Red.
-						FixUpSibling->bIsBlack = true;
-						FixUpParent->bIsBlack = false;
-
-						/*
-						* Fix Up = X
-						* Parent = P
-						* Sibling = W
-						* Sibling Left = WL
-						* Sibling Right = WR
-						* 
-						*                P(B->R)
-						*              /  \
-						*             X(B) W(R->B) It was Red before, => Children are Black
-						*                 / \
-						*             (B)WL WR(B)
-						* /\/\/\/\/\/\/\
-						* BEFORE ROTATION
-						*/
+						FixUpSibling->bIsBlack = Black;
+						FixUpParent->bIsBlack = Red;
 						RotateLeft(FixUpParent);
-						/*
-						* AFTER ROTATION
-						* \/\/\/\/\/\/\/
-						*                   W(R->B) It was Red before, => Children are Black
-						*                  /   \
-						*             P(B->R)   WR(B)
-						*              /   \
-						*           X(B)  (B)WL
-						* 
-						* 1) After Rotation, W/Sibling will always be Black
-						* 2) New W cannot be Nil, as If it is Nil, This initial RB Tree property of Red-Black height won't hold.
-						*/
-
 						FixUpSibling = FixUpParent->Right;
 					}
 
 					// CASE 2
-					// If Our Sibling has 2 Black child nodes
-					if (FixUpSibling->Right->bIsBlack && FixUpSibling->Left->bIsBlack)
+					if (FixUpSibling->Left->bIsBlack && FixUpSibling->Right->bIsBlack)
 					{
-						// Set Sibling Color to Red and FixUp to its Parent 
-						FixUpSibling->bIsBlack = false;
+						FixUpSibling->bIsBlack = Red;
 						FixUpNode = FixUpParent;
-
-						if (!FixUpNode->bIsBlack)
-						{
-							// If FixUp is Red
-							// then color it Black and Return
-							FixUpNode->bIsBlack = true;
-							return;
-						}
-						else
-						{
-							// If FixUp is Black
-							// and Root
-							if (FixUpNode == Root)
-							{
-								return;
-							}
-						}
-						// If Black and non-root
-						// Adjust FixupParent, and Sibling
-						FixUpParent = FixUpParent->Parent;
-						FixUpSibling = FixUpParent->Right;
-						continue;
 					}
-
-					// CASE 3
-					// If Our Sibling Left = Red, Right = Black
-					if (FixUpSibling->Right->bIsBlack && !FixUpSibling->Left->bIsBlack)
+					else
 					{
-						FixUpSibling->Left->bIsBlack = true;
-						FixUpSibling->bIsBlack = false;
-
-						/*
-						* Fix Up = X
-						* Parent = P
-						* Sibling = W
-						* Sibling Left = WL
-						* Sibling Right = WR
-						*
-						*                P(B)
-						*              /  \
-						*             X(B) W(B->R)
-						*                 / \
-						*          (R->B)WL WR(B)
-						* /\/\/\/\/\/\/\
-						* BEFORE ROTATION
-						*/
-						RotateRight(FixUpSibling);
-						/*
-						* AFTER ROTATION
-						* \/\/\/\/\/\/\/
-						*                P(B)
-						*              /  \
-						*             X(B) WL(R->B)
-						*                   \
-						*                   W(B->R)
-						*                    \
-						*                    WR(B)
-						*
-						*/
-
-						// Will be equal to Sibling's Previous Left
-						FixUpSibling = FixUpParent->Right;
-					}
+						// CASE 3
+						if (FixUpSibling->Right->bIsBlack)
+						{
+							FixUpSibling->Left->bIsBlack = Black;
+							FixUpSibling->bIsBlack = Red;
+							RotateRight(FixUpSibling);
+							FixUpSibling = FixUpParent->Right;
+						}
 
-					// After case 3, Sibling Right will always be Red.
-					// CASE 4
-					if (!FixUpSibling->Right->bIsBlack)
-					{
+						// CASE 4
 						FixUpSibling->bIsBlack = FixUpParent->bIsBlack;
-						FixUpParent->bIsBlack = true;
-						FixUpSibling->Right->bIsBlack = true;
-
-						/*
-						* Fix Up = X
-						* Parent = P
-						* Sibling = W
-						* Sibling Left = WL
-						* Sibling Right = WR
-						* 
-						*                P(B)
-						*              /  \
-						*             X(B) W(R->B)
-						*                   \
-						*                   WR(B->R)
-						* /\/\/\/\/\/\/\
-						* BEFORE ROTATION
-						*/
+						FixUpParent->bIsBlack = Black;
+						FixUpSibling->Right->bIsBlack = Black;
 						RotateLeft(FixUpParent);
-						return;
+						FixUpNode = Root;
 					}
 				}
-				// If FixUp is the Right Child - The Rotations and Assignments Vary
 				else
 				{
-					// X is Right Child
 					TRBNode<T>* FixUpSibling = FixUpParent->Left;
 
 					// CASE 1
-					if (!FixUpSibling->bIsBlack)
+					if (FixUpSibling->bIsBlack == Red)
 					{
-						// If Sibling is Red
-						// Color Sibling Black and Parent Red.
-						FixUpSibling->bIsBlack = true;
-						FixUpParent->bIsBlack = false;
-
-						// Refer to Mirrored Rotations Above
-						RotateLeft(FixUpParent);
-
-						// Reset Sibling
+						FixUpSibling->bIsBlack = Black;
+						FixUpParent->bIsBlack = Red;
+						RotateRight(FixUpParent);
 						FixUpSibling = FixUpParent->Left;
 					}
 
 					// CASE 2
-					// If Our Sibling has 2 Black child nodes
-					if (FixUpSibling->Right->bIsBlack && FixUpSibling->Left->bIsBlack)
+					if (FixUpSibling->Left->bIsBlack && FixUpSibling->Right->bIsBlack)
 					{
-						// Set Sibling Color to Red and FixUp to its Parent 
-						FixUpSibling->bIsBlack = false;
+						FixUpSibling->bIsBlack = Red;
 						FixUpNode = FixUpParent;
-
-						if (!FixUpNode->bIsBlack)
-						{
-							// If FixUp is Red
-							// then color it Black and Return
-							FixUpNode->bIsBlack = true;
-							return;
-						}
-						else
-						{
-							// If FixUp is Black
-							// and Root
-							if (FixUpNode == Root)
-							{
-								return;
-							}
-						}
-						// If Black and non-root
-						// Adjust FixupParent, and Sibling
-						FixUpParent = FixUpParent->Parent;
-						FixUpSibling = FixUpParent->Right;
-						continue;
 					}
-
-					// CASE 3
-					// If Our Sibling Right = Red, Left = Black
-					if (!FixUpSibling->Right->bIsBlack && FixUpSibling->Left->bIsBlack)
+					else
 					{
-						FixUpSibling->Right->bIsBlack = true;
-						FixUpSibling->bIsBlack = false;
-
-						// Refer to Mirrored Rotations Above
-						RotateLeft(FixUpSibling);
-
-						// Will be equal to Sibling's Previous Right
-						FixUpSibling = FixUpParent->Left;
-					}
+						// CASE 3
+						if (FixUpSibling->Left->bIsBlack)
+						{
+							FixUpSibling->Right->bIsBlack = Black;
+							FixUpSibling->bIsBlack = Red;
+							RotateLeft(FixUpSibling);
+							FixUpSibling = FixUpParent->Left;
+						}
 
-					// After case 3, Sibling Right will always be Red.
-					// CASE 4
-					if (!FixUpSibling->Left->bIsBlack)
-					{
+						// CASE 4
 						FixUpSibling->bIsBlack = FixUpParent->bIsBlack;
-						FixUpParent->bIsBlack = true;
-						FixUpSibling->Left->bIsBlack = true;
-
-						// Refer to Mirrored Rotations Above
+						FixUpParent->bIsBlack = Black;
+						FixUpSibling->Left->bIsBlack = Black;
 						RotateRight(FixUpParent);
-						return;
+						FixUpNode = Root;
 					}
 				}
 			}
-		}
-
-		/*
-		* Search Helper that Searches a node from the Red Black Tree recursively
-		*
-		* @param Current - Currently looked at node to perform deletion
-		* @param NewVal - const L Value Ref to the Value to be searched for in the RBTree
-		*
-		* @returns true if Node with NewVal exists, false otherwise
-		*/
-		FORCEINLINE constexpr bool SearchHelper(TRBNode<T>* Current, const T& NewVal) noexcept
-		{
-			if (Current == nullptr)
-			{
-				return false;
-			}
-			else
-			{
-				if (NewVal == Current->Value)
-				{
-					return true;
-				}
-				else if (Pred(NewVal, Current->Value))
-				{
-					// Look to the Left
-					return SearchHelper(Current->Left, NewVal);
-				}
-				else if (Pred(Current->Value, NewVal))
-				{
-					// Look to the Right
-					return SearchHelper(Current->Right, NewVal);
-				}
-			}
-			return false;
-		}
-
-		FORCEINLINE constexpr void ReconnectParent(TRBNode<T>* Current, TRBNode<T>* NewConnection) noexcept
-		{
-			if (Current == nullptr)
-			{
-				return;
-			}
-			if (Current->Parent)
-			{
-				if (Current->Parent->Right == Current)
-				{
-					Current->Parent->Right = NewConnection;
-				}
-				else if (Current->Parent->Left == Current)
-				{
-					Current->Parent->Left = NewConnection;
-				}
-			}
+			FixUpNode->bIsBlack = Black;
 		}
 
 		/*
@@ -1570,22 +1375,17 @@ namespace AAEngine {
 		*
 		* @returns Pointer to the Node with the Min Value
 		*/
-		FORCEINLINE constexpr TRBNode<T>* FindMinInSubTree(TRBNode<T>* SubTreeRoot) noexcept
+		FORCEINLINE constexpr TRBNode<T>* FindMinInSubTree(TRBNode<T>* SubTreeRoot) const noexcept
 		{
 			if (SubTreeRoot == nullptr)
 			{
 				return nullptr;
 			}
-
-			if (SubTreeRoot->Left == nullptr || SubTreeRoot->Left->bIsNil)
+			while (!SubTreeRoot->Left->bIsNil)
 			{
-				return SubTreeRoot;
-			}
-			else
-			{
-				// Keep going left to find the min value
-				return FindMinInSubTree(SubTreeRoot->Left);
+				SubTreeRoot = SubTreeRoot->Left;
 			}
+			return SubTreeRoot;
 		}
 
 		/*
@@ -1595,26 +1395,21 @@ namespace AAEngine {
 		*
 		* @returns Pointer to the Node with the Max Value
 		*/
-		FORCEINLINE constexpr TRBNode<T>* FindMaxInSubTree(TRBNode<T>* SubTreeRoot) noexcept
+		FORCEINLINE constexpr TRBNode<T>* FindMaxInSubTree(TRBNode<T>* SubTreeRoot) const noexcept
 		{
 			if (SubTreeRoot == nullptr)
 			{
 				return nullptr;
 			}
-
-			if (SubTreeRoot->Right == nullptr || SubTreeRoot->Right->bIsNil)
+			while (!SubTreeRoot->Right->bIsNil)
 			{
-				return SubTreeRoot;
-			}
-			else
-			{
-				// Keep going right to find the max value
-				return FindMaxInSubTree(SubTreeRoot->Right);
+				SubTreeRoot = SubTreeRoot->Right;
 			}
+			return SubTreeRoot;
 		}
 
 		/*
-		* Helper that frees memory form the Red Black Tree recursively
+		* Helper that destroys the nodes of a subtree recursively and gives them back to the pool
 		*
 		* @param Current - Currently looked at node to perform freeing on the Node and it's subtree
 		*/
@@ -1624,19 +1419,11 @@ namespace AAEngine {
 			{
 				return;
 			}
-			if (Current->Left != nullptr && !Current->Left->bIsNil)
-			{
-				FreeRBTreeHelper(Current->Left);
-				Current->Left = nullptr;
-			}
-
-			if (Current->Right != nullptr && !Current->Right->bIsNil)
-			{
-				FreeRBTreeHelper(Current->Right);
-				Current->Right = nullptr;
-			}
+			FreeRBTreeHelper(Current->Left);
+			FreeRBTreeHelper(Current->Right);
 
-			delete Current;
+			Current->~TRBNode<T>();
+			NodePool->Free(Current);
 		}
 
 		/*
@@ -1719,50 +1506,28 @@ namespace AAEngine {
 		*/
 		TRBNode<T>* Root{ nullptr };
 		/*
-		* Nil Node for the Tree
+		* Nil Node for the Tree, shared by every leaf
 		*/
 		TRBNode<T>* Nil{ nullptr };
 		/*
-		* Predicate function used to compare values
+		* Pool every node of the tree (and Nil) is allocated from
+		*/
+		CFixedBlockPool* NodePool{ nullptr };
+		/*
+		* Number of nodes in the tree
+		*/
+		size_t Size{ 0 };
+		/*
+		* Predicate function used to compare keys
 		*/
 		Predicate Pred;
 
-	private:
-
-
 	public:
-		// Const and Non-Const Iterators
-		using Iterator = TRedBlackIterator<TRBNode<T>>;
-		using ConstIterator = TRedBlackIterator<const TRBNode<T>>;
-
 		// Functions for Tree Iteration
-		FORCEINLINE Iterator begin()
-		{
-			if (Root == nullptr)
-			{
-				return Iterator(nullptr);
-			}
-			TRBNode<T>* Temp = Root;
-			while (Temp->Left != nullptr && !Temp->Left->bIsNil)
-			{
-				Temp = Temp->Left;
-			}
-			return Iterator(*Temp);
-		}
-		FORCEINLINE ConstIterator begin() const
-		{
-			if (Root == nullptr)
-			{
-				return ConstIterator(nullptr);
-			}
-			TRBNode<T>* Temp = Root;
-			while (Temp->Left != nullptr && !Temp->Left->bIsNil)
-			{
-				Temp = Temp->Left;
-			}
-			return ConstIterator(*Temp);
-		}
-		FORCEINLINE Iterator			end() { return Iterator(nullptr); }
-		FORCEINLINE ConstIterator		end() const { return ConstIterator(nullptr); }
+		FORCEINLINE Iterator			begin()				{ return Iterator(FindMinInSubTree(Root)); }
+		FORCEINLINE ConstIterator		begin() const		{ return ConstIterator(FindMinInSubTree(Root)); }
+		FORCEINLINE Iterator			end()				{ return Iterator(nullptr); }
+		FORCEINLINE ConstIterator		end() const			{ return ConstIterator(nullptr); }
+#undef RB_NODES_PER_CHUNK
 	};
 }
\ No newline at end of file
@@ -0,0 +1,306 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/Containers/Array.h"
+#include "Core/Containers/Hash.h"
+
+/*
+* Bits of a TResourceHandle used for the slot index, the rest is the generation.
+* 20 bits = 1M live resources per pool, 12 bits = 4095 reuses of a slot before a stale handle can match again.
+*/
+#define RESOURCE_HANDLE_INDEX_BITS 20
+#define RESOURCE_HANDLE_GENERATION_BITS (32 - RESOURCE_HANDLE_INDEX_BITS)
+
+namespace AAEngine {
+
+	/*
+	* 32 bit handle to an element of a TResourcePool, an index into the pool and the generation of the slot it was made for.
+	* Removing the element bumps the generation of its slot, so old handles are detected instead of aliasing a new element.
+	* A default constructed handle is null, generations start at 1 so no valid handle is 0.
+	*
+	* @tparam ResourceType - Type the handle refers to, handles of different types don't convert to each other.
+	*/
+	template<typename ResourceType>
+	class TResourceHandle
+	{
+	public:
+		static constexpr uint32_t IndexMask = (1u << RESOURCE_HANDLE_INDEX_BITS) - 1;
+		static constexpr uint32_t GenerationMask = (1u << RESOURCE_HANDLE_GENERATION_BITS) - 1;
+
+		FORCEINLINE constexpr TResourceHandle() noexcept
+			: Value(0)
+		{
+		}
+
+		FORCEINLINE constexpr TResourceHandle(uint32_t Index, uint32_t Generation) noexcept
+			: Value((Generation << RESOURCE_HANDLE_INDEX_BITS) | (Index & IndexMask))
+		{
+		}
+
+		FORCEINLINE constexpr uint32_t GetIndex() const noexcept		{ return Value & IndexMask; }
+		FORCEINLINE constexpr uint32_t GetGeneration() const noexcept	{ return Value >> RESOURCE_HANDLE_INDEX_BITS; }
+
+		/*
+		* @returns The packed index and generation, e.g. to store the handle in a uint32_t.
+		*/
+		FORCEINLINE constexpr uint32_t GetValue() const noexcept		{ return Value; }
+
+		/*
+		* @returns true if the handle was never set, a handle that isn't null can still be stale, ask the pool.
+		*/
+		FORCEINLINE constexpr bool IsNull() const noexcept				{ return Value == 0; }
+
+		FORCEINLINE constexpr bool operator==(const TResourceHandle& Other) const noexcept { return Value == Other.Value; }
+		FORCEINLINE constexpr bool operator!=(const TResourceHandle& Other) const noexcept { return Value != Other.Value; }
+
+	private:
+		/*
+		* Generation in the high bits, index in the low RESOURCE_HANDLE_INDEX_BITS bits.
+		*/
+		uint32_t Value;
+	};
+
+	/*
+	* Resource handle hasher, the packed value is unique per live resource so it is the hash.
+	*/
+	template<typename ResourceType>
+	struct THash<TResourceHandle<ResourceType>>
+	{
+		FORCEINLINE size_t operator()(const TResourceHandle<ResourceType>& Key) const noexcept
+		{
+			return (size_t)Key.GetValue();
+		}
+	};
+
+	/*
+	* Pool of elements addressed by generational handles (a slot map).
+	* - Elements are kept packed in a dense array, so iterating them is a linear walk without holes.
+	* - Handles index a slot array that stores the generation and the dense index of the element, looking an element up
+	*	or checking a handle is two array reads, no hashing and no pointer chasing.
+	* - Freed slots are kept on a free list, removing swaps the last element into the hole.
+	* - Clear destroys every element at once and invalidates every handle handed out so far.
+	* NOTE: Pointers returned by Get are invalidated by Add and Remove (elements move), keep the handle instead.
+	* NOTE: Not thread-safe.
+	*
+	* @tparam T - Type of the elements.
+	* @tparam HandleTag - Type the handles are typed on, defaults to T (e.g. pool of TRefCountPtr<IShader> with IShader handles).
+	*/
+	template<typename T, typename HandleTag = T>
+	class TResourcePool
+	{
+	public:
+		using HandleType = TResourceHandle<HandleTag>;
+
+		TResourcePool() = default;
+
+		/*
+		* Constructor reserving memory for InitialCapacity elements.
+		*/
+		explicit TResourcePool(size_t InitialCapacity)
+		{
+			Reserve(InitialCapacity);
+		}
+
+		TResourcePool(const TResourcePool&) = delete;
+		TResourcePool& operator=(const TResourcePool&) = delete;
+
+		/*
+		* Constructs an element in the pool.
+		*
+		* @param Args - Arguments for the constructor of T.
+		*
+		* @returns Handle to the new element.
+		*/
+		template<typename... ArgsType>
+		HandleType Add(ArgsType&&... Args)
+		{
+			uint32_t SlotIndex;
+			if (FreeListHead != INDEX_NONE)
+			{
+				SlotIndex = FreeListHead;
+				FreeListHead = Slots[SlotIndex].DenseIndex;
+			}
+			else
+			{
+				AA_CORE_ASSERT(Slots.Num() < HandleType::IndexMask, "TResourcePool is out of handle indices!");
+				SlotIndex = (uint32_t)Slots.Num();
+				Slots.PushBack(FSlot{ 1, 0 });
+			}
+
+			FSlot& Slot = Slots[SlotIndex];
+			Slot.DenseIndex = (uint32_t)Elements.Num();
+			Elements.EmplaceBack(Forward<ArgsType>(Args)...);
+			DenseToSlot.PushBack(SlotIndex);
+			return HandleType(SlotIndex, Slot.Generation);
+		}
+
+		/*
+		* Destroys the element of a handle, the handle and its copies become stale.
+		*
+		* @returns true if the handle was valid.
+		*/
+		bool Remove(HandleType Handle)
+		{
+			if (!IsValid(Handle))
+			{
+				return false;
+			}
+
+			const uint32_t SlotIndex = Handle.GetIndex();
+			const uint32_t DenseIndex = Slots[SlotIndex].DenseIndex;
+			const uint32_t LastDenseIndex = (uint32_t)Elements.Num() - 1;
+
+			// Destroyed at the end, once the pool is consistent again, so its destructor can use the pool
+			T RemovedElement(Move(Elements[DenseIndex]));
+			if (DenseIndex != LastDenseIndex)
+			{
+				// Fill the hole with the last element so the elements stay packed
+				Elements[DenseIndex] = Move(Elements[LastDenseIndex]);
+				DenseToSlot[DenseIndex] = DenseToSlot[LastDenseIndex];
+				Slots[DenseToSlot[DenseIndex]].DenseIndex = DenseIndex;
+			}
+			Elements.PopBack();
+			DenseToSlot.PopBack();
+
+			FreeSlot(SlotIndex);
+			return true;
+		}
+
+		/*
+		* @returns true if the handle refers to an element of this pool that wasn't removed.
+		*/
+		FORCEINLINE bool IsValid(HandleType Handle) const noexcept
+		{
+			const uint32_t SlotIndex = Handle.GetIndex();
+			return SlotIndex < Slots.Num() && Slots[SlotIndex].Generation == Handle.GetGeneration();
+		}
+
+		/*
+		* @returns Pointer to the element of a handle, nullptr if the handle is stale or null.
+		*/
+		FORCEINLINE T* Get(HandleType Handle) noexcept
+		{
+			return IsValid(Handle) ? &Elements[Slots[Handle.GetIndex()].DenseIndex] : nullptr;
+		}
+
+		FORCEINLINE const T* Get(HandleType Handle) const noexcept
+		{
+			return IsValid(Handle) ? &Elements[Slots[Handle.GetIndex()].DenseIndex] : nullptr;
+		}
+
+		/*
+		* Destroys every element and invalidates every handle, the memory is kept for reuse.
+		*/
+		void Clear()
+		{
+			// Invalidate the handles first, so destructors removing handles of this pool find them stale and leave the elements alone
+			for (uint32_t SlotIndex : DenseToSlot)
+			{
+				FreeSlot(SlotIndex);
+			}
+			DenseToSlot.Clear();
+			Elements.Clear();
+		}
+
+		/*
+		* Reserves memory for Capacity elements.
+		*/
+		void Reserve(size_t Capacity)
+		{
+			Elements.Reserve(Capacity);
+			DenseToSlot.Reserve(Capacity);
+			Slots.Reserve(Capacity);
+		}
+
+		/*
+		* Calls Function(Handle, Element) for every element, in dense order.
+		* NOTE: Function must not add or remove elements.
+		*/
+		template<typename FunctionType>
+		void ForEach(FunctionType&& Function)
+		{
+			for (size_t DenseIndex = 0; DenseIndex < Elements.Num(); DenseIndex++)
+			{
+				const uint32_t SlotIndex = DenseToSlot[DenseIndex];
+				Function(HandleType(SlotIndex, Slots[SlotIndex].Generation), Elements[DenseIndex]);
+			}
+		}
+
+		/*
+		* @returns Number of elements in the pool.
+		*/
+		FORCEINLINE size_t Num() const noexcept { return Elements.Num(); }
+
+		/*
+		* @returns true if the pool has no elements.
+		*/
+		FORCEINLINE bool IsEmpty() const noexcept { return Elements.Num() == 0; }
+
+		/*
+		* Elements are packed, so they can be iterated directly.
+		*/
+		FORCEINLINE T* begin() noexcept				{ return Elements.Data(); }
+		FORCEINLINE T* end() noexcept				{ return Elements.Data() + Elements.Num(); }
+		FORCEINLINE const T* begin() const noexcept	{ return Elements.Data(); }
+		FORCEINLINE const T* end() const noexcept	{ return Elements.Data() + Elements.Num(); }
+
+	private:
+		/*
+		* Marker for the end of the free list.
+		*/
+		static constexpr uint32_t INDEX_NONE = ~0u;
+
+		/*
+		* Indirection from a handle index to an element.
+		*/
+		struct FSlot
+		{
+			/*
+			* Generation a handle must have to be valid, bumped every time the slot is freed.
+			*/
+			uint32_t Generation;
+
+			/*
+			* Index of the element in Elements, or the next free slot while the slot is free.
+			*/
+			uint32_t DenseIndex;
+		};
+
+		/*
+		* Bumps the generation of a slot and pushes it on the free list.
+		*/
+		FORCEINLINE void FreeSlot(uint32_t SlotIndex) noexcept
+		{
+			FSlot& Slot = Slots[SlotIndex];
+			Slot.Generation = (Slot.Generation + 1) & HandleType::GenerationMask;
+			if (Slot.Generation == 0)
+			{
+				// 0 is reserved for null handles
+				Slot.Generation = 1;
+			}
+			Slot.DenseIndex = FreeListHead;
+			FreeListHead = SlotIndex;
+		}
+
+	private:
+		/*
+		* Packed elements.
+		*/
+		TArray<T> Elements;
+
+		/*
+		* Slot of each element, parallel to Elements.
+		*/
+		TArray<uint32_t> DenseToSlot;
+
+		/*
+		* Slots indexed by the handles.
+		*/
+		TArray<FSlot> Slots;
+
+		/*
+		* First free slot, INDEX_NONE if every slot is used.
+		*/
+		uint32_t FreeListHead = INDEX_NONE;
+	};
+}
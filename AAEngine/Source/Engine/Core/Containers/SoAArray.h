@@ -0,0 +1,521 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Memory/MemoryOps.h"
+
+#include <new>
+#include <tuple>
+#include <utility>
+
+/*
+* Minimum alignment of every column of a TSoAArray, a full cache line so SIMD kernels can use aligned loads from the start of a column.
+*/
+#define SOA_COLUMN_ALIGNMENT 64
+#define SOA_DEFAULT_RESIZE_MULTIPLIER 2
+
+namespace AAEngine {
+
+	/*
+	* Contiguous view of one column of a TSoAArray.
+	* NOTE: Invalidated by anything that reallocates the array (adding past the capacity, Reserve, ShrinkToFit).
+	*
+	* @tparam T - Type of the field, const for read only views.
+	*/
+	template<typename T>
+	class TSoAColumnView
+	{
+	public:
+		FORCEINLINE constexpr TSoAColumnView(T* InData, size_t InNum) noexcept
+			: ColumnData(InData), ColumnNum(InNum)
+		{
+		}
+
+		FORCEINLINE constexpr T& operator[](size_t Index) const noexcept
+		{
+			AA_CORE_ASSERT(Index < ColumnNum, "Index Out of Bounds: %d when Size is %d", Index, ColumnNum);
+			return ColumnData[Index];
+		}
+
+		/*
+		* @returns Pointer to the first element of the column, aligned to at least SOA_COLUMN_ALIGNMENT.
+		*/
+		FORCEINLINE constexpr T* Data() const noexcept		{ return ColumnData; }
+		FORCEINLINE constexpr size_t Num() const noexcept	{ return ColumnNum; }
+
+		FORCEINLINE constexpr T* begin() const noexcept		{ return ColumnData; }
+		FORCEINLINE constexpr T* end() const noexcept		{ return ColumnData + ColumnNum; }
+
+	private:
+		/*
+		* First element of the column.
+		*/
+		T* ColumnData;
+
+		/*
+		* Number of elements in the column.
+		*/
+		size_t ColumnNum;
+	};
+
+	/*
+	* Iterator over the elements of a TSoAArray, dereferences to a tuple of references to the element's fields.
+	*
+	* @tparam ArrayType - TSoAArray type, const for const iterators.
+	*/
+	template<typename ArrayType>
+	class TSoAIterator
+	{
+	public:
+		FORCEINLINE constexpr TSoAIterator(ArrayType* InArray, size_t InIndex) noexcept
+			: Array(InArray), Index(InIndex)
+		{
+		}
+
+		FORCEINLINE constexpr auto operator*() const noexcept			{ return (*Array)[Index]; }
+
+		FORCEINLINE constexpr TSoAIterator& operator++() noexcept		{ Index++; return *this; }
+		FORCEINLINE constexpr TSoAIterator operator++(int) noexcept		{ TSoAIterator Temp = *this; Index++; return Temp; }
+		FORCEINLINE constexpr TSoAIterator& operator--() noexcept		{ Index--; return *this; }
+		FORCEINLINE constexpr TSoAIterator operator--(int) noexcept		{ TSoAIterator Temp = *this; Index--; return Temp; }
+
+		FORCEINLINE constexpr bool operator==(const TSoAIterator& Other) const noexcept	{ return Index == Other.Index; }
+		FORCEINLINE constexpr bool operator!=(const TSoAIterator& Other) const noexcept	{ return Index != Other.Index; }
+
+		/*
+		* @returns Index of the element the iterator points to.
+		*/
+		FORCEINLINE constexpr size_t GetIndex() const noexcept		{ return Index; }
+
+	private:
+		/*
+		* Array being iterated.
+		*/
+		ArrayType* Array;
+
+		/*
+		* Index of the current element.
+		*/
+		size_t Index;
+	};
+
+	/*
+	* Structure of Arrays, every field of the elements lives in its own contiguous, aligned column.
+	* Loops that only touch some fields (e.g. a transform update reading Positions and Velocities) stream only
+	* those columns through the cache, and SIMD kernels can load 4 / 8 consecutive elements of a field at once.
+	* All columns share one allocation and always have the same Num.
+	*
+	* Element access:
+	*	Array[i]						=> std::tuple<Fields&...>, e.g. auto [Position, Velocity] = Array[i];
+	*	Array.Get<FieldIndex>(i)		=> Single field of element i.
+	*	Array.GetColumn<FieldIndex>()	=> TSoAColumnView over the whole column.
+	*
+	* @tparam Fields - Types of the fields of an element, one column each.
+	*/
+	template<typename... Fields>
+	class AA_ENGINE_API TSoAArray
+	{
+		static_assert(sizeof...(Fields) > 0, "TSoAArray needs at least one field!");
+
+	public:
+		using ElementRef = std::tuple<Fields&...>;
+		using ConstElementRef = std::tuple<const Fields&...>;
+		using Iterator = TSoAIterator<TSoAArray>;
+		using ConstIterator = TSoAIterator<const TSoAArray>;
+
+		template<size_t FieldIndex>
+		using FieldType = std::tuple_element_t<FieldIndex, std::tuple<Fields...>>;
+
+		static constexpr size_t NumFields = sizeof...(Fields);
+
+		/*
+		* Default constructor for TSoAArray.
+		*/
+		FORCEINLINE TSoAArray() noexcept
+			: Block(nullptr), Size(0), Capacity(0)
+		{
+		}
+
+		/*
+		* Constructor for TSoAArray that reserves space.
+		*
+		* @param InitialCapacity - Number of elements that can be added without reallocating.
+		*/
+		FORCEINLINE explicit TSoAArray(size_t InitialCapacity) noexcept
+			: Block(nullptr), Size(0), Capacity(0)
+		{
+			Reserve(InitialCapacity);
+		}
+
+		FORCEINLINE TSoAArray(const TSoAArray& Other) noexcept
+			: Block(nullptr), Size(0), Capacity(0)
+		{
+			Reserve(Other.Size);
+			CopyColumns(Other, std::index_sequence_for<Fields...>{});
+			Size = Other.Size;
+		}
+
+		FORCEINLINE TSoAArray(TSoAArray&& Other) noexcept
+			: Block(Other.Block), Columns(Other.Columns), Size(Other.Size), Capacity(Other.Capacity)
+		{
+			Other.Block = nullptr;
+			Other.Size = 0;
+			Other.Capacity = 0;
+		}
+
+		FORCEINLINE TSoAArray& operator=(const TSoAArray& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				Reserve(Other.Size);
+				CopyColumns(Other, std::index_sequence_for<Fields...>{});
+				Size = Other.Size;
+			}
+			return *this;
+		}
+
+		FORCEINLINE TSoAArray& operator=(TSoAArray&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Clear();
+				FreeBlock();
+				Block = Other.Block;
+				Columns = Other.Columns;
+				Size = Other.Size;
+				Capacity = Other.Capacity;
+				Other.Block = nullptr;
+				Other.Size = 0;
+				Other.Capacity = 0;
+			}
+			return *this;
+		}
+
+		FORCEINLINE ~TSoAArray()
+		{
+			Clear();
+			FreeBlock();
+		}
+
+		/*
+		* Adds an element to the back of the array.
+		*
+		* @param Values - Value of every field of the element, in order.
+		*
+		* @returns Index of the new element.
+		*/
+		template<typename... ValueTypes>
+		FORCEINLINE size_t Add(ValueTypes&&... Values) noexcept
+		{
+			static_assert(sizeof...(ValueTypes) == NumFields, "TSoAArray::Add needs one value per field!");
+			if (Size == Capacity)
+			{
+				ReallocateBlock(Capacity * SOA_DEFAULT_RESIZE_MULTIPLIER + 1);
+			}
+			ConstructAt(Size, std::index_sequence_for<Fields...>{}, Forward<ValueTypes>(Values)...);
+			return Size++;
+		}
+
+		/*
+		* Adds Count value initialized elements (zeroed for arithmetic fields) to the back of the array.
+		*
+		* @param Count - Number of elements to add.
+		*
+		* @returns Index of the first new element.
+		*/
+		FORCEINLINE size_t AddDefaulted(size_t Count) noexcept
+		{
+			ReserveForGrowth(Size + Count);
+			DefaultConstructColumns(Size, Count, std::index_sequence_for<Fields...>{});
+			const size_t FirstIndex = Size;
+			Size += Count;
+			return FirstIndex;
+		}
+
+		/*
+		* Removes an element, keeping the order of the rest.
+		*
+		* @param Index - Index of the element to remove.
+		*/
+		FORCEINLINE void RemoveAt(size_t Index) noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			RemoveAtColumns(Index, std::index_sequence_for<Fields...>{});
+			Size--;
+		}
+
+		/*
+		* Removes an element by moving the last element into its place, O(1) but doesn't keep the order.
+		*
+		* @param Index - Index of the element to remove.
+		*/
+		FORCEINLINE void RemoveAtSwap(size_t Index) noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			RemoveAtSwapColumns(Index, std::index_sequence_for<Fields...>{});
+			Size--;
+		}
+
+		/*
+		* Removes the last element.
+		*/
+		FORCEINLINE void PopBack() noexcept
+		{
+			if (Size > 0)
+			{
+				Size--;
+				DestructColumns(Size, 1, std::index_sequence_for<Fields...>{});
+			}
+		}
+
+		/*
+		* Destroys every element, keeps the memory.
+		*/
+		FORCEINLINE void Clear() noexcept
+		{
+			DestructColumns(0, Size, std::index_sequence_for<Fields...>{});
+			Size = 0;
+		}
+
+		/*
+		* Reserves memory for at least NewCapacity elements in every column.
+		*
+		* @param NewCapacity - The new capacity to reserve.
+		*/
+		FORCEINLINE void Reserve(size_t NewCapacity) noexcept
+		{
+			if (NewCapacity > Capacity)
+			{
+				ReallocateBlock(NewCapacity);
+			}
+		}
+
+		/*
+		* Reduces the capacity of the array to match its size.
+		*/
+		FORCEINLINE void ShrinkToFit() noexcept
+		{
+			if (Capacity > Size)
+			{
+				ReallocateBlock(Size);
+			}
+		}
+
+		/*
+		* @returns Tuple of references to every field of element Index.
+		*/
+		FORCEINLINE ElementRef operator[](size_t Index) noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			return GetElement<ElementRef>(Index, std::index_sequence_for<Fields...>{});
+		}
+
+		FORCEINLINE ConstElementRef operator[](size_t Index) const noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			return GetElement<ConstElementRef>(Index, std::index_sequence_for<Fields...>{});
+		}
+
+		/*
+		* @returns Reference to field FieldIndex of element Index.
+		*/
+		template<size_t FieldIndex>
+		FORCEINLINE FieldType<FieldIndex>& Get(size_t Index) noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			return std::get<FieldIndex>(Columns)[Index];
+		}
+
+		template<size_t FieldIndex>
+		FORCEINLINE const FieldType<FieldIndex>& Get(size_t Index) const noexcept
+		{
+			AA_CORE_ASSERT(Index < Size, "Index Out of Bounds: %d when Size is %d", Index, Size);
+			return std::get<FieldIndex>(Columns)[Index];
+		}
+
+		/*
+		* @returns View over every element's field FieldIndex, contiguous and aligned to at least SOA_COLUMN_ALIGNMENT.
+		*/
+		template<size_t FieldIndex>
+		FORCEINLINE TSoAColumnView<FieldType<FieldIndex>> GetColumn() noexcept
+		{
+			return TSoAColumnView<FieldType<FieldIndex>>(std::get<FieldIndex>(Columns), Size);
+		}
+
+		template<size_t FieldIndex>
+		FORCEINLINE TSoAColumnView<const FieldType<FieldIndex>> GetColumn() const noexcept
+		{
+			return TSoAColumnView<const FieldType<FieldIndex>>(std::get<FieldIndex>(Columns), Size);
+		}
+
+		/*
+		* @returns Number of elements in the array.
+		*/
+		FORCEINLINE size_t Num() const noexcept			{ return Size; }
+
+		/*
+		* @returns Number of elements every column has memory for.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept	{ return Capacity; }
+
+		/*
+		* @returns true if the array has no elements.
+		*/
+		FORCEINLINE bool IsEmpty() const noexcept		{ return Size == 0; }
+
+		FORCEINLINE Iterator		begin()				{ return Iterator(this, 0); }
+		FORCEINLINE ConstIterator	begin() const		{ return ConstIterator(this, 0); }
+		FORCEINLINE Iterator		end()				{ return Iterator(this, Size); }
+		FORCEINLINE ConstIterator	end() const			{ return ConstIterator(this, Size); }
+
+	private:
+		/*
+		* Alignment of the column of field type T.
+		*/
+		template<typename T>
+		static constexpr size_t ColumnAlignment() noexcept
+		{
+			return alignof(T) > SOA_COLUMN_ALIGNMENT ? alignof(T) : SOA_COLUMN_ALIGNMENT;
+		}
+
+		static constexpr size_t BlockAlignment() noexcept
+		{
+			size_t Alignment = SOA_COLUMN_ALIGNMENT;
+			((Alignment = ColumnAlignment<Fields>() > Alignment ? ColumnAlignment<Fields>() : Alignment), ...);
+			return Alignment;
+		}
+
+		/*
+		* Moves every column into one new block with NewCapacity elements per column and frees the old block.
+		* Columns are laid out back to back, each starting on its own alignment.
+		*/
+		FORCEINLINE void ReallocateBlock(size_t NewCapacity) noexcept
+		{
+			if (NewCapacity == 0)
+			{
+				FreeBlock();
+				Capacity = 0;
+				return;
+			}
+
+			size_t BlockSize = 0;
+			((BlockSize = AlignColumnOffset<Fields>(BlockSize) + NewCapacity * sizeof(Fields)), ...);
+
+			uint8_t* NewBlock = (uint8_t*)FMemory::Malloc(BlockSize, BlockAlignment(), EMemoryTag::Containers);
+			AA_CHECK_ALIGNED(NewBlock, BlockAlignment());
+			std::tuple<Fields*...> NewColumns;
+			size_t Offset = 0;
+			SetColumns(NewColumns, NewBlock, Offset, NewCapacity, std::index_sequence_for<Fields...>{});
+			RelocateColumns(NewColumns, std::index_sequence_for<Fields...>{});
+
+			FreeBlock();
+			Block = NewBlock;
+			Columns = NewColumns;
+			Capacity = NewCapacity;
+		}
+
+		template<typename T>
+		static constexpr size_t AlignColumnOffset(size_t Offset) noexcept
+		{
+			return (Offset + ColumnAlignment<T>() - 1) & ~(ColumnAlignment<T>() - 1);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE static void SetColumns(std::tuple<Fields*...>& OutColumns, uint8_t* InBlock, size_t& Offset, size_t InCapacity, std::index_sequence<FieldIndices...>) noexcept
+		{
+			((Offset = AlignColumnOffset<Fields>(Offset),
+				std::get<FieldIndices>(OutColumns) = (Fields*)(InBlock + Offset),
+				Offset += InCapacity * sizeof(Fields)), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void RelocateColumns(std::tuple<Fields*...>& NewColumns, std::index_sequence<FieldIndices...>) noexcept
+		{
+			(RelocateConstructItems(std::get<FieldIndices>(NewColumns), std::get<FieldIndices>(Columns), Size), ...);
+		}
+
+		template<size_t... FieldIndices, typename... ValueTypes>
+		FORCEINLINE void ConstructAt(size_t Index, std::index_sequence<FieldIndices...>, ValueTypes&&... Values) noexcept
+		{
+			(new(std::get<FieldIndices>(Columns) + Index) Fields(Forward<ValueTypes>(Values)), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void DefaultConstructColumns(size_t Index, size_t Count, std::index_sequence<FieldIndices...>) noexcept
+		{
+			(DefaultConstructItems(std::get<FieldIndices>(Columns) + Index, Count), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void CopyColumns(const TSoAArray& Other, std::index_sequence<FieldIndices...>) noexcept
+		{
+			(CopyConstructItems(std::get<FieldIndices>(Columns), (const Fields*)std::get<FieldIndices>(Other.Columns), Other.Size), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void DestructColumns(size_t Index, size_t Count, std::index_sequence<FieldIndices...>) noexcept
+		{
+			(DestructItems(std::get<FieldIndices>(Columns) + Index, Count), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void RemoveAtColumns(size_t Index, std::index_sequence<FieldIndices...>) noexcept
+		{
+			((std::get<FieldIndices>(Columns)[Index].~Fields(),
+				RelocateConstructItems(std::get<FieldIndices>(Columns) + Index, std::get<FieldIndices>(Columns) + Index + 1, Size - Index - 1)), ...);
+		}
+
+		template<size_t... FieldIndices>
+		FORCEINLINE void RemoveAtSwapColumns(size_t Index, std::index_sequence<FieldIndices...>) noexcept
+		{
+			((std::get<FieldIndices>(Columns)[Index].~Fields(),
+				(Index != Size - 1 ? RelocateConstructItems(std::get<FieldIndices>(Columns) + Index, std::get<FieldIndices>(Columns) + Size - 1, 1) : (void)0)), ...);
+		}
+
+		template<typename RefType, size_t... FieldIndices>
+		FORCEINLINE RefType GetElement(size_t Index, std::index_sequence<FieldIndices...>) const noexcept
+		{
+			return RefType(std::get<FieldIndices>(Columns)[Index]...);
+		}
+
+		FORCEINLINE void ReserveForGrowth(size_t RequiredCapacity) noexcept
+		{
+			if (RequiredCapacity > Capacity)
+			{
+				const size_t GrownCapacity = Capacity * SOA_DEFAULT_RESIZE_MULTIPLIER + 1;
+				ReallocateBlock(GrownCapacity > RequiredCapacity ? GrownCapacity : RequiredCapacity);
+			}
+		}
+
+		FORCEINLINE void FreeBlock() noexcept
+		{
+			if (Block)
+			{
+				FMemory::Free(Block);
+				Block = nullptr;
+			}
+		}
+
+	private:
+		/*
+		* Single allocation holding every column.
+		*/
+		uint8_t* Block;
+
+		/*
+		* First element of every column, pointing into Block.
+		*/
+		std::tuple<Fields*...> Columns;
+
+		/*
+		* Number of elements in every column.
+		*/
+		size_t Size;
+
+		/*
+		* Number of elements every column has memory for.
+		*/
+		size_t Capacity;
+	};
+}
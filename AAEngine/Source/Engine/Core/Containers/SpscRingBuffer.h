@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "CoreContainers.h"
+#include "Memory/MemoryOps.h"
+
+#include <atomic>
+#include <new>
+
+namespace AAEngine {
+
+	/*
+	* Bounded lock-free Single Producer Single Consumer Queue, e.g. the game thread handing commands to one worker.
+	* Head and Tail are only ever increased, the slot of an index is Index & (Capacity - 1).
+	* Each side keeps a cached copy of the other side's index on its own cache line, so it only reads the shared
+	* index (and pulls the other thread's cache line) when the cached copy says the buffer is full / empty.
+	* NOTE: Exactly one thread may call TryPush / TryEmplace and exactly one thread may call TryPop at a time.
+	*
+	* @tparam T - Type of the elements.
+	*/
+	template<typename T>
+	class AA_ENGINE_API TSpscRingBuffer
+	{
+	public:
+		/*
+		* Constructor for TSpscRingBuffer.
+		*
+		* @param InCapacity - Minimum number of elements the buffer holds, rounded up to a power of two.
+		*/
+		FORCEINLINE explicit TSpscRingBuffer(size_t InCapacity) noexcept
+		{
+			size_t Capacity = 2;
+			while (Capacity < InCapacity)
+			{
+				Capacity *= 2;
+			}
+			Mask = Capacity - 1;
+			Elements = (T*)::operator new(Capacity * sizeof(T), std::align_val_t(alignof(T) > AA_CACHE_LINE_SIZE ? alignof(T) : AA_CACHE_LINE_SIZE));
+		}
+
+		TSpscRingBuffer(const TSpscRingBuffer&) = delete;
+		TSpscRingBuffer& operator=(const TSpscRingBuffer&) = delete;
+
+		/*
+		* Destroys the elements still in the buffer, no other thread may be using it.
+		*/
+		FORCEINLINE ~TSpscRingBuffer()
+		{
+			const size_t Tail = Producer.Tail.load(std::memory_order_relaxed);
+			for (size_t Index = Consumer.Head.load(std::memory_order_relaxed); Index != Tail; Index++)
+			{
+				Elements[Index & Mask].~T();
+			}
+			::operator delete(Elements, std::align_val_t(alignof(T) > AA_CACHE_LINE_SIZE ? alignof(T) : AA_CACHE_LINE_SIZE));
+		}
+
+		/*
+		* Adds an element to the back of the buffer, Producer thread only.
+		*
+		* @param Element - Element to add.
+		*
+		* @returns false if the buffer is full, Element is left untouched.
+		*/
+		FORCEINLINE bool TryPush(const T& Element) noexcept		{ return TryEmplace(Element); }
+		FORCEINLINE bool TryPush(T&& Element) noexcept			{ return TryEmplace(Move(Element)); }
+
+		/*
+		* Constructs an element at the back of the buffer, Producer thread only.
+		*
+		* @param Args - Arguments for the element's constructor.
+		*
+		* @returns false if the buffer is full, nothing is constructed.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE bool TryEmplace(ArgsType&&... Args) noexcept
+		{
+			const size_t Tail = Producer.Tail.load(std::memory_order_relaxed);
+			if (Tail - Producer.CachedHead > Mask)
+			{
+				Producer.CachedHead = Consumer.Head.load(std::memory_order_acquire);
+				if (Tail - Producer.CachedHead > Mask)
+				{
+					return false;
+				}
+			}
+
+			new(&Elements[Tail & Mask]) T(Forward<ArgsType>(Args)...);
+			Producer.Tail.store(Tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Moves the element at the front of the buffer into OutElement and removes it, Consumer thread only.
+		*
+		* @param OutElement - Set to the front element if there is one.
+		*
+		* @returns false if the buffer is empty.
+		*/
+		FORCEINLINE bool TryPop(T& OutElement) noexcept
+		{
+			const size_t Head = Consumer.Head.load(std::memory_order_relaxed);
+			if (Head == Consumer.CachedTail)
+			{
+				Consumer.CachedTail = Producer.Tail.load(std::memory_order_acquire);
+				if (Head == Consumer.CachedTail)
+				{
+					return false;
+				}
+			}
+
+			T& Element = Elements[Head & Mask];
+			OutElement = Move(Element);
+			Element.~T();
+			Consumer.Head.store(Head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* NOTE: Only a snapshot while the other thread is running.
+		*
+		* @returns Number of elements in the buffer.
+		*/
+		FORCEINLINE size_t Num() const noexcept
+		{
+			const size_t Head = Consumer.Head.load(std::memory_order_acquire);
+			return Producer.Tail.load(std::memory_order_acquire) - Head;
+		}
+
+		/*
+		* NOTE: Only a snapshot while the other thread is running.
+		*
+		* @returns true if the buffer has no elements.
+		*/
+		FORCEINLINE bool IsEmpty() const noexcept	{ return Num() == 0; }
+
+		/*
+		* @returns Number of elements the buffer holds.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept	{ return Mask + 1; }
+
+	private:
+		/*
+		* State written by the Producer.
+		*/
+		struct alignas(AA_CACHE_LINE_SIZE) FProducerState
+		{
+			/*
+			* Index of the next element to push.
+			*/
+			std::atomic<size_t> Tail{ 0 };
+
+			/*
+			* Producer's copy of Head, the buffer has at least Capacity - (Tail - CachedHead) free slots.
+			*/
+			size_t CachedHead{ 0 };
+		};
+
+		/*
+		* State written by the Consumer.
+		*/
+		struct alignas(AA_CACHE_LINE_SIZE) FConsumerState
+		{
+			/*
+			* Index of the next element to pop.
+			*/
+			std::atomic<size_t> Head{ 0 };
+
+			/*
+			* Consumer's copy of Tail, the buffer has at least CachedTail - Head elements.
+			*/
+			size_t CachedTail{ 0 };
+		};
+
+	private:
+		/*
+		* Slots of the buffer, Capacity elements, only [Head, Tail) are constructed.
+		*/
+		alignas(AA_CACHE_LINE_SIZE) T* Elements;
+
+		/*
+		* Capacity - 1.
+		*/
+		size_t Mask;
+
+		FProducerState Producer;
+
+		FConsumerState Consumer;
+	};
+}
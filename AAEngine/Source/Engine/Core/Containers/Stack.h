@@ -1,15 +1,118 @@
 #pragma once
 
+#include "Core/Core.h"
+
+#include "Array.h"
+
 namespace AAEngine {
 
-	template<typename DataType>
-	class TStack
+	/*
+	* Last In First Out Stack, elements are stored contiguously in a TArray with the Top at the back.
+	*
+	* @tparam T - Type of the elements.
+	* @tparam AllocatorType - Allocator policy the stack gets its memory from (see ContainerAllocators.h).
+	*/
+	template<typename T, typename AllocatorType = FHeapAllocator>
+	class AA_ENGINE_API TStack
 	{
 	public:
+		/*
+		* Default constructor for TStack.
+		*/
+		FORCEINLINE constexpr TStack() noexcept
+		{
+		}
+
+		/*
+		* Constructor for TStack that reserves space.
+		*
+		* @param InitialCapacity - Number of elements that can be pushed without reallocating.
+		*/
+		FORCEINLINE constexpr explicit TStack(size_t InitialCapacity) noexcept
+			: InternalStack(InitialCapacity)
+		{
+		}
+
+		/*
+		* Pushes an element on top of the Stack.
+		*
+		* @param Element - Element to push.
+		*/
+		FORCEINLINE constexpr void Push(const T& Element) noexcept		{ InternalStack.PushBack(Element); }
+		FORCEINLINE constexpr void Push(T&& Element) noexcept			{ InternalStack.PushBack(Move(Element)); }
+
+		/*
+		* Constructs an element on top of the Stack.
+		*
+		* @param Args - Arguments for the element's constructor.
+		*
+		* @returns Reference to the new Top element.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE constexpr T& Emplace(ArgsType&&... Args) noexcept
+		{
+			return InternalStack.EmplaceBack(Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Removes the Top element.
+		*/
+		FORCEINLINE constexpr void Pop() noexcept
+		{
+			AA_CORE_ASSERT(!IsEmpty(), "Pop called on an empty Stack!");
+			InternalStack.PopBack();
+		}
+
+		/*
+		* Moves the Top element into OutElement and removes it.
+		*
+		* @param OutElement - Set to the Top element if there is one.
+		*
+		* @returns false if the Stack was empty.
+		*/
+		FORCEINLINE constexpr bool Pop(T& OutElement) noexcept
+		{
+			if (IsEmpty())
+			{
+				return false;
+			}
+			OutElement = Move(InternalStack.Back());
+			InternalStack.PopBack();
+			return true;
+		}
+
+		/*
+		* @returns Reference to the Top element, the Stack must not be empty.
+		*/
+		FORCEINLINE constexpr T& Top() noexcept					{ return InternalStack.Back(); }
+		FORCEINLINE constexpr const T& Top() const noexcept		{ return InternalStack.Back(); }
+
+		/*
+		* @returns Number of elements in the Stack.
+		*/
+		FORCEINLINE constexpr size_t Num() const noexcept		{ return InternalStack.Num(); }
+
+		/*
+		* @returns true if the Stack has no elements.
+		*/
+		FORCEINLINE constexpr bool IsEmpty() const noexcept		{ return InternalStack.IsEmpty(); }
+
+		/*
+		* Reserves memory for at least NewCapacity elements.
+		*
+		* @param NewCapacity - The new capacity to reserve.
+		*/
+		FORCEINLINE constexpr void Reserve(size_t NewCapacity) noexcept	{ InternalStack.Reserve(NewCapacity); }
+
+		/*
+		* Destroys every element, keeps the memory.
+		*/
+		FORCEINLINE constexpr void Clear() noexcept				{ InternalStack.Clear(); }
 
 	private:
-		T* InternalStack{ nullptr };
-		size_t Size;
-		size_t Top;
+		/*
+		* Elements of the Stack, bottom first.
+		*/
+		TArray<T, AllocatorType> InternalStack;
 	};
-}
\ No newline at end of file
+}
@@ -10,10 +10,14 @@ namespace AAEngine {
 	* 
 	* @tparam DataType - The type of elements stored in the array
 	* @tparam Size - The size of the array
+	* @tparam Alignment - Alignment of the first element, e.g. AA_AVX_ALIGNMENT for 8-wide aligned loads. Defaults to the alignment of DataType.
 	*/
-	template<typename DataType, size_t Size>
+	template<typename DataType, size_t Size, size_t Alignment = alignof(DataType)>
 	class AA_ENGINE_API TStaticArray
 	{
+		static_assert((Alignment & (Alignment - 1)) == 0, "TStaticArray alignment must be a power of two!");
+		static_assert(Alignment >= alignof(DataType), "TStaticArray alignment can't be lower than the alignment of its elements!");
+
 	public:
 		/*
 		* Default constructor for the TStaticArray class
@@ -232,17 +236,17 @@ namespace AAEngine {
 		}
 
 		/*
-		* Sorts the elements in the Array
-		* Uses Quick Sort
+		* Sorts the elements in the Array, not stable
+		* Uses Intro Sort
 		*/
 		FORCEINLINE constexpr void Sort() noexcept
 		{
-			Algorithms::QuickSort(InternalArray, Size);
+			Algorithms::IntroSort(InternalArray, Size);
 		}
 
 		/*
-		* Sorts the elements in the Array
-		* Uses Quick Sort
+		* Sorts the elements in the Array, not stable
+		* Uses Intro Sort
 		*
 		* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
 		*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
@@ -250,14 +254,36 @@ namespace AAEngine {
 		template<class Predicate>
 		FORCEINLINE constexpr void Sort(Predicate Pred) noexcept
 		{
-			Algorithms::QuickSort(InternalArray, Size, Pred);
+			Algorithms::IntroSort(InternalArray, Size, Pred);
+		}
+
+		/*
+		* Sorts the elements in the Array, equal elements keep their order
+		* Uses Merge Sort, allocates a scratch buffer of Num() / 2 elements
+		*/
+		FORCEINLINE constexpr void StableSort() noexcept
+		{
+			Algorithms::StableSort(InternalArray, Size);
+		}
+
+		/*
+		* Sorts the elements in the Array, equal elements keep their order
+		* Uses Merge Sort, allocates a scratch buffer of Num() / 2 elements
+		*
+		* @param Pred - A Predicate function that 'overrides the () operator taking in 2 (const T&/ T&&) and comparing them returning a bool'
+		*				bool operator()(const T& A, const T& B) const { return A < B; } => Sorted List { ... A, ..., B, ...} A comes before B
+		*/
+		template<class Predicate>
+		FORCEINLINE constexpr void StableSort(Predicate Pred) noexcept
+		{
+			Algorithms::StableSort(InternalArray, Size, Pred);
 		}
 
 	private:
 		/*
 		* Internal Array object for the TStaticArray class 
 		*/
-		DataType InternalArray[Size] = {};
+		alignas(Alignment) DataType InternalArray[Size] = {};
 
 	public:
 		/*
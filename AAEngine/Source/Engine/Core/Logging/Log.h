@@ -2,6 +2,7 @@
 
 #include "Core/Core.h"
 #include "Core/Math/Color.h"
+#include "Core/Strings/StringBuilder.h"
 
 namespace AAEngine {
 
@@ -76,10 +77,13 @@ namespace AAEngine {
 				break;
 			}
 
-			// NEED TO REPLACE WITH STRING BUILDER LATER;
-			std::string NewFormat = std::string(bIsCore ? "[CORE] " : "[APP] ").append(Format).append("\n");
+			// Formats into the reused builder, so logging doesn't allocate once the builder has grown to the longest message
+			LogBuilder.Reset();
+			LogBuilder.Append(bIsCore ? "[CORE] " : "[APP] ");
+			LogBuilder.Appendf(Format, Args...);
+			LogBuilder.Append('\n');
 
-			printf(NewFormat.c_str(), Args...);
+			fwrite(LogBuilder.CStr(), 1, LogBuilder.Len(), stdout);
 			SET_PLATFORM_LOG_COLOR(FColor::White);
 		}
 
@@ -97,6 +101,9 @@ namespace AAEngine {
 
 		/* Mutex for thread safety */
 		std::mutex LogMutex;
+
+		/* Buffer the log messages are formatted into, guarded by LogMutex */
+		FStringBuilder LogBuilder;
 	};
 
 /*
@@ -107,9 +107,14 @@ namespace Math {
 		{
 			TVector3<T> Vector = TVector3<T>::ZeroVector;
 
-			Vector.Z = FMath::Cos(FMath::DegToRad(Yaw)) * FMath::Cos(FMath::DegToRad(Pitch));
-			Vector.X = FMath::Sin(FMath::DegToRad(Yaw)) * FMath::Cos(FMath::DegToRad(Pitch));
-			Vector.Y = FMath::Sin(FMath::DegToRad(Pitch));
+			T SinYaw = static_cast<T>(0.0f), CosYaw = static_cast<T>(1.0f);
+			T SinPitch = static_cast<T>(0.0f), CosPitch = static_cast<T>(1.0f);
+			FMath::SinCos(FMath::DegToRad(Yaw), SinYaw, CosYaw);
+			FMath::SinCos(FMath::DegToRad(Pitch), SinPitch, CosPitch);
+
+			Vector.Z = CosYaw * CosPitch;
+			Vector.X = SinYaw * CosPitch;
+			Vector.Y = SinPitch;
 
 			return Vector;
 		}
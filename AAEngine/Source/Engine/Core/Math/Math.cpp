@@ -40,4 +40,14 @@ const FMatrix44f FMatrix44f::IdentityMatrix(1.0f);
 // Double Euler Static Consts
 const FEulerd FEulerd::ZeroEuler(0.0);
 // Float Euler Static Consts
-const FEulerf FEulerf::ZeroEuler(0.0f);
\ No newline at end of file
+const FEulerf FEulerf::ZeroEuler(0.0f);
+
+// Double Quaternion Static Consts
+const FQuaterniond FQuaterniond::Identity(0.0, 0.0, 0.0, 1.0);
+// Float Quaternion Static Consts
+const FQuaternionf FQuaternionf::Identity(0.0f, 0.0f, 0.0f, 1.0f);
+
+// Double Transform Static Consts
+const FTransformd FTransformd::Identity;
+// Float Transform Static Consts
+const FTransformf FTransformf::Identity;
\ No newline at end of file
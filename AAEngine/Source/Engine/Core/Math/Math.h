@@ -3,6 +3,10 @@
 #include "Core/Core.h"
 #include "Math/MathUtils.h"
 
+#if AA_PLATFORM_USING_SIMD
+#include "Platform/SIMDIncludes.h"
+#endif
+
 namespace AAEngine {
 namespace Math {
 
@@ -12,7 +16,22 @@ namespace Math {
 		static FORCEINLINE float Sqrt(float A) noexcept { return sqrtf(A); }
 		static FORCEINLINE double Sqrt(double A) noexcept { return sqrt(A); }
 
-		static FORCEINLINE float InvSqrt(float A) noexcept { return 1.0f / sqrtf(A); }
+		/*
+		* 1 / Sqrt(A) for A > 0, from the rsqrt estimate refined by one Newton-Raphson step.
+		* Within 5e-7 of the exact result relatively, about twice the cost of a multiply instead of a sqrt and a divide.
+		*/
+		static FORCEINLINE float InvSqrt(float A) noexcept
+		{
+#if AA_PLATFORM_USING_SIMD
+			const __m128 Value = _mm_set_ss(A);
+			const __m128 Estimate = _mm_rsqrt_ss(Value);
+			// Estimate * (1.5 - 0.5 * A * Estimate * Estimate)
+			const __m128 HalfValueEstimate = _mm_mul_ss(_mm_mul_ss(Value, _mm_set_ss(0.5f)), Estimate);
+			return _mm_cvtss_f32(_mm_mul_ss(Estimate, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(HalfValueEstimate, Estimate))));
+#else
+			return 1.0f / sqrtf(A);
+#endif
+		}
 		static FORCEINLINE double InvSqrt(double A) noexcept { return 1.0 / sqrt(A); }
 
 		static FORCEINLINE float Sin(float A) noexcept { return sinf(A); }
@@ -21,6 +40,35 @@ namespace Math {
 		static FORCEINLINE float Cos(float A) noexcept { return cosf(A); }
 		static FORCEINLINE double Cos(double A) noexcept { return cos(A); }
 
+		/*
+		* Sin and Cos of A from one range reduction, for the rotation builders that need both.
+		* The float version is the polynomial of VectorSinCos, within 2e-7 of the exact results for |A| < 8192,
+		* the error grows with |A| past that and A must stay below 2^31 * Pi / 2.
+		*/
+		static FORCEINLINE void SinCos(float A, float& OutSin, float& OutCos) noexcept
+		{
+			// A = Quadrant * Pi / 2 + Reduced, with Reduced in [-Pi / 4, Pi / 4]
+			const int Quadrant = int(A * AA_2_BY_PI + (A < 0.0f ? -0.5f : 0.5f));
+			const float QuadrantFloat = float(Quadrant);
+			const float Reduced = (((A - QuadrantFloat * AA_PI_BY_2_PART1) - QuadrantFloat * AA_PI_BY_2_PART2) - QuadrantFloat * AA_PI_BY_2_PART3) - QuadrantFloat * AA_PI_BY_2_PART4;
+			const float Reduced2 = Reduced * Reduced;
+
+			const float Sin = Reduced + Reduced * Reduced2 * (AA_SIN_COEFF1 + Reduced2 * (AA_SIN_COEFF2 + Reduced2 * AA_SIN_COEFF3));
+			const float Cos = 1.0f - 0.5f * Reduced2 + Reduced2 * Reduced2 * (AA_COS_COEFF1 + Reduced2 * (AA_COS_COEFF2 + Reduced2 * AA_COS_COEFF3));
+
+			// Every quadrant turns (Sin, Cos) by 90 degrees: (Cos, -Sin), (-Sin, -Cos), (-Cos, Sin)
+			const float SwappedSin = (Quadrant & 1) ? Cos : Sin;
+			const float SwappedCos = (Quadrant & 1) ? Sin : Cos;
+			OutSin = (Quadrant & 2) ? -SwappedSin : SwappedSin;
+			OutCos = ((Quadrant + 1) & 2) ? -SwappedCos : SwappedCos;
+		}
+
+		static FORCEINLINE void SinCos(double A, double& OutSin, double& OutCos) noexcept
+		{
+			OutSin = sin(A);
+			OutCos = cos(A);
+		}
+
 		static FORCEINLINE float Tan(float A) noexcept { return tanf(A); }
 		static FORCEINLINE double Tan(double A) noexcept { return tan(A); }
 
@@ -34,7 +82,13 @@ namespace Math {
 		static FORCEINLINE double ATan(double A) noexcept { return atan(A); }
 
 		static FORCEINLINE float ATan2(float A, float B) noexcept { return atan2f(A, B); }
-		static FORCEINLINE double ATan2(double A, double B) noexcept { return atan2(A, A); }
+		static FORCEINLINE double ATan2(double A, double B) noexcept { return atan2(A, B); }
+
+		static FORCEINLINE float Exp(float A) noexcept { return expf(A); }
+		static FORCEINLINE double Exp(double A) noexcept { return exp(A); }
+
+		static FORCEINLINE float Log(float A) noexcept { return logf(A); }
+		static FORCEINLINE double Log(double A) noexcept { return log(A); }
 
 		static FORCEINLINE float Abs(float A) noexcept { return fabsf(A); }
 		static FORCEINLINE double Abs(double A) noexcept { return abs(A); }
@@ -0,0 +1,623 @@
+#include "AA_PreCompiledHeaders.h"
+#include "Math/MathAVX.h"
+
+#if AA_PLATFORM_USING_SIMD
+#include "Math/Matrix44.h"
+#include "Math/Quaternion.h"
+#include "Math/MathBatch.h"
+#include "Platform/SIMDIncludes.h"
+
+/*
+* NOTE: Every kernel ends with _mm256_zeroupper, the callers are SSE code and mixing them with dirty upper halves stalls.
+* NOTE: TMatrix44 is only 16 byte aligned, so the 256-bit loads and stores are unaligned ones.
+*/
+
+namespace AAEngine {
+namespace Math {
+
+	namespace {
+		/*
+		* Lane crossing swizzle of a __m256d, same meaning as VectorSwizzle.
+		*/
+		template<int X, int Y, int Z, int W>
+		AA_TARGET_AVX2 FORCEINLINE __m256d Swizzle(__m256d Vec)
+		{
+			return _mm256_permute4x64_pd(Vec, SHUFFLEMASK(X, Y, Z, W));
+		}
+
+		/*
+		* (Vec1[X], Vec1[Y], Vec2[Z], Vec2[W]) like VectorShuffle.
+		*/
+		template<int X, int Y, int Z, int W>
+		AA_TARGET_AVX2 FORCEINLINE __m256d Shuffle(__m256d Vec1, __m256d Vec2)
+		{
+			return _mm256_blend_pd(Swizzle<X, Y, X, Y>(Vec1), Swizzle<Z, W, Z, W>(Vec2), 0xC);
+		}
+
+		/*
+		* @returns X + Y + Z + W in every element.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE __m256d HorizontalSum(__m256d Vec)
+		{
+			const __m256d HalfSums = _mm256_add_pd(Vec, _mm256_permute2f128_pd(Vec, Vec, 0x01));
+			return _mm256_add_pd(HalfSums, _mm256_permute_pd(HalfSums, 0x5));
+		}
+
+		/*
+		* 2x2 matrices as (M00, M01, M10, M11), see the VectorMatrix2x2 helpers in MathSSE.h.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE __m256d Matrix2x2Multiply(__m256d Mat1, __m256d Mat2)
+		{
+			return _mm256_fmadd_pd(Mat1, Swizzle<0, 3, 0, 3>(Mat2), _mm256_mul_pd(_mm256_permute_pd(Mat1, 0x5), Swizzle<2, 1, 2, 1>(Mat2)));
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256d Matrix2x2AdjointMultiply(__m256d Mat1, __m256d Mat2)
+		{
+			return _mm256_fmsub_pd(Swizzle<3, 3, 0, 0>(Mat1), Mat2, _mm256_mul_pd(Swizzle<1, 1, 2, 2>(Mat1), Swizzle<2, 3, 0, 1>(Mat2)));
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256d Matrix2x2MultiplyAdjoint(__m256d Mat1, __m256d Mat2)
+		{
+			return _mm256_fmsub_pd(Mat1, Swizzle<3, 0, 3, 0>(Mat2), _mm256_mul_pd(_mm256_permute_pd(Mat1, 0x5), Swizzle<2, 1, 2, 1>(Mat2)));
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256d Cross(__m256d Vec1, __m256d Vec2)
+		{
+			return _mm256_fmsub_pd(Swizzle<1, 2, 0, 3>(Vec1), Swizzle<2, 0, 1, 3>(Vec2), _mm256_mul_pd(Swizzle<2, 0, 1, 3>(Vec1), Swizzle<1, 2, 0, 3>(Vec2)));
+		}
+
+		/*
+		* Result = A * B for row-major float matrices, two rows per register, shared by the single and batch multiplies.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE void MatrixMultiply(float* Result, const float* A, const float* B)
+		{
+			// Rows of B in both halves, each half of a register computes one row of the result
+			const __m256 B0 = _mm256_broadcast_ps((const __m128*)(B + 0));
+			const __m256 B1 = _mm256_broadcast_ps((const __m128*)(B + 4));
+			const __m256 B2 = _mm256_broadcast_ps((const __m128*)(B + 8));
+			const __m256 B3 = _mm256_broadcast_ps((const __m128*)(B + 12));
+
+			// Rows 0 and 1 of A in the low and high halves
+			const __m256 A01 = _mm256_loadu_ps(A);
+			__m256 R01 = _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, SHUFFLEMASK(0, 0, 0, 0)), B0);
+			R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, SHUFFLEMASK(1, 1, 1, 1)), B1, R01);
+			R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, SHUFFLEMASK(2, 2, 2, 2)), B2, R01);
+			R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, SHUFFLEMASK(3, 3, 3, 3)), B3, R01);
+
+			// Rows 2 and 3
+			const __m256 A23 = _mm256_loadu_ps(A + 8);
+			__m256 R23 = _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, SHUFFLEMASK(0, 0, 0, 0)), B0);
+			R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, SHUFFLEMASK(1, 1, 1, 1)), B1, R23);
+			R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, SHUFFLEMASK(2, 2, 2, 2)), B2, R23);
+			R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, SHUFFLEMASK(3, 3, 3, 3)), B3, R23);
+
+			// Both inputs are fully read, so Result may alias them
+			_mm256_storeu_ps(Result, R01);
+			_mm256_storeu_ps(Result + 8, R23);
+		}
+
+		/*
+		* Eight packed FVector3f (24 floats in 3 registers) to one register per component and back,
+		* the low halves hold elements 0-3 and the high halves elements 4-7 like VectorDeinterleave3 in each half.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE void Deinterleave3(const float* Src, __m256& X, __m256& Y, __m256& Z)
+		{
+			const __m256 A = _mm256_loadu_ps(Src);
+			const __m256 B = _mm256_loadu_ps(Src + 8);
+			const __m256 C = _mm256_loadu_ps(Src + 16);
+
+			// Same layout as the three SSE registers of VectorDeinterleave3, elements 0-3 low and 4-7 high
+			const __m256 V0 = _mm256_permute2f128_ps(A, B, 0x30);
+			const __m256 V1 = _mm256_permute2f128_ps(A, C, 0x21);
+			const __m256 V2 = _mm256_permute2f128_ps(B, C, 0x30);
+
+			X = _mm256_shuffle_ps(V0, _mm256_shuffle_ps(V1, V2, SHUFFLEMASK(2, 2, 1, 1)), SHUFFLEMASK(0, 3, 0, 2));
+			Y = _mm256_shuffle_ps(_mm256_shuffle_ps(V0, V1, SHUFFLEMASK(1, 1, 0, 0)), _mm256_shuffle_ps(V1, V2, SHUFFLEMASK(3, 3, 2, 2)), SHUFFLEMASK(0, 2, 0, 2));
+			Z = _mm256_shuffle_ps(_mm256_shuffle_ps(V0, V1, SHUFFLEMASK(2, 2, 1, 1)), V2, SHUFFLEMASK(0, 2, 0, 3));
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE void Interleave3(__m256 X, __m256 Y, __m256 Z, float* Dest)
+		{
+			const __m256 V0 = _mm256_shuffle_ps(_mm256_shuffle_ps(X, Y, SHUFFLEMASK(0, 0, 0, 0)), _mm256_shuffle_ps(Z, X, SHUFFLEMASK(0, 0, 1, 1)), SHUFFLEMASK(0, 2, 0, 2));
+			const __m256 V1 = _mm256_shuffle_ps(_mm256_shuffle_ps(Y, Z, SHUFFLEMASK(1, 1, 1, 1)), _mm256_shuffle_ps(X, Y, SHUFFLEMASK(2, 2, 2, 2)), SHUFFLEMASK(0, 2, 0, 2));
+			const __m256 V2 = _mm256_shuffle_ps(_mm256_shuffle_ps(Z, X, SHUFFLEMASK(2, 2, 3, 3)), _mm256_shuffle_ps(Y, Z, SHUFFLEMASK(3, 3, 3, 3)), SHUFFLEMASK(0, 2, 0, 2));
+
+			_mm256_storeu_ps(Dest, _mm256_permute2f128_ps(V0, V1, 0x20));
+			_mm256_storeu_ps(Dest + 8, _mm256_permute2f128_ps(V2, V0, 0x30));
+			_mm256_storeu_ps(Dest + 16, _mm256_permute2f128_ps(V1, V2, 0x31));
+		}
+
+		/*
+		* 4x4 transpose inside each 128-bit half, like VectorTranspose4x4 run on both halves at once.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE void Transpose4x4(__m256& V0, __m256& V1, __m256& V2, __m256& V3)
+		{
+			const __m256 T0 = _mm256_unpacklo_ps(V0, V1);
+			const __m256 T1 = _mm256_unpacklo_ps(V2, V3);
+			const __m256 T2 = _mm256_unpackhi_ps(V0, V1);
+			const __m256 T3 = _mm256_unpackhi_ps(V2, V3);
+			V0 = _mm256_shuffle_ps(T0, T1, SHUFFLEMASK(0, 1, 0, 1));
+			V1 = _mm256_shuffle_ps(T0, T1, SHUFFLEMASK(2, 3, 2, 3));
+			V2 = _mm256_shuffle_ps(T2, T3, SHUFFLEMASK(0, 1, 0, 1));
+			V3 = _mm256_shuffle_ps(T2, T3, SHUFFLEMASK(2, 3, 2, 3));
+		}
+
+		/*
+		* Transposes the four registers so row Row of OutMatrices[k] gets element k of every register, elements 4-7 go to OutMatrices[4] to OutMatrices[7].
+		*/
+		AA_TARGET_AVX2 FORCEINLINE void StoreRowOfEight(__m256 Column0, __m256 Column1, __m256 Column2, __m256 Column3, FMatrix44f* OutMatrices, int Row)
+		{
+			Transpose4x4(Column0, Column1, Column2, Column3);
+			_mm_store_ps(OutMatrices[0].M[Row], _mm256_castps256_ps128(Column0));
+			_mm_store_ps(OutMatrices[1].M[Row], _mm256_castps256_ps128(Column1));
+			_mm_store_ps(OutMatrices[2].M[Row], _mm256_castps256_ps128(Column2));
+			_mm_store_ps(OutMatrices[3].M[Row], _mm256_castps256_ps128(Column3));
+			_mm_store_ps(OutMatrices[4].M[Row], _mm256_extractf128_ps(Column0, 1));
+			_mm_store_ps(OutMatrices[5].M[Row], _mm256_extractf128_ps(Column1, 1));
+			_mm_store_ps(OutMatrices[6].M[Row], _mm256_extractf128_ps(Column2, 1));
+			_mm_store_ps(OutMatrices[7].M[Row], _mm256_extractf128_ps(Column3, 1));
+		}
+
+		/*
+		* 8-wide versions of VectorSinCos, VectorTan, VectorATan2, VectorExp and VectorLog from MathSSE.h, see them for the method and the error bounds.
+		*/
+		AA_TARGET_AVX2 FORCEINLINE __m256 Select(__m256 Mask, __m256 Vec1, __m256 Vec2)
+		{
+			return _mm256_blendv_ps(Vec2, Vec1, Mask);
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 ReduceAngles(__m256 Angles, __m256i& OutQuadrant)
+		{
+			OutQuadrant = _mm256_cvtps_epi32(_mm256_mul_ps(Angles, _mm256_set1_ps(AA_2_BY_PI)));
+			const __m256 QuadrantFloat = _mm256_cvtepi32_ps(OutQuadrant);
+			__m256 Reduced = _mm256_fnmadd_ps(QuadrantFloat, _mm256_set1_ps(AA_PI_BY_2_PART1), Angles);
+			Reduced = _mm256_fnmadd_ps(QuadrantFloat, _mm256_set1_ps(AA_PI_BY_2_PART2), Reduced);
+			Reduced = _mm256_fnmadd_ps(QuadrantFloat, _mm256_set1_ps(AA_PI_BY_2_PART3), Reduced);
+			return _mm256_fnmadd_ps(QuadrantFloat, _mm256_set1_ps(AA_PI_BY_2_PART4), Reduced);
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE void SinCos(__m256 Angles, __m256& OutSin, __m256& OutCos)
+		{
+			__m256i Quadrant;
+			const __m256 Reduced = ReduceAngles(Angles, Quadrant);
+			const __m256 Reduced2 = _mm256_mul_ps(Reduced, Reduced);
+
+			__m256 Sin = _mm256_fmadd_ps(Reduced2, _mm256_set1_ps(AA_SIN_COEFF3), _mm256_set1_ps(AA_SIN_COEFF2));
+			Sin = _mm256_fmadd_ps(Reduced2, Sin, _mm256_set1_ps(AA_SIN_COEFF1));
+			Sin = _mm256_fmadd_ps(_mm256_mul_ps(Reduced2, Reduced), Sin, Reduced);
+
+			__m256 Cos = _mm256_fmadd_ps(Reduced2, _mm256_set1_ps(AA_COS_COEFF3), _mm256_set1_ps(AA_COS_COEFF2));
+			Cos = _mm256_fmadd_ps(Reduced2, Cos, _mm256_set1_ps(AA_COS_COEFF1));
+			Cos = _mm256_fmadd_ps(_mm256_mul_ps(Reduced2, Reduced2), Cos, _mm256_fmadd_ps(Reduced2, _mm256_set1_ps(-0.5f), _mm256_set1_ps(1.0f)));
+
+			const __m256i One = _mm256_set1_epi32(1);
+			const __m256 SwapMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(Quadrant, One), One));
+			const __m256 SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(Quadrant, _mm256_set1_epi32(2)), 30));
+			const __m256 CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(Quadrant, One), _mm256_set1_epi32(2)), 30));
+			OutSin = _mm256_xor_ps(Select(SwapMask, Cos, Sin), SinSign);
+			OutCos = _mm256_xor_ps(Select(SwapMask, Sin, Cos), CosSign);
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 Sin(__m256 Angles)
+		{
+			__m256 SinValue, CosValue;
+			SinCos(Angles, SinValue, CosValue);
+			return SinValue;
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 Cos(__m256 Angles)
+		{
+			__m256 SinValue, CosValue;
+			SinCos(Angles, SinValue, CosValue);
+			return CosValue;
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 Tan(__m256 Angles)
+		{
+			__m256i Quadrant;
+			const __m256 Reduced = ReduceAngles(Angles, Quadrant);
+			const __m256 Reduced2 = _mm256_mul_ps(Reduced, Reduced);
+
+			__m256 TanValue = _mm256_fmadd_ps(Reduced2, _mm256_set1_ps(AA_TAN_COEFF6), _mm256_set1_ps(AA_TAN_COEFF5));
+			TanValue = _mm256_fmadd_ps(Reduced2, TanValue, _mm256_set1_ps(AA_TAN_COEFF4));
+			TanValue = _mm256_fmadd_ps(Reduced2, TanValue, _mm256_set1_ps(AA_TAN_COEFF3));
+			TanValue = _mm256_fmadd_ps(Reduced2, TanValue, _mm256_set1_ps(AA_TAN_COEFF2));
+			TanValue = _mm256_fmadd_ps(Reduced2, TanValue, _mm256_set1_ps(AA_TAN_COEFF1));
+			TanValue = _mm256_fmadd_ps(_mm256_mul_ps(Reduced2, Reduced), TanValue, Reduced);
+
+			const __m256i One = _mm256_set1_epi32(1);
+			const __m256 OddMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(Quadrant, One), One));
+			return Select(OddMask, _mm256_div_ps(_mm256_set1_ps(-1.0f), TanValue), TanValue);
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 ATan2(__m256 Y, __m256 X)
+		{
+			const __m256 SignMask = _mm256_set1_ps(-0.0f);
+			const __m256 AbsY = _mm256_andnot_ps(SignMask, Y);
+			const __m256 AbsX = _mm256_andnot_ps(SignMask, X);
+			const __m256 Max = _mm256_max_ps(AbsY, AbsX);
+			const __m256 Min = _mm256_min_ps(AbsX, AbsY);
+
+			const __m256 bShifted = _mm256_cmp_ps(Min, _mm256_mul_ps(Max, _mm256_set1_ps(AA_TAN_PI_BY_8)), _CMP_GT_OQ);
+			const __m256 Numerator = Select(bShifted, _mm256_sub_ps(Min, Max), Min);
+			const __m256 Denominator = Select(bShifted, _mm256_add_ps(Min, Max), Max);
+			const __m256 Ratio = _mm256_andnot_ps(_mm256_cmp_ps(Max, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_div_ps(Numerator, Denominator));
+			const __m256 Ratio2 = _mm256_mul_ps(Ratio, Ratio);
+
+			__m256 Angle = _mm256_fmadd_ps(Ratio2, _mm256_set1_ps(AA_ATAN_COEFF4), _mm256_set1_ps(AA_ATAN_COEFF3));
+			Angle = _mm256_fmadd_ps(Ratio2, Angle, _mm256_set1_ps(AA_ATAN_COEFF2));
+			Angle = _mm256_fmadd_ps(Ratio2, Angle, _mm256_set1_ps(AA_ATAN_COEFF1));
+			Angle = _mm256_fmadd_ps(_mm256_mul_ps(Ratio2, Ratio), Angle, Ratio);
+			Angle = _mm256_add_ps(Angle, _mm256_and_ps(bShifted, _mm256_set1_ps(AA_PI_BY_4)));
+
+			Angle = Select(_mm256_cmp_ps(AbsY, AbsX, _CMP_GT_OQ), _mm256_sub_ps(_mm256_set1_ps(AA_PI_BY_2), Angle), Angle);
+			// blendv only reads the sign bit, so X itself is the mask of the negative X
+			Angle = Select(X, _mm256_sub_ps(_mm256_set1_ps(AA_PI), Angle), Angle);
+			return _mm256_xor_ps(Angle, _mm256_and_ps(Y, SignMask));
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 Exp(__m256 A)
+		{
+			const __m256 Clamped = _mm256_min_ps(_mm256_set1_ps(AA_EXP_MAX_INPUT), _mm256_max_ps(_mm256_set1_ps(AA_EXP_MIN_INPUT), A));
+			const __m256i Exponent = _mm256_cvtps_epi32(_mm256_mul_ps(Clamped, _mm256_set1_ps(AA_LOG2_E)));
+			const __m256 ExponentFloat = _mm256_cvtepi32_ps(Exponent);
+			__m256 Reduced = _mm256_fnmadd_ps(ExponentFloat, _mm256_set1_ps(AA_LN_2_PART1), Clamped);
+			Reduced = _mm256_fnmadd_ps(ExponentFloat, _mm256_set1_ps(AA_LN_2_PART2), Reduced);
+
+			__m256 Poly = _mm256_fmadd_ps(Reduced, _mm256_set1_ps(AA_EXP_COEFF5), _mm256_set1_ps(AA_EXP_COEFF4));
+			Poly = _mm256_fmadd_ps(Reduced, Poly, _mm256_set1_ps(AA_EXP_COEFF3));
+			Poly = _mm256_fmadd_ps(Reduced, Poly, _mm256_set1_ps(AA_EXP_COEFF2));
+			Poly = _mm256_fmadd_ps(Reduced, Poly, _mm256_set1_ps(AA_EXP_COEFF1));
+			Poly = _mm256_fmadd_ps(Reduced, Poly, _mm256_set1_ps(AA_EXP_COEFF0));
+			Poly = _mm256_fmadd_ps(_mm256_mul_ps(Reduced, Reduced), Poly, _mm256_add_ps(Reduced, _mm256_set1_ps(1.0f)));
+
+			const __m256 Scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(Exponent, _mm256_set1_epi32(127)), 23));
+			return _mm256_mul_ps(Poly, Scale);
+		}
+
+		AA_TARGET_AVX2 FORCEINLINE __m256 Log(__m256 A)
+		{
+			const __m256i Bits = _mm256_castps_si256(_mm256_max_ps(_mm256_set1_ps(1.17549435e-38f), A));
+			__m256 Mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F000000)));
+			__m256 Exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(126)));
+
+			const __m256 One = _mm256_set1_ps(1.0f);
+			const __m256 bSmall = _mm256_cmp_ps(Mantissa, _mm256_set1_ps(AA_INV_SQRT_2), _CMP_LT_OQ);
+			Exponent = _mm256_sub_ps(Exponent, _mm256_and_ps(bSmall, One));
+			Mantissa = _mm256_add_ps(_mm256_sub_ps(Mantissa, One), _mm256_and_ps(bSmall, Mantissa));
+			const __m256 Mantissa2 = _mm256_mul_ps(Mantissa, Mantissa);
+
+			__m256 Poly = _mm256_fmadd_ps(Mantissa, _mm256_set1_ps(AA_LOG_COEFF8), _mm256_set1_ps(AA_LOG_COEFF7));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF6));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF5));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF4));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF3));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF2));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF1));
+			Poly = _mm256_fmadd_ps(Mantissa, Poly, _mm256_set1_ps(AA_LOG_COEFF0));
+			Poly = _mm256_mul_ps(_mm256_mul_ps(Poly, Mantissa2), Mantissa);
+
+			Poly = _mm256_fmadd_ps(Exponent, _mm256_set1_ps(AA_LN_2_PART2), Poly);
+			Poly = _mm256_fmadd_ps(Mantissa2, _mm256_set1_ps(-0.5f), Poly);
+			__m256 Result = _mm256_fmadd_ps(Exponent, _mm256_set1_ps(AA_LN_2_PART1), _mm256_add_ps(Mantissa, Poly));
+
+			const __m256 Zero = _mm256_setzero_ps();
+			Result = _mm256_or_ps(Result, _mm256_cmp_ps(A, Zero, _CMP_NGE_UQ));
+			return Select(_mm256_cmp_ps(A, Zero, _CMP_EQ_OQ), _mm256_set1_ps(-INFINITY), Result);
+		}
+
+		/*
+		* OutValues[i] = Function(Values[i]) eight values at a time.
+		* @returns Number of values done, the caller passes the rest to the SSE kernel.
+		*/
+		template<__m256 (*Function)(__m256)>
+		AA_TARGET_AVX2 FORCEINLINE size_t MapArray(const float* Values, float* OutValues, size_t Num)
+		{
+			size_t Index = 0;
+			for (; Index + 8 <= Num; Index += 8)
+			{
+				_mm256_storeu_ps(OutValues + Index, Function(_mm256_loadu_ps(Values + Index)));
+			}
+			_mm256_zeroupper();
+			return Index;
+		}
+	}
+
+	AA_TARGET_AVX2 void MatrixMultiplyAVX2(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2)
+	{
+		MatrixMultiply(Result->MLin, Mat1->MLin, Mat2->MLin);
+		_mm256_zeroupper();
+	}
+
+	AA_TARGET_AVX2 void MatrixMultiplyAVX2(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2)
+	{
+		const double* A = Mat1->MLin;
+		const double* B = Mat2->MLin;
+
+		const __m256d B0 = _mm256_loadu_pd(B + 0);
+		const __m256d B1 = _mm256_loadu_pd(B + 4);
+		const __m256d B2 = _mm256_loadu_pd(B + 8);
+		const __m256d B3 = _mm256_loadu_pd(B + 12);
+
+		__m256d Rows[4];
+		for (int Row = 0; Row < 4; Row++)
+		{
+			const double* ARow = A + Row * 4;
+			__m256d ResRow = _mm256_mul_pd(_mm256_broadcast_sd(ARow + 0), B0);
+			ResRow = _mm256_fmadd_pd(_mm256_broadcast_sd(ARow + 1), B1, ResRow);
+			ResRow = _mm256_fmadd_pd(_mm256_broadcast_sd(ARow + 2), B2, ResRow);
+			Rows[Row] = _mm256_fmadd_pd(_mm256_broadcast_sd(ARow + 3), B3, ResRow);
+		}
+
+		// Stored once every row is done, in case Result is Mat1
+		_mm256_storeu_pd(Result->MLin + 0, Rows[0]);
+		_mm256_storeu_pd(Result->MLin + 4, Rows[1]);
+		_mm256_storeu_pd(Result->MLin + 8, Rows[2]);
+		_mm256_storeu_pd(Result->MLin + 12, Rows[3]);
+		_mm256_zeroupper();
+	}
+
+	AA_TARGET_AVX2 bool MatrixInverseAVX2(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		const __m256d Row0 = _mm256_loadu_pd(Mat->MLin + 0);
+		const __m256d Row1 = _mm256_loadu_pd(Mat->MLin + 4);
+		const __m256d Row2 = _mm256_loadu_pd(Mat->MLin + 8);
+		const __m256d Row3 = _mm256_loadu_pd(Mat->MLin + 12);
+
+		// The 2x2 blocks [A B; C D] are 128-bit halves of the rows
+		const __m256d A = _mm256_permute2f128_pd(Row0, Row1, 0x20);
+		const __m256d B = _mm256_permute2f128_pd(Row0, Row1, 0x31);
+		const __m256d C = _mm256_permute2f128_pd(Row2, Row3, 0x20);
+		const __m256d D = _mm256_permute2f128_pd(Row2, Row3, 0x31);
+
+		// In-lane unpacks give the block determinants as (Det A, Det C, Det B, Det D)
+		const __m256d BlockDets = _mm256_fmsub_pd(_mm256_unpacklo_pd(Row0, Row2), _mm256_unpackhi_pd(Row1, Row3),
+			_mm256_mul_pd(_mm256_unpackhi_pd(Row0, Row2), _mm256_unpacklo_pd(Row1, Row3)));
+		const __m256d DetA = Swizzle<0, 0, 0, 0>(BlockDets);
+		const __m256d DetC = Swizzle<1, 1, 1, 1>(BlockDets);
+		const __m256d DetB = Swizzle<2, 2, 2, 2>(BlockDets);
+		const __m256d DetD = Swizzle<3, 3, 3, 3>(BlockDets);
+
+		const __m256d AdjDC = Matrix2x2AdjointMultiply(D, C);
+		const __m256d AdjAB = Matrix2x2AdjointMultiply(A, B);
+
+		const __m256d Det = _mm256_sub_pd(_mm256_fmadd_pd(DetA, DetD, _mm256_mul_pd(DetB, DetC)),
+			HorizontalSum(_mm256_mul_pd(AdjAB, Swizzle<0, 2, 1, 3>(AdjDC))));
+
+		if (_mm256_cvtsd_f64(Det) == 0.0)
+		{
+			_mm256_zeroupper();
+			return false;
+		}
+
+		const __m256d X = _mm256_fmsub_pd(DetD, A, Matrix2x2Multiply(B, AdjDC));
+		const __m256d W = _mm256_fmsub_pd(DetA, D, Matrix2x2Multiply(C, AdjAB));
+		const __m256d Y = _mm256_fmsub_pd(DetB, C, Matrix2x2MultiplyAdjoint(D, AdjAB));
+		const __m256d Z = _mm256_fmsub_pd(DetC, B, Matrix2x2MultiplyAdjoint(A, AdjDC));
+
+		const __m256d OneByDet = _mm256_div_pd(_mm256_setr_pd(1.0, -1.0, -1.0, 1.0), Det);
+		const __m256d ScaledX = _mm256_mul_pd(X, OneByDet);
+		const __m256d ScaledY = _mm256_mul_pd(Y, OneByDet);
+		const __m256d ScaledZ = _mm256_mul_pd(Z, OneByDet);
+		const __m256d ScaledW = _mm256_mul_pd(W, OneByDet);
+
+		_mm256_storeu_pd(Result->MLin + 0, Shuffle<3, 1, 3, 1>(ScaledX, ScaledY));
+		_mm256_storeu_pd(Result->MLin + 4, Shuffle<2, 0, 2, 0>(ScaledX, ScaledY));
+		_mm256_storeu_pd(Result->MLin + 8, Shuffle<3, 1, 3, 1>(ScaledZ, ScaledW));
+		_mm256_storeu_pd(Result->MLin + 12, Shuffle<2, 0, 2, 0>(ScaledZ, ScaledW));
+		_mm256_zeroupper();
+		return true;
+	}
+
+	AA_TARGET_AVX2 bool MatrixInverseAffineAVX2(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		const __m256d Row0 = _mm256_loadu_pd(Mat->MLin + 0);
+		const __m256d Row1 = _mm256_loadu_pd(Mat->MLin + 4);
+		const __m256d Row2 = _mm256_loadu_pd(Mat->MLin + 8);
+		const __m256d Translation = _mm256_loadu_pd(Mat->MLin + 12);
+
+		const __m256d Cross0 = Cross(Row1, Row2);
+		const __m256d Cross1 = Cross(Row2, Row0);
+		const __m256d Cross2 = Cross(Row0, Row1);
+
+		const __m256d Det = HorizontalSum(_mm256_mul_pd(Row0, Cross0));
+		if (_mm256_cvtsd_f64(Det) == 0.0)
+		{
+			_mm256_zeroupper();
+			return false;
+		}
+		const __m256d OneByDet = _mm256_div_pd(_mm256_set1_pd(1.0), Det);
+
+		// Transpose of the adjugate columns, the fourth column is the zero W of the cross products
+		const __m256d Zero = _mm256_setzero_pd();
+		const __m256d Low01 = _mm256_unpacklo_pd(Cross0, Cross1);
+		const __m256d High01 = _mm256_unpackhi_pd(Cross0, Cross1);
+		const __m256d Low2 = _mm256_unpacklo_pd(Cross2, Zero);
+		const __m256d High2 = _mm256_unpackhi_pd(Cross2, Zero);
+		const __m256d Inv0 = _mm256_mul_pd(_mm256_permute2f128_pd(Low01, Low2, 0x20), OneByDet);
+		const __m256d Inv1 = _mm256_mul_pd(_mm256_permute2f128_pd(High01, High2, 0x20), OneByDet);
+		const __m256d Inv2 = _mm256_mul_pd(_mm256_permute2f128_pd(Low01, Low2, 0x31), OneByDet);
+
+		__m256d InvTranslation = _mm256_mul_pd(Swizzle<0, 0, 0, 0>(Translation), Inv0);
+		InvTranslation = _mm256_fmadd_pd(Swizzle<1, 1, 1, 1>(Translation), Inv1, InvTranslation);
+		InvTranslation = _mm256_fmadd_pd(Swizzle<2, 2, 2, 2>(Translation), Inv2, InvTranslation);
+		InvTranslation = _mm256_sub_pd(_mm256_setr_pd(0.0, 0.0, 0.0, 1.0), InvTranslation);
+
+		_mm256_storeu_pd(Result->MLin + 0, Inv0);
+		_mm256_storeu_pd(Result->MLin + 4, Inv1);
+		_mm256_storeu_pd(Result->MLin + 8, Inv2);
+		_mm256_storeu_pd(Result->MLin + 12, InvTranslation);
+		_mm256_zeroupper();
+		return true;
+	}
+
+	AA_TARGET_AVX2 void TransformPointsAVX2(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat)
+	{
+		__m256 Elements[4][3];
+		for (int Row = 0; Row < 4; Row++)
+		{
+			for (int Column = 0; Column < 3; Column++)
+			{
+				Elements[Row][Column] = _mm256_set1_ps(Mat->M[Row][Column]);
+			}
+		}
+
+		size_t Index = 0;
+		for (; Index + 8 <= Num; Index += 8)
+		{
+			__m256 X, Y, Z;
+			Deinterleave3(Points[Index].XYZ, X, Y, Z);
+
+			__m256 Result[3];
+			for (int Column = 0; Column < 3; Column++)
+			{
+				Result[Column] = _mm256_fmadd_ps(X, Elements[0][Column], Elements[3][Column]);
+				Result[Column] = _mm256_fmadd_ps(Y, Elements[1][Column], Result[Column]);
+				Result[Column] = _mm256_fmadd_ps(Z, Elements[2][Column], Result[Column]);
+			}
+
+			Interleave3(Result[0], Result[1], Result[2], OutPoints[Index].XYZ);
+		}
+		_mm256_zeroupper();
+
+		if (Index < Num)
+		{
+			TransformPointsSSE(Points + Index, OutPoints + Index, Num - Index, Mat);
+		}
+	}
+
+	AA_TARGET_AVX2 void MultiplyMatricesAVX2(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num)
+	{
+		for (size_t Index = 0; Index < Num; Index++)
+		{
+			MatrixMultiply(OutMatrices[Index].MLin, Mats1[Index].MLin, Mats2[Index].MLin);
+		}
+		_mm256_zeroupper();
+	}
+
+	AA_TARGET_AVX2 void ComposeTransformsAVX2(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num)
+	{
+		const __m256 Zero = _mm256_setzero_ps();
+		const __m256 One = _mm256_set1_ps(1.0f);
+
+		size_t Index = 0;
+		for (; Index + 8 <= Num; Index += 8)
+		{
+			// One register per component, the low halves hold transforms Index to Index + 3 and the high halves Index + 4 to Index + 7
+			__m256 TX, TY, TZ, SX, SY, SZ;
+			Deinterleave3(Locations[Index].XYZ, TX, TY, TZ);
+			Deinterleave3(Scales[Index].XYZ, SX, SY, SZ);
+
+			__m256 QX = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(Rotations[Index].XYZW)), _mm_load_ps(Rotations[Index + 4].XYZW), 1);
+			__m256 QY = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(Rotations[Index + 1].XYZW)), _mm_load_ps(Rotations[Index + 5].XYZW), 1);
+			__m256 QZ = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(Rotations[Index + 2].XYZW)), _mm_load_ps(Rotations[Index + 6].XYZW), 1);
+			__m256 QW = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(Rotations[Index + 3].XYZW)), _mm_load_ps(Rotations[Index + 7].XYZW), 1);
+			Transpose4x4(QX, QY, QZ, QW);
+
+			const __m256 X2 = _mm256_add_ps(QX, QX);
+			const __m256 Y2 = _mm256_add_ps(QY, QY);
+			const __m256 Z2 = _mm256_add_ps(QZ, QZ);
+			const __m256 XX = _mm256_mul_ps(QX, X2);
+			const __m256 YY = _mm256_mul_ps(QY, Y2);
+			const __m256 ZZ = _mm256_mul_ps(QZ, Z2);
+			const __m256 XY = _mm256_mul_ps(QX, Y2);
+			const __m256 XZ = _mm256_mul_ps(QX, Z2);
+			const __m256 YZ = _mm256_mul_ps(QY, Z2);
+			const __m256 WX = _mm256_mul_ps(QW, X2);
+			const __m256 WY = _mm256_mul_ps(QW, Y2);
+			const __m256 WZ = _mm256_mul_ps(QW, Z2);
+
+			// Same rows as ComposeTransformsSSE
+			StoreRowOfEight(_mm256_mul_ps(_mm256_sub_ps(One, _mm256_add_ps(YY, ZZ)), SX), _mm256_mul_ps(_mm256_add_ps(XY, WZ), SX), _mm256_mul_ps(_mm256_sub_ps(XZ, WY), SX), Zero, OutMatrices + Index, 0);
+			StoreRowOfEight(_mm256_mul_ps(_mm256_sub_ps(XY, WZ), SY), _mm256_mul_ps(_mm256_sub_ps(One, _mm256_add_ps(XX, ZZ)), SY), _mm256_mul_ps(_mm256_add_ps(YZ, WX), SY), Zero, OutMatrices + Index, 1);
+			StoreRowOfEight(_mm256_mul_ps(_mm256_add_ps(XZ, WY), SZ), _mm256_mul_ps(_mm256_sub_ps(YZ, WX), SZ), _mm256_mul_ps(_mm256_sub_ps(One, _mm256_add_ps(XX, YY)), SZ), Zero, OutMatrices + Index, 2);
+			StoreRowOfEight(TX, TY, TZ, One, OutMatrices + Index, 3);
+		}
+		_mm256_zeroupper();
+
+		if (Index < Num)
+		{
+			ComposeTransformsSSE(Locations + Index, Rotations + Index, Scales + Index, OutMatrices + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void SinAVX2(const float* Angles, float* OutSines, size_t Num)
+	{
+		const size_t Index = MapArray<&Sin>(Angles, OutSines, Num);
+		if (Index < Num)
+		{
+			SinSSE(Angles + Index, OutSines + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void CosAVX2(const float* Angles, float* OutCosines, size_t Num)
+	{
+		const size_t Index = MapArray<&Cos>(Angles, OutCosines, Num);
+		if (Index < Num)
+		{
+			CosSSE(Angles + Index, OutCosines + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void SinCosAVX2(const float* Angles, float* OutSines, float* OutCosines, size_t Num)
+	{
+		size_t Index = 0;
+		for (; Index + 8 <= Num; Index += 8)
+		{
+			__m256 SinValue, CosValue;
+			SinCos(_mm256_loadu_ps(Angles + Index), SinValue, CosValue);
+			_mm256_storeu_ps(OutSines + Index, SinValue);
+			_mm256_storeu_ps(OutCosines + Index, CosValue);
+		}
+		_mm256_zeroupper();
+
+		if (Index < Num)
+		{
+			SinCosSSE(Angles + Index, OutSines + Index, OutCosines + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void TanAVX2(const float* Angles, float* OutTangents, size_t Num)
+	{
+		const size_t Index = MapArray<&Tan>(Angles, OutTangents, Num);
+		if (Index < Num)
+		{
+			TanSSE(Angles + Index, OutTangents + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void ATan2AVX2(const float* Ys, const float* Xs, float* OutAngles, size_t Num)
+	{
+		size_t Index = 0;
+		for (; Index + 8 <= Num; Index += 8)
+		{
+			_mm256_storeu_ps(OutAngles + Index, ATan2(_mm256_loadu_ps(Ys + Index), _mm256_loadu_ps(Xs + Index)));
+		}
+		_mm256_zeroupper();
+
+		if (Index < Num)
+		{
+			ATan2SSE(Ys + Index, Xs + Index, OutAngles + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void ExpAVX2(const float* Values, float* OutValues, size_t Num)
+	{
+		const size_t Index = MapArray<&Exp>(Values, OutValues, Num);
+		if (Index < Num)
+		{
+			ExpSSE(Values + Index, OutValues + Index, Num - Index);
+		}
+	}
+
+	AA_TARGET_AVX2 void LogAVX2(const float* Values, float* OutValues, size_t Num)
+	{
+		const size_t Index = MapArray<&Log>(Values, OutValues, Num);
+		if (Index < Num)
+		{
+			LogSSE(Values + Index, OutValues + Index, Num - Index);
+		}
+	}
+}
+}
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#if AA_PLATFORM_USING_SIMD
+#include "Math/MathForwards.h"
+
+namespace AAEngine {
+namespace Math {
+
+	/*
+	* AVX2 / FMA kernels, 256-bit versions of the MathSSE.h matrix products.
+	* They are compiled out of line with AA_TARGET_AVX2 so the rest of the engine stays on the SSE2 baseline,
+	* only call them on CPUs where FPlatformCPU::HasAVX2() is true, usually through FMathDispatch.
+	*/
+
+	/*
+	* Result = Mat1 * Mat2, two rows per 256-bit register.
+	*/
+	void MatrixMultiplyAVX2(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2);
+
+	/*
+	* Result = Mat1 * Mat2, one row per __m256d.
+	*/
+	void MatrixMultiplyAVX2(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2);
+
+	/*
+	* Result = Inverse(Mat) through 2x2 blocks like MatrixInverseSSE, one row per __m256d.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	bool MatrixInverseAVX2(FMatrix44d* Result, const FMatrix44d* Mat);
+
+	/*
+	* Result = Inverse(Mat) for a Mat with last column (0, 0, 0, 1), like MatrixInverseAffineSSE.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	bool MatrixInverseAffineAVX2(FMatrix44d* Result, const FMatrix44d* Mat);
+
+	/*
+	* FMathBatch kernels, 8 elements per iteration, the remaining ones go through the SSE kernels.
+	*/
+	void TransformPointsAVX2(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat);
+	void MultiplyMatricesAVX2(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num);
+	void ComposeTransformsAVX2(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num);
+	void SinAVX2(const float* Angles, float* OutSines, size_t Num);
+	void CosAVX2(const float* Angles, float* OutCosines, size_t Num);
+	void SinCosAVX2(const float* Angles, float* OutSines, float* OutCosines, size_t Num);
+	void TanAVX2(const float* Angles, float* OutTangents, size_t Num);
+	void ATan2AVX2(const float* Ys, const float* Xs, float* OutAngles, size_t Num);
+	void ExpAVX2(const float* Values, float* OutValues, size_t Num);
+	void LogAVX2(const float* Values, float* OutValues, size_t Num);
+}
+}
+#endif
@@ -0,0 +1,486 @@
+#include "AA_PreCompiledHeaders.h"
+#include "Math/MathBatch.h"
+#include "Math/MathDispatch.h"
+#include "Math/Quaternion.h"
+#include "Threading/ParallelFor.h"
+
+namespace AAEngine {
+namespace Math {
+
+	namespace {
+		/*
+		* Runs Kernel(Start, Count) over [0, Num), split in MATH_BATCH_TASK_SIZE tasks across threads once Num reaches ParallelMin.
+		*/
+		template<typename KernelType>
+		void RunBatch(size_t Num, size_t ParallelMin, KernelType&& Kernel)
+		{
+			if (Num < ParallelMin)
+			{
+				Kernel(0, Num);
+				return;
+			}
+
+			const size_t NumTasks = (Num + MATH_BATCH_TASK_SIZE - 1) / MATH_BATCH_TASK_SIZE;
+			ParallelFor(NumTasks, [&](size_t Task)
+			{
+				const size_t Start = Task * MATH_BATCH_TASK_SIZE;
+				Kernel(Start, Num - Start < MATH_BATCH_TASK_SIZE ? Num - Start : MATH_BATCH_TASK_SIZE);
+			});
+		}
+
+		/*
+		* Kernels of the active backend, resolving the backend first so the worker threads call the real kernels instead of the resolve stubs.
+		*/
+		FORCEINLINE const FMathKernels& GetResolvedKernels() noexcept
+		{
+			FMathDispatch::GetBackend();
+			return FMathDispatch::GetActiveKernels();
+		}
+	}
+
+	void FMathBatch::TransformPoints(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f& Mat) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().TransformPointsFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_POINTS, [&](size_t Start, size_t Count)
+		{
+			Kernel(Points + Start, OutPoints + Start, Count, &Mat);
+		});
+	}
+
+	void FMathBatch::MultiplyMatrices(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().MultiplyMatricesFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_MATRICES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Mats1 + Start, Mats2 + Start, OutMatrices + Start, Count);
+		});
+	}
+
+	void FMathBatch::ComposeTransforms(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().ComposeTransformsFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_MATRICES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Locations + Start, Rotations + Start, Scales + Start, OutMatrices + Start, Count);
+		});
+	}
+
+	void FMathBatch::NlerpQuaternions(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().NlerpQuaternionsFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_QUATERNIONS, [&](size_t Start, size_t Count)
+		{
+			Kernel(Quats1 + Start, Quats2 + Start, OutQuats + Start, Count, Alpha);
+		});
+	}
+
+	void FMathBatch::SlerpQuaternions(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().SlerpQuaternionsFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_QUATERNIONS, [&](size_t Start, size_t Count)
+		{
+			Kernel(Quats1 + Start, Quats2 + Start, OutQuats + Start, Count, Alpha);
+		});
+	}
+
+	void FMathBatch::Sin(const float* Angles, float* OutSines, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().SinFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Angles + Start, OutSines + Start, Count);
+		});
+	}
+
+	void FMathBatch::Cos(const float* Angles, float* OutCosines, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().CosFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Angles + Start, OutCosines + Start, Count);
+		});
+	}
+
+	void FMathBatch::SinCos(const float* Angles, float* OutSines, float* OutCosines, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().SinCosFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Angles + Start, OutSines + Start, OutCosines + Start, Count);
+		});
+	}
+
+	void FMathBatch::Tan(const float* Angles, float* OutTangents, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().TanFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Angles + Start, OutTangents + Start, Count);
+		});
+	}
+
+	void FMathBatch::ATan2(const float* Ys, const float* Xs, float* OutAngles, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().ATan2Float;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Ys + Start, Xs + Start, OutAngles + Start, Count);
+		});
+	}
+
+	void FMathBatch::Exp(const float* Values, float* OutValues, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().ExpFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Values + Start, OutValues + Start, Count);
+		});
+	}
+
+	void FMathBatch::Log(const float* Values, float* OutValues, size_t Num) noexcept
+	{
+		const auto Kernel = GetResolvedKernels().LogFloat;
+		RunBatch(Num, MATH_BATCH_PARALLEL_MIN_VALUES, [&](size_t Start, size_t Count)
+		{
+			Kernel(Values + Start, OutValues + Start, Count);
+		});
+	}
+
+#if AA_PLATFORM_USING_SIMD
+	namespace {
+		/*
+		* Four packed FVector3f (12 floats in 3 registers) to one register per component, and back.
+		*/
+		FORCEINLINE void VectorDeinterleave3(const VectorRegister4Float& V0, const VectorRegister4Float& V1, const VectorRegister4Float& V2,
+			VectorRegister4Float& X, VectorRegister4Float& Y, VectorRegister4Float& Z)
+		{
+			// V0 = (X0 Y0 Z0 X1), V1 = (Y1 Z1 X2 Y2), V2 = (Z2 X3 Y3 Z3)
+			X = VectorShuffle(V0, VectorShuffle(V1, V2, 2, 2, 1, 1), 0, 3, 0, 2);
+			Y = VectorShuffle(VectorShuffle(V0, V1, 1, 1, 0, 0), VectorShuffle(V1, V2, 3, 3, 2, 2), 0, 2, 0, 2);
+			Z = VectorShuffle(VectorShuffle(V0, V1, 2, 2, 1, 1), V2, 0, 2, 0, 3);
+		}
+
+		FORCEINLINE void VectorInterleave3(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z,
+			VectorRegister4Float& V0, VectorRegister4Float& V1, VectorRegister4Float& V2)
+		{
+			V0 = VectorShuffle(VectorShuffle(X, Y, 0, 0, 0, 0), VectorShuffle(Z, X, 0, 0, 1, 1), 0, 2, 0, 2);
+			V1 = VectorShuffle(VectorShuffle(Y, Z, 1, 1, 1, 1), VectorShuffle(X, Y, 2, 2, 2, 2), 0, 2, 0, 2);
+			V2 = VectorShuffle(VectorShuffle(Z, X, 2, 2, 3, 3), VectorShuffle(Y, Z, 3, 3, 3, 3), 0, 2, 0, 2);
+		}
+
+		/*
+		* Four quaternions to one register per component and back.
+		*/
+		FORCEINLINE void VectorLoadQuaternions4(const FQuaternionf* Quats, VectorRegister4Float& X, VectorRegister4Float& Y, VectorRegister4Float& Z, VectorRegister4Float& W)
+		{
+			X = VectorLoadAligned(Quats[0].XYZW);
+			Y = VectorLoadAligned(Quats[1].XYZW);
+			Z = VectorLoadAligned(Quats[2].XYZW);
+			W = VectorLoadAligned(Quats[3].XYZW);
+			VectorTranspose4x4(X, Y, Z, W);
+		}
+
+		/*
+		* OutQuats[k] = Normalize(Quat1[k] * Scale1[k] + Quat2[k] * Scale2[k]), with Scale2 taking the sign of CosAngle so the blend takes the short way.
+		*/
+		FORCEINLINE void VectorBlendQuaternions4(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats,
+			const VectorRegister4Float& CosAngle, const VectorRegister4Float& Scale1, VectorRegister4Float Scale2)
+		{
+			// Scale2 is positive, so flipping its sign bit with the one of CosAngle gives the short way
+			Scale2 = _mm_xor_ps(Scale2, _mm_and_ps(CosAngle, _mm_set1_ps(-0.0f)));
+
+			VectorRegister4Float X1, Y1, Z1, W1, X2, Y2, Z2, W2;
+			VectorLoadQuaternions4(Quats1, X1, Y1, Z1, W1);
+			VectorLoadQuaternions4(Quats2, X2, Y2, Z2, W2);
+
+			VectorRegister4Float X = VectorMultiplyAdd(X2, Scale2, VectorMultiply(X1, Scale1));
+			VectorRegister4Float Y = VectorMultiplyAdd(Y2, Scale2, VectorMultiply(Y1, Scale1));
+			VectorRegister4Float Z = VectorMultiplyAdd(Z2, Scale2, VectorMultiply(Z1, Scale1));
+			VectorRegister4Float W = VectorMultiplyAdd(W2, Scale2, VectorMultiply(W1, Scale1));
+
+			VectorRegister4Float SizeSquared = VectorMultiply(X, X);
+			SizeSquared = VectorMultiplyAdd(Y, Y, SizeSquared);
+			SizeSquared = VectorMultiplyAdd(Z, Z, SizeSquared);
+			SizeSquared = VectorMultiplyAdd(W, W, SizeSquared);
+			const VectorRegister4Float InvSize = VectorDivide(MakeVectorRegister4Float(1.0f, 1.0f, 1.0f, 1.0f), VectorSqrt(SizeSquared));
+
+			X = VectorMultiply(X, InvSize);
+			Y = VectorMultiply(Y, InvSize);
+			Z = VectorMultiply(Z, InvSize);
+			W = VectorMultiply(W, InvSize);
+			VectorTranspose4x4(X, Y, Z, W);
+			VectorStoreAligned(X, OutQuats[0].XYZW);
+			VectorStoreAligned(Y, OutQuats[1].XYZW);
+			VectorStoreAligned(Z, OutQuats[2].XYZW);
+			VectorStoreAligned(W, OutQuats[3].XYZW);
+		}
+
+		/*
+		* Dot products of four pairs of quaternions.
+		*/
+		FORCEINLINE VectorRegister4Float VectorDotQuaternions4(const FQuaternionf* Quats1, const FQuaternionf* Quats2)
+		{
+			// Element wise products of every pair, summed after the transpose
+			VectorRegister4Float Dot0 = VectorMultiply(VectorLoadAligned(Quats1[0].XYZW), VectorLoadAligned(Quats2[0].XYZW));
+			VectorRegister4Float Dot1 = VectorMultiply(VectorLoadAligned(Quats1[1].XYZW), VectorLoadAligned(Quats2[1].XYZW));
+			VectorRegister4Float Dot2 = VectorMultiply(VectorLoadAligned(Quats1[2].XYZW), VectorLoadAligned(Quats2[2].XYZW));
+			VectorRegister4Float Dot3 = VectorMultiply(VectorLoadAligned(Quats1[3].XYZW), VectorLoadAligned(Quats2[3].XYZW));
+			VectorTranspose4x4(Dot0, Dot1, Dot2, Dot3);
+			return VectorAdd(VectorAdd(Dot0, Dot1), VectorAdd(Dot2, Dot3));
+		}
+
+		/*
+		* Last 1 to 3 values of an array in a zero padded register and back, so the tails of the transcendental kernels
+		* get the same approximation as the rest instead of the libm one of the scalar kernels.
+		*/
+		FORCEINLINE VectorRegister4Float VectorLoadTail(const float* Values, size_t Num)
+		{
+			alignas(16) float Padded[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				Padded[Index] = Values[Index];
+			}
+			return VectorLoadAligned(Padded);
+		}
+
+		FORCEINLINE void VectorStoreTail(const VectorRegister4Float& Reg, float* OutValues, size_t Num)
+		{
+			alignas(16) float Padded[4];
+			VectorStoreAligned(Reg, Padded);
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				OutValues[Index] = Padded[Index];
+			}
+		}
+
+		/*
+		* OutValues[i] = Function(Values[i]) four values at a time.
+		*/
+		template<VectorRegister4Float (*Function)(const VectorRegister4Float&)>
+		FORCEINLINE void VectorMapArray(const float* Values, float* OutValues, size_t Num)
+		{
+			size_t Index = 0;
+			for (; Index + 4 <= Num; Index += 4)
+			{
+				VectorStore(Function(VectorLoad(Values + Index)), OutValues + Index);
+			}
+
+			if (Index < Num)
+			{
+				VectorStoreTail(Function(VectorLoadTail(Values + Index, Num - Index)), OutValues + Index, Num - Index);
+			}
+		}
+
+		/*
+		* Transposes the four registers so row Row of OutMatrices[k] gets element k of every register.
+		*/
+		FORCEINLINE void VectorStoreRowOfFour(VectorRegister4Float Column0, VectorRegister4Float Column1, VectorRegister4Float Column2, VectorRegister4Float Column3,
+			FMatrix44f* OutMatrices, int Row)
+		{
+			VectorTranspose4x4(Column0, Column1, Column2, Column3);
+			VectorStoreAligned(Column0, OutMatrices[0].M[Row]);
+			VectorStoreAligned(Column1, OutMatrices[1].M[Row]);
+			VectorStoreAligned(Column2, OutMatrices[2].M[Row]);
+			VectorStoreAligned(Column3, OutMatrices[3].M[Row]);
+		}
+	}
+
+	void TransformPointsSSE(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat)
+	{
+		// Every element of the upper 4x3 of the matrix in its own register
+		VectorRegister4Float Elements[4][3];
+		for (int Row = 0; Row < 4; Row++)
+		{
+			for (int Column = 0; Column < 3; Column++)
+			{
+				Elements[Row][Column] = MakeVectorRegister4Float(Mat->M[Row][Column], Mat->M[Row][Column], Mat->M[Row][Column], Mat->M[Row][Column]);
+			}
+		}
+
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const float* Src = Points[Index].XYZ;
+			VectorRegister4Float X, Y, Z;
+			VectorDeinterleave3(VectorLoad(Src), VectorLoad(Src + 4), VectorLoad(Src + 8), X, Y, Z);
+
+			VectorRegister4Float Result[3];
+			for (int Column = 0; Column < 3; Column++)
+			{
+				Result[Column] = VectorMultiplyAdd(X, Elements[0][Column], Elements[3][Column]);
+				Result[Column] = VectorMultiplyAdd(Y, Elements[1][Column], Result[Column]);
+				Result[Column] = VectorMultiplyAdd(Z, Elements[2][Column], Result[Column]);
+			}
+
+			VectorRegister4Float V0, V1, V2;
+			VectorInterleave3(Result[0], Result[1], Result[2], V0, V1, V2);
+			float* Dest = OutPoints[Index].XYZ;
+			VectorStore(V0, Dest);
+			VectorStore(V1, Dest + 4);
+			VectorStore(V2, Dest + 8);
+		}
+
+		if (Index < Num)
+		{
+			FMathDispatch::GetKernels(EMathBackend::Scalar).TransformPointsFloat(Points + Index, OutPoints + Index, Num - Index, Mat);
+		}
+	}
+
+	void MultiplyMatricesSSE(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num)
+	{
+		for (size_t Index = 0; Index < Num; Index++)
+		{
+			MatrixMultiplySSE(&OutMatrices[Index], &Mats1[Index], &Mats2[Index]);
+		}
+	}
+
+	void ComposeTransformsSSE(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num)
+	{
+		const VectorRegister4Float Zero = MakeVectorRegister4Float(0.0f, 0.0f, 0.0f, 0.0f);
+		const VectorRegister4Float One = MakeVectorRegister4Float(1.0f, 1.0f, 1.0f, 1.0f);
+
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			// One register per component, element k of every register belongs to transform Index + k
+			VectorRegister4Float TX, TY, TZ, SX, SY, SZ;
+			const float* Location = Locations[Index].XYZ;
+			const float* Scale = Scales[Index].XYZ;
+			VectorDeinterleave3(VectorLoad(Location), VectorLoad(Location + 4), VectorLoad(Location + 8), TX, TY, TZ);
+			VectorDeinterleave3(VectorLoad(Scale), VectorLoad(Scale + 4), VectorLoad(Scale + 8), SX, SY, SZ);
+
+			VectorRegister4Float QX = VectorLoadAligned(Rotations[Index].XYZW);
+			VectorRegister4Float QY = VectorLoadAligned(Rotations[Index + 1].XYZW);
+			VectorRegister4Float QZ = VectorLoadAligned(Rotations[Index + 2].XYZW);
+			VectorRegister4Float QW = VectorLoadAligned(Rotations[Index + 3].XYZW);
+			VectorTranspose4x4(QX, QY, QZ, QW);
+
+			const VectorRegister4Float X2 = VectorAdd(QX, QX);
+			const VectorRegister4Float Y2 = VectorAdd(QY, QY);
+			const VectorRegister4Float Z2 = VectorAdd(QZ, QZ);
+			const VectorRegister4Float XX = VectorMultiply(QX, X2);
+			const VectorRegister4Float YY = VectorMultiply(QY, Y2);
+			const VectorRegister4Float ZZ = VectorMultiply(QZ, Z2);
+			const VectorRegister4Float XY = VectorMultiply(QX, Y2);
+			const VectorRegister4Float XZ = VectorMultiply(QX, Z2);
+			const VectorRegister4Float YZ = VectorMultiply(QY, Z2);
+			const VectorRegister4Float WX = VectorMultiply(QW, X2);
+			const VectorRegister4Float WY = VectorMultiply(QW, Y2);
+			const VectorRegister4Float WZ = VectorMultiply(QW, Z2);
+
+			// Rows of the rotation scaled by the scale of their axis, one register per element of the row
+			VectorStoreRowOfFour(VectorMultiply(VectorSubtract(One, VectorAdd(YY, ZZ)), SX), VectorMultiply(VectorAdd(XY, WZ), SX), VectorMultiply(VectorSubtract(XZ, WY), SX), Zero, OutMatrices + Index, 0);
+			VectorStoreRowOfFour(VectorMultiply(VectorSubtract(XY, WZ), SY), VectorMultiply(VectorSubtract(One, VectorAdd(XX, ZZ)), SY), VectorMultiply(VectorAdd(YZ, WX), SY), Zero, OutMatrices + Index, 1);
+			VectorStoreRowOfFour(VectorMultiply(VectorAdd(XZ, WY), SZ), VectorMultiply(VectorSubtract(YZ, WX), SZ), VectorMultiply(VectorSubtract(One, VectorAdd(XX, YY)), SZ), Zero, OutMatrices + Index, 2);
+			VectorStoreRowOfFour(TX, TY, TZ, One, OutMatrices + Index, 3);
+		}
+
+		if (Index < Num)
+		{
+			FMathDispatch::GetKernels(EMathBackend::Scalar).ComposeTransformsFloat(Locations + Index, Rotations + Index, Scales + Index, OutMatrices + Index, Num - Index);
+		}
+	}
+
+	void NlerpQuaternionsSSE(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+	{
+		const VectorRegister4Float Scale1 = MakeVectorRegister4Float(1.0f - Alpha, 1.0f - Alpha, 1.0f - Alpha, 1.0f - Alpha);
+		const VectorRegister4Float Scale2 = MakeVectorRegister4Float(Alpha, Alpha, Alpha, Alpha);
+
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			VectorBlendQuaternions4(Quats1 + Index, Quats2 + Index, OutQuats + Index, VectorDotQuaternions4(Quats1 + Index, Quats2 + Index), Scale1, Scale2);
+		}
+
+		if (Index < Num)
+		{
+			FMathDispatch::GetKernels(EMathBackend::Scalar).NlerpQuaternionsFloat(Quats1 + Index, Quats2 + Index, OutQuats + Index, Num - Index, Alpha);
+		}
+	}
+
+	void SlerpQuaternionsSSE(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+	{
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Float CosAngle = VectorDotQuaternions4(Quats1 + Index, Quats2 + Index);
+
+			// The weights need an ACos and two Sin per pair, those stay scalar
+			alignas(16) float CosAngles[4];
+			alignas(16) float Scales1[4];
+			alignas(16) float Scales2[4];
+			VectorStoreAligned(_mm_andnot_ps(_mm_set1_ps(-0.0f), CosAngle), CosAngles);
+			for (int Pair = 0; Pair < 4; Pair++)
+			{
+				FMathBatch::GetSlerpScales(CosAngles[Pair], Alpha, Scales1[Pair], Scales2[Pair]);
+			}
+
+			VectorBlendQuaternions4(Quats1 + Index, Quats2 + Index, OutQuats + Index, CosAngle, VectorLoadAligned(Scales1), VectorLoadAligned(Scales2));
+		}
+
+		if (Index < Num)
+		{
+			FMathDispatch::GetKernels(EMathBackend::Scalar).SlerpQuaternionsFloat(Quats1 + Index, Quats2 + Index, OutQuats + Index, Num - Index, Alpha);
+		}
+	}
+
+	void SinSSE(const float* Angles, float* OutSines, size_t Num)
+	{
+		VectorMapArray<&VectorSin>(Angles, OutSines, Num);
+	}
+
+	void CosSSE(const float* Angles, float* OutCosines, size_t Num)
+	{
+		VectorMapArray<&VectorCos>(Angles, OutCosines, Num);
+	}
+
+	void SinCosSSE(const float* Angles, float* OutSines, float* OutCosines, size_t Num)
+	{
+		VectorRegister4Float Sin, Cos;
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			VectorSinCos(VectorLoad(Angles + Index), Sin, Cos);
+			VectorStore(Sin, OutSines + Index);
+			VectorStore(Cos, OutCosines + Index);
+		}
+
+		if (Index < Num)
+		{
+			VectorSinCos(VectorLoadTail(Angles + Index, Num - Index), Sin, Cos);
+			VectorStoreTail(Sin, OutSines + Index, Num - Index);
+			VectorStoreTail(Cos, OutCosines + Index, Num - Index);
+		}
+	}
+
+	void TanSSE(const float* Angles, float* OutTangents, size_t Num)
+	{
+		VectorMapArray<&VectorTan>(Angles, OutTangents, Num);
+	}
+
+	void ATan2SSE(const float* Ys, const float* Xs, float* OutAngles, size_t Num)
+	{
+		size_t Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			VectorStore(VectorATan2(VectorLoad(Ys + Index), VectorLoad(Xs + Index)), OutAngles + Index);
+		}
+
+		if (Index < Num)
+		{
+			VectorStoreTail(VectorATan2(VectorLoadTail(Ys + Index, Num - Index), VectorLoadTail(Xs + Index, Num - Index)), OutAngles + Index, Num - Index);
+		}
+	}
+
+	void ExpSSE(const float* Values, float* OutValues, size_t Num)
+	{
+		VectorMapArray<&VectorExp>(Values, OutValues, Num);
+	}
+
+	void LogSSE(const float* Values, float* OutValues, size_t Num)
+	{
+		VectorMapArray<&VectorLog>(Values, OutValues, Num);
+	}
+#endif
+}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Math/Math.h"
+#include "Math/MathForwards.h"
+#include "Containers/SoAArray.h"
+
+/*
+* Smallest count the batch functions split across threads, below it starting the threads costs more than the work.
+*/
+#define MATH_BATCH_PARALLEL_MIN_POINTS 65536
+#define MATH_BATCH_PARALLEL_MIN_MATRICES 8192
+#define MATH_BATCH_PARALLEL_MIN_QUATERNIONS 16384
+#define MATH_BATCH_PARALLEL_MIN_VALUES 65536
+
+/*
+* Elements per task once a batch is split across threads, a multiple of 8 so only the last task has a scalar tail.
+*/
+#define MATH_BATCH_TASK_SIZE 4096
+
+namespace AAEngine {
+namespace Math {
+
+	/*
+	* Math over whole arrays, for mesh baking, culling and animation where calling the per-object operators costs more than the math.
+	* - Every call goes through FMathDispatch once, then runs 4 (SSE) or 8 (AVX2) elements per iteration.
+	* - Large batches are split across threads with ParallelFor.
+	* - Outputs may be the inputs (in place), but must not partially overlap them.
+	*/
+	struct AA_ENGINE_API FMathBatch
+	{
+	public:
+		/*
+		* OutPoints[i] = Points[i] * Mat, with W = 1, so Mat's translation applies.
+		*/
+		static void TransformPoints(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f& Mat) noexcept;
+
+		/*
+		* OutMatrices[i] = Mats1[i] * Mats2[i].
+		*/
+		static void MultiplyMatrices(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num) noexcept;
+
+		/*
+		* Builds the matrix Scale * Rotation * Translation of every transform, with the transform split in one array per component
+		* like the columns of a TSoAArray<FVector3f, FQuaternionf, FVector3f>.
+		* Rotations must be normalized.
+		*/
+		static void ComposeTransforms(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num) noexcept;
+
+		/*
+		* ComposeTransforms over the Location, Rotation and Scale columns of a TSoAArray, OutMatrices needs Transforms.Num() elements.
+		*/
+		FORCEINLINE static void ComposeTransforms(const TSoAArray<FVector3f, FQuaternionf, FVector3f>& Transforms, FMatrix44f* OutMatrices) noexcept
+		{
+			ComposeTransforms(Transforms.GetColumn<0>().Data(), Transforms.GetColumn<1>().Data(), Transforms.GetColumn<2>().Data(), OutMatrices, Transforms.Num());
+		}
+
+		/*
+		* OutQuats[i] = Nlerp(Quats1[i], Quats2[i], Alpha), one blend weight for the whole array like blending two animation poses.
+		*/
+		static void NlerpQuaternions(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha) noexcept;
+
+		/*
+		* OutQuats[i] = Slerp(Quats1[i], Quats2[i], Alpha), see NlerpQuaternions.
+		*/
+		static void SlerpQuaternions(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha) noexcept;
+
+		/*
+		* Transcendental functions over arrays of floats, for procedural animation and bulk rotations.
+		* They use the polynomials of VectorSinCos, VectorTan, VectorATan2, VectorExp and VectorLog, see MathSSE.h for their error bounds and input ranges.
+		* The scalar backend calls FMath::SinCos and libm instead.
+		*/
+		static void Sin(const float* Angles, float* OutSines, size_t Num) noexcept;
+		static void Cos(const float* Angles, float* OutCosines, size_t Num) noexcept;
+		static void SinCos(const float* Angles, float* OutSines, float* OutCosines, size_t Num) noexcept;
+		static void Tan(const float* Angles, float* OutTangents, size_t Num) noexcept;
+
+		/*
+		* OutAngles[i] = ATan2(Ys[i], Xs[i]).
+		*/
+		static void ATan2(const float* Ys, const float* Xs, float* OutAngles, size_t Num) noexcept;
+
+		static void Exp(const float* Values, float* OutValues, size_t Num) noexcept;
+		static void Log(const float* Values, float* OutValues, size_t Num) noexcept;
+
+		/*
+		* Weights of the two quaternions of a slerp, CosAngle is the absolute dot product of the pair.
+		* Close pairs get the lerp weights, where the sines of the angle lose their precision.
+		*/
+		FORCEINLINE static void GetSlerpScales(float CosAngle, float Alpha, float& OutScale1, float& OutScale2) noexcept
+		{
+			OutScale1 = 1.0f - Alpha;
+			OutScale2 = Alpha;
+			if (CosAngle < 0.9999f)
+			{
+				const float Angle = FMath::ACos(CosAngle);
+				const float InvSinAngle = 1.0f / FMath::Sin(Angle);
+				OutScale1 = FMath::Sin(OutScale1 * Angle) * InvSinAngle;
+				OutScale2 = FMath::Sin(OutScale2 * Angle) * InvSinAngle;
+			}
+		}
+	};
+
+#if AA_PLATFORM_USING_SIMD
+	/*
+	* SSE versions of the FMathBatch kernels, call them through FMathDispatch.
+	*/
+	void TransformPointsSSE(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat);
+	void MultiplyMatricesSSE(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num);
+	void ComposeTransformsSSE(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num);
+	void NlerpQuaternionsSSE(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha);
+	void SlerpQuaternionsSSE(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha);
+	void SinSSE(const float* Angles, float* OutSines, size_t Num);
+	void CosSSE(const float* Angles, float* OutCosines, size_t Num);
+	void SinCosSSE(const float* Angles, float* OutSines, float* OutCosines, size_t Num);
+	void TanSSE(const float* Angles, float* OutTangents, size_t Num);
+	void ATan2SSE(const float* Ys, const float* Xs, float* OutAngles, size_t Num);
+	void ExpSSE(const float* Values, float* OutValues, size_t Num);
+	void LogSSE(const float* Values, float* OutValues, size_t Num);
+#endif
+}
+}
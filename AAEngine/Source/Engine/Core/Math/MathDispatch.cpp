@@ -0,0 +1,553 @@
+#include "AA_PreCompiledHeaders.h"
+#include "Math/MathDispatch.h"
+#include "Math/MathAVX.h"
+#include "Math/MathBatch.h"
+#include "Math/Matrix44.h"
+#include "Math/Quaternion.h"
+#include "Platform/PlatformCPU.h"
+
+namespace AAEngine {
+namespace Math {
+
+	namespace {
+		/*
+		* Plain C++ kernels, always available. Kept here instead of MathSISD.h as those are only compiled without SIMD.
+		*/
+		template<typename T>
+		void MatrixMultiplyScalar(TMatrix44<T>* Result, const TMatrix44<T>* Mat1, const TMatrix44<T>* Mat2)
+		{
+			const T (&A)[4][4] = Mat1->M;
+			const T (&B)[4][4] = Mat2->M;
+			T Res[4][4];
+
+			for (int Row = 0; Row < 4; Row++)
+			{
+				for (int Column = 0; Column < 4; Column++)
+				{
+					Res[Row][Column] = A[Row][0] * B[0][Column] + A[Row][1] * B[1][Column] + A[Row][2] * B[2][Column] + A[Row][3] * B[3][Column];
+				}
+			}
+
+			FMemory::MemCopy(Result, Res, sizeof(Res));
+		}
+
+		/*
+		* Cofactor expansion, the 2x2 minors of the last two rows are shared by the first two rows of the adjugate.
+		*/
+		template<typename T>
+		bool MatrixInverseScalar(TMatrix44<T>* Result, const TMatrix44<T>* Mat)
+		{
+			const T (&M)[4][4] = Mat->M;
+
+			// Minors of rows 2 and 3, MinorXY uses columns X and Y
+			const T Minor01 = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+			const T Minor02 = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+			const T Minor03 = M[2][0] * M[3][3] - M[2][3] * M[3][0];
+			const T Minor12 = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+			const T Minor13 = M[2][1] * M[3][3] - M[2][3] * M[3][1];
+			const T Minor23 = M[2][2] * M[3][3] - M[2][3] * M[3][2];
+
+			// Cofactors of row 0
+			const T Cofactor0 =  (M[1][1] * Minor23 - M[1][2] * Minor13 + M[1][3] * Minor12);
+			const T Cofactor1 = -(M[1][0] * Minor23 - M[1][2] * Minor03 + M[1][3] * Minor02);
+			const T Cofactor2 =  (M[1][0] * Minor13 - M[1][1] * Minor03 + M[1][3] * Minor01);
+			const T Cofactor3 = -(M[1][0] * Minor12 - M[1][1] * Minor02 + M[1][2] * Minor01);
+
+			const T Det = M[0][0] * Cofactor0 + M[0][1] * Cofactor1 + M[0][2] * Cofactor2 + M[0][3] * Cofactor3;
+			if (Det == static_cast<T>(0))
+			{
+				return false;
+			}
+			const T OneByDet = static_cast<T>(1) / Det;
+
+			// Minors of rows 0 and 1
+			const T Minor01Top = M[0][0] * M[1][1] - M[0][1] * M[1][0];
+			const T Minor02Top = M[0][0] * M[1][2] - M[0][2] * M[1][0];
+			const T Minor03Top = M[0][0] * M[1][3] - M[0][3] * M[1][0];
+			const T Minor12Top = M[0][1] * M[1][2] - M[0][2] * M[1][1];
+			const T Minor13Top = M[0][1] * M[1][3] - M[0][3] * M[1][1];
+			const T Minor23Top = M[0][2] * M[1][3] - M[0][3] * M[1][2];
+
+			// Inverse = Transpose(Cofactors) / Det
+			T Res[4][4];
+			Res[0][0] = Cofactor0 * OneByDet;
+			Res[1][0] = Cofactor1 * OneByDet;
+			Res[2][0] = Cofactor2 * OneByDet;
+			Res[3][0] = Cofactor3 * OneByDet;
+
+			Res[0][1] = -(M[0][1] * Minor23 - M[0][2] * Minor13 + M[0][3] * Minor12) * OneByDet;
+			Res[1][1] =  (M[0][0] * Minor23 - M[0][2] * Minor03 + M[0][3] * Minor02) * OneByDet;
+			Res[2][1] = -(M[0][0] * Minor13 - M[0][1] * Minor03 + M[0][3] * Minor01) * OneByDet;
+			Res[3][1] =  (M[0][0] * Minor12 - M[0][1] * Minor02 + M[0][2] * Minor01) * OneByDet;
+
+			Res[0][2] =  (M[3][1] * Minor23Top - M[3][2] * Minor13Top + M[3][3] * Minor12Top) * OneByDet;
+			Res[1][2] = -(M[3][0] * Minor23Top - M[3][2] * Minor03Top + M[3][3] * Minor02Top) * OneByDet;
+			Res[2][2] =  (M[3][0] * Minor13Top - M[3][1] * Minor03Top + M[3][3] * Minor01Top) * OneByDet;
+			Res[3][2] = -(M[3][0] * Minor12Top - M[3][1] * Minor02Top + M[3][2] * Minor01Top) * OneByDet;
+
+			Res[0][3] = -(M[2][1] * Minor23Top - M[2][2] * Minor13Top + M[2][3] * Minor12Top) * OneByDet;
+			Res[1][3] =  (M[2][0] * Minor23Top - M[2][2] * Minor03Top + M[2][3] * Minor02Top) * OneByDet;
+			Res[2][3] = -(M[2][0] * Minor13Top - M[2][1] * Minor03Top + M[2][3] * Minor01Top) * OneByDet;
+			Res[3][3] =  (M[2][0] * Minor12Top - M[2][1] * Minor02Top + M[2][2] * Minor01Top) * OneByDet;
+
+			FMemory::MemCopy(Result, Res, sizeof(Res));
+			return true;
+		}
+
+		/*
+		* Inverts the 3x3 part through its adjugate and rotates the translation by it.
+		*/
+		template<typename T>
+		bool MatrixInverseAffineScalar(TMatrix44<T>* Result, const TMatrix44<T>* Mat)
+		{
+			const T (&M)[4][4] = Mat->M;
+
+			const T Cofactor00 = M[1][1] * M[2][2] - M[1][2] * M[2][1];
+			const T Cofactor01 = M[1][2] * M[2][0] - M[1][0] * M[2][2];
+			const T Cofactor02 = M[1][0] * M[2][1] - M[1][1] * M[2][0];
+
+			const T Det = M[0][0] * Cofactor00 + M[0][1] * Cofactor01 + M[0][2] * Cofactor02;
+			if (Det == static_cast<T>(0))
+			{
+				return false;
+			}
+			const T OneByDet = static_cast<T>(1) / Det;
+
+			T Res[4][4];
+			Res[0][0] = Cofactor00 * OneByDet;
+			Res[1][0] = Cofactor01 * OneByDet;
+			Res[2][0] = Cofactor02 * OneByDet;
+
+			Res[0][1] = (M[0][2] * M[2][1] - M[0][1] * M[2][2]) * OneByDet;
+			Res[1][1] = (M[0][0] * M[2][2] - M[0][2] * M[2][0]) * OneByDet;
+			Res[2][1] = (M[0][1] * M[2][0] - M[0][0] * M[2][1]) * OneByDet;
+
+			Res[0][2] = (M[0][1] * M[1][2] - M[0][2] * M[1][1]) * OneByDet;
+			Res[1][2] = (M[0][2] * M[1][0] - M[0][0] * M[1][2]) * OneByDet;
+			Res[2][2] = (M[0][0] * M[1][1] - M[0][1] * M[1][0]) * OneByDet;
+
+			for (int Column = 0; Column < 3; Column++)
+			{
+				Res[Column][3] = static_cast<T>(0);
+				Res[3][Column] = -(M[3][0] * Res[0][Column] + M[3][1] * Res[1][Column] + M[3][2] * Res[2][Column]);
+			}
+			Res[3][3] = static_cast<T>(1);
+
+			FMemory::MemCopy(Result, Res, sizeof(Res));
+			return true;
+		}
+
+		void TransformPointsScalar(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat)
+		{
+			const float (&M)[4][4] = Mat->M;
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				const float X = Points[Index].X, Y = Points[Index].Y, Z = Points[Index].Z;
+				OutPoints[Index].X = X * M[0][0] + Y * M[1][0] + Z * M[2][0] + M[3][0];
+				OutPoints[Index].Y = X * M[0][1] + Y * M[1][1] + Z * M[2][1] + M[3][1];
+				OutPoints[Index].Z = X * M[0][2] + Y * M[1][2] + Z * M[2][2] + M[3][2];
+			}
+		}
+
+		void MultiplyMatricesScalar(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				MatrixMultiplyScalar(&OutMatrices[Index], &Mats1[Index], &Mats2[Index]);
+			}
+		}
+
+		/*
+		* Scale * Rotation * Translation, the rotation rows are the basis vectors rotated by the quaternion.
+		*/
+		void ComposeTransformsScalar(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				const FQuaternionf& Quat = Rotations[Index];
+				const FVector3f& Scale = Scales[Index];
+				const FVector3f& Location = Locations[Index];
+
+				const float X2 = Quat.X + Quat.X, Y2 = Quat.Y + Quat.Y, Z2 = Quat.Z + Quat.Z;
+				const float XX = Quat.X * X2, YY = Quat.Y * Y2, ZZ = Quat.Z * Z2;
+				const float XY = Quat.X * Y2, XZ = Quat.X * Z2, YZ = Quat.Y * Z2;
+				const float WX = Quat.W * X2, WY = Quat.W * Y2, WZ = Quat.W * Z2;
+
+				float (&M)[4][4] = OutMatrices[Index].M;
+				M[0][0] = (1.0f - (YY + ZZ)) * Scale.X;	M[0][1] = (XY + WZ) * Scale.X;			M[0][2] = (XZ - WY) * Scale.X;			M[0][3] = 0.0f;
+				M[1][0] = (XY - WZ) * Scale.Y;			M[1][1] = (1.0f - (XX + ZZ)) * Scale.Y;	M[1][2] = (YZ + WX) * Scale.Y;			M[1][3] = 0.0f;
+				M[2][0] = (XZ + WY) * Scale.Z;			M[2][1] = (YZ - WX) * Scale.Z;			M[2][2] = (1.0f - (XX + YY)) * Scale.Z;	M[2][3] = 0.0f;
+				M[3][0] = Location.X;					M[3][1] = Location.Y;					M[3][2] = Location.Z;					M[3][3] = 1.0f;
+			}
+		}
+
+		/*
+		* OutQuats[i] = Normalize(Quats1[i] * Scale1 + Quats2[i] * Scale2), Scale2 negated when the pair is more than 180 degrees apart.
+		*/
+		FORCEINLINE void BlendQuaternionScalar(const FQuaternionf& Quat1, const FQuaternionf& Quat2, FQuaternionf& OutQuat, float CosAngle, float Scale1, float Scale2)
+		{
+			Scale2 = CosAngle < 0.0f ? -Scale2 : Scale2;
+			float Res[4];
+			for (int Element = 0; Element < 4; Element++)
+			{
+				Res[Element] = Quat1.XYZW[Element] * Scale1 + Quat2.XYZW[Element] * Scale2;
+			}
+
+			const float InvSize = 1.0f / FMath::Sqrt(Res[0] * Res[0] + Res[1] * Res[1] + Res[2] * Res[2] + Res[3] * Res[3]);
+			for (int Element = 0; Element < 4; Element++)
+			{
+				OutQuat.XYZW[Element] = Res[Element] * InvSize;
+			}
+		}
+
+		void NlerpQuaternionsScalar(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				BlendQuaternionScalar(Quats1[Index], Quats2[Index], OutQuats[Index], FQuaternionf::Dot(Quats1[Index], Quats2[Index]), 1.0f - Alpha, Alpha);
+			}
+		}
+
+		void SlerpQuaternionsScalar(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				const float CosAngle = FQuaternionf::Dot(Quats1[Index], Quats2[Index]);
+				float Scale1, Scale2;
+				FMathBatch::GetSlerpScales(FMath::Abs(CosAngle), Alpha, Scale1, Scale2);
+				BlendQuaternionScalar(Quats1[Index], Quats2[Index], OutQuats[Index], CosAngle, Scale1, Scale2);
+			}
+		}
+
+		/*
+		* OutValues[i] = Function(Values[i]), for the transcendental kernels.
+		*/
+		template<float (*Function)(float)>
+		void MapScalar(const float* Values, float* OutValues, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				OutValues[Index] = Function(Values[Index]);
+			}
+		}
+
+		void SinCosScalar(const float* Angles, float* OutSines, float* OutCosines, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				FMath::SinCos(Angles[Index], OutSines[Index], OutCosines[Index]);
+			}
+		}
+
+		void ATan2Scalar(const float* Ys, const float* Xs, float* OutAngles, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; Index++)
+			{
+				OutAngles[Index] = FMath::ATan2(Ys[Index], Xs[Index]);
+			}
+		}
+
+		const FMathKernels ScalarKernels =
+		{
+			&MatrixMultiplyScalar<float>,
+			&MatrixMultiplyScalar<double>,
+			&MatrixInverseScalar<float>,
+			&MatrixInverseScalar<double>,
+			&MatrixInverseAffineScalar<float>,
+			&MatrixInverseAffineScalar<double>,
+			&TransformPointsScalar,
+			&MultiplyMatricesScalar,
+			&ComposeTransformsScalar,
+			&NlerpQuaternionsScalar,
+			&SlerpQuaternionsScalar,
+			&MapScalar<&FMath::Sin>,
+			&MapScalar<&FMath::Cos>,
+			&SinCosScalar,
+			&MapScalar<&FMath::Tan>,
+			&ATan2Scalar,
+			&MapScalar<&FMath::Exp>,
+			&MapScalar<&FMath::Log>
+		};
+
+#if AA_PLATFORM_USING_SIMD
+		const FMathKernels SSEKernels =
+		{
+			&MatrixMultiplySSE,
+			&MatrixMultiplySSE,
+			&MatrixInverseSSE,
+			&MatrixInverseSSE,
+			&MatrixInverseAffineSSE,
+			&MatrixInverseAffineSSE,
+			&TransformPointsSSE,
+			&MultiplyMatricesSSE,
+			&ComposeTransformsSSE,
+			&NlerpQuaternionsSSE,
+			&SlerpQuaternionsSSE,
+			&SinSSE,
+			&CosSSE,
+			&SinCosSSE,
+			&TanSSE,
+			&ATan2SSE,
+			&ExpSSE,
+			&LogSSE
+		};
+
+		// The float inverses already fill a 128-bit register per row, only the double ones gain from 256 bits
+		const FMathKernels AVX2Kernels =
+		{
+			&MatrixMultiplyAVX2,
+			&MatrixMultiplyAVX2,
+			&MatrixInverseSSE,
+			&MatrixInverseAVX2,
+			&MatrixInverseAffineSSE,
+			&MatrixInverseAffineAVX2,
+			&TransformPointsAVX2,
+			&MultiplyMatricesAVX2,
+			&ComposeTransformsAVX2,
+			&NlerpQuaternionsSSE,
+			&SlerpQuaternionsSSE,
+			&SinAVX2,
+			&CosAVX2,
+			&SinCosAVX2,
+			&TanAVX2,
+			&ATan2AVX2,
+			&ExpAVX2,
+			&LogAVX2
+		};
+#endif
+
+		/*
+		* First call of a kernel before Initialize, picks the backend then runs the real kernel.
+		*/
+		void ResolveMatrixMultiplyFloat(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().MatrixMultiplyFloat(Result, Mat1, Mat2);
+		}
+
+		void ResolveMatrixMultiplyDouble(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().MatrixMultiplyDouble(Result, Mat1, Mat2);
+		}
+
+		bool ResolveMatrixInverseFloat(FMatrix44f* Result, const FMatrix44f* Mat)
+		{
+			FMathDispatch::GetBackend();
+			return FMathDispatch::GetActiveKernels().MatrixInverseFloat(Result, Mat);
+		}
+
+		bool ResolveMatrixInverseDouble(FMatrix44d* Result, const FMatrix44d* Mat)
+		{
+			FMathDispatch::GetBackend();
+			return FMathDispatch::GetActiveKernels().MatrixInverseDouble(Result, Mat);
+		}
+
+		bool ResolveMatrixInverseAffineFloat(FMatrix44f* Result, const FMatrix44f* Mat)
+		{
+			FMathDispatch::GetBackend();
+			return FMathDispatch::GetActiveKernels().MatrixInverseAffineFloat(Result, Mat);
+		}
+
+		bool ResolveMatrixInverseAffineDouble(FMatrix44d* Result, const FMatrix44d* Mat)
+		{
+			FMathDispatch::GetBackend();
+			return FMathDispatch::GetActiveKernels().MatrixInverseAffineDouble(Result, Mat);
+		}
+
+		void ResolveTransformPointsFloat(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().TransformPointsFloat(Points, OutPoints, Num, Mat);
+		}
+
+		void ResolveMultiplyMatricesFloat(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().MultiplyMatricesFloat(Mats1, Mats2, OutMatrices, Num);
+		}
+
+		void ResolveComposeTransformsFloat(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().ComposeTransformsFloat(Locations, Rotations, Scales, OutMatrices, Num);
+		}
+
+		void ResolveNlerpQuaternionsFloat(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().NlerpQuaternionsFloat(Quats1, Quats2, OutQuats, Num, Alpha);
+		}
+
+		void ResolveSlerpQuaternionsFloat(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().SlerpQuaternionsFloat(Quats1, Quats2, OutQuats, Num, Alpha);
+		}
+
+		void ResolveSinFloat(const float* Angles, float* OutSines, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().SinFloat(Angles, OutSines, Num);
+		}
+
+		void ResolveCosFloat(const float* Angles, float* OutCosines, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().CosFloat(Angles, OutCosines, Num);
+		}
+
+		void ResolveSinCosFloat(const float* Angles, float* OutSines, float* OutCosines, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().SinCosFloat(Angles, OutSines, OutCosines, Num);
+		}
+
+		void ResolveTanFloat(const float* Angles, float* OutTangents, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().TanFloat(Angles, OutTangents, Num);
+		}
+
+		void ResolveATan2Float(const float* Ys, const float* Xs, float* OutAngles, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().ATan2Float(Ys, Xs, OutAngles, Num);
+		}
+
+		void ResolveExpFloat(const float* Values, float* OutValues, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().ExpFloat(Values, OutValues, Num);
+		}
+
+		void ResolveLogFloat(const float* Values, float* OutValues, size_t Num)
+		{
+			FMathDispatch::GetBackend();
+			FMathDispatch::GetActiveKernels().LogFloat(Values, OutValues, Num);
+		}
+
+		const FMathKernels ResolveKernels =
+		{
+			&ResolveMatrixMultiplyFloat,
+			&ResolveMatrixMultiplyDouble,
+			&ResolveMatrixInverseFloat,
+			&ResolveMatrixInverseDouble,
+			&ResolveMatrixInverseAffineFloat,
+			&ResolveMatrixInverseAffineDouble,
+			&ResolveTransformPointsFloat,
+			&ResolveMultiplyMatricesFloat,
+			&ResolveComposeTransformsFloat,
+			&ResolveNlerpQuaternionsFloat,
+			&ResolveSlerpQuaternionsFloat,
+			&ResolveSinFloat,
+			&ResolveCosFloat,
+			&ResolveSinCosFloat,
+			&ResolveTanFloat,
+			&ResolveATan2Float,
+			&ResolveExpFloat,
+			&ResolveLogFloat
+		};
+
+		/*
+		* @returns Backend of a kernel table, Count for the resolve stubs.
+		*/
+		EMathBackend GetKernelsBackend(const FMathKernels* Kernels) noexcept
+		{
+#if AA_PLATFORM_USING_SIMD
+			if (Kernels == &AVX2Kernels)
+			{
+				return EMathBackend::AVX2;
+			}
+			if (Kernels == &SSEKernels)
+			{
+				return EMathBackend::SSE;
+			}
+#endif
+			return Kernels == &ScalarKernels ? EMathBackend::Scalar : EMathBackend::Count;
+		}
+	}
+
+	// Constant initialized, so it is valid before any dynamic initializer runs
+	std::atomic<const FMathKernels*> FMathDispatch::ActiveKernels{ &ResolveKernels };
+
+	void FMathDispatch::Initialize()
+	{
+		SetBackend(GetBestBackend());
+		FPlatformCPU::LogFeatures();
+		AA_CORE_LOG(Info, "Math kernels: %s", GetBackendName(GetBackend()));
+	}
+
+	EMathBackend FMathDispatch::GetBackend() noexcept
+	{
+		const FMathKernels* Kernels = ActiveKernels.load(std::memory_order_acquire);
+		if (Kernels == &ResolveKernels)
+		{
+			// Only replaces the stubs, a backend set by another thread in between stays
+			const FMathKernels* BestKernels = &GetKernels(GetBestBackend());
+			if (ActiveKernels.compare_exchange_strong(Kernels, BestKernels, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				Kernels = BestKernels;
+			}
+		}
+		return GetKernelsBackend(Kernels);
+	}
+
+	bool FMathDispatch::SetBackend(EMathBackend Backend) noexcept
+	{
+		if (!IsBackendSupported(Backend))
+		{
+			return false;
+		}
+
+		ActiveKernels.store(&GetKernels(Backend), std::memory_order_release);
+		return true;
+	}
+
+	EMathBackend FMathDispatch::GetBestBackend() noexcept
+	{
+		if (IsBackendSupported(EMathBackend::AVX2))
+		{
+			return EMathBackend::AVX2;
+		}
+		return IsBackendSupported(EMathBackend::SSE) ? EMathBackend::SSE : EMathBackend::Scalar;
+	}
+
+	bool FMathDispatch::IsBackendSupported(EMathBackend Backend) noexcept
+	{
+		switch (Backend)
+		{
+		case EMathBackend::Scalar:	return true;
+#if AA_PLATFORM_USING_SIMD
+		case EMathBackend::SSE:		return true;
+		case EMathBackend::AVX2:	return FPlatformCPU::HasAVX2();
+#endif
+		default:					return false;
+		}
+	}
+
+	const FMathKernels& FMathDispatch::GetKernels(EMathBackend Backend) noexcept
+	{
+		AA_CORE_ASSERT(IsBackendSupported(Backend), "Math backend is not supported on this CPU!");
+		switch (Backend)
+		{
+#if AA_PLATFORM_USING_SIMD
+		case EMathBackend::SSE:		return SSEKernels;
+		case EMathBackend::AVX2:	return AVX2Kernels;
+#endif
+		default:					return ScalarKernels;
+		}
+	}
+
+	const char* FMathDispatch::GetBackendName(EMathBackend Backend) noexcept
+	{
+		switch (Backend)
+		{
+		case EMathBackend::Scalar:	return "Scalar";
+		case EMathBackend::SSE:		return "SSE";
+		case EMathBackend::AVX2:	return "AVX2";
+		default:					return "Unknown";
+		}
+	}
+}
+}
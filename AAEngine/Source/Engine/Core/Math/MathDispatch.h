@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Math/MathForwards.h"
+
+#include <atomic>
+
+namespace AAEngine {
+namespace Math {
+
+	/*
+	* Instruction sets the dispatched math kernels are written for.
+	*/
+	enum class EMathBackend : uint8_t
+	{
+		Scalar,
+		SSE,
+		AVX2,
+
+		Count
+	};
+
+	/*
+	* Math kernels with a version per backend, called through FMathDispatch::GetActiveKernels.
+	*/
+	struct FMathKernels
+	{
+		/*
+		* Result = Mat1 * Mat2, Result may be one of the inputs.
+		*/
+		void (*MatrixMultiplyFloat)(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2);
+		void (*MatrixMultiplyDouble)(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2);
+
+		/*
+		* Result = Inverse(Mat), Result may be Mat.
+		* @returns false, leaving Result untouched, if Mat is singular.
+		*/
+		bool (*MatrixInverseFloat)(FMatrix44f* Result, const FMatrix44f* Mat);
+		bool (*MatrixInverseDouble)(FMatrix44d* Result, const FMatrix44d* Mat);
+
+		/*
+		* Inverse of a matrix whose last column is (0, 0, 0, 1), same contract as MatrixInverse.
+		*/
+		bool (*MatrixInverseAffineFloat)(FMatrix44f* Result, const FMatrix44f* Mat);
+		bool (*MatrixInverseAffineDouble)(FMatrix44d* Result, const FMatrix44d* Mat);
+
+		/*
+		* Batch kernels behind FMathBatch, single threaded, see FMathBatch for what they compute.
+		*/
+		void (*TransformPointsFloat)(const FVector3f* Points, FVector3f* OutPoints, size_t Num, const FMatrix44f* Mat);
+		void (*MultiplyMatricesFloat)(const FMatrix44f* Mats1, const FMatrix44f* Mats2, FMatrix44f* OutMatrices, size_t Num);
+		void (*ComposeTransformsFloat)(const FVector3f* Locations, const FQuaternionf* Rotations, const FVector3f* Scales, FMatrix44f* OutMatrices, size_t Num);
+		void (*NlerpQuaternionsFloat)(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha);
+		void (*SlerpQuaternionsFloat)(const FQuaternionf* Quats1, const FQuaternionf* Quats2, FQuaternionf* OutQuats, size_t Num, float Alpha);
+		void (*SinFloat)(const float* Angles, float* OutSines, size_t Num);
+		void (*CosFloat)(const float* Angles, float* OutCosines, size_t Num);
+		void (*SinCosFloat)(const float* Angles, float* OutSines, float* OutCosines, size_t Num);
+		void (*TanFloat)(const float* Angles, float* OutTangents, size_t Num);
+		void (*ATan2Float)(const float* Ys, const float* Xs, float* OutAngles, size_t Num);
+		void (*ExpFloat)(const float* Values, float* OutValues, size_t Num);
+		void (*LogFloat)(const float* Values, float* OutValues, size_t Num);
+	};
+
+	/*
+	* Picks the math kernels for the CPU at runtime, so a build for the SSE2 baseline still uses AVX2 / FMA where it is present.
+	* - The active kernels start out as stubs that pick the best backend on their first call, so math done during static initialization works too.
+	* - They are published through an atomic pointer, worker threads making their first call at the same time all end up on the same kernels.
+	* - Initialize picks it up front and logs the choice, the engine calls it at startup.
+	* - SetBackend forces a backend, e.g. to compare them in benchmarks.
+	*/
+	struct AA_ENGINE_API FMathDispatch
+	{
+	public:
+		/*
+		* @returns Kernels of the active backend.
+		*/
+		static FORCEINLINE const FMathKernels& GetActiveKernels() noexcept
+		{
+			return *ActiveKernels.load(std::memory_order_acquire);
+		}
+
+		/*
+		* Selects the best backend the CPU supports and logs it.
+		*/
+		static void Initialize();
+
+		/*
+		* Picks the best backend first if no kernel was called yet.
+		*
+		* @returns The backend of the active kernels.
+		*/
+		static EMathBackend GetBackend() noexcept;
+
+		/*
+		* Makes the kernels of a backend the active ones. Meant for startup and benchmarks:
+		* it is safe to call while other threads do math, but their calls in flight finish on the old kernels.
+		*
+		* @returns false, and keeps the current backend, if the CPU or the build doesn't support Backend.
+		*/
+		static bool SetBackend(EMathBackend Backend) noexcept;
+
+		/*
+		* @returns The fastest backend the CPU and the build support.
+		*/
+		static EMathBackend GetBestBackend() noexcept;
+
+		/*
+		* @returns true if Backend can run on this CPU with this build.
+		*/
+		static bool IsBackendSupported(EMathBackend Backend) noexcept;
+
+		/*
+		* @returns The kernels of a backend, to call one explicitly. Backend must be supported.
+		*/
+		static const FMathKernels& GetKernels(EMathBackend Backend) noexcept;
+
+		/*
+		* @returns Name of a backend.
+		*/
+		static const char* GetBackendName(EMathBackend Backend) noexcept;
+
+	private:
+		/*
+		* Kernels of the active backend, the resolve stubs until a backend is picked.
+		*/
+		static std::atomic<const FMathKernels*> ActiveKernels;
+	};
+}
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Templates/AATypeTraits.h"
+
 namespace AAEngine::Math
 {
 	// Forward declaration of templates
@@ -12,6 +14,15 @@ namespace AAEngine::Math
 	template<typename T> struct TTransform;
 }
 
+// Math types only hold plain floating point data, so they can be moved around with a memcpy
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TVector2<T>>		{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TVector3<T>>		{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TVector4<T>>		{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TMatrix44<T>>		{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TQuaternion<T>>	{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TEuler<T>>			{ enum { Value = true }; };
+template<typename T> struct TIsTriviallyRelocatable<AAEngine::Math::TTransform<T>>		{ enum { Value = true }; };
+
 using FVector4f = AAEngine::Math::TVector4<float>;
 using FVector4d = AAEngine::Math::TVector4<double>;
 
@@ -3,7 +3,8 @@
 #include "Core/Core.h"
 
 #if !AA_PLATFORM_USING_SIMD
-#include "Memory/IncludesMemory.h"
+#include "Memory/MemoryIncludes.h"
+#include "Math/Math.h"
 #include "Math/MathForwards.h"
 
 namespace AAEngine {
@@ -39,22 +40,62 @@ namespace Math {
 		return Res;
 	}
 
+	/*
+	* Overloads of the MakeVectorRegister4 functions, for code written once for float and double registers.
+	*/
+	FORCEINLINE VectorRegister4Float MakeVectorRegister(float A, float B, float C, float D)
+	{
+		return MakeVectorRegister4Float(A, B, C, D);
+	}
+
+	FORCEINLINE VectorRegister4Double MakeVectorRegister(double A, double B, double C, double D)
+	{
+		return MakeVectorRegister4Double(A, B, C, D);
+	}
+
 	FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr)
 	{
+		AA_CHECK_ALIGNED(Ptr, 16);
 		return MakeVectorRegister4Float(Ptr[0], Ptr[1], Ptr[2], Ptr[3]);
 	}
 
 	FORCEINLINE VectorRegister4Double VectorLoadAligned(const double* Ptr)
 	{
+		AA_CHECK_ALIGNED(Ptr, 16);
 		return MakeVectorRegister4Double(Ptr[0], Ptr[1], Ptr[2], Ptr[3]);
 	}
 
 	FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Reg, float* Dest)
 	{
+		AA_CHECK_ALIGNED(Dest, 16);
 		FMemory::MemCopy(Dest, &Reg, 4 * sizeof(float));
 	}
 
 	FORCEINLINE void VectorStoreAligned(const VectorRegister4Double& Reg, double* Dest)
+	{
+		AA_CHECK_ALIGNED(Dest, 16);
+		FMemory::MemCopy(Dest, &Reg, 4 * sizeof(double));
+	}
+
+	/*
+	* Unaligned load / store, for data with no alignment guarantee like packed FVector3f arrays.
+	*/
+	FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr)
+	{
+		return MakeVectorRegister4Float(Ptr[0], Ptr[1], Ptr[2], Ptr[3]);
+	}
+
+	FORCEINLINE VectorRegister4Double VectorLoad(const double* Ptr)
+	{
+		return MakeVectorRegister4Double(Ptr[0], Ptr[1], Ptr[2], Ptr[3]);
+	}
+
+	FORCEINLINE void VectorStore(const VectorRegister4Float& Reg, float* Dest)
+	{
+		FMemory::MemCopy(Dest, &Reg, 4 * sizeof(float));
+	}
+
+	FORCEINLINE void VectorStore(const VectorRegister4Double& Reg, double* Dest)
 	{
 		FMemory::MemCopy(Dest, &Reg, 4 * sizeof(double));
 	}
@@ -271,6 +312,110 @@ namespace Math {
 		return ResultVec;
 	}
 
+	FORCEINLINE VectorRegister4Float VectorSqrt(const VectorRegister4Float& VecReg)
+	{
+		return MakeVectorRegister4Float(FMath::Sqrt(VecReg.V[0]), FMath::Sqrt(VecReg.V[1]), FMath::Sqrt(VecReg.V[2]), FMath::Sqrt(VecReg.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Double VectorSqrt(const VectorRegister4Double& VecReg)
+	{
+		return MakeVectorRegister4Double(FMath::Sqrt(VecReg.V[0]), FMath::Sqrt(VecReg.V[1]), FMath::Sqrt(VecReg.V[2]), FMath::Sqrt(VecReg.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorReciprocalSqrt(const VectorRegister4Float& VecReg)
+	{
+		return MakeVectorRegister4Float(FMath::InvSqrt(VecReg.V[0]), FMath::InvSqrt(VecReg.V[1]), FMath::InvSqrt(VecReg.V[2]), FMath::InvSqrt(VecReg.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Double VectorReciprocalSqrt(const VectorRegister4Double& VecReg)
+	{
+		return MakeVectorRegister4Double(FMath::InvSqrt(VecReg.V[0]), FMath::InvSqrt(VecReg.V[1]), FMath::InvSqrt(VecReg.V[2]), FMath::InvSqrt(VecReg.V[3]));
+	}
+
+	FORCEINLINE float VectorGetFirstComponent(const VectorRegister4Float& VecReg)
+	{
+		return VecReg.V[0];
+	}
+
+	FORCEINLINE double VectorGetFirstComponent(const VectorRegister4Double& VecReg)
+	{
+		return VecReg.V[0];
+	}
+
+	/*
+	* @returns X + Y + Z + W in every element.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorHorizontalSum(const VectorRegisterType& VecReg)
+	{
+		const auto Sum = VecReg.V[0] + VecReg.V[1] + VecReg.V[2] + VecReg.V[3];
+		return MakeVectorRegister(Sum, Sum, Sum, Sum);
+	}
+
+	/*
+	* @returns Dot product of the XYZW of two registers in every element.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorDot4(const VectorRegisterType& VecReg1, const VectorRegisterType& VecReg2)
+	{
+		return VectorHorizontalSum(VectorMultiply(VecReg1, VecReg2));
+	}
+
+	/*
+	* @returns Dot product of the XYZ of two registers in every element.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorDot3(const VectorRegisterType& VecReg1, const VectorRegisterType& VecReg2)
+	{
+		const auto Dot = VecReg1.V[0] * VecReg2.V[0] + VecReg1.V[1] * VecReg2.V[1] + VecReg1.V[2] * VecReg2.V[2];
+		return MakeVectorRegister(Dot, Dot, Dot, Dot);
+	}
+
+	/*
+	* Transcendental functions of every element, FMath::SinCos for Sin / Cos and libm for the others.
+	*/
+	FORCEINLINE void VectorSinCos(const VectorRegister4Float& Angles, VectorRegister4Float& OutSin, VectorRegister4Float& OutCos)
+	{
+		for (int Element = 0; Element < 4; Element++)
+		{
+			FMath::SinCos(Angles.V[Element], OutSin.V[Element], OutCos.V[Element]);
+		}
+	}
+
+	FORCEINLINE VectorRegister4Float VectorSin(const VectorRegister4Float& Angles)
+	{
+		VectorRegister4Float Sin, Cos;
+		VectorSinCos(Angles, Sin, Cos);
+		return Sin;
+	}
+
+	FORCEINLINE VectorRegister4Float VectorCos(const VectorRegister4Float& Angles)
+	{
+		VectorRegister4Float Sin, Cos;
+		VectorSinCos(Angles, Sin, Cos);
+		return Cos;
+	}
+
+	FORCEINLINE VectorRegister4Float VectorTan(const VectorRegister4Float& Angles)
+	{
+		return MakeVectorRegister4Float(FMath::Tan(Angles.V[0]), FMath::Tan(Angles.V[1]), FMath::Tan(Angles.V[2]), FMath::Tan(Angles.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorATan2(const VectorRegister4Float& Y, const VectorRegister4Float& X)
+	{
+		return MakeVectorRegister4Float(FMath::ATan2(Y.V[0], X.V[0]), FMath::ATan2(Y.V[1], X.V[1]), FMath::ATan2(Y.V[2], X.V[2]), FMath::ATan2(Y.V[3], X.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorExp(const VectorRegister4Float& A)
+	{
+		return MakeVectorRegister4Float(FMath::Exp(A.V[0]), FMath::Exp(A.V[1]), FMath::Exp(A.V[2]), FMath::Exp(A.V[3]));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorLog(const VectorRegister4Float& A)
+	{
+		return MakeVectorRegister4Float(FMath::Log(A.V[0]), FMath::Log(A.V[1]), FMath::Log(A.V[2]), FMath::Log(A.V[3]));
+	}
+
 	FORCEINLINE VectorRegister4Float VectorMatrixMultiply(const VectorRegister4Float& VecReg, const FMatrix44f* Mat)
 	{
 		typedef float Float4x4[4][4];
@@ -359,7 +504,11 @@ namespace Math {
 		FMemory::MemCopy(Result, &ResultMat, 16 * sizeof(double));
 	}
 
-	FORCEINLINE void MatrixInverse(FMatrix44f* Result, const FMatrix44f* Mat1)
+	/*
+	* Result = Inverse(Mat1), Result may be Mat1.
+	* @returns false, leaving Result untouched, if Mat1 is singular.
+	*/
+	FORCEINLINE bool MatrixInverse(FMatrix44f* Result, const FMatrix44f* Mat1)
 	{
 		typedef float Float4x4[4][4];
 		const Float4x4& M = *((const Float4x4*)Mat1);
@@ -390,6 +539,11 @@ namespace Math {
 
 		float Determinant = Det[0] * M[0][0] - Det[1] * M[0][1] + Det[2] * M[0][2] - Det[3] * M[0][3];
 
+		if (Determinant == 0.0f)
+		{
+			return false;
+		}
+
 		float OneByDet = 1.0f / Determinant;
 
 		Res[0][0] = OneByDet * Det[0];
@@ -413,9 +567,10 @@ namespace Math {
 		Res[3][3] = OneByDet * ((M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) + (M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])));
 
 		FMemory::MemCopy(Result, &Res, 16 * sizeof(float));
+		return true;
 	}
 
-	FORCEINLINE void MatrixInverse(FMatrix44d* Result, const FMatrix44d* Mat1)
+	FORCEINLINE bool MatrixInverse(FMatrix44d* Result, const FMatrix44d* Mat1)
 	{
 		typedef double Double4x4[4][4];
 		const Double4x4& M = *((const Double4x4*)Mat1);
@@ -446,7 +601,12 @@ namespace Math {
 
 		double Determinant = Det[0] * M[0][0] - Det[1] * M[0][1] + Det[2] * M[0][2] - Det[3] * M[0][3];
 
-		double OneByDet = 1.0f / Determinant;
+		if (Determinant == 0.0)
+		{
+			return false;
+		}
+
+		double OneByDet = 1.0 / Determinant;
 
 		Res[0][0] = OneByDet * Det[0];
 		Res[1][0] = -OneByDet * Det[1];
@@ -458,19 +618,370 @@ namespace Math {
 		Res[2][1] = -OneByDet * ((M[0][0] * Temp[2][0]) - (M[0][1] * Temp[2][1]) + (M[0][3] * Temp[2][2]));
 		Res[3][1] = OneByDet * ((M[0][0] * Temp[3][0]) - (M[0][1] * Temp[3][1]) + (M[0][2] * Temp[3][2]));
 
-		Res[0][2] = ((M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) + (M[0][3] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])));
-		Res[1][2] = -(((M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][2] - M[1][2] * M[3][0]))));
-		Res[2][2] = ((M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])));
-		Res[3][2] = -(((M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][2] - M[1][2] * M[3][0])) + (M[0][2] * (M[1][0] * M[3][1] - M[1][1] * M[3][0]))));
+		Res[0][2] =OneByDet * ((M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) + (M[0][3] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])));
+		Res[1][2] =-OneByDet * (((M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][2] - M[1][2] * M[3][0]))));
+		Res[2][2] =OneByDet * ((M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])));
+		Res[3][2] =-OneByDet * (((M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][2] - M[1][2] * M[3][0])) + (M[0][2] * (M[1][0] * M[3][1] - M[1][1] * M[3][0]))));
 
-		Res[0][3] = -(((M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) + (M[0][3] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]))));
-		Res[1][3] = ((M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])));
-		Res[2][3] = -(((M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]))));
-		Res[3][3] = ((M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) + (M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])));
+		Res[0][3] =-OneByDet * (((M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) + (M[0][3] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]))));
+		Res[1][3] =OneByDet * ((M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])));
+		Res[2][3] =-OneByDet * (((M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]))));
+		Res[3][3] =OneByDet * ((M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) + (M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])));
 
 		FMemory::MemCopy(Result, &Res, 16 * sizeof(double));
+		return true;
+	}
+
+	/*
+	* Result = Inverse(Mat) for a Mat with last column (0, 0, 0, 1): inverts the 3x3 part and rotates the translation by it.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	template<typename T>
+	FORCEINLINE bool MatrixInverseAffineRows(T* Result, const T* Mat)
+	{
+		typedef T Type4x4[4][4];
+		const Type4x4& M = *((const Type4x4*)Mat);
+		Type4x4 Res;
+
+		const T Cofactor00 = M[1][1] * M[2][2] - M[1][2] * M[2][1];
+		const T Cofactor01 = M[1][2] * M[2][0] - M[1][0] * M[2][2];
+		const T Cofactor02 = M[1][0] * M[2][1] - M[1][1] * M[2][0];
+
+		const T Determinant = M[0][0] * Cofactor00 + M[0][1] * Cofactor01 + M[0][2] * Cofactor02;
+		if (Determinant == static_cast<T>(0))
+		{
+			return false;
+		}
+		const T OneByDet = static_cast<T>(1) / Determinant;
+
+		Res[0][0] = Cofactor00 * OneByDet;
+		Res[1][0] = Cofactor01 * OneByDet;
+		Res[2][0] = Cofactor02 * OneByDet;
+
+		Res[0][1] = (M[0][2] * M[2][1] - M[0][1] * M[2][2]) * OneByDet;
+		Res[1][1] = (M[0][0] * M[2][2] - M[0][2] * M[2][0]) * OneByDet;
+		Res[2][1] = (M[0][1] * M[2][0] - M[0][0] * M[2][1]) * OneByDet;
+
+		Res[0][2] = (M[0][1] * M[1][2] - M[0][2] * M[1][1]) * OneByDet;
+		Res[1][2] = (M[0][2] * M[1][0] - M[0][0] * M[1][2]) * OneByDet;
+		Res[2][2] = (M[0][0] * M[1][1] - M[0][1] * M[1][0]) * OneByDet;
+
+		for (int Column = 0; Column < 3; Column++)
+		{
+			Res[Column][3] = static_cast<T>(0);
+			Res[3][Column] = -(M[3][0] * Res[0][Column] + M[3][1] * Res[1][Column] + M[3][2] * Res[2][Column]);
+		}
+		Res[3][3] = static_cast<T>(1);
+
+		FMemory::MemCopy(Result, &Res, 16 * sizeof(T));
+		return true;
+	}
+
+	FORCEINLINE bool MatrixInverseAffine(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		return MatrixInverseAffineRows((float*)Result, (const float*)Mat);
+	}
+
+	FORCEINLINE bool MatrixInverseAffine(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		return MatrixInverseAffineRows((double*)Result, (const double*)Mat);
+	}
+
+	/*
+	* @returns Determinant of Mat through the cofactors of its first row.
+	*/
+	template<typename T>
+	FORCEINLINE T MatrixDeterminantRows(const T* Mat)
+	{
+		typedef T Type4x4[4][4];
+		const Type4x4& M = *((const Type4x4*)Mat);
+
+		const T Minor01 = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+		const T Minor02 = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+		const T Minor03 = M[2][0] * M[3][3] - M[2][3] * M[3][0];
+		const T Minor12 = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+		const T Minor13 = M[2][1] * M[3][3] - M[2][3] * M[3][1];
+		const T Minor23 = M[2][2] * M[3][3] - M[2][3] * M[3][2];
+
+		return	M[0][0] * (M[1][1] * Minor23 - M[1][2] * Minor13 + M[1][3] * Minor12) -
+				M[0][1] * (M[1][0] * Minor23 - M[1][2] * Minor03 + M[1][3] * Minor02) +
+				M[0][2] * (M[1][0] * Minor13 - M[1][1] * Minor03 + M[1][3] * Minor01) -
+				M[0][3] * (M[1][0] * Minor12 - M[1][1] * Minor02 + M[1][2] * Minor01);
+	}
+
+	FORCEINLINE float MatrixDeterminant(const FMatrix44f* Mat)
+	{
+		return MatrixDeterminantRows((const float*)Mat);
+	}
+
+	FORCEINLINE double MatrixDeterminant(const FMatrix44d* Mat)
+	{
+		return MatrixDeterminantRows((const double*)Mat);
+	}
+
+	/*
+	* Result = Transpose(Mat), Result may be Mat.
+	*/
+	template<typename T>
+	FORCEINLINE void MatrixTransposeRows(T* Result, const T* Mat)
+	{
+		T Res[16];
+		for (int Row = 0; Row < 4; Row++)
+		{
+			for (int Column = 0; Column < 4; Column++)
+			{
+				Res[Column * 4 + Row] = Mat[Row * 4 + Column];
+			}
+		}
+		FMemory::MemCopy(Result, Res, sizeof(Res));
+	}
+
+	FORCEINLINE void MatrixTranspose(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		MatrixTransposeRows((float*)Result, (const float*)Mat);
+	}
+
+	FORCEINLINE void MatrixTranspose(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		MatrixTransposeRows((double*)Result, (const double*)Mat);
+	}
+
+	/*
+	* Quaternion helpers on (X, Y, Z, W) elements, same results as the MathSSE.h ones.
+	*/
+
+	/*
+	* Result = Quat1 * Quat2, the Hamilton product Quat2 Quat1. Result may be Quat1 or Quat2.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionMultiplyElements(T* Result, const T* Quat1, const T* Quat2)
+	{
+		const T AX = Quat2[0], AY = Quat2[1], AZ = Quat2[2], AW = Quat2[3];
+		const T BX = Quat1[0], BY = Quat1[1], BZ = Quat1[2], BW = Quat1[3];
+		Result[0] = AW * BX + AX * BW + AY * BZ - AZ * BY;
+		Result[1] = AW * BY - AX * BZ + AY * BW + AZ * BX;
+		Result[2] = AW * BZ + AX * BY - AY * BX + AZ * BW;
+		Result[3] = AW * BW - AX * BX - AY * BY - AZ * BZ;
+	}
+
+	FORCEINLINE void QuaternionMultiply(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2)
+	{
+		QuaternionMultiplyElements((float*)Result, (const float*)Quat1, (const float*)Quat2);
+	}
+
+	FORCEINLINE void QuaternionMultiply(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2)
+	{
+		QuaternionMultiplyElements((double*)Result, (const double*)Quat1, (const double*)Quat2);
+	}
+
+	/*
+	* Result = Quat * Vec * Conjugate(Quat) for a normalized Quat. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionRotateVectorElements(T* Result, const T* Quat, const T* Vec)
+	{
+		const T QX = Quat[0], QY = Quat[1], QZ = Quat[2], QW = Quat[3];
+		const T VX = Vec[0], VY = Vec[1], VZ = Vec[2];
+
+		const T CX = T(2) * (QY * VZ - QZ * VY);
+		const T CY = T(2) * (QZ * VX - QX * VZ);
+		const T CZ = T(2) * (QX * VY - QY * VX);
+
+		Result[0] = VX + QW * CX + (QY * CZ - QZ * CY);
+		Result[1] = VY + QW * CY + (QZ * CX - QX * CZ);
+		Result[2] = VZ + QW * CZ + (QX * CY - QY * CX);
+	}
+
+	FORCEINLINE void QuaternionRotateVector(FVector3f* Result, const FQuaternionf* Quat, const FVector3f* Vec)
+	{
+		QuaternionRotateVectorElements((float*)Result, (const float*)Quat, (const float*)Vec);
+	}
+
+	FORCEINLINE void QuaternionRotateVector(FVector3d* Result, const FQuaterniond* Quat, const FVector3d* Vec)
+	{
+		QuaternionRotateVectorElements((double*)Result, (const double*)Quat, (const double*)Vec);
+	}
+
+	/*
+	* Result = Quat / Size(Quat).
+	* @returns false, leaving Result untouched, if the squared size is below Tolerance.
+	*/
+	template<typename T>
+	FORCEINLINE bool QuaternionNormalizeElements(T* Result, const T* Quat, T Tolerance)
+	{
+		const T SizeSquared = Quat[0] * Quat[0] + Quat[1] * Quat[1] + Quat[2] * Quat[2] + Quat[3] * Quat[3];
+		if (SizeSquared < Tolerance)
+		{
+			return false;
+		}
+
+		const T InvSize = T(1) / FMath::Sqrt(SizeSquared);
+		for (int Index = 0; Index < 4; Index++)
+		{
+			Result[Index] = Quat[Index] * InvSize;
+		}
+		return true;
+	}
+
+	FORCEINLINE bool QuaternionNormalize(FQuaternionf* Result, const FQuaternionf* Quat, float Tolerance)
+	{
+		return QuaternionNormalizeElements((float*)Result, (const float*)Quat, Tolerance);
+	}
+
+	FORCEINLINE bool QuaternionNormalize(FQuaterniond* Result, const FQuaterniond* Quat, double Tolerance)
+	{
+		return QuaternionNormalizeElements((double*)Result, (const double*)Quat, Tolerance);
+	}
+
+	/*
+	* Result = Normalize(Quat1 * Scale1 + Quat2 * Scale2).
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionBlendElements(T* Result, const T* Quat1, const T* Quat2, T Scale1, T Scale2)
+	{
+		T Res[4];
+		for (int Index = 0; Index < 4; Index++)
+		{
+			Res[Index] = Quat1[Index] * Scale1 + Quat2[Index] * Scale2;
+		}
+
+		const T InvSize = T(1) / FMath::Sqrt(Res[0] * Res[0] + Res[1] * Res[1] + Res[2] * Res[2] + Res[3] * Res[3]);
+		for (int Index = 0; Index < 4; Index++)
+		{
+			Result[Index] = Res[Index] * InvSize;
+		}
+	}
+
+	/*
+	* Result = Normalize(Lerp(Quat1, Quat2, Alpha)) along the short way.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionNlerpElements(T* Result, const T* Quat1, const T* Quat2, T Alpha)
+	{
+		const T CosAngle = Quat1[0] * Quat2[0] + Quat1[1] * Quat2[1] + Quat1[2] * Quat2[2] + Quat1[3] * Quat2[3];
+		QuaternionBlendElements(Result, Quat1, Quat2, T(1) - Alpha, CosAngle < T(0) ? -Alpha : Alpha);
+	}
+
+	/*
+	* Result = constant speed interpolation from Quat1 to Quat2 along the short way, a normalized lerp for close quaternions.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionSlerpElements(T* Result, const T* Quat1, const T* Quat2, T Alpha)
+	{
+		const T RawCosAngle = Quat1[0] * Quat2[0] + Quat1[1] * Quat2[1] + Quat1[2] * Quat2[2] + Quat1[3] * Quat2[3];
+		const T CosAngle = RawCosAngle < T(0) ? -RawCosAngle : RawCosAngle;
+
+		T Scale1 = T(1) - Alpha;
+		T Scale2 = Alpha;
+		if (CosAngle < T(0.9999))
+		{
+			const T Angle = FMath::ACos(CosAngle);
+			const T InvSinAngle = T(1) / FMath::Sin(Angle);
+			Scale1 = FMath::Sin(Scale1 * Angle) * InvSinAngle;
+			Scale2 = FMath::Sin(Scale2 * Angle) * InvSinAngle;
+		}
+		QuaternionBlendElements(Result, Quat1, Quat2, Scale1, RawCosAngle < T(0) ? -Scale2 : Scale2);
+	}
+
+	FORCEINLINE void QuaternionNlerp(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2, float Alpha)
+	{
+		QuaternionNlerpElements((float*)Result, (const float*)Quat1, (const float*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionNlerp(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2, double Alpha)
+	{
+		QuaternionNlerpElements((double*)Result, (const double*)Quat1, (const double*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionSlerp(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2, float Alpha)
+	{
+		QuaternionSlerpElements((float*)Result, (const float*)Quat1, (const float*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionSlerp(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2, double Alpha)
+	{
+		QuaternionSlerpElements((double*)Result, (const double*)Quat1, (const double*)Quat2, Alpha);
+	}
+
+	/*
+	* Transform helpers on the (X, Y, Z, W) rotation and (X, Y, Z) location and scale elements of a TTransform, same results as the MathSSE.h ones.
+	*/
+
+	/*
+	* Result = Rotate(Vec * Scale) + Location. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformPositionElements(T* Result, const T* Rotation, const T* Location, const T* Scale, const T* Vec)
+	{
+		const T Scaled[3] = { Vec[0] * Scale[0], Vec[1] * Scale[1], Vec[2] * Scale[2] };
+		QuaternionRotateVectorElements(Result, Rotation, Scaled);
+		Result[0] += Location[0];
+		Result[1] += Location[1];
+		Result[2] += Location[2];
+	}
+
+	/*
+	* Result = Unrotate(Vec - Location) * InvScale, the exact inverse of TransformPositionElements. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void InverseTransformPositionElements(T* Result, const T* Rotation, const T* Location, const T* InvScale, const T* Vec)
+	{
+		const T Conjugate[4] = { -Rotation[0], -Rotation[1], -Rotation[2], Rotation[3] };
+		const T Translated[3] = { Vec[0] - Location[0], Vec[1] - Location[1], Vec[2] - Location[2] };
+		QuaternionRotateVectorElements(Result, Conjugate, Translated);
+		Result[0] *= InvScale[0];
+		Result[1] *= InvScale[1];
+		Result[2] *= InvScale[2];
+	}
+
+	/*
+	* Transform1 followed by Transform2:
+	* Rotation = Rotation1 * Rotation2, Scale = Scale1 * Scale2, Location = Rotate2(Location1 * Scale2) + Location2.
+	* The results may be any of the inputs.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformMultiplyElements(T* ResultRotation, T* ResultLocation, T* ResultScale,
+		const T* Rotation1, const T* Location1, const T* Scale1, const T* Rotation2, const T* Location2, const T* Scale2)
+	{
+		const T Rot2[4] = { Rotation2[0], Rotation2[1], Rotation2[2], Rotation2[3] };
+		const T Loc2[3] = { Location2[0], Location2[1], Location2[2] };
+		const T Scl2[3] = { Scale2[0], Scale2[1], Scale2[2] };
+		const T Scaled[3] = { Location1[0] * Scl2[0], Location1[1] * Scl2[1], Location1[2] * Scl2[2] };
+
+		QuaternionMultiplyElements(ResultRotation, Rotation1, Rot2);
+		ResultScale[0] = Scale1[0] * Scl2[0];
+		ResultScale[1] = Scale1[1] * Scl2[1];
+		ResultScale[2] = Scale1[2] * Scl2[2];
+		QuaternionRotateVectorElements(ResultLocation, Rot2, Scaled);
+		ResultLocation[0] += Loc2[0];
+		ResultLocation[1] += Loc2[1];
+		ResultLocation[2] += Loc2[2];
+	}
+
+	/*
+	* Rotation = Conjugate(Rotation), Scale = InvScale, Location = -Unrotate(Location) * InvScale.
+	* The results may be the inputs.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformInverseElements(T* ResultRotation, T* ResultLocation, T* ResultScale, const T* Rotation, const T* Location, const T* InvScale)
+	{
+		const T Conjugate[4] = { -Rotation[0], -Rotation[1], -Rotation[2], Rotation[3] };
+		const T InvScl[3] = { InvScale[0], InvScale[1], InvScale[2] };
+		const T Negated[3] = { -Location[0], -Location[1], -Location[2] };
+
+		QuaternionRotateVectorElements(ResultLocation, Conjugate, Negated);
+		ResultLocation[0] *= InvScl[0];
+		ResultLocation[1] *= InvScl[1];
+		ResultLocation[2] *= InvScl[2];
+		for (int Element = 0; Element < 4; Element++)
+		{
+			ResultRotation[Element] = Conjugate[Element];
+		}
+		ResultScale[0] = InvScl[0];
+		ResultScale[1] = InvScl[1];
+		ResultScale[2] = InvScl[2];
 	}
 
 }
 }
-#endif
\ No newline at end of file
+#endif
@@ -4,7 +4,9 @@
 
 #if AA_PLATFORM_USING_SIMD
 #include "Memory/MemoryIncludes.h"
+#include "Math/Math.h"
 #include "Math/MathForwards.h"
+#include "Math/MathDispatch.h"
 #include "Platform/SIMDIncludes.h"
 
 namespace AAEngine {
@@ -38,62 +40,116 @@ namespace Math {
 		return VectorRegister4Double(_mm_setr_pd(A, B), _mm_setr_pd(C, D));
 	}
 
+	/*
+	* Overloads of the MakeVectorRegister4 functions, for code written once for float and double registers.
+	*/
+	FORCEINLINE VectorRegister4Float MakeVectorRegister(float A, float B, float C, float D)
+	{
+		return MakeVectorRegister4Float(A, B, C, D);
+	}
+
+	FORCEINLINE VectorRegister4Double MakeVectorRegister(double A, double B, double C, double D)
+	{
+		return MakeVectorRegister4Double(A, B, C, D);
+	}
+
 	FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr)
 	{
+		AA_CHECK_ALIGNED(Ptr, 16);
 		return _mm_load_ps((const float*)Ptr);
 	}
 
 	FORCEINLINE VectorRegister4Double VectorLoadAligned(const double* Ptr)
 	{
+		AA_CHECK_ALIGNED(Ptr, 16);
 		return VectorRegister4Double(_mm_load_pd((const double*)Ptr), _mm_load_pd((const double*)(Ptr + 2)));
 	}
 
 	FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Reg, float* Dest)
 	{
+		AA_CHECK_ALIGNED(Dest, 16);
 		_mm_store_ps(Dest, Reg);
 	}
 
 	FORCEINLINE void VectorStoreAligned(const VectorRegister4Double& Reg, double* Dest)
 	{
+		AA_CHECK_ALIGNED(Dest, 16);
 		_mm_store_pd(Dest, Reg.XY);
 		_mm_store_pd(Dest + 2, Reg.ZW);
 	}
 
+	/*
+	* Unaligned load / store, for data with no alignment guarantee like packed FVector3f arrays.
+	*/
+	FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr)
+	{
+		return _mm_loadu_ps(Ptr);
+	}
+
+	FORCEINLINE VectorRegister4Double VectorLoad(const double* Ptr)
+	{
+		return VectorRegister4Double(_mm_loadu_pd(Ptr), _mm_loadu_pd(Ptr + 2));
+	}
+
+	FORCEINLINE void VectorStore(const VectorRegister4Float& Reg, float* Dest)
+	{
+		_mm_storeu_ps(Dest, Reg);
+	}
+
+	FORCEINLINE void VectorStore(const VectorRegister4Double& Reg, double* Dest)
+	{
+		_mm_storeu_pd(Dest, Reg.XY);
+		_mm_storeu_pd(Dest + 2, Reg.ZW);
+	}
+
 #define SHUFFLEMASK(A0,A1,B2,B3) ( (A0) | ((A1)<<2) | ((B2)<<4) | ((B3)<<6) )
 
 #define SHUFFLEMASK2(A0,A1) ((A0) | ((A1)<<1))
 
-	// TO DO: Double Support Later
-	/*template<int Index1, int Index2, int Index3, int Index4>
-	FORCEINLINE VectorRegister4Double VectorShuffleTemplate(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+	/*
+	* @returns The half of a double register holding element Index.
+	*/
+	template<int Index>
+	FORCEINLINE VectorRegister2Double VectorGetHalf(const VectorRegister4Double& Vec)
 	{
-		AA_CORE_ASSERT(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
-		_mm_shuffle_pd(Vec1, Vec2, SHUFFLEMASK(Index1, Index2, Index3, Index4));
-	}*/
+		if constexpr (Index < 2)
+		{
+			return Vec.XY;
+		}
+		else
+		{
+			return Vec.ZW;
+		}
+	}
 
-	template<int Index>
-	FORCEINLINE VectorRegister4Double VectorReplicateTemplate(const VectorRegister4Double& Vec)
+	template<int Index0, int Index1, int Index2, int Index3>
+	FORCEINLINE VectorRegister4Double VectorShuffleTemplate(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
 	{
-		static_assert(int(Index >= 0 && Index <= 3), "Invalid Index");
-		return VectorShuffleTemplate<Index, Index, Index, Index>(Vec, Vec);
+		static_assert(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
+		// Each result half picks one element of the halves holding the wanted indices
+		return VectorRegister4Double(
+			_mm_shuffle_pd(VectorGetHalf<Index0>(Vec1), VectorGetHalf<Index1>(Vec1), SHUFFLEMASK2(Index0 & 1, Index1 & 1)),
+			_mm_shuffle_pd(VectorGetHalf<Index2>(Vec2), VectorGetHalf<Index3>(Vec2), SHUFFLEMASK2(Index2 & 1, Index3 & 1)));
 	}
 
 	template<int Index0, int Index1, int Index2, int Index3>
 	FORCEINLINE VectorRegister4Double VectorSwizzleTemplate(const VectorRegister4Double& Vec)
 	{
-		static_assert(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
-		_mm_shuffle_pd(Vec.XY, Vec.XY, SHUFFLEMASK2(Index0, Index1));
-		_mm_shuffle_pd(Vec.ZW, Vec.ZW, SHUFFLEMASK2(Index2, Index3));
-		return MakeVectorRegister4Double(0.0, 0.0, 0.0, 0.0);
+		return VectorShuffleTemplate<Index0, Index1, Index2, Index3>(Vec, Vec);
+	}
+
+	template<int Index>
+	FORCEINLINE VectorRegister4Double VectorReplicateTemplate(const VectorRegister4Double& Vec)
+	{
+		static_assert(int(Index >= 0 && Index <= 3), "Invalid Index");
+		return VectorShuffleTemplate<Index, Index, Index, Index>(Vec, Vec);
 	}
 
 	template<int Index0, int Index1, int Index2, int Index3>
-	FORCEINLINE VectorRegister4Double VectorShuffleTemplate(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+	FORCEINLINE VectorRegister4Float VectorShuffleTemplate(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
 	{
-		static_assert(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
-		_mm_shuffle_pd(Vec1.XY, Vec2.XY, SHUFFLEMASK2(Index0, Index1));
-		_mm_shuffle_pd(Vec1.ZW, Vec2.ZW, SHUFFLEMASK2(Index2, Index3));
-		return MakeVectorRegister4Double(0.0, 0.0, 0.0, 0.0);
+		//static_assert(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
+		return _mm_shuffle_ps(Vec1, Vec2, SHUFFLEMASK(Index0, Index1, Index2, Index3));
 	}
 
 	template<int Index>
@@ -110,13 +166,6 @@ namespace Math {
 		return _mm_shuffle_ps(Vec, Vec, SHUFFLEMASK(Index0, Index1, Index2, Index3));
 	}
 
-	template<int Index0, int Index1, int Index2, int Index3>
-	FORCEINLINE VectorRegister4Float VectorShuffleTemplate(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
-	{
-		//static_assert(int(Index0 >= 0 && Index0 <= 3 && Index1 >= 0 && Index1 <= 3 && Index2 >= 0 && Index2 <= 3 && Index3 >= 0 && Index3 <= 3), "Invalid Index");
-		return _mm_shuffle_ps(Vec1, Vec2, SHUFFLEMASK(Index0, Index1, Index2, Index3));
-	}
-
 	/**
 	* Replicates one element into all four elements and returns the new vector.
 	*
@@ -222,7 +271,7 @@ namespace Math {
 
 	FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& VecReg1, const VectorRegister4Float& VecReg2, const VectorRegister4Float& VecReg3)
 	{
-#if AA_PROCESSOR_SUPPORT_FMA3
+#if AA_PLATFORM_HAS_FMA3
 		return _mm_fmadd_ps(VecReg1, VecReg2, VecReg3);
 #else
 		return VectorAdd(VectorMultiply(VecReg1, VecReg2), VecReg3);
@@ -231,7 +280,7 @@ namespace Math {
 
 	FORCEINLINE VectorRegister4Double VectorMultiplyAdd(const VectorRegister4Double& VecReg1, const VectorRegister4Double& VecReg2, const VectorRegister4Double& VecReg3)
 	{
-#if AA_PROCESSOR_SUPPORT_FMA3
+#if AA_PLATFORM_HAS_FMA3
 		VectorRegister4Double ResultVec;
 		ResultVec.XY = _mm_fmadd_pd(VecReg1.XY, VecReg2.XY, VecReg3.XY);
 		ResultVec.ZW = _mm_fmadd_pd(VecReg1.ZW, VecReg2.ZW, VecReg3.ZW);
@@ -283,6 +332,278 @@ namespace Math {
 		return ResultVec;
 	}
 
+	FORCEINLINE VectorRegister4Float VectorSqrt(const VectorRegister4Float& VecReg)
+	{
+		return _mm_sqrt_ps(VecReg);
+	}
+
+	FORCEINLINE VectorRegister4Double VectorSqrt(const VectorRegister4Double& VecReg)
+	{
+		VectorRegister4Double ResultVec;
+		ResultVec.XY = _mm_sqrt_pd(VecReg.XY);
+		ResultVec.ZW = _mm_sqrt_pd(VecReg.ZW);
+		return ResultVec;
+	}
+
+	/*
+	* @returns The X element of a register.
+	*/
+	FORCEINLINE float VectorGetFirstComponent(const VectorRegister4Float& VecReg)
+	{
+		return _mm_cvtss_f32(VecReg);
+	}
+
+	FORCEINLINE double VectorGetFirstComponent(const VectorRegister4Double& VecReg)
+	{
+		return _mm_cvtsd_f64(VecReg.XY);
+	}
+
+	/*
+	* @returns X + Y + Z + W in every element, with shuffles instead of the slower hadd.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorHorizontalSum(const VectorRegisterType& VecReg)
+	{
+		const VectorRegisterType PairSums = VectorAdd(VecReg, VectorSwizzle(VecReg, 2, 3, 0, 1));
+		return VectorAdd(PairSums, VectorSwizzle(PairSums, 1, 0, 3, 2));
+	}
+
+	/*
+	* @returns Cross product of the XYZ of two registers, W is VecReg1.W * VecReg2.W - VecReg1.W * VecReg2.W so 0 for finite inputs.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorCross(const VectorRegisterType& VecReg1, const VectorRegisterType& VecReg2)
+	{
+		return VectorSubtract(
+			VectorMultiply(VectorSwizzle(VecReg1, 1, 2, 0, 3), VectorSwizzle(VecReg2, 2, 0, 1, 3)),
+			VectorMultiply(VectorSwizzle(VecReg1, 2, 0, 1, 3), VectorSwizzle(VecReg2, 1, 2, 0, 3)));
+	}
+
+	/*
+	* @returns Dot product of the XYZW of two registers in every element.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorDot4(const VectorRegisterType& VecReg1, const VectorRegisterType& VecReg2)
+	{
+		return VectorHorizontalSum(VectorMultiply(VecReg1, VecReg2));
+	}
+
+	/*
+	* @returns Dot product of the XYZ of two registers in every element.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorDot3(const VectorRegisterType& VecReg1, const VectorRegisterType& VecReg2)
+	{
+		const VectorRegisterType Products = VectorMultiply(VecReg1, VecReg2);
+		return VectorAdd(VectorAdd(VectorReplicate(Products, 0), VectorReplicate(Products, 1)), VectorReplicate(Products, 2));
+	}
+
+	/*
+	* @returns 1 / Sqrt of every element, see FMath::InvSqrt for the precision of the float version.
+	*/
+	FORCEINLINE VectorRegister4Float VectorReciprocalSqrt(const VectorRegister4Float& VecReg)
+	{
+		const VectorRegister4Float Estimate = _mm_rsqrt_ps(VecReg);
+		const VectorRegister4Float HalfValueEstimate = _mm_mul_ps(_mm_mul_ps(VecReg, _mm_set1_ps(0.5f)), Estimate);
+		return _mm_mul_ps(Estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(HalfValueEstimate, Estimate)));
+	}
+
+	// SSE has no double estimate, so this one is exact
+	FORCEINLINE VectorRegister4Double VectorReciprocalSqrt(const VectorRegister4Double& VecReg)
+	{
+		return VectorDivide(MakeVectorRegister4Double(1.0, 1.0, 1.0, 1.0), VectorSqrt(VecReg));
+	}
+
+	/*
+	* @returns Elements of VecReg1 where Mask is set and of VecReg2 elsewhere, Mask being the all ones / all zeros result of a comparison.
+	*/
+	FORCEINLINE VectorRegister4Float VectorSelect(const VectorRegister4Float& Mask, const VectorRegister4Float& VecReg1, const VectorRegister4Float& VecReg2)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, VecReg1), _mm_andnot_ps(Mask, VecReg2));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& VecReg)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), VecReg);
+	}
+
+	/*
+	* Transcendental functions of the 4 floats of a register, with the Cephes polynomials of MathUtils.h instead of 4 libm calls.
+	* The error bounds are absolute for Sin / Cos / ATan2 and relative for Tan / Exp / Log, measured against the double precision libm results.
+	* FMathBatch runs them over arrays, 8 floats at a time with AVX2.
+	*/
+
+	/*
+	* Splits every element in Quadrant * Pi / 2 + Reduced, with Reduced in [-Pi / 4, Pi / 4], for VectorSinCos and VectorTan.
+	*
+	* @returns Reduced angles.
+	*/
+	FORCEINLINE VectorRegister4Float VectorReduceAngles(const VectorRegister4Float& Angles, __m128i& OutQuadrant)
+	{
+		OutQuadrant = _mm_cvtps_epi32(_mm_mul_ps(Angles, _mm_set1_ps(AA_2_BY_PI)));
+		const VectorRegister4Float QuadrantFloat = _mm_cvtepi32_ps(OutQuadrant);
+		VectorRegister4Float Reduced = VectorMultiplyAdd(QuadrantFloat, _mm_set1_ps(-AA_PI_BY_2_PART1), Angles);
+		Reduced = VectorMultiplyAdd(QuadrantFloat, _mm_set1_ps(-AA_PI_BY_2_PART2), Reduced);
+		Reduced = VectorMultiplyAdd(QuadrantFloat, _mm_set1_ps(-AA_PI_BY_2_PART3), Reduced);
+		return VectorMultiplyAdd(QuadrantFloat, _mm_set1_ps(-AA_PI_BY_2_PART4), Reduced);
+	}
+
+	/*
+	* Sin and Cos of every element, same reduction and error bounds as FMath::SinCos.
+	*/
+	FORCEINLINE void VectorSinCos(const VectorRegister4Float& Angles, VectorRegister4Float& OutSin, VectorRegister4Float& OutCos)
+	{
+		__m128i Quadrant;
+		const VectorRegister4Float Reduced = VectorReduceAngles(Angles, Quadrant);
+		const VectorRegister4Float Reduced2 = VectorMultiply(Reduced, Reduced);
+
+		VectorRegister4Float Sin = VectorMultiplyAdd(Reduced2, _mm_set1_ps(AA_SIN_COEFF3), _mm_set1_ps(AA_SIN_COEFF2));
+		Sin = VectorMultiplyAdd(Reduced2, Sin, _mm_set1_ps(AA_SIN_COEFF1));
+		Sin = VectorMultiplyAdd(VectorMultiply(Reduced2, Reduced), Sin, Reduced);
+
+		VectorRegister4Float Cos = VectorMultiplyAdd(Reduced2, _mm_set1_ps(AA_COS_COEFF3), _mm_set1_ps(AA_COS_COEFF2));
+		Cos = VectorMultiplyAdd(Reduced2, Cos, _mm_set1_ps(AA_COS_COEFF1));
+		Cos = VectorMultiplyAdd(VectorMultiply(Reduced2, Reduced2), Cos, VectorMultiplyAdd(Reduced2, _mm_set1_ps(-0.5f), _mm_set1_ps(1.0f)));
+
+		// Odd quadrants swap Sin and Cos, bit 1 of Quadrant is the sign of Sin and bit 1 of Quadrant + 1 the one of Cos
+		const __m128i One = _mm_set1_epi32(1);
+		const VectorRegister4Float SwapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, One), One));
+		const VectorRegister4Float SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Quadrant, _mm_set1_epi32(2)), 30));
+		const VectorRegister4Float CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(Quadrant, One), _mm_set1_epi32(2)), 30));
+		OutSin = _mm_xor_ps(VectorSelect(SwapMask, Cos, Sin), SinSign);
+		OutCos = _mm_xor_ps(VectorSelect(SwapMask, Sin, Cos), CosSign);
+	}
+
+	FORCEINLINE VectorRegister4Float VectorSin(const VectorRegister4Float& Angles)
+	{
+		VectorRegister4Float Sin, Cos;
+		VectorSinCos(Angles, Sin, Cos);
+		return Sin;
+	}
+
+	FORCEINLINE VectorRegister4Float VectorCos(const VectorRegister4Float& Angles)
+	{
+		VectorRegister4Float Sin, Cos;
+		VectorSinCos(Angles, Sin, Cos);
+		return Cos;
+	}
+
+	/*
+	* Tan of every element from its own polynomial on the reduced angle instead of Sin / Cos, whose error blows up next to the poles.
+	* Within 3e-7 relatively for |A| < 8192, next to the poles and zeros too.
+	*/
+	FORCEINLINE VectorRegister4Float VectorTan(const VectorRegister4Float& Angles)
+	{
+		__m128i Quadrant;
+		const VectorRegister4Float Reduced = VectorReduceAngles(Angles, Quadrant);
+		const VectorRegister4Float Reduced2 = VectorMultiply(Reduced, Reduced);
+
+		VectorRegister4Float Tan = VectorMultiplyAdd(Reduced2, _mm_set1_ps(AA_TAN_COEFF6), _mm_set1_ps(AA_TAN_COEFF5));
+		Tan = VectorMultiplyAdd(Reduced2, Tan, _mm_set1_ps(AA_TAN_COEFF4));
+		Tan = VectorMultiplyAdd(Reduced2, Tan, _mm_set1_ps(AA_TAN_COEFF3));
+		Tan = VectorMultiplyAdd(Reduced2, Tan, _mm_set1_ps(AA_TAN_COEFF2));
+		Tan = VectorMultiplyAdd(Reduced2, Tan, _mm_set1_ps(AA_TAN_COEFF1));
+		Tan = VectorMultiplyAdd(VectorMultiply(Reduced2, Reduced), Tan, Reduced);
+
+		// Odd quadrants are Pi / 2 away, where Tan(Reduced + Pi / 2) = -1 / Tan(Reduced)
+		const __m128i One = _mm_set1_epi32(1);
+		const VectorRegister4Float OddMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, One), One));
+		return VectorSelect(OddMask, VectorDivide(_mm_set1_ps(-1.0f), Tan), Tan);
+	}
+
+	/*
+	* Angle of (X, Y) in [-Pi, Pi] like atan2, within 3e-7 of it, signed zeros included. Two infinite inputs give NaN.
+	*/
+	FORCEINLINE VectorRegister4Float VectorATan2(const VectorRegister4Float& Y, const VectorRegister4Float& X)
+	{
+		// ATan of Min / Max in [0, 1], folded to the octant of (X, Y) afterwards.
+		// The operand order makes min / max return the NaN of either input.
+		const VectorRegister4Float AbsY = VectorAbs(Y);
+		const VectorRegister4Float AbsX = VectorAbs(X);
+		const VectorRegister4Float Max = _mm_max_ps(AbsY, AbsX);
+		const VectorRegister4Float Min = _mm_min_ps(AbsX, AbsY);
+
+		// Above Tan(Pi / 8) the ratio is moved around 0 with ATan(R) = Pi / 4 + ATan((R - 1) / (R + 1)), with a single divide for both cases
+		const VectorRegister4Float bShifted = _mm_cmpgt_ps(Min, _mm_mul_ps(Max, _mm_set1_ps(AA_TAN_PI_BY_8)));
+		const VectorRegister4Float Numerator = VectorSelect(bShifted, VectorSubtract(Min, Max), Min);
+		const VectorRegister4Float Denominator = VectorSelect(bShifted, VectorAdd(Min, Max), Max);
+		// 0 / 0 at the origin, where only the signs matter
+		const VectorRegister4Float Ratio = _mm_andnot_ps(_mm_cmpeq_ps(Max, _mm_setzero_ps()), VectorDivide(Numerator, Denominator));
+		const VectorRegister4Float Ratio2 = VectorMultiply(Ratio, Ratio);
+
+		VectorRegister4Float Angle = VectorMultiplyAdd(Ratio2, _mm_set1_ps(AA_ATAN_COEFF4), _mm_set1_ps(AA_ATAN_COEFF3));
+		Angle = VectorMultiplyAdd(Ratio2, Angle, _mm_set1_ps(AA_ATAN_COEFF2));
+		Angle = VectorMultiplyAdd(Ratio2, Angle, _mm_set1_ps(AA_ATAN_COEFF1));
+		Angle = VectorMultiplyAdd(VectorMultiply(Ratio2, Ratio), Angle, Ratio);
+		Angle = VectorAdd(Angle, _mm_and_ps(bShifted, _mm_set1_ps(AA_PI_BY_4)));
+
+		Angle = VectorSelect(_mm_cmpgt_ps(AbsY, AbsX), VectorSubtract(_mm_set1_ps(AA_PI_BY_2), Angle), Angle);
+		const VectorRegister4Float bNegativeX = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(X), 31));
+		Angle = VectorSelect(bNegativeX, VectorSubtract(_mm_set1_ps(AA_PI), Angle), Angle);
+		return _mm_xor_ps(Angle, _mm_and_ps(Y, _mm_set1_ps(-0.0f)));
+	}
+
+	/*
+	* e^A, within 2e-7 relatively. Inputs are clamped to [AA_EXP_MIN_INPUT, AA_EXP_MAX_INPUT],
+	* so the results saturate to [1.2e-38, 1.6e38] instead of going denormal or infinite.
+	*/
+	FORCEINLINE VectorRegister4Float VectorExp(const VectorRegister4Float& A)
+	{
+		// A = N * Ln(2) + Reduced, e^A = 2^N * e^Reduced. The clamp keeps NaNs as its second operand
+		const VectorRegister4Float Clamped = _mm_min_ps(_mm_set1_ps(AA_EXP_MAX_INPUT), _mm_max_ps(_mm_set1_ps(AA_EXP_MIN_INPUT), A));
+		const __m128i Exponent = _mm_cvtps_epi32(_mm_mul_ps(Clamped, _mm_set1_ps(AA_LOG2_E)));
+		const VectorRegister4Float ExponentFloat = _mm_cvtepi32_ps(Exponent);
+		VectorRegister4Float Reduced = VectorMultiplyAdd(ExponentFloat, _mm_set1_ps(-AA_LN_2_PART1), Clamped);
+		Reduced = VectorMultiplyAdd(ExponentFloat, _mm_set1_ps(-AA_LN_2_PART2), Reduced);
+
+		VectorRegister4Float Poly = VectorMultiplyAdd(Reduced, _mm_set1_ps(AA_EXP_COEFF5), _mm_set1_ps(AA_EXP_COEFF4));
+		Poly = VectorMultiplyAdd(Reduced, Poly, _mm_set1_ps(AA_EXP_COEFF3));
+		Poly = VectorMultiplyAdd(Reduced, Poly, _mm_set1_ps(AA_EXP_COEFF2));
+		Poly = VectorMultiplyAdd(Reduced, Poly, _mm_set1_ps(AA_EXP_COEFF1));
+		Poly = VectorMultiplyAdd(Reduced, Poly, _mm_set1_ps(AA_EXP_COEFF0));
+		Poly = VectorMultiplyAdd(VectorMultiply(Reduced, Reduced), Poly, VectorAdd(Reduced, _mm_set1_ps(1.0f)));
+
+		// 2^N built in the exponent bits
+		const VectorRegister4Float Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Exponent, _mm_set1_epi32(127)), 23));
+		return VectorMultiply(Poly, Scale);
+	}
+
+	/*
+	* Natural logarithm, within 2e-7 absolutely where |Log(A)| < 1 and relatively elsewhere.
+	* A must be finite, 0 gives -infinity, negative numbers and NaN give NaN and denormals are taken as the smallest normal float.
+	*/
+	FORCEINLINE VectorRegister4Float VectorLog(const VectorRegister4Float& A)
+	{
+		// A = 2^Exponent * Mantissa with Mantissa in [Sqrt(0.5), Sqrt(2)], Log(A) = Exponent * Ln(2) + Log(Mantissa)
+		const __m128i Bits = _mm_castps_si128(_mm_max_ps(_mm_set1_ps(1.17549435e-38f), A));
+		VectorRegister4Float Mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+		VectorRegister4Float Exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126)));
+
+		const VectorRegister4Float bSmall = _mm_cmplt_ps(Mantissa, _mm_set1_ps(AA_INV_SQRT_2));
+		Exponent = VectorSubtract(Exponent, _mm_and_ps(bSmall, _mm_set1_ps(1.0f)));
+		Mantissa = VectorAdd(VectorSubtract(Mantissa, _mm_set1_ps(1.0f)), _mm_and_ps(bSmall, Mantissa));
+		const VectorRegister4Float Mantissa2 = VectorMultiply(Mantissa, Mantissa);
+
+		VectorRegister4Float Poly = VectorMultiplyAdd(Mantissa, _mm_set1_ps(AA_LOG_COEFF8), _mm_set1_ps(AA_LOG_COEFF7));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF6));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF5));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF4));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF3));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF2));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF1));
+		Poly = VectorMultiplyAdd(Mantissa, Poly, _mm_set1_ps(AA_LOG_COEFF0));
+		Poly = VectorMultiply(VectorMultiply(Poly, Mantissa2), Mantissa);
+
+		// The small part of Exponent * Ln(2) first, to keep the sum precise
+		Poly = VectorMultiplyAdd(Exponent, _mm_set1_ps(AA_LN_2_PART2), Poly);
+		Poly = VectorMultiplyAdd(Mantissa2, _mm_set1_ps(-0.5f), Poly);
+		VectorRegister4Float Result = VectorMultiplyAdd(Exponent, _mm_set1_ps(AA_LN_2_PART1), VectorAdd(Mantissa, Poly));
+
+		const VectorRegister4Float Zero = _mm_setzero_ps();
+		Result = _mm_or_ps(Result, _mm_cmpnge_ps(A, Zero));
+		return VectorSelect(_mm_cmpeq_ps(A, Zero), _mm_set1_ps(-INFINITY), Result);
+	}
+
 	FORCEINLINE VectorRegister4Float VectorMatrixMultiply(const VectorRegister4Float& VecReg, const FMatrix44f* Mat)
 	{
 		typedef float Float4x4[4][4];
@@ -327,7 +648,7 @@ namespace Math {
 		return ResultVec;
 	}
 
-	FORCEINLINE void MatrixMultiply(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2)
+	FORCEINLINE void MatrixMultiplySSE(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2)
 	{
 
 		const VectorRegister4Float* M1 = ((const VectorRegister4Float*)Mat1);
@@ -364,7 +685,7 @@ namespace Math {
 		ResultMat[3] = ResRow;
 	}
 
-	FORCEINLINE void MatrixMultiply(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2)
+	FORCEINLINE void MatrixMultiplySSE(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2)
 	{
 		const VectorRegister4Double* A = (const VectorRegister4Double*)Mat1;
 		const VectorRegister4Double* B = (const VectorRegister4Double*)Mat2;
@@ -402,118 +723,559 @@ namespace Math {
 		R[3] = Temp;
 	}
 
-	FORCEINLINE void MatrixInverse(FMatrix44f* Result, const FMatrix44f* Mat1)
+	/*
+	* Result = Mat1 * Mat2 with the kernel of the backend picked by FMathDispatch (AVX2 / FMA on CPUs that have it, else MatrixMultiplySSE).
+	*/
+	FORCEINLINE void MatrixMultiply(FMatrix44f* Result, const FMatrix44f* Mat1, const FMatrix44f* Mat2)
 	{
-		typedef float Float4x4[4][4];
-		const Float4x4& M = *((const Float4x4*)Mat1);
-		Float4x4 Res;
+		FMathDispatch::GetActiveKernels().MatrixMultiplyFloat(Result, Mat1, Mat2);
+	}
+
+	FORCEINLINE void MatrixMultiply(FMatrix44d* Result, const FMatrix44d* Mat1, const FMatrix44d* Mat2)
+	{
+		FMathDispatch::GetActiveKernels().MatrixMultiplyDouble(Result, Mat1, Mat2);
+	}
+
+	/*
+	* Transposes four rows in place, generic over float and double registers.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE void VectorTranspose4x4(VectorRegisterType& Row0, VectorRegisterType& Row1, VectorRegisterType& Row2, VectorRegisterType& Row3)
+	{
+		const VectorRegisterType Low01 = VectorShuffle(Row0, Row1, 0, 1, 0, 1);
+		const VectorRegisterType Low23 = VectorShuffle(Row2, Row3, 0, 1, 0, 1);
+		const VectorRegisterType High01 = VectorShuffle(Row0, Row1, 2, 3, 2, 3);
+		const VectorRegisterType High23 = VectorShuffle(Row2, Row3, 2, 3, 2, 3);
+
+		Row0 = VectorShuffle(Low01, Low23, 0, 2, 0, 2);
+		Row1 = VectorShuffle(Low01, Low23, 1, 3, 1, 3);
+		Row2 = VectorShuffle(High01, High23, 0, 2, 0, 2);
+		Row3 = VectorShuffle(High01, High23, 1, 3, 1, 3);
+	}
+
+	/*
+	* 2x2 matrix helpers for the block inverse, a register holds a 2x2 matrix as (M00, M01, M10, M11).
+	* @returns Mat1 * Mat2
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorMatrix2x2Multiply(const VectorRegisterType& Mat1, const VectorRegisterType& Mat2)
+	{
+		return VectorMultiplyAdd(Mat1, VectorSwizzle(Mat2, 0, 3, 0, 3), VectorMultiply(VectorSwizzle(Mat1, 1, 0, 3, 2), VectorSwizzle(Mat2, 2, 1, 2, 1)));
+	}
+
+	/*
+	* @returns Adjugate(Mat1) * Mat2
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorMatrix2x2AdjointMultiply(const VectorRegisterType& Mat1, const VectorRegisterType& Mat2)
+	{
+		return VectorSubtract(VectorMultiply(VectorSwizzle(Mat1, 3, 3, 0, 0), Mat2), VectorMultiply(VectorSwizzle(Mat1, 1, 1, 2, 2), VectorSwizzle(Mat2, 2, 3, 0, 1)));
+	}
+
+	/*
+	* @returns Mat1 * Adjugate(Mat2)
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorMatrix2x2MultiplyAdjoint(const VectorRegisterType& Mat1, const VectorRegisterType& Mat2)
+	{
+		return VectorSubtract(VectorMultiply(Mat1, VectorSwizzle(Mat2, 3, 0, 3, 0)), VectorMultiply(VectorSwizzle(Mat1, 1, 0, 3, 2), VectorSwizzle(Mat2, 2, 1, 2, 1)));
+	}
+
+	/*
+	* Determinants of the four 2x2 blocks of a matrix, [A B; C D] gives (Det A, Det B, Det C, Det D).
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorMatrixBlockDeterminants(const VectorRegisterType& Row0, const VectorRegisterType& Row1, const VectorRegisterType& Row2, const VectorRegisterType& Row3)
+	{
+		return VectorSubtract(
+			VectorMultiply(VectorShuffle(Row0, Row2, 0, 2, 0, 2), VectorShuffle(Row1, Row3, 1, 3, 1, 3)),
+			VectorMultiply(VectorShuffle(Row0, Row2, 1, 3, 1, 3), VectorShuffle(Row1, Row3, 0, 2, 0, 2)));
+	}
+
+	/*
+	* Block inverse shared by the float and double MatrixInverseSSE, splits the matrix in 2x2 blocks [A B; C D] and
+	* builds the inverse from their adjugates, about half the multiplies of the cofactor expansion.
+	*
+	* @returns false, leaving Result untouched, if the matrix is singular.
+	*/
+	template<typename T>
+	FORCEINLINE bool MatrixInverseBlockwise(T* Result, const T* Mat)
+	{
+		typedef decltype(VectorLoadAligned(Mat)) VectorRegisterType;
 
-		Float4x4 Temp;
-		Temp[0][0] = M[2][2] * M[3][3] - M[2][3] * M[3][2];
-		Temp[0][1] = M[2][1] * M[3][3] - M[2][3] * M[3][1];
-		Temp[0][2] = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+		const VectorRegisterType Row0 = VectorLoadAligned(Mat);
+		const VectorRegisterType Row1 = VectorLoadAligned(Mat + 4);
+		const VectorRegisterType Row2 = VectorLoadAligned(Mat + 8);
+		const VectorRegisterType Row3 = VectorLoadAligned(Mat + 12);
 
-		Temp[1][0] = M[2][2] * M[3][3] - M[2][3] * M[3][2];
-		Temp[1][1] = M[2][0] * M[3][3] - M[2][3] * M[3][0];
-		Temp[1][2] = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+		const VectorRegisterType A = VectorShuffle(Row0, Row1, 0, 1, 0, 1);
+		const VectorRegisterType B = VectorShuffle(Row0, Row1, 2, 3, 2, 3);
+		const VectorRegisterType C = VectorShuffle(Row2, Row3, 0, 1, 0, 1);
+		const VectorRegisterType D = VectorShuffle(Row2, Row3, 2, 3, 2, 3);
 
-		Temp[2][0] = M[2][1] * M[3][3] - M[2][3] * M[3][1];
-		Temp[2][1] = M[2][0] * M[3][3] - M[2][3] * M[3][0];
-		Temp[2][2] = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+		const VectorRegisterType BlockDets = VectorMatrixBlockDeterminants(Row0, Row1, Row2, Row3);
+		const VectorRegisterType DetA = VectorReplicate(BlockDets, 0);
+		const VectorRegisterType DetB = VectorReplicate(BlockDets, 1);
+		const VectorRegisterType DetC = VectorReplicate(BlockDets, 2);
+		const VectorRegisterType DetD = VectorReplicate(BlockDets, 3);
 
-		Temp[3][0] = M[2][1] * M[3][2] - M[2][2] * M[3][1];
-		Temp[3][1] = M[2][0] * M[3][2] - M[2][2] * M[3][0];
-		Temp[3][2] = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+		const VectorRegisterType AdjDC = VectorMatrix2x2AdjointMultiply(D, C);
+		const VectorRegisterType AdjAB = VectorMatrix2x2AdjointMultiply(A, B);
 
-		float Det[4];
-		Det[0] = ((M[1][1] * Temp[0][0]) - (M[1][2] * Temp[0][1]) + (M[1][3] * Temp[0][2]));
-		Det[1] = ((M[1][0] * Temp[1][0]) - (M[1][2] * Temp[1][1]) + (M[1][3] * Temp[1][2]));
-		Det[2] = ((M[1][0] * Temp[2][0]) - (M[1][1] * Temp[2][1]) + (M[1][3] * Temp[2][2]));
-		Det[3] = ((M[1][0] * Temp[3][0]) - (M[1][1] * Temp[3][1]) + (M[1][2] * Temp[3][2]));
+		// Det M = Det A * Det D + Det B * Det C - Trace(Adj(A) * B * Adj(D) * C)
+		const VectorRegisterType Det = VectorSubtract(
+			VectorAdd(VectorMultiply(DetA, DetD), VectorMultiply(DetB, DetC)),
+			VectorHorizontalSum(VectorMultiply(AdjAB, VectorSwizzle(AdjDC, 0, 2, 1, 3))));
 
-		float Determinant = Det[0] * M[0][0] - Det[1] * M[0][1] + Det[2] * M[0][2] - Det[3] * M[0][3];
+		if (VectorGetFirstComponent(Det) == 0)
+		{
+			return false;
+		}
 
-		float OneByDet = 1.0f / Determinant;
+		// Adjugates of the blocks of the inverse, stored transposed
+		const VectorRegisterType X = VectorSubtract(VectorMultiply(DetD, A), VectorMatrix2x2Multiply(B, AdjDC));
+		const VectorRegisterType W = VectorSubtract(VectorMultiply(DetA, D), VectorMatrix2x2Multiply(C, AdjAB));
+		const VectorRegisterType Y = VectorSubtract(VectorMultiply(DetB, C), VectorMatrix2x2MultiplyAdjoint(D, AdjAB));
+		const VectorRegisterType Z = VectorSubtract(VectorMultiply(DetC, B), VectorMatrix2x2MultiplyAdjoint(A, AdjDC));
+
+		const T One = 1;
+		const VectorRegisterType OneByDet = VectorDivide(MakeVectorRegister(One, -One, -One, One), Det);
+
+		const VectorRegisterType ScaledX = VectorMultiply(X, OneByDet);
+		const VectorRegisterType ScaledY = VectorMultiply(Y, OneByDet);
+		const VectorRegisterType ScaledZ = VectorMultiply(Z, OneByDet);
+		const VectorRegisterType ScaledW = VectorMultiply(W, OneByDet);
+
+		// Every input row is in registers, so Result may be Mat
+		VectorStoreAligned(VectorShuffle(ScaledX, ScaledY, 3, 1, 3, 1), Result);
+		VectorStoreAligned(VectorShuffle(ScaledX, ScaledY, 2, 0, 2, 0), Result + 4);
+		VectorStoreAligned(VectorShuffle(ScaledZ, ScaledW, 3, 1, 3, 1), Result + 8);
+		VectorStoreAligned(VectorShuffle(ScaledZ, ScaledW, 2, 0, 2, 0), Result + 12);
+		return true;
+	}
 
-		Res[0][0] = OneByDet * Det[0];
-		Res[1][0] = -OneByDet * Det[1];
-		Res[2][0] = OneByDet * Det[2];
-		Res[3][0] = -OneByDet * Det[3];
+	/*
+	* Inverse of a matrix whose last column is (0, 0, 0, 1), the 3x3 part is inverted through cross products and
+	* the translation is rotated by it, cheaper than the general inverse.
+	*
+	* @returns false, leaving Result untouched, if the 3x3 part is singular.
+	*/
+	template<typename T>
+	FORCEINLINE bool MatrixInverseAffineRows(T* Result, const T* Mat)
+	{
+		typedef decltype(VectorLoadAligned(Mat)) VectorRegisterType;
 
-		Res[0][1] = -OneByDet * ((M[0][1] * Temp[0][0]) - (M[0][2] * Temp[0][1]) + (M[0][3] * Temp[0][2]));
-		Res[1][1] = OneByDet * ((M[0][0] * Temp[1][0]) - (M[0][2] * Temp[1][1]) + (M[0][3] * Temp[1][2]));
-		Res[2][1] = -OneByDet * ((M[0][0] * Temp[2][0]) - (M[0][1] * Temp[2][1]) + (M[0][3] * Temp[2][2]));
-		Res[3][1] = OneByDet * ((M[0][0] * Temp[3][0]) - (M[0][1] * Temp[3][1]) + (M[0][2] * Temp[3][2]));
+		const VectorRegisterType Row0 = VectorLoadAligned(Mat);
+		const VectorRegisterType Row1 = VectorLoadAligned(Mat + 4);
+		const VectorRegisterType Row2 = VectorLoadAligned(Mat + 8);
+		const VectorRegisterType Translation = VectorLoadAligned(Mat + 12);
 
-		Res[0][2] = OneByDet * ((M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) + (M[0][3] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])));
-		Res[1][2] = -OneByDet * (((M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][2] - M[1][2] * M[3][0]))));
-		Res[2][2] = OneByDet * ((M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])));
-		Res[3][2] = -OneByDet * (((M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][2] - M[1][2] * M[3][0])) + (M[0][2] * (M[1][0] * M[3][1] - M[1][1] * M[3][0]))));
+		// Columns of the adjugate, their W is 0 whatever the W of the rows is
+		VectorRegisterType Cross0 = VectorCross(Row1, Row2);
+		VectorRegisterType Cross1 = VectorCross(Row2, Row0);
+		VectorRegisterType Cross2 = VectorCross(Row0, Row1);
 
-		Res[0][3] = -OneByDet * (((M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) + (M[0][3] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]))));
-		Res[1][3] = OneByDet * ((M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])));
-		Res[2][3] = -OneByDet * (((M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]))));
-		Res[3][3] = OneByDet * ((M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) + (M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])));
+		const VectorRegisterType Det = VectorHorizontalSum(VectorMultiply(Row0, Cross0));
+		if (VectorGetFirstComponent(Det) == 0)
+		{
+			return false;
+		}
 
-		FMemory::MemCopy(Result, &Res, 16 * sizeof(float));
+		const T One = 1;
+		const T Zero = 0;
+		const VectorRegisterType OneByDet = VectorDivide(MakeVectorRegister(One, One, One, One), Det);
+
+		VectorRegisterType Unused = MakeVectorRegister(Zero, Zero, Zero, Zero);
+		VectorTranspose4x4(Cross0, Cross1, Cross2, Unused);
+		const VectorRegisterType Inv0 = VectorMultiply(Cross0, OneByDet);
+		const VectorRegisterType Inv1 = VectorMultiply(Cross1, OneByDet);
+		const VectorRegisterType Inv2 = VectorMultiply(Cross2, OneByDet);
+
+		// -Translation * Inverse3x3, with the 1 of the last column added back
+		VectorRegisterType InvTranslation = VectorMultiply(VectorReplicate(Translation, 0), Inv0);
+		InvTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 1), Inv1, InvTranslation);
+		InvTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 2), Inv2, InvTranslation);
+		InvTranslation = VectorSubtract(MakeVectorRegister(Zero, Zero, Zero, One), InvTranslation);
+
+		VectorStoreAligned(Inv0, Result);
+		VectorStoreAligned(Inv1, Result + 4);
+		VectorStoreAligned(Inv2, Result + 8);
+		VectorStoreAligned(InvTranslation, Result + 12);
+		return true;
 	}
 
-	FORCEINLINE void MatrixInverse(FMatrix44d* Result, const FMatrix44d* Mat1)
+	/*
+	* Result = Inverse(Mat), Result may be Mat.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	FORCEINLINE bool MatrixInverseSSE(FMatrix44f* Result, const FMatrix44f* Mat)
 	{
-		typedef double Double4x4[4][4];
-		const Double4x4& M = *((const Double4x4*)Mat1);
-		Double4x4 Res;
+		return MatrixInverseBlockwise((float*)Result, (const float*)Mat);
+	}
 
-		Double4x4 Temp;
-		Temp[0][0] = M[2][2] * M[3][3] - M[2][3] * M[3][2];
-		Temp[0][1] = M[2][1] * M[3][3] - M[2][3] * M[3][1];
-		Temp[0][2] = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+	FORCEINLINE bool MatrixInverseSSE(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		return MatrixInverseBlockwise((double*)Result, (const double*)Mat);
+	}
 
-		Temp[1][0] = M[2][2] * M[3][3] - M[2][3] * M[3][2];
-		Temp[1][1] = M[2][0] * M[3][3] - M[2][3] * M[3][0];
-		Temp[1][2] = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+	/*
+	* Result = Inverse(Mat) for a Mat made of rotation, scale and translation only (last column (0, 0, 0, 1)), Result may be Mat.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	FORCEINLINE bool MatrixInverseAffineSSE(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		return MatrixInverseAffineRows((float*)Result, (const float*)Mat);
+	}
 
-		Temp[2][0] = M[2][1] * M[3][3] - M[2][3] * M[3][1];
-		Temp[2][1] = M[2][0] * M[3][3] - M[2][3] * M[3][0];
-		Temp[2][2] = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+	FORCEINLINE bool MatrixInverseAffineSSE(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		return MatrixInverseAffineRows((double*)Result, (const double*)Mat);
+	}
 
-		Temp[3][0] = M[2][1] * M[3][2] - M[2][2] * M[3][1];
-		Temp[3][1] = M[2][0] * M[3][2] - M[2][2] * M[3][0];
-		Temp[3][2] = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+	/*
+	* Result = Inverse(Mat) with the kernel of the backend picked by FMathDispatch, Result may be Mat.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	FORCEINLINE bool MatrixInverse(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		return FMathDispatch::GetActiveKernels().MatrixInverseFloat(Result, Mat);
+	}
 
-		double Det[4];
-		Det[0] = ((M[1][1] * Temp[0][0]) - (M[1][2] * Temp[0][1]) + (M[1][3] * Temp[0][2]));
-		Det[1] = ((M[1][0] * Temp[1][0]) - (M[1][2] * Temp[1][1]) + (M[1][3] * Temp[1][2]));
-		Det[2] = ((M[1][0] * Temp[2][0]) - (M[1][1] * Temp[2][1]) + (M[1][3] * Temp[2][2]));
-		Det[3] = ((M[1][0] * Temp[3][0]) - (M[1][1] * Temp[3][1]) + (M[1][2] * Temp[3][2]));
+	FORCEINLINE bool MatrixInverse(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		return FMathDispatch::GetActiveKernels().MatrixInverseDouble(Result, Mat);
+	}
 
-		double Determinant = Det[0] * M[0][0] - Det[1] * M[0][1] + Det[2] * M[0][2] - Det[3] * M[0][3];
+	/*
+	* Result = Inverse(Mat) for an affine Mat (last column (0, 0, 0, 1)) with the kernel of the backend picked by FMathDispatch.
+	* @returns false, leaving Result untouched, if Mat is singular.
+	*/
+	FORCEINLINE bool MatrixInverseAffine(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		return FMathDispatch::GetActiveKernels().MatrixInverseAffineFloat(Result, Mat);
+	}
 
-		double OneByDet = 1.0f / Determinant;
+	FORCEINLINE bool MatrixInverseAffine(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		return FMathDispatch::GetActiveKernels().MatrixInverseAffineDouble(Result, Mat);
+	}
 
-		Res[0][0] = OneByDet * Det[0];
-		Res[1][0] = -OneByDet * Det[1];
-		Res[2][0] = OneByDet * Det[2];
-		Res[3][0] = -OneByDet * Det[3];
+	/*
+	* @returns Determinant of Mat, from the determinants of its 2x2 blocks.
+	*/
+	template<typename T>
+	FORCEINLINE T MatrixDeterminantBlockwise(const T* Mat)
+	{
+		typedef decltype(VectorLoadAligned(Mat)) VectorRegisterType;
 
-		Res[0][1] = -OneByDet * ((M[0][1] * Temp[0][0]) - (M[0][2] * Temp[0][1]) + (M[0][3] * Temp[0][2]));
-		Res[1][1] = OneByDet * ((M[0][0] * Temp[1][0]) - (M[0][2] * Temp[1][1]) + (M[0][3] * Temp[1][2]));
-		Res[2][1] = -OneByDet * ((M[0][0] * Temp[2][0]) - (M[0][1] * Temp[2][1]) + (M[0][3] * Temp[2][2]));
-		Res[3][1] = OneByDet * ((M[0][0] * Temp[3][0]) - (M[0][1] * Temp[3][1]) + (M[0][2] * Temp[3][2]));
+		const VectorRegisterType Row0 = VectorLoadAligned(Mat);
+		const VectorRegisterType Row1 = VectorLoadAligned(Mat + 4);
+		const VectorRegisterType Row2 = VectorLoadAligned(Mat + 8);
+		const VectorRegisterType Row3 = VectorLoadAligned(Mat + 12);
 
-		Res[0][2] = ((M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) + (M[0][3] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])));
-		Res[1][2] = -(((M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2])) - (M[0][2] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][2] - M[1][2] * M[3][0]))));
-		Res[2][2] = ((M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][3] - M[1][3] * M[3][0])) + (M[0][3] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])));
-		Res[3][2] = -(((M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])) - (M[0][1] * (M[1][0] * M[3][2] - M[1][2] * M[3][0])) + (M[0][2] * (M[1][0] * M[3][1] - M[1][1] * M[3][0]))));
+		const VectorRegisterType BlockDets = VectorMatrixBlockDeterminants(Row0, Row1, Row2, Row3);
+		const VectorRegisterType AdjDC = VectorMatrix2x2AdjointMultiply(VectorShuffle(Row2, Row3, 2, 3, 2, 3), VectorShuffle(Row2, Row3, 0, 1, 0, 1));
+		const VectorRegisterType AdjAB = VectorMatrix2x2AdjointMultiply(VectorShuffle(Row0, Row1, 0, 1, 0, 1), VectorShuffle(Row0, Row1, 2, 3, 2, 3));
 
-		Res[0][3] = -(((M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) + (M[0][3] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]))));
-		Res[1][3] = ((M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2])) - (M[0][2] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])));
-		Res[2][3] = -(((M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][3] - M[1][3] * M[2][0])) + (M[0][3] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]))));
-		Res[3][3] = ((M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) - (M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) + (M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])));
+		// (Det A * Det D, Det B * Det C) in the first two elements, the trace term summed over all four
+		const VectorRegisterType Products = VectorMultiply(BlockDets, VectorSwizzle(BlockDets, 3, 2, 1, 0));
+		const VectorRegisterType Det = VectorSubtract(VectorAdd(Products, VectorReplicate(Products, 1)), VectorHorizontalSum(VectorMultiply(AdjAB, VectorSwizzle(AdjDC, 0, 2, 1, 3))));
+		return VectorGetFirstComponent(Det);
+	}
+
+	FORCEINLINE float MatrixDeterminant(const FMatrix44f* Mat)
+	{
+		return MatrixDeterminantBlockwise((const float*)Mat);
+	}
+
+	FORCEINLINE double MatrixDeterminant(const FMatrix44d* Mat)
+	{
+		return MatrixDeterminantBlockwise((const double*)Mat);
+	}
+
+	/*
+	* Result = Transpose(Mat), Result may be Mat.
+	*/
+	template<typename T>
+	FORCEINLINE void MatrixTransposeRows(T* Result, const T* Mat)
+	{
+		auto Row0 = VectorLoadAligned(Mat);
+		auto Row1 = VectorLoadAligned(Mat + 4);
+		auto Row2 = VectorLoadAligned(Mat + 8);
+		auto Row3 = VectorLoadAligned(Mat + 12);
 
-		FMemory::MemCopy(Result, &Res, 16 * sizeof(double));
+		VectorTranspose4x4(Row0, Row1, Row2, Row3);
+
+		VectorStoreAligned(Row0, Result);
+		VectorStoreAligned(Row1, Result + 4);
+		VectorStoreAligned(Row2, Result + 8);
+		VectorStoreAligned(Row3, Result + 12);
+	}
+
+	FORCEINLINE void MatrixTranspose(FMatrix44f* Result, const FMatrix44f* Mat)
+	{
+		MatrixTransposeRows((float*)Result, (const float*)Mat);
+	}
+
+	FORCEINLINE void MatrixTranspose(FMatrix44d* Result, const FMatrix44d* Mat)
+	{
+		MatrixTransposeRows((double*)Result, (const double*)Mat);
+	}
+
+	/*
+	* Quaternion helpers on (X, Y, Z, W) elements, see TQuaternion for the conventions.
+	*/
+
+	/*
+	* @returns Quat1 * Quat2, the rotation of Quat1 followed by the one of Quat2 like a matrix product,
+	* which is the Hamilton product Quat2 Quat1.
+	*/
+	template<typename T, typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorQuaternionMultiply(const VectorRegisterType& Quat1, const VectorRegisterType& Quat2)
+	{
+		// Quat2.W * Quat1 plus Quat2.X, Y, Z times signed swizzles of Quat1
+		VectorRegisterType Res = VectorMultiply(VectorReplicate(Quat2, 3), Quat1);
+		Res = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat2, 0), MakeVectorRegister(T(1), T(-1), T(1), T(-1))), VectorSwizzle(Quat1, 3, 2, 1, 0), Res);
+		Res = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat2, 1), MakeVectorRegister(T(1), T(1), T(-1), T(-1))), VectorSwizzle(Quat1, 2, 3, 0, 1), Res);
+		Res = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat2, 2), MakeVectorRegister(T(-1), T(1), T(1), T(-1))), VectorSwizzle(Quat1, 1, 0, 3, 2), Res);
+		return Res;
+	}
+
+	/*
+	* @returns Quat * Vec * Conjugate(Quat) for a normalized Quat, as Vec + W * C + Cross(Quat, C) with C = 2 * Cross(Quat, Vec).
+	* The W of the result is the W of Vec.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorQuaternionRotateVector(const VectorRegisterType& Quat, const VectorRegisterType& Vec)
+	{
+		VectorRegisterType Cross = VectorCross(Quat, Vec);
+		Cross = VectorAdd(Cross, Cross);
+		return VectorAdd(VectorMultiplyAdd(VectorReplicate(Quat, 3), Cross, Vec), VectorCross(Quat, Cross));
+	}
+
+	/*
+	* @returns Conjugate(Quat) * Vec * Quat for a normalized Quat, the inverse of VectorQuaternionRotateVector.
+	*/
+	template<typename T, typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorQuaternionUnrotateVector(const VectorRegisterType& Quat, const VectorRegisterType& Vec)
+	{
+		return VectorQuaternionRotateVector(VectorMultiply(Quat, MakeVectorRegister(T(-1), T(-1), T(-1), T(1))), Vec);
+	}
+
+	/*
+	* Result = Quat1 * Quat2, see VectorQuaternionMultiply. Result may be Quat1 or Quat2.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionMultiplyElements(T* Result, const T* Quat1, const T* Quat2)
+	{
+		VectorStoreAligned(VectorQuaternionMultiply<T>(VectorLoadAligned(Quat1), VectorLoadAligned(Quat2)), Result);
+	}
+
+	FORCEINLINE void QuaternionMultiply(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2)
+	{
+		QuaternionMultiplyElements((float*)Result, (const float*)Quat1, (const float*)Quat2);
+	}
+
+	FORCEINLINE void QuaternionMultiply(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2)
+	{
+		QuaternionMultiplyElements((double*)Result, (const double*)Quat1, (const double*)Quat2);
+	}
+
+	/*
+	* Copies the X, Y and Z of a register to a 3 element vector.
+	*/
+	template<typename T, typename VectorRegisterType>
+	FORCEINLINE void VectorStoreVector3(const VectorRegisterType& Vec, T* Dest)
+	{
+		alignas(16) T Out[4];
+		VectorStoreAligned(Vec, Out);
+		Dest[0] = Out[0];
+		Dest[1] = Out[1];
+		Dest[2] = Out[2];
+	}
+
+	/*
+	* Result = Quat * Vec * Conjugate(Quat) for a normalized Quat, see VectorQuaternionRotateVector. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionRotateVectorElements(T* Result, const T* Quat, const T* Vec)
+	{
+		VectorStoreVector3(VectorQuaternionRotateVector(VectorLoadAligned(Quat), MakeVectorRegister(Vec[0], Vec[1], Vec[2], T(0))), Result);
+	}
+
+	FORCEINLINE void QuaternionRotateVector(FVector3f* Result, const FQuaternionf* Quat, const FVector3f* Vec)
+	{
+		QuaternionRotateVectorElements((float*)Result, (const float*)Quat, (const float*)Vec);
+	}
+
+	FORCEINLINE void QuaternionRotateVector(FVector3d* Result, const FQuaterniond* Quat, const FVector3d* Vec)
+	{
+		QuaternionRotateVectorElements((double*)Result, (const double*)Quat, (const double*)Vec);
+	}
+
+	/*
+	* Result = Quat / Size(Quat).
+	* @returns false, leaving Result untouched, if the squared size is below Tolerance.
+	*/
+	template<typename T>
+	FORCEINLINE bool QuaternionNormalizeElements(T* Result, const T* Quat, T Tolerance)
+	{
+		const auto Q = VectorLoadAligned(Quat);
+		const auto SizeSquared = VectorHorizontalSum(VectorMultiply(Q, Q));
+		if (VectorGetFirstComponent(SizeSquared) < Tolerance)
+		{
+			return false;
+		}
+		VectorStoreAligned(VectorDivide(Q, VectorSqrt(SizeSquared)), Result);
+		return true;
+	}
+
+	FORCEINLINE bool QuaternionNormalize(FQuaternionf* Result, const FQuaternionf* Quat, float Tolerance)
+	{
+		return QuaternionNormalizeElements((float*)Result, (const float*)Quat, Tolerance);
+	}
+
+	FORCEINLINE bool QuaternionNormalize(FQuaterniond* Result, const FQuaterniond* Quat, double Tolerance)
+	{
+		return QuaternionNormalizeElements((double*)Result, (const double*)Quat, Tolerance);
+	}
+
+	/*
+	* @returns Quat / Size(Quat), without a check for zero quaternions.
+	*/
+	template<typename VectorRegisterType>
+	FORCEINLINE VectorRegisterType VectorQuaternionNormalize(const VectorRegisterType& Quat)
+	{
+		return VectorDivide(Quat, VectorSqrt(VectorHorizontalSum(VectorMultiply(Quat, Quat))));
+	}
+
+	/*
+	* Result = Normalize(Lerp(Quat1, Quat2, Alpha)), Quat2 is negated first when the quaternions are more than 180 degrees apart
+	* so the blend takes the short way.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionNlerpElements(T* Result, const T* Quat1, const T* Quat2, T Alpha)
+	{
+		const auto Q1 = VectorLoadAligned(Quat1);
+		const auto Q2 = VectorLoadAligned(Quat2);
+		const T Scale2 = VectorGetFirstComponent(VectorHorizontalSum(VectorMultiply(Q1, Q2))) < T(0) ? -Alpha : Alpha;
+		const T Scale1 = T(1) - Alpha;
+
+		const auto Res = VectorMultiplyAdd(Q2, MakeVectorRegister(Scale2, Scale2, Scale2, Scale2), VectorMultiply(Q1, MakeVectorRegister(Scale1, Scale1, Scale1, Scale1)));
+		VectorStoreAligned(VectorQuaternionNormalize(Res), Result);
+	}
+
+	/*
+	* Result = constant speed interpolation from Quat1 to Quat2 along the short way, both normalized.
+	* Close quaternions fall back to a normalized lerp, where the sines of the angle lose their precision.
+	*/
+	template<typename T>
+	FORCEINLINE void QuaternionSlerpElements(T* Result, const T* Quat1, const T* Quat2, T Alpha)
+	{
+		const auto Q1 = VectorLoadAligned(Quat1);
+		const auto Q2 = VectorLoadAligned(Quat2);
+		const T RawCosAngle = VectorGetFirstComponent(VectorHorizontalSum(VectorMultiply(Q1, Q2)));
+		const T CosAngle = RawCosAngle < T(0) ? -RawCosAngle : RawCosAngle;
+
+		T Scale1 = T(1) - Alpha;
+		T Scale2 = Alpha;
+		if (CosAngle < T(0.9999))
+		{
+			const T Angle = FMath::ACos(CosAngle);
+			const T InvSinAngle = T(1) / FMath::Sin(Angle);
+			Scale1 = FMath::Sin(Scale1 * Angle) * InvSinAngle;
+			Scale2 = FMath::Sin(Scale2 * Angle) * InvSinAngle;
+		}
+		Scale2 = RawCosAngle < T(0) ? -Scale2 : Scale2;
+
+		const auto Res = VectorMultiplyAdd(Q2, MakeVectorRegister(Scale2, Scale2, Scale2, Scale2), VectorMultiply(Q1, MakeVectorRegister(Scale1, Scale1, Scale1, Scale1)));
+		VectorStoreAligned(VectorQuaternionNormalize(Res), Result);
+	}
+
+	FORCEINLINE void QuaternionNlerp(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2, float Alpha)
+	{
+		QuaternionNlerpElements((float*)Result, (const float*)Quat1, (const float*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionNlerp(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2, double Alpha)
+	{
+		QuaternionNlerpElements((double*)Result, (const double*)Quat1, (const double*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionSlerp(FQuaternionf* Result, const FQuaternionf* Quat1, const FQuaternionf* Quat2, float Alpha)
+	{
+		QuaternionSlerpElements((float*)Result, (const float*)Quat1, (const float*)Quat2, Alpha);
+	}
+
+	FORCEINLINE void QuaternionSlerp(FQuaterniond* Result, const FQuaterniond* Quat1, const FQuaterniond* Quat2, double Alpha)
+	{
+		QuaternionSlerpElements((double*)Result, (const double*)Quat1, (const double*)Quat2, Alpha);
+	}
+
+	/*
+	* Transform helpers on the (X, Y, Z, W) rotation and (X, Y, Z) location and scale elements of a TTransform, see it for the conventions.
+	*/
+
+	/*
+	* Result = Rotate(Vec * Scale) + Location. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformPositionElements(T* Result, const T* Rotation, const T* Location, const T* Scale, const T* Vec)
+	{
+		const auto Scaled = VectorMultiply(MakeVectorRegister(Vec[0], Vec[1], Vec[2], T(0)), MakeVectorRegister(Scale[0], Scale[1], Scale[2], T(0)));
+		const auto Res = VectorAdd(VectorQuaternionRotateVector(VectorLoadAligned(Rotation), Scaled), MakeVectorRegister(Location[0], Location[1], Location[2], T(0)));
+		VectorStoreVector3(Res, Result);
+	}
+
+	/*
+	* Result = Unrotate(Vec - Location) * InvScale, the exact inverse of TransformPositionElements. Result may be Vec.
+	*/
+	template<typename T>
+	FORCEINLINE void InverseTransformPositionElements(T* Result, const T* Rotation, const T* Location, const T* InvScale, const T* Vec)
+	{
+		const auto Translated = VectorSubtract(MakeVectorRegister(Vec[0], Vec[1], Vec[2], T(0)), MakeVectorRegister(Location[0], Location[1], Location[2], T(0)));
+		const auto Res = VectorMultiply(VectorQuaternionUnrotateVector<T>(VectorLoadAligned(Rotation), Translated), MakeVectorRegister(InvScale[0], InvScale[1], InvScale[2], T(0)));
+		VectorStoreVector3(Res, Result);
+	}
+
+	/*
+	* Transform1 followed by Transform2:
+	* Rotation = Rotation1 * Rotation2, Scale = Scale1 * Scale2, Location = Rotate2(Location1 * Scale2) + Location2.
+	* The results may be any of the inputs.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformMultiplyElements(T* ResultRotation, T* ResultLocation, T* ResultScale,
+		const T* Rotation1, const T* Location1, const T* Scale1, const T* Rotation2, const T* Location2, const T* Scale2)
+	{
+		const auto Rot2 = VectorLoadAligned(Rotation2);
+		const auto Scl2 = MakeVectorRegister(Scale2[0], Scale2[1], Scale2[2], T(0));
+
+		const auto Rot = VectorQuaternionMultiply<T>(VectorLoadAligned(Rotation1), Rot2);
+		const auto Scl = VectorMultiply(MakeVectorRegister(Scale1[0], Scale1[1], Scale1[2], T(0)), Scl2);
+		const auto Loc = VectorAdd(VectorQuaternionRotateVector(Rot2, VectorMultiply(MakeVectorRegister(Location1[0], Location1[1], Location1[2], T(0)), Scl2)),
+			MakeVectorRegister(Location2[0], Location2[1], Location2[2], T(0)));
+
+		VectorStoreAligned(Rot, ResultRotation);
+		VectorStoreVector3(Loc, ResultLocation);
+		VectorStoreVector3(Scl, ResultScale);
+	}
+
+	/*
+	* Rotation = Conjugate(Rotation), Scale = InvScale, Location = -Unrotate(Location) * InvScale.
+	* The results may be the inputs.
+	*/
+	template<typename T>
+	FORCEINLINE void TransformInverseElements(T* ResultRotation, T* ResultLocation, T* ResultScale, const T* Rotation, const T* Location, const T* InvScale)
+	{
+		const auto Conjugate = VectorMultiply(VectorLoadAligned(Rotation), MakeVectorRegister(T(-1), T(-1), T(-1), T(1)));
+		const auto InvScl = MakeVectorRegister(InvScale[0], InvScale[1], InvScale[2], T(0));
+		const auto Loc = VectorMultiply(VectorQuaternionRotateVector(Conjugate, MakeVectorRegister(-Location[0], -Location[1], -Location[2], T(0))), InvScl);
+
+		VectorStoreAligned(Conjugate, ResultRotation);
+		VectorStoreVector3(Loc, ResultLocation);
+		VectorStoreVector3(InvScl, ResultScale);
 	}
 
 }
 }
-#endif
\ No newline at end of file
+#endif
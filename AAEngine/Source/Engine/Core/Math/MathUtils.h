@@ -44,4 +44,65 @@
 #define AA_DOUBLE_INV_SQRT_2	(0.70710678118654752440084436210485)
 #define AA_DOUBLE_INV_SQRT_3	(0.57735026918962576450914878050196)
 #define AA_DOUBLE_SQRT_2_BY_2	(0.70710678118654752440084436210485)
-#define AA_DOUBLE_SQRT_3_BY_2	(0.86602540378443864676372317075294)
\ No newline at end of file
+#define AA_DOUBLE_SQRT_3_BY_2	(0.86602540378443864676372317075294)
+
+/*
+* Constants of the polynomial Sin / Cos / Tan / ATan2 / Exp / Log behind FMath::SinCos, MathSSE.h and MathAVX.cpp.
+* The coefficients are the single precision minimax ones of the Cephes library.
+*/
+#define AA_2_BY_PI			(0.63661977236758134308f)
+#define AA_PI_BY_4			(0.78539816339744830962f)
+#define AA_TAN_PI_BY_8		(0.41421356237309504880f)
+#define AA_LOG2_E			(1.44269504088896340736f)
+
+// Pi / 2 and Ln(2) split in parts with few mantissa bits, so N * Part stays exact in the range reductions, all but the last part
+// Pi / 2 needs 4 parts, with 3 the rounding of N * Part3 is a big relative error for Tan next to its zeros and poles
+#define AA_PI_BY_2_PART1	(1.5703125f)
+#define AA_PI_BY_2_PART2	(4.837512969970703125e-4f)
+#define AA_PI_BY_2_PART3	(7.54953362047672271729e-8f)
+#define AA_PI_BY_2_PART4	(2.56334406825708960298e-12f)
+#define AA_LN_2_PART1		(0.693359375f)
+#define AA_LN_2_PART2		(-2.12194440e-4f)
+
+// Sin(X) = X + X^3 * (S1 + X^2 * (S2 + X^2 * S3)) and Cos(X) = 1 - X^2 / 2 + X^4 * (C1 + X^2 * (C2 + X^2 * C3)) on [-Pi / 4, Pi / 4]
+#define AA_SIN_COEFF1		(-1.6666654611e-1f)
+#define AA_SIN_COEFF2		(8.3321608736e-3f)
+#define AA_SIN_COEFF3		(-1.9515295891e-4f)
+#define AA_COS_COEFF1		(4.166664568298827e-2f)
+#define AA_COS_COEFF2		(-1.388731625493765e-3f)
+#define AA_COS_COEFF3		(2.443315711809948e-5f)
+
+// Tan(X) = X + X^3 * (T1 + X^2 * (T2 + ... X^2 * T6)) on [-Pi / 4, Pi / 4]
+#define AA_TAN_COEFF1		(3.33331568548e-1f)
+#define AA_TAN_COEFF2		(1.33387994085e-1f)
+#define AA_TAN_COEFF3		(5.34112807005e-2f)
+#define AA_TAN_COEFF4		(2.44301354525e-2f)
+#define AA_TAN_COEFF5		(3.11992232697e-3f)
+#define AA_TAN_COEFF6		(9.38540185543e-3f)
+
+// ATan(X) = X + X^3 * (A1 + X^2 * (A2 + X^2 * (A3 + X^2 * A4))) on [-Tan(Pi / 8), Tan(Pi / 8)]
+#define AA_ATAN_COEFF1		(-3.33329491539e-1f)
+#define AA_ATAN_COEFF2		(1.99777106478e-1f)
+#define AA_ATAN_COEFF3		(-1.38776856032e-1f)
+#define AA_ATAN_COEFF4		(8.05374449538e-2f)
+
+// Exp(X) = 1 + X + X^2 * (E0 + X * (E1 + ... X * E5)) on [-Ln(2) / 2, Ln(2) / 2], inputs clamped so 2^N stays a normal float
+#define AA_EXP_COEFF0		(5.0000001201e-1f)
+#define AA_EXP_COEFF1		(1.6666665459e-1f)
+#define AA_EXP_COEFF2		(4.1665795894e-2f)
+#define AA_EXP_COEFF3		(8.3334519073e-3f)
+#define AA_EXP_COEFF4		(1.3981999507e-3f)
+#define AA_EXP_COEFF5		(1.9875691500e-4f)
+#define AA_EXP_MIN_INPUT	(-87.3365447505f)
+#define AA_EXP_MAX_INPUT	(88.0f)
+
+// Log(1 + X) = X - X^2 / 2 + X^3 * (L0 + X * (L1 + ... X * L8)) on [Sqrt(0.5) - 1, Sqrt(2) - 1]
+#define AA_LOG_COEFF0		(3.3333331174e-1f)
+#define AA_LOG_COEFF1		(-2.4999993993e-1f)
+#define AA_LOG_COEFF2		(2.0000714765e-1f)
+#define AA_LOG_COEFF3		(-1.6668057665e-1f)
+#define AA_LOG_COEFF4		(1.4249322787e-1f)
+#define AA_LOG_COEFF5		(-1.2420140846e-1f)
+#define AA_LOG_COEFF6		(1.1676998740e-1f)
+#define AA_LOG_COEFF7		(-1.1514610310e-1f)
+#define AA_LOG_COEFF8		(7.0376836292e-2f)
\ No newline at end of file
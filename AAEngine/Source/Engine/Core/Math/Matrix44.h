@@ -69,22 +69,10 @@ namespace Math {
 			}
 		}
 
-		FORCEINLINE constexpr TMatrix44(const TMatrix44& Mat) noexcept
-		{
-			for (int i = 0; i < 16; i++)
-			{
-				MLin[i] = Mat.MLin[i];
-			}
-		}
+		// Defaulted so a copy is a plain memory copy, copying element by element cost more than the product in operator*
+		constexpr TMatrix44(const TMatrix44& Mat) noexcept = default;
 
-		FORCEINLINE constexpr TMatrix44& operator=(const TMatrix44& Mat) noexcept
-		{
-			for (int i = 0; i < 16; i++)
-			{
-				MLin[i] = Mat.MLin[i];
-			}
-			return *this;
-		}
+		constexpr TMatrix44& operator=(const TMatrix44& Mat) noexcept = default;
 
 		FORCEINLINE constexpr TMatrix44 operator*(const TMatrix44& Mat) const noexcept
 		{
@@ -235,23 +223,17 @@ namespace Math {
 					(M[0][2] * (M[1][0] * M[2][1] - M[2][0] * M[1][1]));
 		}
 
+		/*
+		* @returns Determinant of the matrix, vectorized through MatrixDeterminant.
+		*/
 		FORCEINLINE constexpr T Determinant() const noexcept
 		{
-			return	M[0][0] * ((M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2])) - (M[1][2] * (M[2][1] * M[3][3] - M[2][3] * M[3][1])) + (M[1][3] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]))) -
-					M[0][1] * ((M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2])) - (M[1][2] * (M[2][0] * M[3][3] - M[2][3] * M[3][0])) + (M[1][3] * (M[2][0] * M[3][2] - M[2][2] * M[3][0]))) +
-					M[0][2] * ((M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1])) - (M[1][1] * (M[2][0] * M[3][3] - M[2][3] * M[3][0])) + (M[1][3] * (M[2][0] * M[3][1] - M[2][1] * M[3][0]))) -
-					M[0][3] * ((M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1])) - (M[1][1] * (M[2][0] * M[3][2] - M[2][2] * M[3][0])) + (M[1][2] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])));
+			return MatrixDeterminant(this);
 		}
 
 		FORCEINLINE constexpr void Transpose() noexcept
 		{
-			for (int i = 0; i < 4; i++)
-			{
-				for (int j = i + 1; j < 4; j++)
-				{
-					FMath::Swap(M[i][j], M[j][i]);
-				}
-			}
+			MatrixTranspose(this, this);
 		}
 
 		FORCEINLINE constexpr void InverseFast() noexcept
@@ -260,33 +242,38 @@ namespace Math {
 			MatrixInverse(this, this);
 		}
 
+		/*
+		* Inverts the matrix, becomes the identity if it is singular.
+		*/
 		FORCEINLINE constexpr void Inverse() noexcept
 		{
-			T Det = Determinant();
-			if (Det == static_cast<T>(0.0f))
+			// The kernel reports a zero determinant itself, no need to compute it twice
+			if (!MatrixInverse(this, this))
 			{
 				*this = IdentityMatrix;
 			}
-			else
+		}
+
+		/*
+		* Inverts a matrix made of rotation, scale and translation only (last column (0, 0, 0, 1)), like view and model matrices.
+		* Cheaper than Inverse, becomes the identity if it is singular.
+		*/
+		FORCEINLINE constexpr void InverseAffine() noexcept
+		{
+			if (!MatrixInverseAffine(this, this))
 			{
-				MatrixInverse(this, this);
+				*this = IdentityMatrix;
 			}
 		}
 
-		FORCEINLINE constexpr TMatrix44 GetTranspose() noexcept
+		FORCEINLINE constexpr TMatrix44 GetTranspose() const noexcept
 		{
 			TMatrix44 Result;
-			for (int i = 0; i < 4; i++)
-			{
-				for (int j = 0; j < 4; j++)
-				{
-					Result.M[j][i] = M[i][j];
-				}
-			}
+			MatrixTranspose(&Result, this);
 			return Result;
 		}
 
-		FORCEINLINE constexpr TMatrix44 GetInverseFast() noexcept
+		FORCEINLINE constexpr TMatrix44 GetInverseFast() const noexcept
 		{
 			AA_CORE_ASSERT(Determinant() != static_cast<T>(0.0f), "Determinant 0, will crash in release.");
 			
@@ -296,20 +283,26 @@ namespace Math {
 			return Result;
 		}
 
-		FORCEINLINE constexpr TMatrix44 GetInverse() noexcept
+		FORCEINLINE constexpr TMatrix44 GetInverse() const noexcept
 		{
 			TMatrix44 Result;
-
-			T Det = Determinant();
-			if (Det == static_cast<T>(0))
+			if (!MatrixInverse(&Result, this))
 			{
 				Result = IdentityMatrix;
 			}
-			else
+			return Result;
+		}
+
+		/*
+		* @returns The inverse of an affine matrix (last column (0, 0, 0, 1)), or the identity if it is singular.
+		*/
+		FORCEINLINE constexpr TMatrix44 GetInverseAffine() const noexcept
+		{
+			TMatrix44 Result;
+			if (!MatrixInverseAffine(&Result, this))
 			{
-				MatrixInverse(&Result, this);
+				Result = IdentityMatrix;
 			}
-
 			return Result;
 		}
 
@@ -374,12 +367,13 @@ namespace Math {
 		{
 			TMatrix44 RotMatrix(static_cast<T>(1.0f));
 
-			T AngleRad = FMath::DegToRad(AngleDeg);
+			T SinAngle = static_cast<T>(0.0f), CosAngle = static_cast<T>(1.0f);
+			FMath::SinCos(FMath::DegToRad(static_cast<T>(AngleDeg)), SinAngle, CosAngle);
 
-			RotMatrix.M[1][1] = FMath::Cos(AngleRad);
-			RotMatrix.M[2][1] = FMath::Sin(AngleRad);
-			RotMatrix.M[1][2] = -FMath::Sin(AngleRad);
-			RotMatrix.M[2][2] = FMath::Cos(AngleRad);
+			RotMatrix.M[1][1] = CosAngle;
+			RotMatrix.M[2][1] = SinAngle;
+			RotMatrix.M[1][2] = -SinAngle;
+			RotMatrix.M[2][2] = CosAngle;
 
 			return RotMatrix;
 		}
@@ -388,12 +382,13 @@ namespace Math {
 		{
 			TMatrix44 RotMatrix(static_cast<T>(1.0f));
 
-			T AngleRad = FMath::DegToRad(AngleDeg);
+			T SinAngle = static_cast<T>(0.0f), CosAngle = static_cast<T>(1.0f);
+			FMath::SinCos(FMath::DegToRad(static_cast<T>(AngleDeg)), SinAngle, CosAngle);
 
-			RotMatrix.M[0][0] = FMath::Cos(AngleRad);
-			RotMatrix.M[2][0] = -FMath::Sin(AngleRad);
-			RotMatrix.M[0][2] = FMath::Sin(AngleRad);
-			RotMatrix.M[2][2] = FMath::Cos(AngleRad);
+			RotMatrix.M[0][0] = CosAngle;
+			RotMatrix.M[2][0] = -SinAngle;
+			RotMatrix.M[0][2] = SinAngle;
+			RotMatrix.M[2][2] = CosAngle;
 
 			return RotMatrix;
 		}
@@ -402,12 +397,13 @@ namespace Math {
 		{
 			TMatrix44 RotMatrix(static_cast<T>(1.0f));
 
-			T AngleRad = FMath::DegToRad(AngleDeg);
+			T SinAngle = static_cast<T>(0.0f), CosAngle = static_cast<T>(1.0f);
+			FMath::SinCos(FMath::DegToRad(static_cast<T>(AngleDeg)), SinAngle, CosAngle);
 
-			RotMatrix.M[0][0] = FMath::Cos(AngleRad);
-			RotMatrix.M[1][0] = FMath::Sin(AngleRad);
-			RotMatrix.M[0][1] = -FMath::Sin(AngleRad);
-			RotMatrix.M[1][1] = FMath::Cos(AngleRad);
+			RotMatrix.M[0][0] = CosAngle;
+			RotMatrix.M[1][0] = SinAngle;
+			RotMatrix.M[0][1] = -SinAngle;
+			RotMatrix.M[1][1] = CosAngle;
 
 			return RotMatrix;
 		}
@@ -438,28 +434,31 @@ namespace Math {
 
 			TMatrix44 RotMatrix(static_cast<T>(1.0f));
 
-			T AngleRad = FMath::DegToRad(AngleDeg);
-			T CosAngle = FMath::Cos(AngleRad);
-			T SinAngle = FMath::Sin(AngleRad);
+			T SinAngle = static_cast<T>(0.0f), CosAngle = static_cast<T>(1.0f);
+			FMath::SinCos(FMath::DegToRad(static_cast<T>(AngleDeg)), SinAngle, CosAngle);
+			const T OneMinusCos = static_cast<T>(1.0f) - CosAngle;
 
-			RotMatrix.M[0][0] = (Axis.X * Axis.X * static_cast<T>(1.0f) - CosAngle) + CosAngle;
-			RotMatrix.M[0][1] = (Axis.X * Axis.Y * static_cast<T>(1.0f) - CosAngle) + Axis.Z * SinAngle;
-			RotMatrix.M[0][2] = (Axis.X * Axis.Z * static_cast<T>(1.0f) - CosAngle) - Axis.Y * SinAngle;
+			RotMatrix.M[0][0] = Axis.X * Axis.X * OneMinusCos + CosAngle;
+			RotMatrix.M[0][1] = Axis.X * Axis.Y * OneMinusCos + Axis.Z * SinAngle;
+			RotMatrix.M[0][2] = Axis.X * Axis.Z * OneMinusCos - Axis.Y * SinAngle;
 
-			RotMatrix.M[1][0] = (Axis.Y * Axis.X * static_cast<T>(1.0f) - CosAngle) - Axis.Z * SinAngle;
-			RotMatrix.M[1][1] = (Axis.Y * Axis.Y * static_cast<T>(1.0f) - CosAngle) + CosAngle;
-			RotMatrix.M[1][2] = (Axis.Y * Axis.Z * static_cast<T>(1.0f) - CosAngle) + Axis.X * SinAngle;
+			RotMatrix.M[1][0] = Axis.Y * Axis.X * OneMinusCos - Axis.Z * SinAngle;
+			RotMatrix.M[1][1] = Axis.Y * Axis.Y * OneMinusCos + CosAngle;
+			RotMatrix.M[1][2] = Axis.Y * Axis.Z * OneMinusCos + Axis.X * SinAngle;
 			
-			RotMatrix.M[2][0] = (Axis.Z * Axis.X * static_cast<T>(1.0f) - CosAngle) + Axis.Y * SinAngle;
-			RotMatrix.M[2][1] = (Axis.Z * Axis.Y * static_cast<T>(1.0f) - CosAngle) - Axis.X * SinAngle;
-			RotMatrix.M[2][2] = (Axis.Z * Axis.Z * static_cast<T>(1.0f) - CosAngle) + CosAngle;
+			RotMatrix.M[2][0] = Axis.Z * Axis.X * OneMinusCos + Axis.Y * SinAngle;
+			RotMatrix.M[2][1] = Axis.Z * Axis.Y * OneMinusCos - Axis.X * SinAngle;
+			RotMatrix.M[2][2] = Axis.Z * Axis.Z * OneMinusCos + CosAngle;
 
 			return RotMatrix;
 		}
 
+		/*
+		* Scale * Rotation * Translation of the transform, see TTransform::ToMatrix, needs Math/Transform.h.
+		*/
 		FORCEINLINE constexpr static TMatrix44 MakeFromTransform(const TTransform<T>& InTransform) noexcept
 		{
-			return TMatrix44();
+			return InTransform.ToMatrix();
 		}
 
 		FORCEINLINE constexpr static TMatrix44 MakePerspective(T FOV, T Aspect, T Near, T Far) noexcept
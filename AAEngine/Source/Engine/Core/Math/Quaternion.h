@@ -1,8 +1,23 @@
 #pragma once
 
+#include "Core/Core.h"
+#include "Math/Vector3.h"
+#include "Math/Matrix44.h"
+#include "Math/Euler.h"
+
+#include "Math/VectorRegister.h"
+
 namespace AAEngine {
 namespace Math {
 
+	/*
+	* Rotation quaternion, (X, Y, Z) = Axis * Sin(Angle / 2) and W = Cos(Angle / 2).
+	*
+	* - Vec * ToMatrix() == RotateVector(Vec) == Quat * Vec * Conjugate(Quat).
+	* - Quat1 * Quat2 is the rotation of Quat1 followed by the one of Quat2, same order as the matrix product,
+	*   so (Quat1 * Quat2).ToMatrix() == Quat1.ToMatrix() * Quat2.ToMatrix().
+	* - Rotating functions expect normalized quaternions.
+	*/
 	template<typename T>
 	struct alignas(16) TQuaternion
 	{
@@ -20,6 +35,8 @@ namespace Math {
 			};
 		};
 
+		AA_ENGINE_API static const TQuaternion<T> Identity;
+
 		FORCEINLINE constexpr TQuaternion() noexcept
 			: X(static_cast<T>(0.0f)), Y(static_cast<T>(0.0f)), Z(static_cast<T>(0.0f)), W(static_cast<T>(0.0f))
 		{}
@@ -52,6 +69,242 @@ namespace Math {
 			W = NewQuat.W;
 			return *this;
 		}
+
+		/*
+		* Rotation of this quaternion followed by the one of Quat.
+		*/
+		FORCEINLINE TQuaternion<T> operator*(const TQuaternion<T>& Quat) const noexcept
+		{
+			TQuaternion<T> Result;
+			QuaternionMultiply(&Result, this, &Quat);
+			return Result;
+		}
+
+		FORCEINLINE TQuaternion<T>& operator*=(const TQuaternion<T>& Quat) noexcept
+		{
+			QuaternionMultiply(this, this, &Quat);
+			return *this;
+		}
+
+		FORCEINLINE constexpr T SizeSquared() const noexcept
+		{
+			return X * X + Y * Y + Z * Z + W * W;
+		}
+
+		FORCEINLINE T Size() const noexcept
+		{
+			return FMath::Sqrt(SizeSquared());
+		}
+
+		FORCEINLINE constexpr bool IsNormalized(T Tolerance = AA_SMALL_NUMBER) const noexcept
+		{
+			return FMath::Abs(static_cast<T>(1.0f) - SizeSquared()) < Tolerance;
+		}
+
+		/*
+		* Normalizes in place, a quaternion with a squared size below Tolerance becomes the identity.
+		* @returns false if the quaternion was too small to normalize.
+		*/
+		FORCEINLINE bool Normalize(T Tolerance = AA_VERY_SMALL_NUMBER) noexcept
+		{
+			if (!QuaternionNormalize(this, this, Tolerance))
+			{
+				*this = Identity;
+				return false;
+			}
+			return true;
+		}
+
+		FORCEINLINE TQuaternion<T> GetNormalized(T Tolerance = AA_VERY_SMALL_NUMBER) const noexcept
+		{
+			TQuaternion<T> Result(*this);
+			Result.Normalize(Tolerance);
+			return Result;
+		}
+
+		/*
+		* Opposite rotation for a normalized quaternion.
+		*/
+		FORCEINLINE constexpr TQuaternion<T> GetConjugate() const noexcept
+		{
+			return TQuaternion<T>(-X, -Y, -Z, W);
+		}
+
+		/*
+		* Conjugate / SizeSquared, the opposite rotation even for a quaternion that is not normalized.
+		*/
+		FORCEINLINE constexpr TQuaternion<T> GetInverse() const noexcept
+		{
+			const T InvSizeSquared = static_cast<T>(1.0f) / SizeSquared();
+			return TQuaternion<T>(-X * InvSizeSquared, -Y * InvSizeSquared, -Z * InvSizeSquared, W * InvSizeSquared);
+		}
+
+		FORCEINLINE TVector3<T> RotateVector(const TVector3<T>& Vec) const noexcept
+		{
+			TVector3<T> Result;
+			QuaternionRotateVector(&Result, this, &Vec);
+			return Result;
+		}
+
+		FORCEINLINE TVector3<T> UnrotateVector(const TVector3<T>& Vec) const noexcept
+		{
+			const TQuaternion<T> Conjugate = GetConjugate();
+			TVector3<T> Result;
+			QuaternionRotateVector(&Result, &Conjugate, &Vec);
+			return Result;
+		}
+
+		/*
+		* Rotation matrix of the quaternion, the rows are the rotated X, Y and Z axes.
+		*/
+		FORCEINLINE constexpr TMatrix44<T> ToMatrix() const noexcept
+		{
+			const T X2 = X + X, Y2 = Y + Y, Z2 = Z + Z;
+			const T XX = X * X2, YY = Y * Y2, ZZ = Z * Z2;
+			const T XY = X * Y2, XZ = X * Z2, YZ = Y * Z2;
+			const T WX = W * X2, WY = W * Y2, WZ = W * Z2;
+			const T One = static_cast<T>(1.0f);
+			const T Zero = static_cast<T>(0.0f);
+
+			return TMatrix44<T>(
+				TVector4<T>(One - (YY + ZZ), XY + WZ, XZ - WY, Zero),
+				TVector4<T>(XY - WZ, One - (XX + ZZ), YZ + WX, Zero),
+				TVector4<T>(XZ + WY, YZ - WX, One - (XX + YY), Zero),
+				TVector4<T>(Zero, Zero, Zero, One));
+		}
+
+		/*
+		* Same rotation as TMatrix44::MakeFromRotationXYZ(ToEuler()), in degrees.
+		* Yaw is kept in [-90, 90], at +-90 the Roll is folded into the Pitch.
+		*/
+		FORCEINLINE TEuler<T> ToEuler() const noexcept
+		{
+			const T One = static_cast<T>(1.0f);
+			const T Two = static_cast<T>(2.0f);
+
+			// Elements of ToMatrix(), see MakeFromEuler for how the angles map to them
+			const T M02 = Two * (X * Z - W * Y);
+			const T M12 = -Two * (Y * Z + W * X);
+			const T M22 = One - Two * (X * X + Y * Y);
+			const T CosYaw = FMath::Sqrt(M12 * M12 + M22 * M22);
+
+			// ATan2 keeps the Yaw precise next to +-90, where ASin(M02) loses it
+			TEuler<T> Euler;
+			Euler.Yaw = FMath::RadToDeg(FMath::ATan2(M02, CosYaw));
+			if (CosYaw > static_cast<T>(AA_SMALL_NUMBER))
+			{
+				Euler.Pitch = FMath::RadToDeg(FMath::ATan2(M12, M22));
+				Euler.Roll = FMath::RadToDeg(FMath::ATan2(-Two * (X * Y + W * Z), One - Two * (Y * Y + Z * Z)));
+			}
+			else
+			{
+				Euler.Roll = static_cast<T>(0.0f);
+				Euler.Pitch = FMath::RadToDeg(FMath::ATan2(Two * (X * Y - W * Z) * (M02 < static_cast<T>(0.0f) ? -One : One), One - Two * (X * X + Z * Z)));
+			}
+			return Euler;
+		}
+
+		/*
+		* Basic Statics
+		*/
+
+		FORCEINLINE static constexpr T Dot(const TQuaternion<T>& Quat1, const TQuaternion<T>& Quat2) noexcept
+		{
+			return Quat1.X * Quat2.X + Quat1.Y * Quat2.Y + Quat1.Z * Quat2.Z + Quat1.W * Quat2.W;
+		}
+
+		FORCEINLINE static constexpr bool AreNearlyEqual(const TQuaternion<T>& Quat1, const TQuaternion<T>& Quat2, T Tolerance = AA_SMALL_NUMBER) noexcept
+		{
+			return FMath::Abs(Quat1.X - Quat2.X) < Tolerance && FMath::Abs(Quat1.Y - Quat2.Y) < Tolerance && FMath::Abs(Quat1.Z - Quat2.Z) < Tolerance && FMath::Abs(Quat1.W - Quat2.W) < Tolerance;
+		}
+
+		/*
+		* Rotation of AngleDeg degrees around a normalized Axis, same direction as TMatrix44::MakeFromAngleAxis.
+		*/
+		FORCEINLINE static TQuaternion<T> MakeFromAngleAxis(T AngleDeg, const TVector3<T>& Axis) noexcept
+		{
+			AA_CORE_ASSERT(int(Axis.IsNormalized()), "UnNormalized Axis. Incorrect!");
+
+			const T HalfAngleRad = FMath::DegToRad(AngleDeg) * static_cast<T>(0.5f);
+			T SinHalfAngle, CosHalfAngle;
+			FMath::SinCos(HalfAngleRad, SinHalfAngle, CosHalfAngle);
+			return TQuaternion<T>(Axis.X * SinHalfAngle, Axis.Y * SinHalfAngle, Axis.Z * SinHalfAngle, CosHalfAngle);
+		}
+
+		/*
+		* Same rotation as TMatrix44::MakeFromRotationXYZ, Pitch then Yaw then Roll.
+		* MakeFromRotationX/Y/Z turn the opposite way of MakeFromAngleAxis, so the product of the three axis rotations
+		* is expanded here with the negated half angles.
+		*/
+		FORCEINLINE static TQuaternion<T> MakeFromEuler(const TEuler<T>& InRotation) noexcept
+		{
+			const T HalfScale = static_cast<T>(-0.5f);
+			const T PitchRad = FMath::DegToRad(InRotation.Pitch) * HalfScale;
+			const T YawRad = FMath::DegToRad(InRotation.Yaw) * HalfScale;
+			const T RollRad = FMath::DegToRad(InRotation.Roll) * HalfScale;
+
+			T SP, CP, SY, CY, SR, CR;
+			FMath::SinCos(PitchRad, SP, CP);
+			FMath::SinCos(YawRad, SY, CY);
+			FMath::SinCos(RollRad, SR, CR);
+
+			return TQuaternion<T>(
+				CR * CY * SP - SR * SY * CP,
+				CR * SY * CP + SR * CY * SP,
+				SR * CY * CP - CR * SY * SP,
+				CR * CY * CP + SR * SY * SP);
+		}
+
+		/*
+		* Quaternion of the rotation in the upper 3x3 of Mat, which must have no scale or shear.
+		* Picks the largest of W, X, Y, Z to divide by, so it stays precise for every angle.
+		*/
+		FORCEINLINE static TQuaternion<T> MakeFromMatrix(const TMatrix44<T>& Mat) noexcept
+		{
+			const T (&M)[4][4] = Mat.M;
+			const T One = static_cast<T>(1.0f);
+			const T Half = static_cast<T>(0.5f);
+			const T Quarter = static_cast<T>(0.25f);
+			const T Trace = M[0][0] + M[1][1] + M[2][2];
+
+			if (Trace > static_cast<T>(0.0f))
+			{
+				const T InvS = Half / FMath::Sqrt(Trace + One);
+				return TQuaternion<T>((M[1][2] - M[2][1]) * InvS, (M[2][0] - M[0][2]) * InvS, (M[0][1] - M[1][0]) * InvS, Quarter / InvS);
+			}
+			if (M[0][0] > M[1][1] && M[0][0] > M[2][2])
+			{
+				const T InvS = Half / FMath::Sqrt(One + M[0][0] - M[1][1] - M[2][2]);
+				return TQuaternion<T>(Quarter / InvS, (M[0][1] + M[1][0]) * InvS, (M[2][0] + M[0][2]) * InvS, (M[1][2] - M[2][1]) * InvS);
+			}
+			if (M[1][1] > M[2][2])
+			{
+				const T InvS = Half / FMath::Sqrt(One + M[1][1] - M[0][0] - M[2][2]);
+				return TQuaternion<T>((M[0][1] + M[1][0]) * InvS, Quarter / InvS, (M[1][2] + M[2][1]) * InvS, (M[2][0] - M[0][2]) * InvS);
+			}
+			const T InvS = Half / FMath::Sqrt(One + M[2][2] - M[0][0] - M[1][1]);
+			return TQuaternion<T>((M[2][0] + M[0][2]) * InvS, (M[1][2] + M[2][1]) * InvS, Quarter / InvS, (M[0][1] - M[1][0]) * InvS);
+		}
+
+		/*
+		* Normalized linear interpolation along the short way, cheap but not at constant speed.
+		*/
+		FORCEINLINE static TQuaternion<T> Nlerp(const TQuaternion<T>& Quat1, const TQuaternion<T>& Quat2, T Alpha) noexcept
+		{
+			TQuaternion<T> Result;
+			QuaternionNlerp(&Result, &Quat1, &Quat2, Alpha);
+			return Result;
+		}
+
+		/*
+		* Spherical interpolation along the short way, at constant angular speed.
+		*/
+		FORCEINLINE static TQuaternion<T> Slerp(const TQuaternion<T>& Quat1, const TQuaternion<T>& Quat2, T Alpha) noexcept
+		{
+			TQuaternion<T> Result;
+			QuaternionSlerp(&Result, &Quat1, &Quat2, Alpha);
+			return Result;
+		}
 	};
 }
-}
\ No newline at end of file
+}
@@ -1,57 +1,310 @@
 #pragma once
 
+#include "Core/Core.h"
 #include "Math/Vector3.h"
+#include "Math/Matrix44.h"
 #include "Math/Euler.h"
+#include "Math/Quaternion.h"
+
+#include "Math/VectorRegister.h"
 
 namespace AAEngine {
 namespace Math {
 
+	/*
+	* Scale, then Rotation, then Location, the same as the matrix Scale * Rotation * Translation.
+	*
+	* - TransformPosition(Vec) == Rotation.RotateVector(Vec * Scale) + Location == Vec * ToMatrix() with W = 1.
+	* - Transform1 * Transform2 is Transform1 followed by Transform2 like the matrix product, so a child's world transform
+	*   is ChildLocal * ParentWorld. It is exact unless a non uniform scale of Transform2 meets a rotation of Transform1,
+	*   which would need a shear that a TRS can't hold.
+	* - The matrix is built by the first GetMatrix() after a change and cached until the next one, so change the
+	*   transform through the setters. GetMatrix() writes the cache, don't call it from several threads on a dirty transform.
+	*/
 	template<typename T>
 	struct alignas(16) TTransform
 	{
 		static_assert(std::is_floating_point_v<T>, "T must be a floating point type.");
 	public:
-		union
-		{
-			struct
-			{
-				TVector3<T> Location;
-				TEuler<T> Rotation;
-				TVector3<T> Scale;
-			};
-		};
+		AA_ENGINE_API static const TTransform<T> Identity;
 
 		FORCEINLINE constexpr TTransform() noexcept
-			: X(static_cast<T>(0.0f)), Y(static_cast<T>(0.0f)), Z(static_cast<T>(0.0f)), W(static_cast<T>(0.0f))
+			: Rotation(static_cast<T>(0.0f), static_cast<T>(0.0f), static_cast<T>(0.0f), static_cast<T>(1.0f)), Location(static_cast<T>(0.0f)), Scale(static_cast<T>(1.0f)), bMatrixDirty(true)
+		{}
+
+		FORCEINLINE constexpr explicit TTransform(const TVector3<T>& InLocation, const TQuaternion<T>& InRotation = TQuaternion<T>::Identity, const TVector3<T>& InScale = TVector3<T>::OneVector) noexcept
+			: Rotation(InRotation), Location(InLocation), Scale(InScale), bMatrixDirty(true)
 		{}
 
-		FORCEINLINE constexpr TTransform(const TVector3<T>& InVec, const TEuler<T>& InEuler = TEuler<T>::ZeroEuler, const TVector3<T>& InScale = TVector3<T>::OneVector) noexcept
-			: Location(InVec)
+		FORCEINLINE TTransform(const TVector3<T>& InLocation, const TEuler<T>& InRotation, const TVector3<T>& InScale = TVector3<T>::OneVector) noexcept
+			: Rotation(TQuaternion<T>::MakeFromEuler(InRotation)), Location(InLocation), Scale(InScale), bMatrixDirty(true)
 		{}
 
-		FORCEINLINE constexpr TTransform(const TEuler<T>& InEuler) noexcept
-			: Rotation(InEuler)
+		FORCEINLINE constexpr explicit TTransform(const TQuaternion<T>& InRotation) noexcept
+			: Rotation(InRotation), Location(static_cast<T>(0.0f)), Scale(static_cast<T>(1.0f)), bMatrixDirty(true)
 		{}
 
-		FORCEINLINE constexpr TTransform(const TVector3<T>& InScale) noexcept
-			: Scale(InVec)
+		FORCEINLINE explicit TTransform(const TEuler<T>& InRotation) noexcept
+			: Rotation(TQuaternion<T>::MakeFromEuler(InRotation)), Location(static_cast<T>(0.0f)), Scale(static_cast<T>(1.0f)), bMatrixDirty(true)
 		{}
 
 		FORCEINLINE constexpr TTransform(const TTransform<T>& NewTransform) noexcept
+			: Rotation(NewTransform.Rotation), Location(NewTransform.Location), Scale(NewTransform.Scale), bMatrixDirty(NewTransform.bMatrixDirty), CachedMatrix(NewTransform.CachedMatrix)
+		{}
+
+		FORCEINLINE constexpr TTransform<T>& operator=(const TTransform<T>& NewTransform) noexcept
 		{
-			Location = NewTransform.Location;
 			Rotation = NewTransform.Rotation;
+			Location = NewTransform.Location;
 			Scale = NewTransform.Scale;
+			bMatrixDirty = NewTransform.bMatrixDirty;
+			CachedMatrix = NewTransform.CachedMatrix;
+			return *this;
 		}
 
-		FORCEINLINE constexpr TTransform<T>& operator=(const TTransform<T>& NewVector) noexcept
+		/*
+		* This transform followed by Other, see the class comment.
+		*/
+		FORCEINLINE TTransform<T> operator*(const TTransform<T>& Other) const noexcept
 		{
-			Location = NewTransform.Location;
-			Rotation = NewTransform.Rotation;
-			Scale = NewTransform.Scale;
+			TTransform<T> Result;
+			TransformMultiplyElements(Result.Rotation.XYZW, Result.Location.XYZ, Result.Scale.XYZ,
+				Rotation.XYZW, Location.XYZ, Scale.XYZ, Other.Rotation.XYZW, Other.Location.XYZ, Other.Scale.XYZ);
+			return Result;
+		}
+
+		FORCEINLINE TTransform<T>& operator*=(const TTransform<T>& Other) noexcept
+		{
+			TransformMultiplyElements(Rotation.XYZW, Location.XYZ, Scale.XYZ,
+				Rotation.XYZW, Location.XYZ, Scale.XYZ, Other.Rotation.XYZW, Other.Location.XYZ, Other.Scale.XYZ);
+			bMatrixDirty = true;
 			return *this;
 		}
+
+		/*
+		* Getters and Setters, the setters mark the cached matrix dirty.
+		*/
+
+		FORCEINLINE constexpr const TVector3<T>& GetLocation() const noexcept { return Location; }
+		FORCEINLINE constexpr const TQuaternion<T>& GetRotation() const noexcept { return Rotation; }
+		FORCEINLINE constexpr const TVector3<T>& GetScale() const noexcept { return Scale; }
+		FORCEINLINE TEuler<T> GetEulerRotation() const noexcept { return Rotation.ToEuler(); }
+
+		FORCEINLINE constexpr void SetLocation(const TVector3<T>& InLocation) noexcept
+		{
+			Location = InLocation;
+			bMatrixDirty = true;
+		}
+
+		FORCEINLINE constexpr void AddLocation(const TVector3<T>& DeltaLocation) noexcept
+		{
+			Location += DeltaLocation;
+			bMatrixDirty = true;
+		}
+
+		/*
+		* InRotation must be normalized.
+		*/
+		FORCEINLINE constexpr void SetRotation(const TQuaternion<T>& InRotation) noexcept
+		{
+			Rotation = InRotation;
+			bMatrixDirty = true;
+		}
+
+		FORCEINLINE void SetRotation(const TEuler<T>& InRotation) noexcept
+		{
+			Rotation = TQuaternion<T>::MakeFromEuler(InRotation);
+			bMatrixDirty = true;
+		}
+
+		FORCEINLINE constexpr void SetScale(const TVector3<T>& InScale) noexcept
+		{
+			Scale = InScale;
+			bMatrixDirty = true;
+		}
+
+		/*
+		* InRotation must be normalized.
+		*/
+		FORCEINLINE constexpr void SetComponents(const TVector3<T>& InLocation, const TQuaternion<T>& InRotation, const TVector3<T>& InScale) noexcept
+		{
+			SetLocation(InLocation);
+			SetRotation(InRotation);
+			SetScale(InScale);
+		}
+
+		FORCEINLINE constexpr bool IsMatrixDirty() const noexcept { return bMatrixDirty; }
+
+		/*
+		* Transforming Functions
+		*/
+
+		/*
+		* Rotation.RotateVector(Position * Scale) + Location.
+		*/
+		FORCEINLINE TVector3<T> TransformPosition(const TVector3<T>& Position) const noexcept
+		{
+			TVector3<T> Result;
+			TransformPositionElements(Result.XYZ, Rotation.XYZW, Location.XYZ, Scale.XYZ, Position.XYZ);
+			return Result;
+		}
+
+		/*
+		* TransformPosition without the Location, for directions and offsets.
+		*/
+		FORCEINLINE TVector3<T> TransformVector(const TVector3<T>& Vec) const noexcept
+		{
+			return Rotation.RotateVector(Vec * Scale);
+		}
+
+		/*
+		* Exact inverse of TransformPosition, also with a non uniform Scale. A zero Scale component gives a zero output component.
+		*/
+		FORCEINLINE TVector3<T> InverseTransformPosition(const TVector3<T>& Position) const noexcept
+		{
+			const TVector3<T> InvScale = GetSafeScaleReciprocal(Scale);
+			TVector3<T> Result;
+			InverseTransformPositionElements(Result.XYZ, Rotation.XYZW, Location.XYZ, InvScale.XYZ, Position.XYZ);
+			return Result;
+		}
+
+		FORCEINLINE TVector3<T> InverseTransformVector(const TVector3<T>& Vec) const noexcept
+		{
+			return Rotation.UnrotateVector(Vec) * GetSafeScaleReciprocal(Scale);
+		}
+
+		/*
+		* The transform undoing this one, Transform * Transform.GetInverse() is the identity.
+		* Like the product it is exact for uniform scales, with a non uniform Scale and a Rotation use InverseTransformPosition
+		* or the inverse of the matrix instead.
+		*/
+		FORCEINLINE TTransform<T> GetInverse() const noexcept
+		{
+			const TVector3<T> InvScale = GetSafeScaleReciprocal(Scale);
+			TTransform<T> Result;
+			TransformInverseElements(Result.Rotation.XYZW, Result.Location.XYZ, Result.Scale.XYZ, Rotation.XYZW, Location.XYZ, InvScale.XYZ);
+			return Result;
+		}
+
+		/*
+		* Matrix Functions
+		*/
+
+		/*
+		* Builds Scale * Rotation * Translation, the rows are the scaled rotated axes and the Location.
+		*/
+		FORCEINLINE constexpr TMatrix44<T> ToMatrix() const noexcept
+		{
+			const T X2 = Rotation.X + Rotation.X, Y2 = Rotation.Y + Rotation.Y, Z2 = Rotation.Z + Rotation.Z;
+			const T XX = Rotation.X * X2, YY = Rotation.Y * Y2, ZZ = Rotation.Z * Z2;
+			const T XY = Rotation.X * Y2, XZ = Rotation.X * Z2, YZ = Rotation.Y * Z2;
+			const T WX = Rotation.W * X2, WY = Rotation.W * Y2, WZ = Rotation.W * Z2;
+			const T One = static_cast<T>(1.0f);
+			const T Zero = static_cast<T>(0.0f);
+
+			// Written element by element, building the rows as TVector4 first costs more than the math
+			TMatrix44<T> Result;
+			Result.M[0][0] = (One - (YY + ZZ)) * Scale.X;
+			Result.M[0][1] = (XY + WZ) * Scale.X;
+			Result.M[0][2] = (XZ - WY) * Scale.X;
+			Result.M[0][3] = Zero;
+			Result.M[1][0] = (XY - WZ) * Scale.Y;
+			Result.M[1][1] = (One - (XX + ZZ)) * Scale.Y;
+			Result.M[1][2] = (YZ + WX) * Scale.Y;
+			Result.M[1][3] = Zero;
+			Result.M[2][0] = (XZ + WY) * Scale.Z;
+			Result.M[2][1] = (YZ - WX) * Scale.Z;
+			Result.M[2][2] = (One - (XX + YY)) * Scale.Z;
+			Result.M[2][3] = Zero;
+			Result.M[3][0] = Location.X;
+			Result.M[3][1] = Location.Y;
+			Result.M[3][2] = Location.Z;
+			Result.M[3][3] = One;
+			return Result;
+		}
+
+		/*
+		* Same as ToMatrix, built once per change of the transform.
+		*/
+		FORCEINLINE const TMatrix44<T>& GetMatrix() const noexcept
+		{
+			if (bMatrixDirty)
+			{
+				CachedMatrix = ToMatrix();
+				bMatrixDirty = false;
+			}
+			return CachedMatrix;
+		}
+
+		/*
+		* Basic Statics
+		*/
+
+		/*
+		* Splits a matrix with no shear into its Scale, Rotation and Location.
+		* A mirroring matrix gets a negative Scale.X, a zero scale axis gives the identity rotation.
+		*/
+		FORCEINLINE static TTransform<T> MakeFromMatrix(const TMatrix44<T>& Mat) noexcept
+		{
+			const T (&M)[4][4] = Mat.M;
+			TVector3<T> Axes[3] = {
+				TVector3<T>(M[0][0], M[0][1], M[0][2]),
+				TVector3<T>(M[1][0], M[1][1], M[1][2]),
+				TVector3<T>(M[2][0], M[2][1], M[2][2]) };
+
+			TVector3<T> OutScale(Axes[0].Size(), Axes[1].Size(), Axes[2].Size());
+			if ((Axes[0] | (Axes[1] ^ Axes[2])) < static_cast<T>(0.0f))
+			{
+				OutScale.X = -OutScale.X;
+			}
+			if (OutScale.GetAbs().Min() <= static_cast<T>(AA_VERY_SMALL_NUMBER))
+			{
+				return TTransform<T>(TVector3<T>(M[3][0], M[3][1], M[3][2]), TQuaternion<T>::Identity, OutScale);
+			}
+
+			TMatrix44<T> RotationMatrix(Mat);
+			for (int Axis = 0; Axis < 3; Axis++)
+			{
+				for (int Element = 0; Element < 3; Element++)
+				{
+					RotationMatrix.M[Axis][Element] /= OutScale[Axis];
+				}
+			}
+			return TTransform<T>(TVector3<T>(M[3][0], M[3][1], M[3][2]), TQuaternion<T>::MakeFromMatrix(RotationMatrix).GetNormalized(), OutScale);
+		}
+
+		FORCEINLINE static constexpr bool AreNearlyEqual(const TTransform<T>& Transform1, const TTransform<T>& Transform2, T Tolerance = AA_SMALL_NUMBER) noexcept
+		{
+			// q and -q are the same rotation
+			const TQuaternion<T>& Rotation2 = Transform2.Rotation;
+			const bool bSameRotation = TQuaternion<T>::AreNearlyEqual(Transform1.Rotation, Rotation2, Tolerance) ||
+				TQuaternion<T>::AreNearlyEqual(Transform1.Rotation, TQuaternion<T>(-Rotation2.X, -Rotation2.Y, -Rotation2.Z, -Rotation2.W), Tolerance);
+			return bSameRotation && TVector3<T>::AreNearlyEqual(Transform1.Location, Transform2.Location, Tolerance) && TVector3<T>::AreNearlyEqual(Transform1.Scale, Transform2.Scale, Tolerance);
+		}
+
+	private:
+		/*
+		* 1 / Scale, with 0 for the components too small to invert.
+		*/
+		FORCEINLINE static constexpr TVector3<T> GetSafeScaleReciprocal(const TVector3<T>& InScale, T Tolerance = AA_VERY_SMALL_NUMBER) noexcept
+		{
+			const T One = static_cast<T>(1.0f);
+			const T Zero = static_cast<T>(0.0f);
+			return TVector3<T>(
+				FMath::Abs(InScale.X) > Tolerance ? One / InScale.X : Zero,
+				FMath::Abs(InScale.Y) > Tolerance ? One / InScale.Y : Zero,
+				FMath::Abs(InScale.Z) > Tolerance ? One / InScale.Z : Zero);
+		}
+
+	private:
+		// Rotation first so it keeps the 16 byte alignment its SIMD loads need
+		TQuaternion<T> Rotation;
+		TVector3<T> Location;
+		TVector3<T> Scale;
+
+		mutable bool bMatrixDirty;
+		mutable TMatrix44<T> CachedMatrix;
 	};
 
 }
-}
\ No newline at end of file
+}
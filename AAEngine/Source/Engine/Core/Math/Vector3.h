@@ -239,10 +239,14 @@ namespace AAEngine {
 
 			FORCEINLINE constexpr bool IsNormalized(T Tolerance = AA_SMALL_NUMBER) const noexcept
 			{
-				return FMath::Abs(static_cast<T>(0.0f) - Size()) < Tolerance;
+				return FMath::Abs(static_cast<T>(1.0f) - SizeSquared()) < Tolerance;
 			}
 
-			FORCEINLINE constexpr bool Normalize(T Tolerance = AA_SMALL_NUMBER) const noexcept
+			/*
+			* Normalizes in place with the fast reciprocal square root, see FMath::InvSqrt.
+			* @returns false, leaving the vector untouched, if its squared size is not above Tolerance.
+			*/
+			FORCEINLINE constexpr bool Normalize(T Tolerance = AA_SMALL_NUMBER) noexcept
 			{
 				T SumSquared = X * X + Y * Y + Z * Z;
 				if (SumSquared > Tolerance)
@@ -267,6 +271,14 @@ namespace AAEngine {
 				return OneVector;
 			}
 
+			/*
+			* Normal without the size checks, for vectors known to be far from zero.
+			*/
+			FORCEINLINE constexpr TVector3<T> GetUnsafeNormal() const noexcept
+			{
+				return *this * FMath::InvSqrt(SizeSquared());
+			}
+
 			FORCEINLINE constexpr T MagnitudeSquared() const noexcept
 			{
 				return X * X + Y * Y + Z * Z;
@@ -319,19 +331,21 @@ namespace AAEngine {
 				return SS.str();
 			}
 
-			template<typename T>
 			FORCEINLINE static constexpr T DotProduct(const TVector3<T>& Vec1, const TVector3<T>& Vec2) noexcept
 			{
 				return Vec1 | Vec2;
 			}
 
-			template<typename T>
 			FORCEINLINE static constexpr TVector3<T> CrossProduct(const TVector3<T>& Vec1, const TVector3<T>& Vec2) noexcept
 			{
 				return Vec1 ^ Vec2;
 			}
 
-			template<typename T>
+			FORCEINLINE static constexpr T DistanceSquared(const TVector3<T>& Vec1, const TVector3<T>& Vec2) noexcept
+			{
+				return (Vec1 - Vec2).SizeSquared();
+			}
+
 			FORCEINLINE static constexpr T Distance(const TVector3<T>& Vec1, const TVector3<T>& Vec2) noexcept
 			{
 				return (Vec1 - Vec2).Size();
@@ -12,8 +12,8 @@ namespace AAEngine {
 namespace Math {
 
 	/*
+	* The arithmetic, dot products and normalization go through the VectorRegister layer, one register per vector.
 	* TO DO:
-	* - SIMD support
 	* - Angle Between Vectors
 	* - Projections
 	*/
@@ -70,19 +70,29 @@ namespace Math {
 			W = NewVector.W;
 			return *this;
 		}
+
+		FORCEINLINE explicit TVector4(const TVectorRegister<T>& VecReg) noexcept
+		{
+			VectorStoreAligned(VecReg, XYZW);
+		}
+
+		FORCEINLINE TVectorRegister<T> GetRegister() const noexcept
+		{
+			return VectorLoadAligned(XYZW);
+		}
 		
 		/*
 		* Basic Math Operators
 		*/
 
-		FORCEINLINE constexpr TVector4<T> operator+(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE TVector4<T> operator+(const TVector4<T>& Vec) const noexcept
 		{
-			return TVector4<T>(X + Vec.X, Y + Vec.Y, Z + Vec.Z, W + Vec.W);
+			return TVector4<T>(VectorAdd(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator+(T Value) const noexcept
+		FORCEINLINE TVector4<T> operator+(T Value) const noexcept
 		{
-			return TVector4<T>(X + Value, Y + Value, Z + Value, W + Value);
+			return TVector4<T>(VectorAdd(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)));
 		}
 
 		FORCEINLINE constexpr TVector4<T> operator+() const noexcept
@@ -90,86 +100,87 @@ namespace Math {
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator+=(const TVector4<T>& Vec) noexcept
+		FORCEINLINE TVector4<T>& operator+=(const TVector4<T>& Vec) noexcept
 		{
-			X += Vec.X; Y += Vec.Y; Z += Vec.Z; W += Vec.W;
+			VectorStoreAligned(VectorAdd(GetRegister(), Vec.GetRegister()), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator+=(T Value) noexcept
+		FORCEINLINE TVector4<T>& operator+=(T Value) noexcept
 		{
-			X += Value; Y += Value; Z += Value; W += Value;
+			VectorStoreAligned(VectorAdd(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator-(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE TVector4<T> operator-(const TVector4<T>& Vec) const noexcept
 		{
-			return TVector4<T>(X - Vec.X, Y - Vec.Y, Z - Vec.Z, W - Vec.W);
+			return TVector4<T>(VectorSubtract(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator-(T Value) const noexcept
+		FORCEINLINE TVector4<T> operator-(T Value) const noexcept
 		{
-			return TVector4<T>(X - Value, Y - Value, Z - Value, W - Value);
+			return TVector4<T>(VectorSubtract(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)));
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator-() const noexcept
+		FORCEINLINE TVector4<T> operator-() const noexcept
 		{
-			return TVector4<T>(-X, -Y, -Z, -W);
+			const T Zero = static_cast<T>(0.0f);
+			return TVector4<T>(VectorSubtract(MakeVectorRegister(Zero, Zero, Zero, Zero), GetRegister()));
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator-=(const TVector4<T>& Vec) noexcept
+		FORCEINLINE TVector4<T>& operator-=(const TVector4<T>& Vec) noexcept
 		{
-			X -= Vec.X; Y -= Vec.Y; Z -= Vec.Z; W -= Vec.W;
+			VectorStoreAligned(VectorSubtract(GetRegister(), Vec.GetRegister()), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator-=(T Value) noexcept
+		FORCEINLINE TVector4<T>& operator-=(T Value) noexcept
 		{
-			X -= Value; Y -= Value; Z -= Value; W -= Value;
+			VectorStoreAligned(VectorSubtract(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator*(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE TVector4<T> operator*(const TVector4<T>& Vec) const noexcept
 		{
-			return TVector4<T>(X * Vec.X, Y * Vec.Y, Z * Vec.Z, W * Vec.W);
+			return TVector4<T>(VectorMultiply(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator*(T Value) const noexcept
+		FORCEINLINE TVector4<T> operator*(T Value) const noexcept
 		{
-			return TVector4<T>(X * Value, Y * Value, Z * Value, W * Value);
+			return TVector4<T>(VectorMultiply(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)));
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator*=(const TVector4<T>& Vec) noexcept
+		FORCEINLINE TVector4<T>& operator*=(const TVector4<T>& Vec) noexcept
 		{
-			X *= Vec.X; Y *= Vec.Y; Z *= Vec.Z; W *= Vec.W;
+			VectorStoreAligned(VectorMultiply(GetRegister(), Vec.GetRegister()), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator*=(T Value) noexcept
+		FORCEINLINE TVector4<T>& operator*=(T Value) noexcept
 		{
-			X *= Value; Y *= Value; Z *= Value; W *= Value;
+			VectorStoreAligned(VectorMultiply(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator/(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE TVector4<T> operator/(const TVector4<T>& Vec) const noexcept
 		{
-			return TVector4<T>(X / Vec.X, Y / Vec.Y, Z / Vec.Z, W / Vec.W);
+			return TVector4<T>(VectorDivide(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr TVector4<T> operator/(T Value) const noexcept
+		FORCEINLINE TVector4<T> operator/(T Value) const noexcept
 		{
-			return TVector4<T>(X / Value, Y / Value, Z / Value, W / Value);
+			return TVector4<T>(VectorDivide(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)));
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator/=(const TVector4<T>& Vec) noexcept
+		FORCEINLINE TVector4<T>& operator/=(const TVector4<T>& Vec) noexcept
 		{
-			X /= Vec.X; Y /= Vec.Y; Z /= Vec.Z; W /= Vec.W;
+			VectorStoreAligned(VectorDivide(GetRegister(), Vec.GetRegister()), XYZW);
 			return *this;
 		}
 
-		FORCEINLINE constexpr TVector4<T>& operator/=(T Value) noexcept
+		FORCEINLINE TVector4<T>& operator/=(T Value) noexcept
 		{
-			X /= Value; Y /= Value; Z /= Value; W /= Value;
+			VectorStoreAligned(VectorDivide(GetRegister(), MakeVectorRegister(Value, Value, Value, Value)), XYZW);
 			return *this;
 		}
 
@@ -214,22 +225,22 @@ namespace Math {
 		* Basic Vector Operations
 		*/
 
-		FORCEINLINE constexpr T Dot(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE T Dot(const TVector4<T>& Vec) const noexcept
 		{
-			return X * Vec.X + Y * Vec.Y + Z * Vec.Z + W * Vec.W;
+			return VectorGetFirstComponent(VectorDot4(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr T Dot3(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE T Dot3(const TVector4<T>& Vec) const noexcept
 		{
-			return X * Vec.X + Y * Vec.Y + Z * Vec.Z;
+			return VectorGetFirstComponent(VectorDot3(GetRegister(), Vec.GetRegister()));
 		}
 
-		FORCEINLINE constexpr T operator|(const TVector4<T>& Vec) const noexcept
+		FORCEINLINE T operator|(const TVector4<T>& Vec) const noexcept
 		{
 			return Dot(Vec);
 		}
 
-		FORCEINLINE constexpr T Dot(const TVector3<T>& Vec) noexcept
+		FORCEINLINE constexpr T Dot(const TVector3<T>& Vec) const noexcept
 		{
 			return X * Vec.X + Y * Vec.Y + Z * Vec.Z;
 		}
@@ -244,56 +255,85 @@ namespace Math {
 			return FMath::Abs(X) < Tolerance && FMath::Abs(Y) < Tolerance && FMath::Abs(Z) < Tolerance && FMath::Abs(W) < Tolerance;
 		}
 
-		FORCEINLINE constexpr bool IsNormalized(T Tolerance = AA_SMALL_NUMBER) const noexcept
+		FORCEINLINE bool IsNormalized(T Tolerance = AA_SMALL_NUMBER) const noexcept
 		{
-			return FMath::Abs(static_cast<T>(0.0f) - Size()) < Tolerance;
+			return FMath::Abs(static_cast<T>(1.0f) - SizeSquared()) < Tolerance;
 		}
 
-		FORCEINLINE constexpr bool Normalize(T Tolerance = AA_SMALL_NUMBER) const noexcept
+		/*
+		* Normalizes in place with the fast reciprocal square root, see FMath::InvSqrt.
+		* @returns false, leaving the vector untouched, if its squared size is not above Tolerance.
+		*/
+		FORCEINLINE bool Normalize(T Tolerance = AA_SMALL_NUMBER) noexcept
 		{
-			T SumSquared = X * X + Y * Y + Z * Z + W * W;
-			if (SumSquared > Tolerance)
+			const TVectorRegister<T> Vec = GetRegister();
+			const TVectorRegister<T> SumSquared = VectorDot4(Vec, Vec);
+			if (VectorGetFirstComponent(SumSquared) > Tolerance)
 			{
-				*this *= FMath::InvSqrt(SumSquared);
+				VectorStoreAligned(VectorMultiply(Vec, VectorReciprocalSqrt(SumSquared)), XYZW);
 				return true;
 			}
 			return false;
 		}
 
-		FORCEINLINE constexpr TVector4<T> GetSafeNormal(T Tolerance = AA_SMALL_NUMBER) const noexcept
+		FORCEINLINE TVector4<T> GetSafeNormal(T Tolerance = AA_SMALL_NUMBER) const noexcept
 		{
-			T SumSquared = X * X + Y * Y + Z * Z + W * W;
-			if (SumSquared == static_cast<T>(0.0f))
+			const TVectorRegister<T> Vec = GetRegister();
+			const TVectorRegister<T> SumSquared = VectorDot4(Vec, Vec);
+			const T SumSquaredValue = VectorGetFirstComponent(SumSquared);
+			if (SumSquaredValue == static_cast<T>(0.0f))
 			{
 				return *this;
 			}
-			else if (SumSquared > Tolerance)
+			else if (SumSquaredValue > Tolerance)
 			{
-				return *this * FMath::InvSqrt(SumSquared);
+				return TVector4<T>(VectorMultiply(Vec, VectorReciprocalSqrt(SumSquared)));
 			}
 			return OneVector;
 		}
 
-		FORCEINLINE constexpr T MagnitudeSquared() const noexcept
+		/*
+		* Normal without the size checks, for vectors known to be far from zero.
+		*/
+		FORCEINLINE TVector4<T> GetUnsafeNormal() const noexcept
+		{
+			const TVectorRegister<T> Vec = GetRegister();
+			return TVector4<T>(VectorMultiply(Vec, VectorReciprocalSqrt(VectorDot4(Vec, Vec))));
+		}
+
+		FORCEINLINE T MagnitudeSquared() const noexcept
 		{
-			return X * X + Y * Y + Z * Z + W * W;
+			return SizeSquared();
 		}
 
-		FORCEINLINE constexpr T Magnitude() const noexcept
+		FORCEINLINE T Magnitude() const noexcept
 		{
-			return FMath::Sqrt(MagnitudeSquared());
+			return Size();
 		}
 
-		FORCEINLINE constexpr T SizeSquared() const noexcept
+		FORCEINLINE T SizeSquared() const noexcept
 		{
-			return X * X + Y * Y + Z * Z + W * W;
+			return Dot(*this);
 		}
 
-		FORCEINLINE constexpr T Size() const noexcept
+		FORCEINLINE T Size() const noexcept
 		{
 			return FMath::Sqrt(SizeSquared());
 		}
 
+		/*
+		* Size of the XYZ, for points and directions with W ignored.
+		*/
+		FORCEINLINE T SizeSquared3() const noexcept
+		{
+			return Dot3(*this);
+		}
+
+		FORCEINLINE T Size3() const noexcept
+		{
+			return FMath::Sqrt(SizeSquared3());
+		}
+
 		FORCEINLINE constexpr T Max() const noexcept
 		{
 			return FMath::Max(FMath::Max(X, Y), FMath::Max(Z, W));
@@ -326,6 +366,36 @@ namespace Math {
 			return SS.str();
 		}
 
+		FORCEINLINE static T DotProduct(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+		{
+			return Vec1 | Vec2;
+		}
+
+		FORCEINLINE static T DistanceSquared(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+		{
+			const TVectorRegister<T> Delta = VectorSubtract(Vec1.GetRegister(), Vec2.GetRegister());
+			return VectorGetFirstComponent(VectorDot4(Delta, Delta));
+		}
+
+		FORCEINLINE static T Distance(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+		{
+			return FMath::Sqrt(DistanceSquared(Vec1, Vec2));
+		}
+
+		/*
+		* Distance between the XYZ of two points, W ignored.
+		*/
+		FORCEINLINE static T DistanceSquared3(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+		{
+			const TVectorRegister<T> Delta = VectorSubtract(Vec1.GetRegister(), Vec2.GetRegister());
+			return VectorGetFirstComponent(VectorDot3(Delta, Delta));
+		}
+
+		FORCEINLINE static T Distance3(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+		{
+			return FMath::Sqrt(DistanceSquared3(Vec1, Vec2));
+		}
+
 		FORCEINLINE static constexpr bool AreNearlyEqual(const TVector4<T>& Vec1, const TVector4<T>& Vec2, T Tolerance = AA_SMALL_NUMBER) noexcept
 		{
 			return FMath::Abs(Vec1.X - Vec2.X) < Tolerance && FMath::Abs(Vec1.Y - Vec2.Y) < Tolerance && FMath::Abs(Vec1.Z - Vec2.Z) < Tolerance && FMath::Abs(Vec1.W - Vec2.W) < Tolerance;
@@ -333,19 +403,19 @@ namespace Math {
 	};
 
 	template<typename T>
-	FORCEINLINE constexpr T DotProduct(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+	FORCEINLINE T DotProduct(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
 	{
-		return Vec1 | Vec2;
+		return TVector4<T>::DotProduct(Vec1, Vec2);
 	}
 
 	template<typename T>
-	FORCEINLINE constexpr T Distance(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
+	FORCEINLINE T Distance(const TVector4<T>& Vec1, const TVector4<T>& Vec2) noexcept
 	{
-		return (Vec1 - Vec2).Size();
+		return TVector4<T>::Distance(Vec1, Vec2);
 	}
 
 	template<typename T>
-	FORCEINLINE constexpr TVector4<T> operator*(T Val, const TVector4<T>& Vec) noexcept
+	FORCEINLINE TVector4<T> operator*(T Val, const TVector4<T>& Vec) noexcept
 	{
 		return Vec * Val;
 	}
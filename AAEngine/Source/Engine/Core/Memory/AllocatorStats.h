@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "CoreMemory.h"
+
+#include <atomic>
+
+namespace AAEngine {
+
+	/*
+	* Counters kept by every engine allocator.
+	* Updated with relaxed atomics so the same stats object can be shared between threads without locking.
+	* Compiled down to nothing when AA_TRACK_ALLOCATOR_STATS is 0.
+	*/
+	struct AA_ENGINE_API FAllocatorStats
+	{
+	public:
+		/*
+		* Records an allocation of the given size.
+		*
+		* @param Bytes - Number of bytes handed out.
+		*/
+		FORCEINLINE void TrackAllocation(size_t Bytes) noexcept
+		{
+#if AA_TRACK_ALLOCATOR_STATS
+			TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+			LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+			size_t NewLiveBytes = LiveBytes.fetch_add(Bytes, std::memory_order_relaxed) + Bytes;
+
+			size_t CurrentPeak = HighWaterMark.load(std::memory_order_relaxed);
+			while (NewLiveBytes > CurrentPeak && !HighWaterMark.compare_exchange_weak(CurrentPeak, NewLiveBytes, std::memory_order_relaxed))
+			{
+			}
+#endif
+		}
+
+		/*
+		* Records a free of the given size.
+		*
+		* @param Bytes - Number of bytes given back.
+		*/
+		FORCEINLINE void TrackFree(size_t Bytes) noexcept
+		{
+#if AA_TRACK_ALLOCATOR_STATS
+			LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+			LiveBytes.fetch_sub(Bytes, std::memory_order_relaxed);
+#endif
+		}
+
+		/*
+		* Records an allocation that was grown or shrunk in place.
+		*
+		* @param OldBytes - Size before the resize.
+		* @param NewBytes - Size after the resize.
+		*/
+		FORCEINLINE void TrackResize(size_t OldBytes, size_t NewBytes) noexcept
+		{
+#if AA_TRACK_ALLOCATOR_STATS
+			size_t NewLiveBytes = LiveBytes.fetch_add(NewBytes - OldBytes, std::memory_order_relaxed) + (NewBytes - OldBytes);
+
+			size_t CurrentPeak = HighWaterMark.load(std::memory_order_relaxed);
+			while (NewLiveBytes > CurrentPeak && !HighWaterMark.compare_exchange_weak(CurrentPeak, NewLiveBytes, std::memory_order_relaxed))
+			{
+			}
+#endif
+		}
+
+		/*
+		* Clears every counter, including the high-water mark.
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			LiveBytes.store(0, std::memory_order_relaxed);
+			HighWaterMark.store(0, std::memory_order_relaxed);
+			TotalAllocations.store(0, std::memory_order_relaxed);
+			LiveAllocations.store(0, std::memory_order_relaxed);
+		}
+
+		/*
+		* Clears the live counters but keeps the totals and the high-water mark.
+		* Used by allocators that release everything at once.
+		*/
+		FORCEINLINE void ResetLive() noexcept
+		{
+			LiveBytes.store(0, std::memory_order_relaxed);
+			LiveAllocations.store(0, std::memory_order_relaxed);
+		}
+
+		/*
+		* @returns Bytes currently handed out by the allocator.
+		*/
+		FORCEINLINE size_t GetLiveBytes() const noexcept { return LiveBytes.load(std::memory_order_relaxed); }
+
+		/*
+		* @returns Largest value GetLiveBytes() has reached since the last Reset().
+		*/
+		FORCEINLINE size_t GetHighWaterMark() const noexcept { return HighWaterMark.load(std::memory_order_relaxed); }
+
+		/*
+		* @returns Number of allocations made since the last Reset().
+		*/
+		FORCEINLINE size_t GetTotalAllocations() const noexcept { return TotalAllocations.load(std::memory_order_relaxed); }
+
+		/*
+		* @returns Number of allocations that have not been freed yet.
+		*/
+		FORCEINLINE size_t GetLiveAllocations() const noexcept { return LiveAllocations.load(std::memory_order_relaxed); }
+
+		/*
+		* Const ToString function used to print the stats to the console for Debugging
+		*
+		* @returns std::string of the counters in a formatted way.
+		*/
+		std::string ToString() const
+		{
+			std::stringstream SS;
+			SS << "Live: " << GetLiveBytes() << " B in " << GetLiveAllocations() << " allocs, "
+				<< "Peak: " << GetHighWaterMark() << " B, "
+				<< "Total Allocs: " << GetTotalAllocations();
+			return SS.str();
+		}
+
+	private:
+		/*
+		* Bytes currently handed out.
+		*/
+		std::atomic<size_t> LiveBytes{ 0 };
+
+		/*
+		* Peak of LiveBytes.
+		*/
+		std::atomic<size_t> HighWaterMark{ 0 };
+
+		/*
+		* Allocations made since the last Reset.
+		*/
+		std::atomic<size_t> TotalAllocations{ 0 };
+
+		/*
+		* Allocations still alive.
+		*/
+		std::atomic<size_t> LiveAllocations{ 0 };
+	};
+}
@@ -7,3 +7,91 @@
 #else
 	#error AAEngine only supports Windows!
 #endif
+
+/*
+* Enables the bytes / allocations / high-water mark counters kept by the engine allocators.
+*/
+#ifndef AA_TRACK_ALLOCATOR_STATS
+	#if defined(AA_DEBUG) || defined(AA_RELEASE)
+		#define AA_TRACK_ALLOCATOR_STATS 1
+	#else
+		#define AA_TRACK_ALLOCATOR_STATS 0
+	#endif
+#endif
+
+/*
+* Records the call stack, tag and size of live FMemory allocations (FMemoryTracker), for the memory panel and the leak report.
+*/
+#ifndef AA_TRACK_ALLOCATIONS
+	#if defined(AA_DEBUG) || defined(AA_RELEASE)
+		#define AA_TRACK_ALLOCATIONS 1
+	#else
+		#define AA_TRACK_ALLOCATIONS 0
+	#endif
+#endif
+
+/*
+* One in how many allocations of a thread FMemoryTracker records.
+* Every allocation in debug, sampled in release where capturing a call stack per allocation would cost too much.
+*/
+#ifndef AA_TRACK_ALLOCATIONS_SAMPLE_RATE
+	#ifdef AA_DEBUG
+		#define AA_TRACK_ALLOCATIONS_SAMPLE_RATE 1
+	#else
+		#define AA_TRACK_ALLOCATIONS_SAMPLE_RATE 64
+	#endif
+#endif
+
+/*
+* Alignment of FMemory::Malloc when none is given, what the system heap guarantees on x64.
+*/
+#define DEFAULT_MEMORY_ALIGNMENT 16
+
+/*
+* Alignment of a 256 bit AVX register, for buffers read with aligned AVX loads.
+*/
+#define AA_AVX_ALIGNMENT 32
+
+/*
+* Checks the pointers returned by the allocators and passed to aligned SIMD loads / stores.
+* Separate from AA_ENABLE_ASSERTS so debug builds keep it on, a misaligned buffer is reported with its address instead of faulting somewhere inside a math kernel.
+*/
+#ifndef AA_CHECK_ALIGNMENT
+	#ifdef AA_DEBUG
+		#define AA_CHECK_ALIGNMENT 1
+	#else
+		#define AA_CHECK_ALIGNMENT 0
+	#endif
+#endif
+
+#if AA_CHECK_ALIGNMENT
+	#define AA_CHECK_ALIGNED(Pointer, Alignment)	{ if ((((uintptr_t)(Pointer)) & ((uintptr_t)(Alignment) - 1)) != 0) { AA_CORE_LOG(Error, "Misaligned pointer %p, expected %zu byte alignment!", (const void*)(Pointer), (size_t)(Alignment)); __debugbreak(); } }
+#else
+	#define AA_CHECK_ALIGNED(Pointer, Alignment)
+#endif
+
+/*
+* Backends FMemory can allocate from, picked with AA_MALLOC_BACKEND.
+* AA_MALLOC_SYSTEM - CRT heap.
+* AA_MALLOC_THREAD_CACHE - Per thread caches of small size classes, CRT heap for the rest.
+* AA_MALLOC_GUARD - Guard bytes, fill patterns and a free quarantine around the CRT heap, for hunting memory bugs.
+*/
+#define AA_MALLOC_SYSTEM 0
+#define AA_MALLOC_THREAD_CACHE 1
+#define AA_MALLOC_GUARD 2
+
+#ifndef AA_MALLOC_BACKEND
+	#define AA_MALLOC_BACKEND AA_MALLOC_THREAD_CACHE
+#endif
+
+/*
+* Routes the global operator new / delete through FMemory (defined in EntryPoint.h).
+* Off for DLL builds: new / delete are replaced per module, objects created on one side of the DLL and deleted on the other would mix heaps.
+*/
+#ifndef AA_OVERRIDE_OPERATOR_NEW
+	#ifdef AA_DYNAMIC_LINK
+		#define AA_OVERRIDE_OPERATOR_NEW 0
+	#else
+		#define AA_OVERRIDE_OPERATOR_NEW 1
+	#endif
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "AllocatorStats.h"
+
+namespace AAEngine {
+
+	/*
+	* Pool of equally sized memory blocks.
+	* Blocks are carved out of larger chunks and recycled through an intrusive free list, so allocating and freeing are a couple of pointer swaps.
+	* Chunks are only given back to the system when the pool is destroyed.
+	* NOTE: Not thread-safe.
+	*/
+	class AA_ENGINE_API CFixedBlockPool
+	{
+	public:
+		/*
+		* Constructor for CFixedBlockPool.
+		*
+		* @param InBlockSize - Size of each block in bytes, rounded up to hold at least a pointer.
+		* @param InBlocksPerChunk - Number of blocks reserved from the system at a time.
+		*/
+		CFixedBlockPool(size_t InBlockSize, size_t InBlocksPerChunk)
+			: BlockSize(RoundBlockSize(InBlockSize)), BlocksPerChunk(InBlocksPerChunk), FreeList(nullptr), Chunks(nullptr)
+		{
+		}
+
+		CFixedBlockPool(const CFixedBlockPool&) = delete;
+		CFixedBlockPool& operator=(const CFixedBlockPool&) = delete;
+
+		/*
+		* Destructor for CFixedBlockPool.
+		* Frees every chunk, blocks that are still in use are left dangling.
+		*/
+		~CFixedBlockPool()
+		{
+			while (Chunks)
+			{
+				FChunkHeader* Next = Chunks->Next;
+				::operator delete(Chunks);
+				Chunks = Next;
+			}
+		}
+
+		/*
+		* Takes a block from the pool, reserving a new chunk if the free list is empty.
+		*
+		* @returns Pointer to a block of GetBlockSize() bytes.
+		*/
+		FORCEINLINE void* Allocate() noexcept
+		{
+			if (!FreeList)
+			{
+				AllocateChunk();
+			}
+
+			FFreeBlock* Block = FreeList;
+			FreeList = Block->Next;
+			Stats.TrackAllocation(BlockSize);
+			return Block;
+		}
+
+		/*
+		* Puts a block back on the free list.
+		*
+		* @param Pointer - Block returned by Allocate.
+		*/
+		FORCEINLINE void Free(void* Pointer) noexcept
+		{
+			FFreeBlock* Block = (FFreeBlock*)Pointer;
+			Block->Next = FreeList;
+			FreeList = Block;
+			Stats.TrackFree(BlockSize);
+		}
+
+		/*
+		* @returns Size of the blocks handed out by the pool.
+		*/
+		FORCEINLINE size_t GetBlockSize() const noexcept { return BlockSize; }
+
+		/*
+		* @returns Allocation counters for this pool.
+		*/
+		FORCEINLINE FAllocatorStats& GetStats() noexcept { return Stats; }
+
+	private:
+		/*
+		* Free blocks store the link to the next free block in their own memory.
+		*/
+		struct FFreeBlock
+		{
+			FFreeBlock* Next;
+		};
+
+		/*
+		* Header in front of every chunk, used to free the chunks on destruction.
+		* Padded to 16 bytes so the blocks after it stay 16 byte aligned.
+		*/
+		struct alignas(16) FChunkHeader
+		{
+			FChunkHeader* Next;
+		};
+
+		/*
+		* Reserves a new chunk and threads all its blocks onto the free list.
+		*/
+		void AllocateChunk() noexcept
+		{
+			FChunkHeader* Chunk = (FChunkHeader*)::operator new(sizeof(FChunkHeader) + BlockSize * BlocksPerChunk);
+			Chunk->Next = Chunks;
+			Chunks = Chunk;
+
+			uint8_t* FirstBlock = (uint8_t*)(Chunk + 1);
+			for (size_t i = BlocksPerChunk; i > 0; i--)
+			{
+				FFreeBlock* Block = (FFreeBlock*)(FirstBlock + (i - 1) * BlockSize);
+				Block->Next = FreeList;
+				FreeList = Block;
+			}
+		}
+
+		/*
+		* Rounds a block size up to a multiple of 16 bytes.
+		*/
+		static constexpr size_t RoundBlockSize(size_t InBlockSize) noexcept
+		{
+			return InBlockSize < sizeof(FFreeBlock) ? 16 : (InBlockSize + 15) & ~(size_t)15;
+		}
+
+		/*
+		* Size of each block in bytes.
+		*/
+		size_t BlockSize;
+
+		/*
+		* Number of blocks reserved from the system at a time.
+		*/
+		size_t BlocksPerChunk;
+
+		/*
+		* Head of the free block list.
+		*/
+		FFreeBlock* FreeList;
+
+		/*
+		* Head of the list of chunks owned by the pool.
+		*/
+		FChunkHeader* Chunks;
+
+		/*
+		* Allocation counters for this pool.
+		*/
+		FAllocatorStats Stats;
+	};
+}
@@ -0,0 +1,74 @@
+#include "AA_PreCompiledHeaders.h"
+#include "FrameAllocator.h"
+
+namespace AAEngine {
+
+	CFrameAllocator& CFrameAllocator::Get()
+	{
+		static CFrameAllocator FrameAllocator;
+		return FrameAllocator;
+	}
+
+	CFrameAllocator::CFrameAllocator()
+		: FrameBuffer(AA_FRAME_ARENA_SIZE), TwoFrameBuffers{ FFrameBuffer(AA_TWO_FRAME_ARENA_SIZE), FFrameBuffer(AA_TWO_FRAME_ARENA_SIZE) }
+	{
+	}
+
+	void* CFrameAllocator::AllocateOverflow(FFrameBuffer& Buffer, size_t Bytes, size_t Alignment) noexcept
+	{
+		// The link to the next block sits in front of the returned memory, padded to keep the alignment
+		const size_t Padding = Alignment > DEFAULT_MEMORY_ALIGNMENT ? Alignment : DEFAULT_MEMORY_ALIGNMENT;
+		uint8_t* Base = (uint8_t*)FMemory::Malloc(Padding + Bytes, Alignment);
+		if (!Base)
+		{
+			return nullptr;
+		}
+
+		FOverflowBlock* Block = (FOverflowBlock*)Base;
+		Block->Next = Buffer.OverflowBlocks;
+		Buffer.OverflowBlocks = Block;
+		Buffer.OverflowBytes += Bytes;
+		return Base + Padding;
+	}
+
+	void CFrameAllocator::EndFrame() noexcept
+	{
+		ResetBuffer(FrameBuffer, "Frame");
+
+		// The buffer switched to holds the two frame data of the previous frame's previous frame
+		TwoFrameIndex ^= 1;
+		ResetBuffer(TwoFrameBuffers[TwoFrameIndex], "Two frame");
+		FrameNumber++;
+	}
+
+	void CFrameAllocator::ResetBuffer(FFrameBuffer& Buffer, const char* BufferName) noexcept
+	{
+		const size_t UsedBytes = Buffer.Arena.GetUsedBytes() + Buffer.OverflowBytes;
+		Buffer.PeakUsedBytes = UsedBytes > Buffer.PeakUsedBytes ? UsedBytes : Buffer.PeakUsedBytes;
+
+		if (Buffer.OverflowBytes > Buffer.PeakOverflowBytes)
+		{
+			Buffer.PeakOverflowBytes = Buffer.OverflowBytes;
+			AA_CORE_LOG(Warning, "%s allocator overflowed by %zu bytes in frame %llu (arena: %zu bytes), the overflow went to the heap.",
+				BufferName, Buffer.OverflowBytes, (unsigned long long)FrameNumber, Buffer.Arena.GetCapacity());
+		}
+
+		while (Buffer.OverflowBlocks)
+		{
+			FOverflowBlock* Next = Buffer.OverflowBlocks->Next;
+			FMemory::Free(Buffer.OverflowBlocks);
+			Buffer.OverflowBlocks = Next;
+		}
+		Buffer.OverflowBytes = 0;
+		Buffer.Arena.Reset();
+	}
+
+	void CFrameAllocator::LogStats() const
+	{
+		AA_CORE_LOG(Info, "Frame allocator after %llu frames:", (unsigned long long)FrameNumber);
+		AA_CORE_LOG(Info, "\tFrame - Peak: %zu / %zu bytes, Overflows: %zu",
+			GetFrameHighWaterMark(), FrameBuffer.Arena.GetCapacity(), FrameBuffer.Arena.GetNumOverflows());
+		AA_CORE_LOG(Info, "\tTwo frame - Peak: %zu / %zu bytes, Overflows: %zu",
+			GetTwoFrameHighWaterMark(), TwoFrameBuffers[0].Arena.GetCapacity(), TwoFrameBuffers[0].Arena.GetNumOverflows() + TwoFrameBuffers[1].Arena.GetNumOverflows());
+	}
+}
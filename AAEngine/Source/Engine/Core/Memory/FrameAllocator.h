@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Templates/AATemplates.h"
+#include "LinearArena.h"
+
+#include <new>
+#include <type_traits>
+
+/*
+* Size of each of the two arenas behind CFrameAllocator::AllocateTwoFrames.
+*/
+#ifndef AA_TWO_FRAME_ARENA_SIZE
+	#define AA_TWO_FRAME_ARENA_SIZE (2 * 1024 * 1024)
+#endif
+
+namespace AAEngine {
+
+	/*
+	* Scratch memory for data that only lives for a frame, handed to every layer in CLayer::OnUpdate.
+	* - Allocate: Memory is released at the end of the current frame (CLinearArena::GetFrameArena()).
+	* - AllocateTwoFrames: Memory is released at the end of the next frame, for data consumed one frame later (e.g. by a render thread).
+	*	Two arenas are used in turn, the one that is switched to at the end of a frame only held data of the frame before.
+	* Allocating is a pointer bump and releasing is resetting the arenas, no destructors are run.
+	* Allocations that don't fit in an arena still succeed from the heap and are freed with the arena, every overflow is counted
+	* and a warning is logged whenever a frame overflows by more than any frame before it, so the arena sizes can be raised.
+	* NOTE: Not thread-safe, only the game thread allocates. Other threads may read the memory during its lifetime.
+	*/
+	class AA_ENGINE_API CFrameAllocator
+	{
+	public:
+		/*
+		* @returns The engine frame allocator, ended by CEngineApplication::Run every frame.
+		*/
+		static CFrameAllocator& Get();
+
+		CFrameAllocator(const CFrameAllocator&) = delete;
+		CFrameAllocator& operator=(const CFrameAllocator&) = delete;
+
+		/*
+		* Allocates memory that is released at the end of the current frame.
+		*
+		* @param Bytes - Number of bytes needed.
+		* @param Alignment - Power of two alignment for the returned pointer.
+		*
+		* @returns Pointer to the memory, never nullptr unless the heap is out of memory.
+		*/
+		FORCEINLINE void* Allocate(size_t Bytes, size_t Alignment = DEFAULT_ARENA_ALIGNMENT) noexcept
+		{
+			void* Pointer = FrameBuffer.Arena.Allocate(Bytes, Alignment);
+			return Pointer ? Pointer : AllocateOverflow(FrameBuffer, Bytes, Alignment);
+		}
+
+		/*
+		* Allocates memory that is released at the end of the next frame.
+		*
+		* @param Bytes - Number of bytes needed.
+		* @param Alignment - Power of two alignment for the returned pointer.
+		*
+		* @returns Pointer to the memory, never nullptr unless the heap is out of memory.
+		*/
+		FORCEINLINE void* AllocateTwoFrames(size_t Bytes, size_t Alignment = DEFAULT_ARENA_ALIGNMENT) noexcept
+		{
+			FFrameBuffer& Buffer = TwoFrameBuffers[TwoFrameIndex];
+			void* Pointer = Buffer.Arena.Allocate(Bytes, Alignment);
+			return Pointer ? Pointer : AllocateOverflow(Buffer, Bytes, Alignment);
+		}
+
+		/*
+		* Constructs an object that lives until the end of the current frame.
+		* Its destructor is never called, so it must be trivially destructible.
+		*
+		* @param Args - Arguments for the constructor of T.
+		*
+		* @returns Pointer to the new object.
+		*/
+		template<typename T, typename... ArgsType>
+		FORCEINLINE T* New(ArgsType&&... Args) noexcept
+		{
+			static_assert(std::is_trivially_destructible<T>::value, "Frame memory is released without calling destructors!");
+			return new (Allocate(sizeof(T), alignof(T))) T(Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Constructs an object that lives until the end of the next frame.
+		* Its destructor is never called, so it must be trivially destructible.
+		*
+		* @param Args - Arguments for the constructor of T.
+		*
+		* @returns Pointer to the new object.
+		*/
+		template<typename T, typename... ArgsType>
+		FORCEINLINE T* NewTwoFrames(ArgsType&&... Args) noexcept
+		{
+			static_assert(std::is_trivially_destructible<T>::value, "Frame memory is released without calling destructors!");
+			return new (AllocateTwoFrames(sizeof(T), alignof(T))) T(Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Allocates an array that lives until the end of the current frame, the elements are value initialized.
+		*
+		* @param Count - Number of elements.
+		*
+		* @returns Pointer to the first element.
+		*/
+		template<typename T>
+		FORCEINLINE T* NewArray(size_t Count) noexcept
+		{
+			static_assert(std::is_trivially_destructible<T>::value, "Frame memory is released without calling destructors!");
+			T* Elements = (T*)Allocate(Count * sizeof(T), alignof(T));
+			for (size_t i = 0; i < Count; i++)
+			{
+				new (Elements + i) T();
+			}
+			return Elements;
+		}
+
+		/*
+		* Releases the memory of the current frame and the two frame memory of the previous frame.
+		* Called by the engine at the end of every frame.
+		* NOTE: Everything allocated with Allocate this frame, and with AllocateTwoFrames last frame, must be dead.
+		*/
+		void EndFrame() noexcept;
+
+		/*
+		* Logs the peak usage and the overflows of the arenas.
+		*/
+		void LogStats() const;
+
+		/*
+		* @returns Number of frames ended so far.
+		*/
+		FORCEINLINE uint64_t GetFrameNumber() const noexcept { return FrameNumber; }
+
+		/*
+		* @returns Arena behind Allocate.
+		*/
+		FORCEINLINE CLinearArena& GetFrameArena() noexcept { return FrameBuffer.Arena; }
+
+		/*
+		* @returns Arena behind AllocateTwoFrames for the current frame.
+		*/
+		FORCEINLINE CLinearArena& GetTwoFrameArena() noexcept { return TwoFrameBuffers[TwoFrameIndex].Arena; }
+
+		/*
+		* @returns Most bytes (arena + overflow) Allocate used in a single frame.
+		*/
+		FORCEINLINE size_t GetFrameHighWaterMark() const noexcept { return FrameBuffer.PeakUsedBytes; }
+
+		/*
+		* @returns Most bytes (arena + overflow) AllocateTwoFrames used in a single frame.
+		*/
+		FORCEINLINE size_t GetTwoFrameHighWaterMark() const noexcept
+		{
+			return TwoFrameBuffers[0].PeakUsedBytes > TwoFrameBuffers[1].PeakUsedBytes ? TwoFrameBuffers[0].PeakUsedBytes : TwoFrameBuffers[1].PeakUsedBytes;
+		}
+
+		/*
+		* @returns Number of allocations that didn't fit in their arena so far.
+		*/
+		FORCEINLINE size_t GetNumOverflows() const noexcept
+		{
+			return FrameBuffer.Arena.GetNumOverflows() + TwoFrameBuffers[0].Arena.GetNumOverflows() + TwoFrameBuffers[1].Arena.GetNumOverflows();
+		}
+
+	private:
+		/*
+		* Constructor for CFrameAllocator, only used by Get.
+		*/
+		CFrameAllocator();
+
+		/*
+		* Allocation made from the heap because it didn't fit in the arena.
+		* Linked together so they are freed with the arena.
+		*/
+		struct FOverflowBlock
+		{
+			FOverflowBlock* Next;
+		};
+
+		/*
+		* An arena and the heap allocations that overflowed it.
+		*/
+		struct FFrameBuffer
+		{
+			explicit FFrameBuffer(size_t Capacity)
+				: Arena(Capacity)
+			{
+			}
+
+			/*
+			* Arena the allocations are bumped out of.
+			*/
+			CLinearArena Arena;
+
+			/*
+			* Heap allocations made since the last reset.
+			*/
+			FOverflowBlock* OverflowBlocks = nullptr;
+
+			/*
+			* Bytes of the heap allocations made since the last reset.
+			*/
+			size_t OverflowBytes = 0;
+
+			/*
+			* Most bytes (arena + overflow) used between two resets.
+			*/
+			size_t PeakUsedBytes = 0;
+
+			/*
+			* Most overflow bytes between two resets, a warning is logged every time it grows.
+			*/
+			size_t PeakOverflowBytes = 0;
+		};
+
+		/*
+		* Allocates from the heap after the arena of Buffer ran out of space.
+		*/
+		void* AllocateOverflow(FFrameBuffer& Buffer, size_t Bytes, size_t Alignment) noexcept;
+
+		/*
+		* Updates the peaks of Buffer, frees its overflow allocations and resets its arena.
+		*
+		* @param BufferName - Name used in the overflow warning.
+		*/
+		void ResetBuffer(FFrameBuffer& Buffer, const char* BufferName) noexcept;
+
+	private:
+		/*
+		* Memory released at the end of every frame.
+		*/
+		FFrameBuffer FrameBuffer;
+
+		/*
+		* Memory released at the end of the frame after the one it was allocated in, used in turn.
+		*/
+		FFrameBuffer TwoFrameBuffers[2];
+
+		/*
+		* Index of the buffer AllocateTwoFrames uses this frame.
+		*/
+		uint32_t TwoFrameIndex = 0;
+
+		/*
+		* Number of frames ended so far.
+		*/
+		uint64_t FrameNumber = 0;
+	};
+}
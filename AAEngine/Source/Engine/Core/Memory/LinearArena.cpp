@@ -0,0 +1,11 @@
+#include "AA_PreCompiledHeaders.h"
+#include "LinearArena.h"
+#include "FrameAllocator.h"
+
+namespace AAEngine {
+
+	CLinearArena& CLinearArena::GetFrameArena()
+	{
+		return CFrameAllocator::Get().GetFrameArena();
+	}
+}
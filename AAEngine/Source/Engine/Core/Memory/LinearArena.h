@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "AllocatorStats.h"
+
+/*
+* Size of the engine wide frame arena returned by CLinearArena::GetFrameArena().
+*/
+#ifndef AA_FRAME_ARENA_SIZE
+	#define AA_FRAME_ARENA_SIZE (4 * 1024 * 1024)
+#endif
+
+/*
+* Alignment used by CLinearArena when none is given.
+*/
+#define DEFAULT_ARENA_ALIGNMENT 16
+
+namespace AAEngine {
+
+	/*
+	* Linear (bump pointer) arena.
+	* Allocations are carved out of one pre-allocated buffer and are all released at once with Reset().
+	* Freeing the most recent allocation gives its memory back, everything else is only reclaimed on Reset().
+	* NOTE: Not thread-safe, an arena belongs to the thread that resets it.
+	*/
+	class AA_ENGINE_API CLinearArena
+	{
+	public:
+		/*
+		* Constructor for CLinearArena.
+		*
+		* @param InCapacity - Size of the backing buffer in bytes.
+		*/
+		explicit CLinearArena(size_t InCapacity)
+			: Buffer((uint8_t*)::operator new(InCapacity)), Capacity(InCapacity), Offset(0), LastAllocationOffset(0), NumOverflows(0)
+		{
+		}
+
+		CLinearArena(const CLinearArena&) = delete;
+		CLinearArena& operator=(const CLinearArena&) = delete;
+
+		/*
+		* Destructor for CLinearArena.
+		* Frees the backing buffer, anything still pointing into it is left dangling.
+		*/
+		~CLinearArena()
+		{
+			::operator delete(Buffer);
+		}
+
+		/*
+		* Bumps the arena by the given size.
+		*
+		* @param Bytes - Number of bytes needed.
+		* @param Alignment - Power of two alignment for the returned pointer.
+		*
+		* @returns Pointer into the arena or nullptr if the arena does not have enough space left.
+		*/
+		FORCEINLINE void* Allocate(size_t Bytes, size_t Alignment = DEFAULT_ARENA_ALIGNMENT) noexcept
+		{
+			uintptr_t Base = (uintptr_t)Buffer;
+			size_t AlignedOffset = ((Base + Offset + Alignment - 1) & ~(uintptr_t)(Alignment - 1)) - Base;
+
+			if (AlignedOffset + Bytes > Capacity)
+			{
+				NumOverflows++;
+				return nullptr;
+			}
+
+			LastAllocationOffset = AlignedOffset;
+			Offset = AlignedOffset + Bytes;
+			Stats.TrackAllocation(Bytes);
+			return Buffer + AlignedOffset;
+		}
+
+		/*
+		* Tries to grow or shrink an allocation without moving it.
+		* Only works for the most recent allocation.
+		*
+		* @param Pointer - Pointer returned by Allocate.
+		* @param OldBytes - Size the allocation was made with.
+		* @param NewBytes - Size the allocation should have.
+		*
+		* @returns True if the allocation now has NewBytes of space.
+		*/
+		FORCEINLINE bool TryResize(void* Pointer, size_t OldBytes, size_t NewBytes) noexcept
+		{
+			if ((uint8_t*)Pointer != Buffer + LastAllocationOffset || LastAllocationOffset + NewBytes > Capacity)
+			{
+				return false;
+			}
+
+			Offset = LastAllocationOffset + NewBytes;
+			Stats.TrackResize(OldBytes, NewBytes);
+			return true;
+		}
+
+		/*
+		* Gives an allocation back to the arena.
+		* Memory is only reclaimed if Pointer is the most recent allocation.
+		*
+		* @param Pointer - Pointer returned by Allocate.
+		* @param Bytes - Size the allocation was made with.
+		*/
+		FORCEINLINE void Free(void* Pointer, size_t Bytes) noexcept
+		{
+			if ((uint8_t*)Pointer == Buffer + LastAllocationOffset && LastAllocationOffset + Bytes == Offset)
+			{
+				Offset = LastAllocationOffset;
+			}
+			Stats.TrackFree(Bytes);
+		}
+
+		/*
+		* Checks whether a pointer lives inside this arena.
+		*
+		* @param Pointer - Pointer to check.
+		*
+		* @returns True if the pointer is inside the arena's buffer.
+		*/
+		FORCEINLINE bool Owns(const void* Pointer) const noexcept
+		{
+			return (const uint8_t*)Pointer >= Buffer && (const uint8_t*)Pointer < Buffer + Capacity;
+		}
+
+		/*
+		* Releases every allocation made from the arena.
+		* Keeps the high-water mark so it can be reported over many frames.
+		* NOTE: Anything allocated from the arena must be dead before this is called.
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			Offset = 0;
+			LastAllocationOffset = 0;
+			Stats.ResetLive();
+		}
+
+		/*
+		* @returns Bytes used in the arena, including alignment padding.
+		*/
+		FORCEINLINE size_t GetUsedBytes() const noexcept { return Offset; }
+
+		/*
+		* @returns Size of the backing buffer in bytes.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept { return Capacity; }
+
+		/*
+		* @returns Number of allocations that did not fit in the arena.
+		*/
+		FORCEINLINE size_t GetNumOverflows() const noexcept { return NumOverflows; }
+
+		/*
+		* @returns Allocation counters for this arena.
+		*/
+		FORCEINLINE FAllocatorStats& GetStats() noexcept { return Stats; }
+
+		/*
+		* Engine wide arena for data that only lives for the current frame.
+		* Owned by CFrameAllocator, reset by the engine at the end of every frame.
+		*
+		* @returns Reference to the frame arena.
+		*/
+		static CLinearArena& GetFrameArena();
+
+	private:
+		/*
+		* Backing buffer of the arena.
+		*/
+		uint8_t* Buffer;
+
+		/*
+		* Size of the backing buffer in bytes.
+		*/
+		size_t Capacity;
+
+		/*
+		* Offset of the first free byte in Buffer.
+		*/
+		size_t Offset;
+
+		/*
+		* Offset of the most recent allocation, used to free / resize it in place.
+		*/
+		size_t LastAllocationOffset;
+
+		/*
+		* Number of allocations that did not fit in the arena.
+		*/
+		size_t NumOverflows;
+
+		/*
+		* Allocation counters for this arena.
+		*/
+		FAllocatorStats Stats;
+	};
+}
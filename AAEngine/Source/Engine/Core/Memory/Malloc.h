@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace AAEngine {
+
+	/*
+	* Interface for the backends FMemory allocates from.
+	* FMemory remembers the size and alignment of every allocation, so backends are always given them back on Realloc / Free
+	* and don't need to store anything per allocation.
+	* NOTE: Every backend must be thread-safe.
+	*/
+	class AA_ENGINE_API IMalloc
+	{
+	public:
+		virtual ~IMalloc() = default;
+
+		/*
+		* Allocates a block of memory.
+		*
+		* @param Size - Number of bytes needed.
+		* @param Alignment - Power of two alignment, at least DEFAULT_MEMORY_ALIGNMENT.
+		*
+		* @returns Pointer to the block, nullptr if out of memory.
+		*/
+		virtual void* Malloc(size_t Size, size_t Alignment) = 0;
+
+		/*
+		* Grows or shrinks a block, moving it if needed.
+		*
+		* @param Pointer - Block returned by Malloc / Realloc of this backend.
+		* @param OldSize - Size the block was allocated with.
+		* @param NewSize - Number of bytes needed.
+		* @param Alignment - Alignment the block was allocated with.
+		*
+		* @returns Pointer to the resized block, nullptr if out of memory (Pointer is still valid then).
+		*/
+		virtual void* Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment) = 0;
+
+		/*
+		* Gives a block back.
+		*
+		* @param Pointer - Block returned by Malloc / Realloc of this backend.
+		* @param Size - Size the block was allocated with.
+		* @param Alignment - Alignment the block was allocated with.
+		*/
+		virtual void Free(void* Pointer, size_t Size, size_t Alignment) = 0;
+
+		/*
+		* @returns Name of the backend, used in the memory stats dump.
+		*/
+		virtual const char* GetName() const = 0;
+	};
+}
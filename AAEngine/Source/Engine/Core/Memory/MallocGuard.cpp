@@ -0,0 +1,121 @@
+#include "AA_PreCompiledHeaders.h"
+#include "MallocGuard.h"
+
+namespace AAEngine {
+
+	namespace {
+		/*
+		* @returns True if every byte of [Data, Data + Size) is Pattern.
+		*/
+		bool HoldsPattern(const uint8_t* Data, size_t Size, uint8_t Pattern)
+		{
+			for (size_t i = 0; i < Size; i++)
+			{
+				if (Data[i] != Pattern)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	CMallocGuard::CMallocGuard(IMalloc& InInner)
+		: Inner(InInner)
+	{
+	}
+
+	CMallocGuard::~CMallocGuard()
+	{
+		for (const FQuarantineEntry& Entry : Quarantine)
+		{
+			if (Entry.Pointer)
+			{
+				Release(Entry);
+			}
+		}
+	}
+
+	void* CMallocGuard::Malloc(size_t Size, size_t Alignment)
+	{
+		const size_t FrontPadding = GetFrontPadding(Alignment);
+		uint8_t* Base = (uint8_t*)Inner.Malloc(FrontPadding + Size + MALLOC_GUARD_SIZE, Alignment);
+		if (!Base)
+		{
+			return nullptr;
+		}
+
+		uint8_t* UserData = Base + FrontPadding;
+		FMemory::MemSet(Base, MALLOC_GUARD_PATTERN, FrontPadding);
+		FMemory::MemSet(UserData, MALLOC_GUARD_ALLOCATED_PATTERN, Size);
+		FMemory::MemSet(UserData + Size, MALLOC_GUARD_PATTERN, MALLOC_GUARD_SIZE);
+		return UserData;
+	}
+
+	void* CMallocGuard::Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment)
+	{
+		void* NewPointer = Malloc(NewSize, Alignment);
+		if (NewPointer)
+		{
+			FMemory::MemCopy(NewPointer, Pointer, OldSize < NewSize ? OldSize : NewSize);
+			Free(Pointer, OldSize, Alignment);
+		}
+		return NewPointer;
+	}
+
+	void CMallocGuard::Free(void* Pointer, size_t Size, size_t Alignment)
+	{
+		CheckAllocation(Pointer, Size, Alignment, false);
+		FMemory::MemSet(Pointer, MALLOC_GUARD_FREED_PATTERN, Size);
+
+		FQuarantineEntry Evicted = {};
+		{
+			std::lock_guard<std::mutex> Lock(QuarantineMutex);
+			Evicted = Quarantine[QuarantineHead];
+			Quarantine[QuarantineHead] = { Pointer, Size, Alignment };
+			QuarantineHead = (QuarantineHead + 1) % MALLOC_GUARD_QUARANTINE_SIZE;
+		}
+
+		if (Evicted.Pointer)
+		{
+			Release(Evicted);
+		}
+	}
+
+	void CMallocGuard::CheckAllocation(void* Pointer, size_t Size, size_t Alignment, bool bFreed) noexcept
+	{
+		const size_t FrontPadding = GetFrontPadding(Alignment);
+		const uint8_t* UserData = (const uint8_t*)Pointer;
+		bool bCorrupted = false;
+
+		// Guards are restored after a corruption is reported, so the quarantine doesn't report it again
+		if (!HoldsPattern(UserData - FrontPadding, FrontPadding, MALLOC_GUARD_PATTERN))
+		{
+			NumCorruptions.fetch_add(1, std::memory_order_relaxed);
+			bCorrupted = true;
+			AA_CORE_LOG(Error, "Memory corruption: Write before the start of allocation %p (%zu bytes)", Pointer, Size);
+			FMemory::MemSet((uint8_t*)UserData - FrontPadding, MALLOC_GUARD_PATTERN, FrontPadding);
+		}
+		if (!HoldsPattern(UserData + Size, MALLOC_GUARD_SIZE, MALLOC_GUARD_PATTERN))
+		{
+			NumCorruptions.fetch_add(1, std::memory_order_relaxed);
+			bCorrupted = true;
+			AA_CORE_LOG(Error, "Memory corruption: Write past the end of allocation %p (%zu bytes)", Pointer, Size);
+			FMemory::MemSet((uint8_t*)UserData + Size, MALLOC_GUARD_PATTERN, MALLOC_GUARD_SIZE);
+		}
+		if (bFreed && !HoldsPattern(UserData, Size, MALLOC_GUARD_FREED_PATTERN))
+		{
+			NumCorruptions.fetch_add(1, std::memory_order_relaxed);
+			bCorrupted = true;
+			AA_CORE_LOG(Error, "Memory corruption: Write after free to allocation %p (%zu bytes)", Pointer, Size);
+		}
+		AA_CORE_ASSERT(!bCorrupted, "Memory corruption!");
+	}
+
+	void CMallocGuard::Release(const FQuarantineEntry& Entry) noexcept
+	{
+		CheckAllocation(Entry.Pointer, Entry.Size, Entry.Alignment, true);
+		const size_t FrontPadding = GetFrontPadding(Entry.Alignment);
+		Inner.Free((uint8_t*)Entry.Pointer - FrontPadding, FrontPadding + Entry.Size + MALLOC_GUARD_SIZE, Entry.Alignment);
+	}
+}
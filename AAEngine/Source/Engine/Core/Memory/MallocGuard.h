@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Malloc.h"
+
+#include <atomic>
+#include <mutex>
+
+/*
+* Bytes of guard placed before and after every allocation.
+*/
+#define MALLOC_GUARD_SIZE 16
+/*
+* Byte patterns written by CMallocGuard: the guards, new memory and freed memory.
+*/
+#define MALLOC_GUARD_PATTERN 0xFD
+#define MALLOC_GUARD_ALLOCATED_PATTERN 0xCD
+#define MALLOC_GUARD_FREED_PATTERN 0xDD
+/*
+* Number of freed allocations CMallocGuard holds on to before really freeing them.
+*/
+#define MALLOC_GUARD_QUARANTINE_SIZE 256
+
+namespace AAEngine {
+
+	/*
+	* Debug backend that catches memory corruption on top of another backend.
+	* - Every allocation is surrounded by guard bytes that are checked when it is freed => Buffer overruns / underruns.
+	* - New memory is filled with MALLOC_GUARD_ALLOCATED_PATTERN => Reads of uninitialized memory stand out.
+	* - Freed memory is filled with MALLOC_GUARD_FREED_PATTERN and kept in a quarantine for MALLOC_GUARD_QUARANTINE_SIZE frees,
+	*	it is checked to still hold the pattern before it is really freed => Writes through dangling pointers.
+	* - Realloc always moves the allocation => Pointers kept across a Realloc are caught as dangling.
+	* Corruptions are logged as errors and counted.
+	* NOTE: Slow and uses more memory, only meant for hunting memory bugs (AA_MALLOC_BACKEND AA_MALLOC_GUARD).
+	*/
+	class AA_ENGINE_API CMallocGuard : public IMalloc
+	{
+	public:
+		/*
+		* Constructor for CMallocGuard.
+		*
+		* @param InInner - Backend the guarded allocations are made from, must outlive the guard.
+		*/
+		explicit CMallocGuard(IMalloc& InInner);
+
+		/*
+		* Destructor for CMallocGuard.
+		* Checks and frees everything still in the quarantine.
+		*/
+		virtual ~CMallocGuard();
+
+		CMallocGuard(const CMallocGuard&) = delete;
+		CMallocGuard& operator=(const CMallocGuard&) = delete;
+
+		virtual void* Malloc(size_t Size, size_t Alignment) override;
+		virtual void* Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment) override;
+		virtual void Free(void* Pointer, size_t Size, size_t Alignment) override;
+		virtual const char* GetName() const override { return "Guard"; }
+
+		/*
+		* @returns Number of corruptions found so far.
+		*/
+		FORCEINLINE size_t GetNumCorruptions() const noexcept { return NumCorruptions.load(std::memory_order_relaxed); }
+
+	private:
+		/*
+		* Freed allocation waiting in the quarantine.
+		*/
+		struct FQuarantineEntry
+		{
+			void* Pointer;
+			size_t Size;
+			size_t Alignment;
+		};
+
+		/*
+		* @returns Bytes in front of the user memory, keeps the user memory aligned.
+		*/
+		static FORCEINLINE size_t GetFrontPadding(size_t Alignment) noexcept
+		{
+			return Alignment > MALLOC_GUARD_SIZE ? Alignment : MALLOC_GUARD_SIZE;
+		}
+
+		/*
+		* Checks the guards of an allocation, and that it still holds the freed pattern if bFreed.
+		* Logs and counts corruption.
+		*/
+		void CheckAllocation(void* Pointer, size_t Size, size_t Alignment, bool bFreed) noexcept;
+
+		/*
+		* Checks an allocation and gives it to the inner backend.
+		*/
+		void Release(const FQuarantineEntry& Entry) noexcept;
+
+	private:
+		/*
+		* Backend the guarded allocations are made from.
+		*/
+		IMalloc& Inner;
+
+		/*
+		* Guards the quarantine.
+		*/
+		std::mutex QuarantineMutex;
+
+		/*
+		* Ring of freed allocations.
+		*/
+		FQuarantineEntry Quarantine[MALLOC_GUARD_QUARANTINE_SIZE] = {};
+
+		/*
+		* Next slot of the quarantine to use, the oldest entry once the ring is full.
+		*/
+		size_t QuarantineHead = 0;
+
+		/*
+		* Number of corruptions found so far.
+		*/
+		std::atomic<size_t> NumCorruptions{ 0 };
+	};
+}
@@ -0,0 +1,22 @@
+#include "AA_PreCompiledHeaders.h"
+#include "MallocSystem.h"
+
+#include <malloc.h>
+
+namespace AAEngine {
+
+	void* CMallocSystem::Malloc(size_t Size, size_t Alignment)
+	{
+		return _aligned_malloc(Size ? Size : 1, Alignment);
+	}
+
+	void* CMallocSystem::Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment)
+	{
+		return _aligned_realloc(Pointer, NewSize ? NewSize : 1, Alignment);
+	}
+
+	void CMallocSystem::Free(void* Pointer, size_t Size, size_t Alignment)
+	{
+		_aligned_free(Pointer);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Malloc.h"
+
+namespace AAEngine {
+
+	/*
+	* Backend that goes straight to the CRT heap (_aligned_malloc).
+	* Used for everything the other backends don't serve themselves.
+	*/
+	class AA_ENGINE_API CMallocSystem : public IMalloc
+	{
+	public:
+		virtual void* Malloc(size_t Size, size_t Alignment) override;
+		virtual void* Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment) override;
+		virtual void Free(void* Pointer, size_t Size, size_t Alignment) override;
+		virtual const char* GetName() const override { return "System"; }
+	};
+}
@@ -0,0 +1,218 @@
+#include "AA_PreCompiledHeaders.h"
+#include "MallocThreadCache.h"
+
+namespace AAEngine {
+
+	CMallocThreadCache::CMallocThreadCache()
+	{
+		// 16 byte steps up to 128, then 4 classes per power of two
+		constexpr uint32_t Sizes[MALLOC_NUM_SIZE_CLASSES] = { 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024 };
+		static_assert(Sizes[MALLOC_NUM_SIZE_CLASSES - 1] == MALLOC_SMALL_MAX_SIZE, "The last size class must be MALLOC_SMALL_MAX_SIZE!");
+
+		uint32_t SizeClass = 0;
+		for (uint32_t Steps = 0; Steps <= MALLOC_SMALL_MAX_SIZE / MALLOC_SMALL_ALIGNMENT; Steps++)
+		{
+			while (Sizes[SizeClass] < Steps * MALLOC_SMALL_ALIGNMENT)
+			{
+				SizeClass++;
+			}
+			SizeToClass[Steps] = (uint8_t)SizeClass;
+		}
+
+		for (uint32_t i = 0; i < MALLOC_NUM_SIZE_CLASSES; i++)
+		{
+			ClassSizes[i] = Sizes[i];
+		}
+	}
+
+	void* CMallocThreadCache::Malloc(size_t Size, size_t Alignment)
+	{
+		if (!IsSmall(Size, Alignment))
+		{
+			return System.Malloc(Size, Alignment);
+		}
+
+		const uint32_t SizeClass = GetSizeClass(Size);
+		FThreadCache* Cache = GetThreadCache();
+		if (!Cache)
+		{
+			return AllocateFromPool(SizeClass);
+		}
+
+		if (!Cache->FreeLists[SizeClass])
+		{
+			RefillThreadCache(*Cache, SizeClass);
+			if (!Cache->FreeLists[SizeClass])
+			{
+				return nullptr;
+			}
+		}
+
+		FFreeBlock* Block = Cache->FreeLists[SizeClass];
+		Cache->FreeLists[SizeClass] = Block->Next;
+		Cache->NumFree[SizeClass]--;
+		return Block;
+	}
+
+	void* CMallocThreadCache::Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment)
+	{
+		const bool bOldSmall = IsSmall(OldSize, Alignment);
+		const bool bNewSmall = IsSmall(NewSize, Alignment);
+		if (!bOldSmall && !bNewSmall)
+		{
+			return System.Realloc(Pointer, OldSize, NewSize, Alignment);
+		}
+		if (bOldSmall && bNewSmall && GetSizeClass(OldSize) == GetSizeClass(NewSize))
+		{
+			return Pointer;
+		}
+
+		void* NewPointer = Malloc(NewSize, Alignment);
+		if (NewPointer)
+		{
+			FMemory::MemCopy(NewPointer, Pointer, OldSize < NewSize ? OldSize : NewSize);
+			Free(Pointer, OldSize, Alignment);
+		}
+		return NewPointer;
+	}
+
+	void CMallocThreadCache::Free(void* Pointer, size_t Size, size_t Alignment)
+	{
+		if (!IsSmall(Size, Alignment))
+		{
+			System.Free(Pointer, Size, Alignment);
+			return;
+		}
+
+		const uint32_t SizeClass = GetSizeClass(Size);
+		FFreeBlock* Block = (FFreeBlock*)Pointer;
+		FThreadCache* Cache = GetThreadCache();
+		if (!Cache)
+		{
+			FSizeClassPool& Pool = Pools[SizeClass];
+			std::lock_guard<std::mutex> Lock(Pool.Mutex);
+			Block->Next = Pool.FreeList;
+			Pool.FreeList = Block;
+			return;
+		}
+
+		Block->Next = Cache->FreeLists[SizeClass];
+		Cache->FreeLists[SizeClass] = Block;
+		if (++Cache->NumFree[SizeClass] >= 2 * MALLOC_THREAD_CACHE_BATCH)
+		{
+			SpillThreadCache(*Cache, SizeClass, MALLOC_THREAD_CACHE_BATCH);
+		}
+	}
+
+	CMallocThreadCache::FThreadCache* CMallocThreadCache::GetThreadCache() noexcept
+	{
+		// Trivially destructible, so it is never destroyed and stays usable while other thread_locals are destroyed
+		thread_local FThreadCache Cache = {};
+		if (!Cache.bRegistered)
+		{
+			// First use on this thread, make sure the cache is flushed when the thread exits
+			thread_local FThreadCacheFlusher Flusher;
+			Flusher.Owner = this;
+			Flusher.Cache = &Cache;
+			Cache.bRegistered = true;
+		}
+		return Cache.bFlushed ? nullptr : &Cache;
+	}
+
+	CMallocThreadCache::FThreadCacheFlusher::~FThreadCacheFlusher()
+	{
+		for (uint32_t SizeClass = 0; SizeClass < MALLOC_NUM_SIZE_CLASSES; SizeClass++)
+		{
+			if (Cache->NumFree[SizeClass] > 0)
+			{
+				Owner->SpillThreadCache(*Cache, SizeClass, Cache->NumFree[SizeClass]);
+			}
+		}
+		Cache->bFlushed = true;
+	}
+
+	void CMallocThreadCache::RefillThreadCache(FThreadCache& Cache, uint32_t SizeClass) noexcept
+	{
+		FSizeClassPool& Pool = Pools[SizeClass];
+		const size_t BlockSize = ClassSizes[SizeClass];
+		uint32_t NumMoved = 0;
+
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		while (Pool.FreeList && NumMoved < MALLOC_THREAD_CACHE_BATCH)
+		{
+			FFreeBlock* Block = Pool.FreeList;
+			Pool.FreeList = Block->Next;
+			Block->Next = Cache.FreeLists[SizeClass];
+			Cache.FreeLists[SizeClass] = Block;
+			NumMoved++;
+		}
+
+		while (NumMoved < MALLOC_THREAD_CACHE_BATCH)
+		{
+			if ((size_t)(Pool.ChunkEnd - Pool.ChunkCursor) < BlockSize && !AllocateChunk(Pool))
+			{
+				break;
+			}
+
+			FFreeBlock* Block = (FFreeBlock*)Pool.ChunkCursor;
+			Pool.ChunkCursor += BlockSize;
+			Block->Next = Cache.FreeLists[SizeClass];
+			Cache.FreeLists[SizeClass] = Block;
+			NumMoved++;
+		}
+		Cache.NumFree[SizeClass] += NumMoved;
+	}
+
+	void CMallocThreadCache::SpillThreadCache(FThreadCache& Cache, uint32_t SizeClass, uint32_t Count) noexcept
+	{
+		// Unlink the first Count blocks, then splice them into the pool in one go
+		FFreeBlock* First = Cache.FreeLists[SizeClass];
+		FFreeBlock* Last = First;
+		for (uint32_t i = 1; i < Count; i++)
+		{
+			Last = Last->Next;
+		}
+		Cache.FreeLists[SizeClass] = Last->Next;
+		Cache.NumFree[SizeClass] -= Count;
+
+		FSizeClassPool& Pool = Pools[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Last->Next = Pool.FreeList;
+		Pool.FreeList = First;
+	}
+
+	void* CMallocThreadCache::AllocateFromPool(uint32_t SizeClass) noexcept
+	{
+		FSizeClassPool& Pool = Pools[SizeClass];
+		const size_t BlockSize = ClassSizes[SizeClass];
+
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		if (FFreeBlock* Block = Pool.FreeList)
+		{
+			Pool.FreeList = Block->Next;
+			return Block;
+		}
+		if ((size_t)(Pool.ChunkEnd - Pool.ChunkCursor) < BlockSize && !AllocateChunk(Pool))
+		{
+			return nullptr;
+		}
+
+		void* Block = Pool.ChunkCursor;
+		Pool.ChunkCursor += BlockSize;
+		return Block;
+	}
+
+	bool CMallocThreadCache::AllocateChunk(FSizeClassPool& Pool) noexcept
+	{
+		uint8_t* Chunk = (uint8_t*)System.Malloc(MALLOC_CHUNK_SIZE, MALLOC_SMALL_ALIGNMENT);
+		if (!Chunk)
+		{
+			return false;
+		}
+
+		// The tail of the previous chunk that can't fit a block is lost
+		Pool.ChunkCursor = Chunk;
+		Pool.ChunkEnd = Chunk + MALLOC_CHUNK_SIZE;
+		return true;
+	}
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Core/Containers/CoreContainers.h"
+#include "Malloc.h"
+#include "MallocSystem.h"
+
+#include <mutex>
+
+/*
+* Biggest allocation served from the size classes, bigger ones go to the system heap.
+*/
+#define MALLOC_SMALL_MAX_SIZE 1024
+/*
+* Number of size classes between 16 and MALLOC_SMALL_MAX_SIZE bytes.
+*/
+#define MALLOC_NUM_SIZE_CLASSES 20
+/*
+* Alignment of every small block, over-aligned allocations go to the system heap.
+*/
+#define MALLOC_SMALL_ALIGNMENT 16
+/*
+* Number of blocks moved between a thread cache and the shared pool of a size class at a time.
+*/
+#define MALLOC_THREAD_CACHE_BATCH 32
+/*
+* Size of the chunks small blocks are carved out of.
+*/
+#define MALLOC_CHUNK_SIZE (64 * 1024)
+
+namespace AAEngine {
+
+	/*
+	* Small object backend with per thread caches.
+	* Allocations up to MALLOC_SMALL_MAX_SIZE are rounded up to one of MALLOC_NUM_SIZE_CLASSES size classes.
+	* Every thread keeps a free list per size class, so most Malloc / Free calls are a pointer pop / push without any locking.
+	* Thread caches refill from and spill into a shared, locked pool per size class MALLOC_THREAD_CACHE_BATCH blocks at a time,
+	* so memory freed on another thread than it was allocated on is recycled too.
+	* NOTE: Chunks are never given back to the system, the small block memory stays at its peak.
+	* NOTE: There must only be one instance (FMemory's), the thread caches are per thread, not per instance.
+	*/
+	class AA_ENGINE_API CMallocThreadCache : public IMalloc
+	{
+	public:
+		CMallocThreadCache();
+
+		CMallocThreadCache(const CMallocThreadCache&) = delete;
+		CMallocThreadCache& operator=(const CMallocThreadCache&) = delete;
+
+		virtual void* Malloc(size_t Size, size_t Alignment) override;
+		virtual void* Realloc(void* Pointer, size_t OldSize, size_t NewSize, size_t Alignment) override;
+		virtual void Free(void* Pointer, size_t Size, size_t Alignment) override;
+		virtual const char* GetName() const override { return "ThreadCache"; }
+
+	private:
+		/*
+		* Free blocks store the link to the next free block in their own memory.
+		*/
+		struct FFreeBlock
+		{
+			FFreeBlock* Next;
+		};
+
+		/*
+		* Blocks of one size class shared by every thread.
+		*/
+		struct alignas(AA_CACHE_LINE_SIZE) FSizeClassPool
+		{
+			/*
+			* Guards everything below.
+			*/
+			std::mutex Mutex;
+
+			/*
+			* Blocks given back by the thread caches.
+			*/
+			FFreeBlock* FreeList = nullptr;
+
+			/*
+			* First byte of the current chunk that wasn't handed out yet.
+			*/
+			uint8_t* ChunkCursor = nullptr;
+
+			/*
+			* End of the current chunk.
+			*/
+			uint8_t* ChunkEnd = nullptr;
+		};
+
+		/*
+		* Free lists of one thread.
+		*/
+		struct FThreadCache
+		{
+			/*
+			* Free blocks per size class.
+			*/
+			FFreeBlock* FreeLists[MALLOC_NUM_SIZE_CLASSES];
+
+			/*
+			* Number of blocks in each free list.
+			*/
+			uint32_t NumFree[MALLOC_NUM_SIZE_CLASSES];
+
+			/*
+			* Set once the thread registered its flusher.
+			*/
+			bool bRegistered;
+
+			/*
+			* Set once the thread cache was flushed at thread exit, the thread goes to the shared pools after that.
+			*/
+			bool bFlushed;
+		};
+
+		/*
+		* Gives the cache of a thread back to the shared pools when the thread exits.
+		*/
+		struct FThreadCacheFlusher
+		{
+			~FThreadCacheFlusher();
+
+			/*
+			* Backend the thread cache belongs to.
+			*/
+			CMallocThreadCache* Owner = nullptr;
+
+			/*
+			* Cache to flush.
+			*/
+			FThreadCache* Cache = nullptr;
+		};
+
+		/*
+		* @returns Size class of an allocation of Size bytes (Size <= MALLOC_SMALL_MAX_SIZE).
+		*/
+		FORCEINLINE uint32_t GetSizeClass(size_t Size) const noexcept
+		{
+			return SizeToClass[(Size + MALLOC_SMALL_ALIGNMENT - 1) / MALLOC_SMALL_ALIGNMENT];
+		}
+
+		/*
+		* @returns True if an allocation is served from the size classes.
+		*/
+		static FORCEINLINE bool IsSmall(size_t Size, size_t Alignment) noexcept
+		{
+			return Size <= MALLOC_SMALL_MAX_SIZE && Alignment <= MALLOC_SMALL_ALIGNMENT;
+		}
+
+		/*
+		* @returns The cache of the calling thread, nullptr once the thread is exiting.
+		*/
+		FThreadCache* GetThreadCache() noexcept;
+
+		/*
+		* Moves up to MALLOC_THREAD_CACHE_BATCH blocks from the shared pool of a size class into a thread cache.
+		*/
+		void RefillThreadCache(FThreadCache& Cache, uint32_t SizeClass) noexcept;
+
+		/*
+		* Moves Count blocks from a thread cache back into the shared pool of a size class.
+		*/
+		void SpillThreadCache(FThreadCache& Cache, uint32_t SizeClass, uint32_t Count) noexcept;
+
+		/*
+		* Takes one block straight from a shared pool, used by threads that are exiting.
+		*/
+		void* AllocateFromPool(uint32_t SizeClass) noexcept;
+
+		/*
+		* Carves a new chunk for a shared pool, the pool must be locked.
+		*/
+		bool AllocateChunk(FSizeClassPool& Pool) noexcept;
+
+	private:
+		/*
+		* Shared pool per size class.
+		*/
+		FSizeClassPool Pools[MALLOC_NUM_SIZE_CLASSES];
+
+		/*
+		* Block size of each size class.
+		*/
+		uint32_t ClassSizes[MALLOC_NUM_SIZE_CLASSES];
+
+		/*
+		* Size / MALLOC_SMALL_ALIGNMENT (rounded up) => Size class.
+		*/
+		uint8_t SizeToClass[MALLOC_SMALL_MAX_SIZE / MALLOC_SMALL_ALIGNMENT + 1];
+
+		/*
+		* Serves everything that isn't small and the chunks.
+		*/
+		CMallocSystem System;
+	};
+}
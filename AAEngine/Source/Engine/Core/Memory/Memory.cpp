@@ -0,0 +1,220 @@
+#include "AA_PreCompiledHeaders.h"
+#include "Memory.h"
+#include "MallocSystem.h"
+#include "MallocThreadCache.h"
+#include "MallocGuard.h"
+#include "MemoryTracker.h"
+
+#include <new>
+
+namespace AAEngine {
+
+	namespace {
+		/*
+		* Stored right in front of every allocation, so Free / Realloc / the stats know its size, alignment and tag.
+		*/
+		struct FAllocationHeader
+		{
+			size_t Size;
+			uint32_t Alignment;
+			EMemoryTag Tag;
+			bool bTracked;
+		};
+		static_assert(sizeof(FAllocationHeader) <= DEFAULT_MEMORY_ALIGNMENT, "FAllocationHeader must fit in front of an allocation!");
+
+		/*
+		* Counters per tag, constant initialized so allocations made during static initialization are counted too.
+		*/
+		FAllocatorStats TagStats[(size_t)EMemoryTag::Count];
+
+		/*
+		* Tag of the innermost FMemoryTagScope of each thread.
+		*/
+		thread_local EMemoryTag CurrentTag = EMemoryTag::Untagged;
+
+		/*
+		* Builds the backend in static storage, it is never destroyed as memory is freed until the very end of the program.
+		*/
+		IMalloc* CreateBackend()
+		{
+			alignas(CMallocSystem) static uint8_t SystemStorage[sizeof(CMallocSystem)];
+			IMalloc* System = new (SystemStorage) CMallocSystem();
+
+#if AA_MALLOC_BACKEND == AA_MALLOC_THREAD_CACHE
+			alignas(CMallocThreadCache) static uint8_t BackendStorage[sizeof(CMallocThreadCache)];
+			return new (BackendStorage) CMallocThreadCache();
+#elif AA_MALLOC_BACKEND == AA_MALLOC_GUARD
+			alignas(CMallocGuard) static uint8_t BackendStorage[sizeof(CMallocGuard)];
+			return new (BackendStorage) CMallocGuard(*System);
+#else
+			return System;
+#endif
+		}
+
+		/*
+		* @returns The header of an allocation.
+		*/
+		FORCEINLINE FAllocationHeader* GetHeader(const void* Pointer) noexcept
+		{
+			return (FAllocationHeader*)((uint8_t*)Pointer - sizeof(FAllocationHeader));
+		}
+
+		/*
+		* The header is put in the last bytes of the padding in front of the user memory.
+		* The padding is one alignment (at least DEFAULT_MEMORY_ALIGNMENT) so the user memory keeps the alignment.
+		*
+		* @returns Bytes in front of the user memory.
+		*/
+		FORCEINLINE size_t GetHeaderPadding(size_t Alignment) noexcept
+		{
+			return Alignment;
+		}
+	}
+
+	void* FMemory::Malloc(size_t Size, size_t Alignment, EMemoryTag Tag)
+	{
+		AA_CORE_ASSERT((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two!");
+		Alignment = Alignment < DEFAULT_MEMORY_ALIGNMENT ? DEFAULT_MEMORY_ALIGNMENT : Alignment;
+
+		const size_t Padding = GetHeaderPadding(Alignment);
+		uint8_t* Base = (uint8_t*)GetBackend().Malloc(Padding + Size, Alignment);
+		if (!Base)
+		{
+			return nullptr;
+		}
+
+		if (CurrentTag != EMemoryTag::Untagged)
+		{
+			Tag = CurrentTag;
+		}
+
+		uint8_t* UserData = Base + Padding;
+		FAllocationHeader* Header = GetHeader(UserData);
+		Header->Size = Size;
+		Header->Alignment = (uint32_t)Alignment;
+		Header->Tag = Tag;
+		Header->bTracked = false;
+
+#if AA_TRACK_ALLOCATIONS
+		if (FMemoryTracker::ShouldTrack())
+		{
+			Header->bTracked = true;
+			FMemoryTracker::TrackAllocation(UserData, Size, Tag);
+		}
+#endif
+
+		TagStats[(size_t)Tag].TrackAllocation(Size);
+		AA_CHECK_ALIGNED(UserData, Alignment);
+		return UserData;
+	}
+
+	void* FMemory::Realloc(void* Pointer, size_t NewSize, size_t Alignment, EMemoryTag Tag)
+	{
+		if (!Pointer)
+		{
+			return Malloc(NewSize, Alignment, Tag);
+		}
+		if (NewSize == 0)
+		{
+			Free(Pointer);
+			return nullptr;
+		}
+
+		const FAllocationHeader Header = *GetHeader(Pointer);
+		const size_t Padding = GetHeaderPadding(Header.Alignment);
+
+		// The old address may be reused as soon as the backend moves the block, so the tracker forgets it first
+		if (Header.bTracked)
+		{
+			FMemoryTracker::TrackFree(Pointer);
+		}
+
+		uint8_t* NewBase = (uint8_t*)GetBackend().Realloc((uint8_t*)Pointer - Padding, Padding + Header.Size, Padding + NewSize, Header.Alignment);
+		if (!NewBase)
+		{
+			if (Header.bTracked)
+			{
+				FMemoryTracker::TrackAllocation(Pointer, Header.Size, Header.Tag);
+			}
+			return nullptr;
+		}
+
+		uint8_t* UserData = NewBase + Padding;
+		GetHeader(UserData)->Size = NewSize;
+		if (Header.bTracked)
+		{
+			FMemoryTracker::TrackAllocation(UserData, NewSize, Header.Tag);
+		}
+		TagStats[(size_t)Header.Tag].TrackResize(Header.Size, NewSize);
+		AA_CHECK_ALIGNED(UserData, Header.Alignment);
+		return UserData;
+	}
+
+	void FMemory::Free(void* Pointer)
+	{
+		if (!Pointer)
+		{
+			return;
+		}
+
+		const FAllocationHeader Header = *GetHeader(Pointer);
+		const size_t Padding = GetHeaderPadding(Header.Alignment);
+		TagStats[(size_t)Header.Tag].TrackFree(Header.Size);
+		if (Header.bTracked)
+		{
+			FMemoryTracker::TrackFree(Pointer);
+		}
+		GetBackend().Free((uint8_t*)Pointer - Padding, Padding + Header.Size, Header.Alignment);
+	}
+
+	size_t FMemory::GetAllocationSize(const void* Pointer)
+	{
+		return GetHeader(Pointer)->Size;
+	}
+
+	EMemoryTag FMemory::GetCurrentTag()
+	{
+		return CurrentTag;
+	}
+
+	void FMemory::SetCurrentTag(EMemoryTag Tag)
+	{
+		CurrentTag = Tag;
+	}
+
+	FAllocatorStats& FMemory::GetTagStats(EMemoryTag Tag)
+	{
+		return TagStats[(size_t)Tag];
+	}
+
+	const char* FMemory::GetTagName(EMemoryTag Tag)
+	{
+		switch (Tag)
+		{
+		case EMemoryTag::Untagged:		return "Untagged";
+		case EMemoryTag::Containers:	return "Containers";
+		case EMemoryTag::Renderer:		return "Renderer";
+		case EMemoryTag::Assets:		return "Assets";
+		default:						return "Unknown";
+		}
+	}
+
+	IMalloc& FMemory::GetBackend()
+	{
+		static IMalloc* Backend = CreateBackend();
+		return *Backend;
+	}
+
+	void FMemory::DumpStats()
+	{
+#if AA_TRACK_ALLOCATOR_STATS
+		AA_CORE_LOG(Info, "Memory stats (%s backend):", GetBackend().GetName());
+		for (size_t Tag = 0; Tag < (size_t)EMemoryTag::Count; Tag++)
+		{
+			AA_CORE_LOG(Info, "\t%-10s - %s", GetTagName((EMemoryTag)Tag), TagStats[Tag].ToString().c_str());
+		}
+#else
+		AA_CORE_LOG(Info, "Memory stats are disabled (AA_TRACK_ALLOCATOR_STATS 0)");
+#endif
+	}
+}
@@ -1,10 +1,27 @@
 #pragma once
 
 #include "Core.h"
+#include "CoreMemory.h"
+#include "AllocatorStats.h"
 #include <memory>
 
 namespace AAEngine {
 
+	class IMalloc;
+
+	/*
+	* What an allocation is used for, FMemory keeps separate stats per tag.
+	*/
+	enum class EMemoryTag : uint8_t
+	{
+		Untagged = 0,
+		Containers,
+		Renderer,
+		Assets,
+
+		Count
+	};
+
 	struct AA_ENGINE_API FMemory
 	{
 	public:
@@ -12,5 +29,98 @@ namespace AAEngine {
 		static void*	MemMove(void* Dest, const void* Src, size_t Size)							{ return std::memmove(Dest, Src, Size); }
 		static void*	MemSet(void* Dest, int Value, size_t Size)									{ return std::memset(Dest, Value, Size); }
 		static int		MemCompare(const void* Buffer1, const void* Buffer2, size_t Size)			{ return std::memcmp(Buffer1, Buffer2, Size); }
-	};	
-}
\ No newline at end of file
+
+		/*
+		* Allocates memory from the engine backend (AA_MALLOC_BACKEND).
+		*
+		* @param Size - Number of bytes needed.
+		* @param Alignment - Power of two alignment of the returned pointer, raised to DEFAULT_MEMORY_ALIGNMENT if smaller.
+		* @param Tag - Tag the allocation is counted under when no FMemoryTagScope is active on this thread.
+		*
+		* @returns Pointer to the memory, nullptr if out of memory.
+		*/
+		static void* Malloc(size_t Size, size_t Alignment = DEFAULT_MEMORY_ALIGNMENT, EMemoryTag Tag = EMemoryTag::Untagged);
+
+		/*
+		* Grows or shrinks an allocation, moving it if needed. Keeps the alignment and tag of the allocation.
+		*
+		* @param Pointer - Pointer returned by Malloc / Realloc, or nullptr to make a new allocation.
+		* @param NewSize - Number of bytes needed, 0 frees the allocation.
+		* @param Alignment - Alignment for a new allocation, ignored if Pointer isn't nullptr.
+		* @param Tag - Tag for a new allocation, ignored if Pointer isn't nullptr.
+		*
+		* @returns Pointer to the resized memory, nullptr if NewSize is 0 or if out of memory (Pointer is still valid then).
+		*/
+		static void* Realloc(void* Pointer, size_t NewSize, size_t Alignment = DEFAULT_MEMORY_ALIGNMENT, EMemoryTag Tag = EMemoryTag::Untagged);
+
+		/*
+		* Gives memory back to the engine backend.
+		*
+		* @param Pointer - Pointer returned by Malloc / Realloc, or nullptr.
+		*/
+		static void Free(void* Pointer);
+
+		/*
+		* @returns Size an allocation was made with.
+		*/
+		static size_t GetAllocationSize(const void* Pointer);
+
+		/*
+		* @returns Tag set by the innermost FMemoryTagScope of this thread, Untagged if there is none.
+		*/
+		static EMemoryTag GetCurrentTag();
+
+		/*
+		* Sets the tag of this thread, use FMemoryTagScope instead.
+		*/
+		static void SetCurrentTag(EMemoryTag Tag);
+
+		/*
+		* @returns Counters of every allocation made under the given tag.
+		*/
+		static FAllocatorStats& GetTagStats(EMemoryTag Tag);
+
+		/*
+		* @returns Display name of a tag.
+		*/
+		static const char* GetTagName(EMemoryTag Tag);
+
+		/*
+		* @returns The backend FMemory allocates from.
+		*/
+		static IMalloc& GetBackend();
+
+		/*
+		* Logs the stats of every tag, called at shutdown.
+		*/
+		static void DumpStats();
+	};
+
+	/*
+	* Counts every allocation made on this thread while the scope is alive under the given tag, unless a nested scope overrides it.
+	* e.g. FMemoryTagScope MemoryTag(EMemoryTag::Renderer); at the top of a function creating GPU resources.
+	*/
+	struct AA_ENGINE_API FMemoryTagScope
+	{
+	public:
+		explicit FMemoryTagScope(EMemoryTag Tag)
+			: PreviousTag(FMemory::GetCurrentTag())
+		{
+			FMemory::SetCurrentTag(Tag);
+		}
+
+		~FMemoryTagScope()
+		{
+			FMemory::SetCurrentTag(PreviousTag);
+		}
+
+		FMemoryTagScope(const FMemoryTagScope&) = delete;
+		FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+	private:
+		/*
+		* Tag to restore when the scope ends.
+		*/
+		EMemoryTag PreviousTag;
+	};
+}
@@ -2,7 +2,20 @@
 
 #include "CoreMemory.h"
 #include "Memory.h"
+#include "MemoryOps.h"
+#include "MemoryTracker.h"
+// Allocators
+#include "AllocatorStats.h"
+#include "Malloc.h"
+#include "MallocSystem.h"
+#include "MallocThreadCache.h"
+#include "MallocGuard.h"
+#include "LinearArena.h"
+#include "FrameAllocator.h"
+#include "FixedBlockPool.h"
+#include "ObjectPool.h"
 // Pointers
 #include "UniquePointer.h"
 #include "SharedPointer.h"
-#include "WeakPointer.h"
\ No newline at end of file
+#include "WeakPointer.h"
+#include "RefCountPointer.h"
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Memory.h"
+#include "Templates/AATemplates.h"
+#include "Templates/AATypeTraits.h"
+
+/*
+* Element-range helpers used by the containers to construct, copy, relocate and destroy elements.
+* Each one picks a memcpy / memmove / no-op path from the type traits of T and falls back to per element operations otherwise.
+*/
+
+namespace AAEngine {
+
+	/*
+	* Destroys Count elements starting at Elements.
+	* Does nothing for trivially destructible types.
+	*
+	* @param Elements - First element to destroy.
+	* @param Count - Number of elements to destroy.
+	*/
+	template<typename T>
+	FORCEINLINE void DestructItems(T* Elements, size_t Count) noexcept
+	{
+		if constexpr (!TIsTriviallyDestructible<T>::Value)
+		{
+			for (size_t i = 0; i < Count; i++)
+			{
+				Elements[i].~T();
+			}
+		}
+	}
+
+	/*
+	* Value initializes Count elements in the uninitialized memory at Elements, i.e. T() => zero for arithmetic types.
+	*
+	* @param Elements - Uninitialized memory for Count elements.
+	* @param Count - Number of elements to construct.
+	*/
+	template<typename T>
+	FORCEINLINE void DefaultConstructItems(T* Elements, size_t Count) noexcept
+	{
+		for (size_t i = 0; i < Count; i++)
+		{
+			new(&Elements[i]) T();
+		}
+	}
+
+	/*
+	* Copy constructs Count elements from Source into the uninitialized memory at Dest.
+	*
+	* @param Dest - Uninitialized memory for Count elements.
+	* @param Source - Elements to copy from.
+	* @param Count - Number of elements to copy.
+	*/
+	template<typename T>
+	FORCEINLINE void CopyConstructItems(T* Dest, const T* Source, size_t Count) noexcept
+	{
+		if constexpr (TIsTriviallyCopyable<T>::Value)
+		{
+			if (Count > 0)
+			{
+				FMemory::MemCopy(Dest, Source, sizeof(T) * Count);
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < Count; i++)
+			{
+				new(&Dest[i]) T(Source[i]);
+			}
+		}
+	}
+
+	/*
+	* Move constructs Count elements from Source into the uninitialized memory at Dest.
+	* Source elements are left alive in their moved from state.
+	*
+	* @param Dest - Uninitialized memory for Count elements.
+	* @param Source - Elements to move from.
+	* @param Count - Number of elements to move.
+	*/
+	template<typename T>
+	FORCEINLINE void MoveConstructItems(T* Dest, T* Source, size_t Count) noexcept
+	{
+		if constexpr (TIsTriviallyCopyable<T>::Value)
+		{
+			if (Count > 0)
+			{
+				FMemory::MemCopy(Dest, Source, sizeof(T) * Count);
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < Count; i++)
+			{
+				new(&Dest[i]) T(Move(Source[i]));
+			}
+		}
+	}
+
+	/*
+	* Relocates Count elements from Source to Dest.
+	* Afterwards Dest holds the elements and Source is uninitialized memory.
+	* The ranges may overlap.
+	*
+	* @param Dest - Uninitialized memory for Count elements.
+	* @param Source - Elements to relocate.
+	* @param Count - Number of elements to relocate.
+	*/
+	template<typename T>
+	FORCEINLINE void RelocateConstructItems(T* Dest, T* Source, size_t Count) noexcept
+	{
+		if constexpr (TIsTriviallyRelocatable<T>::Value)
+		{
+			if (Count > 0)
+			{
+				FMemory::MemMove(Dest, Source, sizeof(T) * Count);
+			}
+		}
+		else if (Dest < Source)
+		{
+			for (size_t i = 0; i < Count; i++)
+			{
+				new(&Dest[i]) T(Move(Source[i]));
+				Source[i].~T();
+			}
+		}
+		else if (Dest > Source)
+		{
+			for (size_t i = Count; i > 0; i--)
+			{
+				new(&Dest[i - 1]) T(Move(Source[i - 1]));
+				Source[i - 1].~T();
+			}
+		}
+	}
+}
@@ -0,0 +1,470 @@
+#include "AA_PreCompiledHeaders.h"
+#include "MemoryTracker.h"
+#include "Malloc.h"
+#include "Containers/Array.h"
+#include "Containers/HashMap.h"
+
+#include <DbgHelp.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace AAEngine {
+
+	namespace {
+		/*
+		* Allocator policy of the tracker's own tables.
+		* Allocates from the FMemory backend directly, so the tables are not tracked and never call back into the tracker.
+		*/
+		struct FUntrackedAllocator
+		{
+			template<typename T>
+			class TForElementType
+			{
+			public:
+				FORCEINLINE T* Allocate(size_t Count) noexcept
+				{
+					return (T*)FMemory::GetBackend().Malloc(Count * sizeof(T), Alignment);
+				}
+
+				FORCEINLINE void Deallocate(T* Pointer, size_t Count) noexcept
+				{
+					FMemory::GetBackend().Free(Pointer, Count * sizeof(T), Alignment);
+				}
+
+				FORCEINLINE bool TryResizeInPlace(T* Pointer, size_t OldCount, size_t NewCount) noexcept
+				{
+					return false;
+				}
+
+			private:
+				static constexpr size_t Alignment = alignof(T) > DEFAULT_MEMORY_ALIGNMENT ? alignof(T) : DEFAULT_MEMORY_ALIGNMENT;
+			};
+
+			static FAllocatorStats& GetStats()
+			{
+				static FAllocatorStats Stats;
+				return Stats;
+			}
+		};
+
+		/*
+		* A live tracked allocation.
+		*/
+		struct FTrackedAllocation
+		{
+			/*
+			* Key of the site it was made from.
+			*/
+			uint64_t SiteHash;
+
+			/*
+			* Size of the allocation.
+			*/
+			size_t Size;
+		};
+
+		/*
+		* Cached result of FMemoryTracker::DescribeAddress.
+		*/
+		struct FSymbolName
+		{
+			char Name[256];
+		};
+
+		template<typename KeyType, typename ValueType>
+		using TUntrackedMap = TMap<KeyType, ValueType, THash<KeyType>, TKeyEqual<KeyType>, FUntrackedAllocator>;
+
+		/*
+		* Everything the tracker records, behind one lock.
+		*/
+		struct FTrackerState
+		{
+			/*
+			* Guards Allocations and Sites.
+			*/
+			std::mutex Mutex;
+
+			/*
+			* Live tracked allocations by address.
+			*/
+			TUntrackedMap<void*, FTrackedAllocation> Allocations;
+
+			/*
+			* Every site that made a tracked allocation, by hash of its call stack.
+			*/
+			TUntrackedMap<uint64_t, FAllocationSite> Sites;
+
+			/*
+			* Guards DbgHelp, which is single threaded, and SymbolNames.
+			*/
+			std::mutex SymbolMutex;
+
+			/*
+			* Descriptions of the addresses looked up so far.
+			*/
+			TUntrackedMap<void*, FSymbolName> SymbolNames;
+
+			/*
+			* Whether SymInitialize was called and whether it succeeded.
+			*/
+			bool bSymbolsInitialized = false;
+			bool bSymbolsAvailable = false;
+		};
+
+		/*
+		* Builds the state on first use in static storage and never destroys it, allocations are tracked until the very end of the program.
+		*/
+		FTrackerState& GetState()
+		{
+			alignas(FTrackerState) static uint8_t StateStorage[sizeof(FTrackerState)];
+			static FTrackerState* State = new (StateStorage) FTrackerState();
+			return *State;
+		}
+
+		/*
+		* Allocations left before the next tracked one, per thread.
+		*/
+		thread_local uint32_t SampleCountdown = 0;
+
+		/*
+		* Frame counters, only written by EndFrame on the main thread.
+		*/
+		std::atomic<uint32_t> FrameNumber{ 0 };
+		size_t LastTotalAllocations = 0;
+		size_t LastFrameAllocations = 0;
+		size_t FrameAllocationBudget = MEMORY_TRACKER_FRAME_ALLOCATION_BUDGET;
+		size_t WorstFrameAllocations = 0;
+		float FrameAllocationHistory[MEMORY_TRACKER_FRAME_HISTORY] = {};
+
+		/*
+		* Frames whose function name contains one of these are part of the memory layer, DescribeSite skips them.
+		*/
+		const char* const MemoryLayerFunctions[] = { "FMemory::", "FMemoryTracker::", "operator new", "Allocator", "ReallocateArray", "ReallocateBlock", "NewReferenceController" };
+
+		/*
+		* FNV-1a over the return addresses of a call stack.
+		*/
+		FORCEINLINE uint64_t HashStack(void* const* Stack, uint32_t StackDepth) noexcept
+		{
+			uint64_t Hash = 14695981039346656037ull;
+			for (uint32_t i = 0; i < StackDepth; i++)
+			{
+				Hash = (Hash ^ (uint64_t)(uintptr_t)Stack[i]) * 1099511628211ull;
+			}
+			return Hash;
+		}
+
+		/*
+		* @returns true if the description of a frame belongs to the memory layer.
+		*/
+		bool IsMemoryLayerFunction(const char* Description) noexcept
+		{
+			for (const char* Function : MemoryLayerFunctions)
+			{
+				if (std::strstr(Description, Function))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/*
+		* @returns The file name part of a path.
+		*/
+		const char* GetFileName(const char* Path) noexcept
+		{
+			const char* FileName = Path;
+			for (const char* Char = Path; *Char; Char++)
+			{
+				if (*Char == '\\' || *Char == '/')
+				{
+					FileName = Char + 1;
+				}
+			}
+			return FileName;
+		}
+	}
+
+	bool FMemoryTracker::ShouldTrack() noexcept
+	{
+#if AA_TRACK_ALLOCATIONS
+		if (SampleCountdown == 0)
+		{
+			SampleCountdown = AA_TRACK_ALLOCATIONS_SAMPLE_RATE - 1;
+			return true;
+		}
+		SampleCountdown--;
+#endif
+		return false;
+	}
+
+	void FMemoryTracker::TrackAllocation(void* Pointer, size_t Size, EMemoryTag Tag) noexcept
+	{
+#if AA_TRACK_ALLOCATIONS
+		// Skips this function and the FMemory function calling it
+		void* Stack[MEMORY_TRACKER_STACK_DEPTH];
+		const uint32_t StackDepth = CaptureStackBackTrace(2, MEMORY_TRACKER_STACK_DEPTH, Stack, nullptr);
+		const uint64_t SiteHash = HashStack(Stack, StackDepth);
+		const uint32_t Frame = FrameNumber.load(std::memory_order_relaxed);
+
+		FTrackerState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.Mutex);
+
+		FAllocationSite& Site = State.Sites.FindOrAdd(SiteHash);
+		if (Site.TotalAllocations == 0)
+		{
+			FMemory::MemCopy(Site.Stack, Stack, StackDepth * sizeof(void*));
+			Site.StackDepth = StackDepth;
+			Site.Tag = Tag;
+			Site.FirstFrame = Frame;
+		}
+		Site.LastFrame = Frame;
+		Site.LiveBytes += Size;
+		Site.LiveAllocations++;
+		Site.TotalAllocations++;
+
+		State.Allocations.Add(Pointer, FTrackedAllocation{ SiteHash, Size });
+#endif
+	}
+
+	void FMemoryTracker::TrackFree(void* Pointer) noexcept
+	{
+#if AA_TRACK_ALLOCATIONS
+		FTrackerState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.Mutex);
+
+		FTrackedAllocation* Allocation = State.Allocations.FindValue(Pointer);
+		if (!Allocation)
+		{
+			return;
+		}
+
+		if (FAllocationSite* Site = State.Sites.FindValue(Allocation->SiteHash))
+		{
+			Site->LiveBytes -= Allocation->Size;
+			Site->LiveAllocations--;
+		}
+		State.Allocations.Remove(Pointer);
+#endif
+	}
+
+	bool FMemoryTracker::EndFrame() noexcept
+	{
+		size_t TotalAllocations = 0;
+		for (size_t Tag = 0; Tag < (size_t)EMemoryTag::Count; Tag++)
+		{
+			TotalAllocations += FMemory::GetTagStats((EMemoryTag)Tag).GetTotalAllocations();
+		}
+		LastFrameAllocations = TotalAllocations - LastTotalAllocations;
+		LastTotalAllocations = TotalAllocations;
+
+		const uint32_t Frame = FrameNumber.load(std::memory_order_relaxed);
+		FrameAllocationHistory[Frame % MEMORY_TRACKER_FRAME_HISTORY] = (float)LastFrameAllocations;
+
+		// The first frame also counts startup, it isn't held against the budget
+		bool bOverBudget = false;
+		if (Frame > 0 && FrameAllocationBudget > 0 && LastFrameAllocations > FrameAllocationBudget && LastFrameAllocations > WorstFrameAllocations)
+		{
+			WorstFrameAllocations = LastFrameAllocations;
+			AA_CORE_LOG(Warning, "Frame %u made %zu allocations, the budget is %zu per frame.", Frame, LastFrameAllocations, FrameAllocationBudget);
+			bOverBudget = true;
+		}
+
+		FrameNumber.store(Frame + 1, std::memory_order_relaxed);
+		return bOverBudget;
+	}
+
+	uint32_t FMemoryTracker::GetFrameNumber() noexcept
+	{
+		return FrameNumber.load(std::memory_order_relaxed);
+	}
+
+	size_t FMemoryTracker::GetLastFrameAllocations() noexcept
+	{
+		return LastFrameAllocations;
+	}
+
+	const float* FMemoryTracker::GetFrameAllocationHistory(size_t& OutOffset) noexcept
+	{
+		OutOffset = FrameNumber.load(std::memory_order_relaxed) % MEMORY_TRACKER_FRAME_HISTORY;
+		return FrameAllocationHistory;
+	}
+
+	void FMemoryTracker::SetFrameAllocationBudget(size_t MaxAllocationsPerFrame) noexcept
+	{
+		FrameAllocationBudget = MaxAllocationsPerFrame;
+		WorstFrameAllocations = 0;
+	}
+
+	size_t FMemoryTracker::GetFrameAllocationBudget() noexcept
+	{
+		return FrameAllocationBudget;
+	}
+
+	size_t FMemoryTracker::GetTopSites(FAllocationSite* OutSites, size_t MaxSites) noexcept
+	{
+		size_t NumSites = 0;
+#if AA_TRACK_ALLOCATIONS
+		FTrackerState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.Mutex);
+
+		// Insertion into a sorted array of MaxSites, MaxSites is a handful for the panel
+		for (const auto& SiteEntry : State.Sites)
+		{
+			const FAllocationSite& Site = SiteEntry.Value;
+			if (Site.LiveAllocations == 0 || (NumSites == MaxSites && Site.LiveBytes <= OutSites[MaxSites - 1].LiveBytes))
+			{
+				continue;
+			}
+
+			size_t Index = NumSites < MaxSites ? NumSites++ : MaxSites - 1;
+			while (Index > 0 && OutSites[Index - 1].LiveBytes < Site.LiveBytes)
+			{
+				OutSites[Index] = OutSites[Index - 1];
+				Index--;
+			}
+			OutSites[Index] = Site;
+		}
+#endif
+		return NumSites;
+	}
+
+	void FMemoryTracker::DescribeAddress(void* Address, char* OutBuffer, size_t BufferSize) noexcept
+	{
+		FTrackerState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.SymbolMutex);
+
+		if (const FSymbolName* CachedName = State.SymbolNames.FindValue(Address))
+		{
+			snprintf(OutBuffer, BufferSize, "%s", CachedName->Name);
+			return;
+		}
+
+		const HANDLE Process = GetCurrentProcess();
+		if (!State.bSymbolsInitialized)
+		{
+			State.bSymbolsInitialized = true;
+			SymSetOptions(SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES | SYMOPT_UNDNAME);
+			State.bSymbolsAvailable = SymInitialize(Process, nullptr, TRUE) != FALSE;
+		}
+
+		FSymbolName& Name = State.SymbolNames.FindOrAdd(Address);
+		snprintf(Name.Name, sizeof(Name.Name), "0x%p", Address);
+
+		alignas(SYMBOL_INFO) uint8_t SymbolStorage[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+		SYMBOL_INFO* Symbol = (SYMBOL_INFO*)SymbolStorage;
+		Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+		Symbol->MaxNameLen = MAX_SYM_NAME;
+
+		DWORD64 SymbolDisplacement = 0;
+		if (State.bSymbolsAvailable && SymFromAddr(Process, (DWORD64)Address, &SymbolDisplacement, Symbol))
+		{
+			IMAGEHLP_LINE64 Line = {};
+			Line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+			DWORD LineDisplacement = 0;
+			if (SymGetLineFromAddr64(Process, (DWORD64)Address, &LineDisplacement, &Line))
+			{
+				snprintf(Name.Name, sizeof(Name.Name), "%s (%s:%lu)", Symbol->Name, GetFileName(Line.FileName), Line.LineNumber);
+			}
+			else
+			{
+				snprintf(Name.Name, sizeof(Name.Name), "%s", Symbol->Name);
+			}
+		}
+
+		snprintf(OutBuffer, BufferSize, "%s", Name.Name);
+	}
+
+	void FMemoryTracker::DescribeSite(const FAllocationSite& Site, char* OutBuffer, size_t BufferSize) noexcept
+	{
+		if (Site.StackDepth == 0)
+		{
+			snprintf(OutBuffer, BufferSize, "Unknown");
+			return;
+		}
+
+		for (uint32_t Frame = 0; Frame < Site.StackDepth; Frame++)
+		{
+			DescribeAddress(Site.Stack[Frame], OutBuffer, BufferSize);
+			if (!IsMemoryLayerFunction(OutBuffer))
+			{
+				return;
+			}
+		}
+
+		// Every recorded frame is inside the memory layer, the innermost one is still better than nothing
+		DescribeAddress(Site.Stack[0], OutBuffer, BufferSize);
+	}
+
+	uint32_t FMemoryTracker::GetSampleRate() noexcept
+	{
+		return AA_TRACK_ALLOCATIONS_SAMPLE_RATE;
+	}
+
+	size_t FMemoryTracker::WriteLeakReport(const char* FilePath)
+	{
+#if AA_TRACK_ALLOCATIONS
+		// Copied out so describing the frames and writing the file happen without holding the lock
+		TArray<FAllocationSite, FUntrackedAllocator> LiveSites;
+		{
+			FTrackerState& State = GetState();
+			std::lock_guard<std::mutex> Lock(State.Mutex);
+			for (const auto& SiteEntry : State.Sites)
+			{
+				if (SiteEntry.Value.LiveAllocations > 0)
+				{
+					LiveSites.PushBack(SiteEntry.Value);
+				}
+			}
+		}
+		LiveSites.Sort([](const FAllocationSite& A, const FAllocationSite& B) { return A.LiveBytes > B.LiveBytes; });
+
+		size_t LiveAllocations = 0;
+		size_t LiveBytes = 0;
+		size_t MainLoopSites = 0;
+		for (const FAllocationSite& Site : LiveSites)
+		{
+			LiveAllocations += Site.LiveAllocations;
+			LiveBytes += Site.LiveBytes;
+			MainLoopSites += Site.LastFrame > 0 ? 1 : 0;
+		}
+
+		if (LiveSites.Num() == 0)
+		{
+			AA_CORE_LOG(Info, "Memory leak report: no tracked allocation is alive.");
+			return 0;
+		}
+
+		FILE* File = fopen(FilePath, "w");
+		if (File)
+		{
+			fprintf(File, "AAEngine memory leak report\n");
+			fprintf(File, "Tracked 1 in %u allocations per thread, %u frames.\n", GetSampleRate(), GetFrameNumber());
+			fprintf(File, "%zu allocations (%zu bytes) from %zu sites still alive, %zu of the sites allocated after the first frame.\n", LiveAllocations, LiveBytes, LiveSites.Num(), MainLoopSites);
+
+			char Description[512];
+			for (size_t SiteIndex = 0; SiteIndex < LiveSites.Num(); SiteIndex++)
+			{
+				const FAllocationSite& Site = LiveSites[SiteIndex];
+				fprintf(File, "\n[%zu] %zu bytes in %zu allocations, %s, allocated in frames %u - %u\n",
+					SiteIndex, Site.LiveBytes, Site.LiveAllocations, FMemory::GetTagName(Site.Tag), Site.FirstFrame, Site.LastFrame);
+				for (uint32_t Frame = 0; Frame < Site.StackDepth; Frame++)
+				{
+					DescribeAddress(Site.Stack[Frame], Description, sizeof(Description));
+					fprintf(File, "\t%s\n", Description);
+				}
+			}
+			fclose(File);
+		}
+
+		AA_CORE_LOG(Warning, "Memory leak report: %zu allocations (%zu bytes) from %zu sites still alive, %zu of the sites allocated after the first frame. %s %s",
+			LiveAllocations, LiveBytes, LiveSites.Num(), MainLoopSites, File ? "Written to" : "Couldn't write", FilePath);
+		return LiveAllocations;
+#else
+		return 0;
+#endif
+	}
+}
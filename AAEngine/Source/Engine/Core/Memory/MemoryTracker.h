@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "CoreMemory.h"
+#include "Memory.h"
+
+/*
+* Number of return addresses recorded for each allocation site.
+*/
+#define MEMORY_TRACKER_STACK_DEPTH 8
+
+/*
+* Number of frames of allocation counts kept for the memory panel.
+*/
+#define MEMORY_TRACKER_FRAME_HISTORY 240
+
+/*
+* Allocations a frame can make through FMemory before FMemoryTracker warns, until SetFrameAllocationBudget changes it.
+* Steady state frames should take their temporaries from the frame allocator, a frame going over this is allocating on the heap again.
+*/
+#ifndef MEMORY_TRACKER_FRAME_ALLOCATION_BUDGET
+	#define MEMORY_TRACKER_FRAME_ALLOCATION_BUDGET 256
+#endif
+
+namespace AAEngine {
+
+	/*
+	* Tracked allocations made from one call stack.
+	* When the tracker samples (AA_TRACK_ALLOCATIONS_SAMPLE_RATE > 1) the counts are of sampled allocations only.
+	*/
+	struct FAllocationSite
+	{
+		/*
+		* Return addresses, innermost first.
+		*/
+		void* Stack[MEMORY_TRACKER_STACK_DEPTH];
+
+		/*
+		* Number of valid entries in Stack.
+		*/
+		uint32_t StackDepth;
+
+		/*
+		* Tag of the first allocation made from the site.
+		*/
+		EMemoryTag Tag;
+
+		/*
+		* First and last frame (FMemoryTracker::GetFrameNumber) the site allocated in.
+		*/
+		uint32_t FirstFrame;
+		uint32_t LastFrame;
+
+		/*
+		* Bytes and allocations from the site that are still alive.
+		*/
+		size_t LiveBytes;
+		size_t LiveAllocations;
+
+		/*
+		* Allocations ever made from the site.
+		*/
+		size_t TotalAllocations;
+	};
+
+	/*
+	* Records the call stack, tag and size of live FMemory allocations, to find leaks and what allocates every frame.
+	* - FMemory calls Track* for one in AA_TRACK_ALLOCATIONS_SAMPLE_RATE allocations per thread, so release builds only pay for a few stack captures.
+	* - The tracker's own tables come straight from the FMemory backend, they are not tracked.
+	* - EndFrame counts every allocation of the frame from the FMemory tag stats, sampled or not.
+	* Does nothing when AA_TRACK_ALLOCATIONS is 0.
+	*/
+	struct AA_ENGINE_API FMemoryTracker
+	{
+	public:
+		/*
+		* Called by FMemory::Malloc, counts down the sampling interval of this thread.
+		*
+		* @returns true if the allocation being made should be tracked.
+		*/
+		static bool ShouldTrack() noexcept;
+
+		/*
+		* Records an allocation and the call stack it was made from.
+		*/
+		static void TrackAllocation(void* Pointer, size_t Size, EMemoryTag Tag) noexcept;
+
+		/*
+		* Forgets an allocation, must be called before its memory is given back so the address can't be reused in between.
+		*/
+		static void TrackFree(void* Pointer) noexcept;
+
+		/*
+		* Closes the current frame: stores its allocation count and warns if it went over the budget.
+		* Called by the engine at the end of every frame.
+		*
+		* @returns true if the frame went over the budget and the warning was logged.
+		*/
+		static bool EndFrame() noexcept;
+
+		/*
+		* @returns Number of frames ended so far, allocations made before the first EndFrame are in frame 0.
+		*/
+		static uint32_t GetFrameNumber() noexcept;
+
+		/*
+		* @returns Number of allocations made during the last ended frame, 0 when AA_TRACK_ALLOCATOR_STATS is 0.
+		*/
+		static size_t GetLastFrameAllocations() noexcept;
+
+		/*
+		* Allocations per frame of the last MEMORY_TRACKER_FRAME_HISTORY frames, as floats for ImGui::PlotLines.
+		*
+		* @param OutOffset - Index of the oldest frame in the returned array.
+		*
+		* @returns Array of MEMORY_TRACKER_FRAME_HISTORY counts.
+		*/
+		static const float* GetFrameAllocationHistory(size_t& OutOffset) noexcept;
+
+		/*
+		* Logs a warning every time a frame makes more allocations than the budget and than any frame before it.
+		*
+		* @param MaxAllocationsPerFrame - Allocations a frame is allowed to make, 0 disables the warning.
+		*/
+		static void SetFrameAllocationBudget(size_t MaxAllocationsPerFrame) noexcept;
+
+		/*
+		* @returns Allocations a frame is allowed to make, MEMORY_TRACKER_FRAME_ALLOCATION_BUDGET by default.
+		*/
+		static size_t GetFrameAllocationBudget() noexcept;
+
+		/*
+		* Copies the sites holding the most live bytes.
+		*
+		* @param OutSites - Array of at least MaxSites sites.
+		* @param MaxSites - Number of sites to copy at most.
+		*
+		* @returns Number of sites copied, sorted by live bytes, biggest first.
+		*/
+		static size_t GetTopSites(FAllocationSite* OutSites, size_t MaxSites) noexcept;
+
+		/*
+		* Writes "Function (File:Line)" for a code address, or the raw address if there are no symbols for it. Results are cached.
+		*/
+		static void DescribeAddress(void* Address, char* OutBuffer, size_t BufferSize) noexcept;
+
+		/*
+		* Describes the innermost frame of a site that isn't inside the memory layer, i.e. the code that asked for the memory.
+		*/
+		static void DescribeSite(const FAllocationSite& Site, char* OutBuffer, size_t BufferSize) noexcept;
+
+		/*
+		* @returns One in how many allocations of a thread are tracked.
+		*/
+		static uint32_t GetSampleRate() noexcept;
+
+		/*
+		* Writes every site with allocations still alive to a file, with their full call stacks, and logs a summary.
+		* Called at shutdown once the application is destroyed, what is left is either a leak or owned by a static.
+		*
+		* @param FilePath - File the report is written to.
+		*
+		* @returns Number of tracked allocations still alive.
+		*/
+		static size_t WriteLeakReport(const char* FilePath);
+	};
+}
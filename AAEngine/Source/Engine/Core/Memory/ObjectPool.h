@@ -0,0 +1,421 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Memory.h"
+#include "UniquePointer.h"
+#include "Templates/AATemplates.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/*
+* Number of objects per chunk of a TTypedSlab, one bit of the chunk's live mask per object.
+*/
+#define TYPED_SLAB_CHUNK_SLOTS 64
+
+/*
+* Checks that TTypedSlab::Destroy is given a live object of that slab.
+* Separate from AA_ENABLE_ASSERTS so debug builds keep it on, a double destroy would otherwise put the slot on the free list twice.
+*/
+#ifndef AA_CHECK_SLAB_DESTROY
+	#ifdef AA_DEBUG
+		#define AA_CHECK_SLAB_DESTROY 1
+	#else
+		#define AA_CHECK_SLAB_DESTROY 0
+	#endif
+#endif
+
+namespace AAEngine {
+
+	/*
+	* Slab of objects of one type, for types that are created and destroyed at a high rate (events, render commands, layer transients).
+	* - Objects live in chunks of TYPED_SLAB_CHUNK_SLOTS slots, free slots are recycled through an intrusive free list,
+	*	so Construct / Destroy are a pointer pop / push and a bit flip, no call into the allocator.
+	* - Every chunk keeps a mask of its live slots, Reset destroys every live object in one pass and keeps the chunks for reuse.
+	* - Chunks are only given back when the slab is destroyed.
+	* - Only plain counters are kept per object, the chunks show up in the FMemory stats of the slab's tag.
+	* NOTE: Not thread-safe, see TObjectPool for a slab per thread.
+	*
+	* @tparam T - Type of the objects.
+	*/
+	template<typename T>
+	class TTypedSlab
+	{
+	public:
+		/*
+		* Constructor for TTypedSlab.
+		*
+		* @param InTag - Tag the chunks are allocated under.
+		*/
+		explicit TTypedSlab(EMemoryTag InTag = EMemoryTag::Untagged) noexcept
+			: Tag(InTag)
+		{
+		}
+
+		TTypedSlab(const TTypedSlab&) = delete;
+		TTypedSlab& operator=(const TTypedSlab&) = delete;
+
+		/*
+		* Destructor for TTypedSlab.
+		* Destroys the objects still alive and frees every chunk.
+		*/
+		~TTypedSlab()
+		{
+			Reset();
+			while (Chunks)
+			{
+				FChunk* Next = Chunks->Next;
+				FMemory::Free(Chunks);
+				Chunks = Next;
+			}
+		}
+
+		/*
+		* Constructs an object in a free slot, reserving a new chunk if there is none.
+		*
+		* @param Args - Arguments for the constructor of T.
+		*
+		* @returns Pointer to the new object, nullptr if out of memory.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE T* Construct(ArgsType&&... Args)
+		{
+			if (!FreeList && !AllocateChunk())
+			{
+				return nullptr;
+			}
+
+			FSlot* Slot = FreeList;
+			FreeList = Slot->NextFree;
+
+			T* Object = new (Slot->Storage) T(Forward<ArgsType>(Args)...);
+			Slot->Chunk->LiveMask |= GetSlotBit(Slot);
+			NumLive++;
+			PeakLive = NumLive > PeakLive ? NumLive : PeakLive;
+			return Object;
+		}
+
+		/*
+		* Destroys an object and puts its slot back on the free list.
+		* With AA_CHECK_SLAB_DESTROY (on in debug builds) an object of another slab or one already destroyed is reported and left alone.
+		*
+		* @param Object - Object returned by Construct of this slab, or nullptr.
+		*/
+		FORCEINLINE void Destroy(T* Object)
+		{
+			if (!Object)
+			{
+				return;
+			}
+
+			FSlot* Slot = GetSlot(Object);
+#if AA_CHECK_SLAB_DESTROY
+			if (Slot->Chunk->Owner != this)
+			{
+				AA_CORE_LOG(Error, "Object %p was not constructed by this slab!", (const void*)Object);
+				__debugbreak();
+				return;
+			}
+			if (!(Slot->Chunk->LiveMask & GetSlotBit(Slot)))
+			{
+				AA_CORE_LOG(Error, "Object %p was already destroyed!", (const void*)Object);
+				__debugbreak();
+				return;
+			}
+#endif
+
+			Object->~T();
+			Slot->Chunk->LiveMask &= ~GetSlotBit(Slot);
+			Slot->NextFree = FreeList;
+			FreeList = Slot;
+			NumLive--;
+		}
+
+		/*
+		* Destroys every live object at once, e.g. at the end of a frame. The chunks are kept.
+		* Only walks the live slots, the free ones are already on the free list.
+		*/
+		void Reset()
+		{
+			for (FChunk* Chunk = Chunks; Chunk && NumLive > 0; Chunk = Chunk->Next)
+			{
+				uint64_t LiveMask = Chunk->LiveMask;
+				while (LiveMask)
+				{
+					FSlot* Slot = &Chunk->Slots[CountTrailingZeros(LiveMask)];
+					LiveMask &= LiveMask - 1;
+
+					if constexpr (!std::is_trivially_destructible<T>::value)
+					{
+						((T*)Slot->Storage)->~T();
+					}
+					Slot->NextFree = FreeList;
+					FreeList = Slot;
+					NumLive--;
+				}
+				Chunk->LiveMask = 0;
+			}
+		}
+
+		/*
+		* Reserves chunks until Capacity objects fit without allocating.
+		*/
+		void Reserve(size_t Capacity)
+		{
+			while (NumChunks * TYPED_SLAB_CHUNK_SLOTS < Capacity && AllocateChunk())
+			{
+			}
+		}
+
+		/*
+		* Calls Function(Object) for every live object, in no particular order.
+		* NOTE: Function must not construct or destroy objects of this slab.
+		*/
+		template<typename FunctionType>
+		void ForEach(FunctionType&& Function)
+		{
+			for (FChunk* Chunk = Chunks; Chunk; Chunk = Chunk->Next)
+			{
+				uint64_t LiveMask = Chunk->LiveMask;
+				while (LiveMask)
+				{
+					Function(*(T*)Chunk->Slots[CountTrailingZeros(LiveMask)].Storage);
+					LiveMask &= LiveMask - 1;
+				}
+			}
+		}
+
+		/*
+		* @returns true if Object was constructed by this slab and is alive.
+		*/
+		FORCEINLINE bool Owns(const T* Object) const noexcept
+		{
+			const FSlot* Slot = GetSlot(Object);
+			return Slot->Chunk->Owner == this && (Slot->Chunk->LiveMask & GetSlotBit(Slot));
+		}
+
+		/*
+		* @returns Number of live objects.
+		*/
+		FORCEINLINE size_t Num() const noexcept { return NumLive; }
+
+		/*
+		* @returns Number of objects that fit in the chunks reserved so far.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept { return NumChunks * TYPED_SLAB_CHUNK_SLOTS; }
+
+		/*
+		* @returns Largest number of objects alive at once.
+		*/
+		FORCEINLINE size_t GetPeak() const noexcept { return PeakLive; }
+
+	private:
+		struct FChunk;
+
+		/*
+		* An object and the chunk it belongs to, free slots store the link to the next free slot in the object's memory.
+		*/
+		struct FSlot
+		{
+			FChunk* Chunk;
+			union
+			{
+				FSlot* NextFree;
+				alignas(T) uint8_t Storage[sizeof(T)];
+			};
+		};
+
+		/*
+		* Slots reserved from FMemory at a time.
+		*/
+		struct FChunk
+		{
+			/*
+			* Next chunk of the slab.
+			*/
+			FChunk* Next;
+
+			/*
+			* Slab the chunk belongs to, to catch objects destroyed through the wrong slab.
+			*/
+			const TTypedSlab* Owner;
+
+			/*
+			* Bit i is set while Slots[i] holds an object.
+			*/
+			uint64_t LiveMask;
+
+			FSlot Slots[TYPED_SLAB_CHUNK_SLOTS];
+		};
+		static_assert(TYPED_SLAB_CHUNK_SLOTS <= 64, "The live mask of a chunk is 64 bits!");
+
+		/*
+		* @returns The slot holding an object.
+		*/
+		static FORCEINLINE FSlot* GetSlot(const T* Object) noexcept
+		{
+			return (FSlot*)((uint8_t*)Object - offsetof(FSlot, Storage));
+		}
+
+		/*
+		* @returns The bit of a slot in the live mask of its chunk.
+		*/
+		static FORCEINLINE uint64_t GetSlotBit(const FSlot* Slot) noexcept
+		{
+			return 1ull << (Slot - Slot->Chunk->Slots);
+		}
+
+		/*
+		* @returns Index of the lowest set bit of a non zero mask.
+		*/
+		static FORCEINLINE uint32_t CountTrailingZeros(uint64_t Mask) noexcept
+		{
+#ifdef _MSC_VER
+			unsigned long Index;
+			_BitScanForward64(&Index, Mask);
+			return Index;
+#else
+			return __builtin_ctzll(Mask);
+#endif
+		}
+
+		/*
+		* Reserves a new chunk and threads all its slots onto the free list, first slot first.
+		*
+		* @returns false if out of memory.
+		*/
+		bool AllocateChunk() noexcept
+		{
+			FChunk* Chunk = (FChunk*)FMemory::Malloc(sizeof(FChunk), alignof(FChunk), Tag);
+			if (!Chunk)
+			{
+				return false;
+			}
+
+			Chunk->Next = Chunks;
+			Chunk->Owner = this;
+			Chunk->LiveMask = 0;
+			Chunks = Chunk;
+			NumChunks++;
+
+			for (size_t i = TYPED_SLAB_CHUNK_SLOTS; i > 0; i--)
+			{
+				FSlot* Slot = &Chunk->Slots[i - 1];
+				Slot->Chunk = Chunk;
+				Slot->NextFree = FreeList;
+				FreeList = Slot;
+			}
+			return true;
+		}
+
+	private:
+		/*
+		* Head of the free slot list.
+		*/
+		FSlot* FreeList = nullptr;
+
+		/*
+		* Head of the list of chunks owned by the slab.
+		*/
+		FChunk* Chunks = nullptr;
+
+		/*
+		* Number of chunks owned by the slab.
+		*/
+		size_t NumChunks = 0;
+
+		/*
+		* Number of live objects.
+		*/
+		size_t NumLive = 0;
+
+		/*
+		* Largest value NumLive has reached.
+		*/
+		size_t PeakLive = 0;
+
+		/*
+		* Tag the chunks are allocated under, the chunks are counted in its FMemory stats.
+		*/
+		EMemoryTag Tag;
+	};
+
+	/*
+	* Object pool of a type with one TTypedSlab per thread, so constructing and destroying never locks.
+	* e.g. CKeyPressedEvent* Event = TObjectPool<CKeyPressedEvent>::Construct(Key, 0); ... TObjectPool<CKeyPressedEvent>::Destroy(Event);
+	* NOTE: An object must be destroyed on the thread that constructed it, objects handed to another thread need a TTypedSlab behind a lock.
+	* NOTE: Objects still alive when their thread exits are destroyed with the thread's slab.
+	*
+	* @tparam T - Type of the objects.
+	*/
+	template<typename T>
+	class TObjectPool
+	{
+	public:
+		/*
+		* Constructs an object from the slab of the calling thread.
+		*
+		* @returns Pointer to the new object, nullptr if out of memory.
+		*/
+		template<typename... ArgsType>
+		static FORCEINLINE T* Construct(ArgsType&&... Args)
+		{
+			return GetThreadSlab().Construct(Forward<ArgsType>(Args)...);
+		}
+
+		/*
+		* Destroys an object constructed on the calling thread.
+		*/
+		static FORCEINLINE void Destroy(T* Object)
+		{
+			GetThreadSlab().Destroy(Object);
+		}
+
+		/*
+		* Destroys every object the calling thread constructed and didn't destroy yet.
+		*/
+		static void ResetThread()
+		{
+			GetThreadSlab().Reset();
+		}
+
+		/*
+		* @returns The slab of the calling thread.
+		*/
+		static FORCEINLINE TTypedSlab<T>& GetThreadSlab() noexcept
+		{
+			static thread_local TTypedSlab<T> Slab;
+			return Slab;
+		}
+	};
+
+	/*
+	* Deleter giving objects back to their TObjectPool, for TPooledPtr.
+	*/
+	template<typename T>
+	struct TObjectPoolDeleter
+	{
+		void operator()(T* Pointer)
+		{
+			TObjectPool<T>::Destroy(Pointer);
+		}
+	};
+
+	/*
+	* Unique pointer to an object of a TObjectPool.
+	*/
+	template<typename T>
+	using TPooledPtr = TUniquePtr<T, TObjectPoolDeleter<T>>;
+
+	/*
+	* Constructs an object from the TObjectPool of its type.
+	*
+	* @returns Unique pointer destroying the object back into the pool.
+	*/
+	template<typename T, typename... ArgsType>
+	FORCEINLINE TPooledPtr<T> MakePooled(ArgsType&&... Args)
+	{
+		return TPooledPtr<T>(TObjectPool<T>::Construct(Forward<ArgsType>(Args)...));
+	}
+}
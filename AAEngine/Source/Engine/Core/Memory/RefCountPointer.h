@@ -0,0 +1,368 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Templates/EnableIf.h"
+#include "Templates/AATemplates.h"
+#include "SharedPointerInternals.h"
+
+#include <type_traits>
+
+namespace AAEngine {
+
+	/*
+	* Base class for objects that count their own references, held with TRefCountPtr.
+	* The count lives in the object, so there is no controller block and a TRefCountPtr is a single pointer.
+	* The object deletes itself when the last reference is released, it is allocated from FMemory.
+	* NOTE: Mode is ThreadSafe by default, NotThreadSafe objects must only be referenced from one thread.
+	*/
+	template<ESPMode Mode = ESPMode::ThreadSafe>
+	class TRefCountedObject
+	{
+	public:
+		TRefCountedObject() noexcept
+			: NumRefs(0)
+		{
+		}
+
+		/*
+		* Virtual Destructor as Release deletes the derived object through this class
+		*/
+		virtual ~TRefCountedObject() = default;
+
+		/*
+		* Deleted Copy Constructor and Copy Assignment Operator, the count belongs to this instance
+		*/
+		TRefCountedObject(const TRefCountedObject&) = delete;
+		TRefCountedObject& operator=(const TRefCountedObject&) = delete;
+
+		/*
+		* Adds a reference
+		*
+		* @returns Number of references after adding this one
+		*/
+		FORCEINLINE uint32_t AddRef() const noexcept
+		{
+			return (uint32_t)NumRefs.Increment();
+		}
+
+		/*
+		* Releases a reference, deletes the object when it was the last one
+		*
+		* @returns Number of references left
+		*/
+		FORCEINLINE uint32_t Release() const noexcept
+		{
+			const int32_t RefsLeft = NumRefs.Decrement();
+			AA_CORE_ASSERT(RefsLeft >= 0, "Released a reference that was never added!");
+			if (RefsLeft == 0)
+			{
+				delete this;
+			}
+			return (uint32_t)RefsLeft;
+		}
+
+		/*
+		* @returns Number of references to the object
+		*/
+		FORCEINLINE uint32_t GetRefCount() const noexcept
+		{
+			return (uint32_t)NumRefs.Get();
+		}
+
+		/*
+		* Ref counted objects are allocated from FMemory, so they show up in the stats of the current FMemoryTagScope
+		*/
+		static void* operator new(size_t Size) { return FMemory::Malloc(Size); }
+		static void* operator new(size_t Size, std::align_val_t Alignment) { return FMemory::Malloc(Size, (size_t)Alignment); }
+		static void* operator new(size_t, void* Place) noexcept { return Place; }
+		static void operator delete(void* Pointer) noexcept { FMemory::Free(Pointer); }
+		static void operator delete(void* Pointer, std::align_val_t) noexcept { FMemory::Free(Pointer); }
+		static void operator delete(void*, void*) noexcept {}
+
+	private:
+		/*
+		* Number of references, starts at 0 as the first TRefCountPtr adds one
+		*/
+		mutable TReferenceCount<Mode> NumRefs;
+	};
+
+	/*
+	* Templated Intrusive Reference Counting Pointer class
+	* Works with any T that has AddRef() and Release(), usually a TRefCountedObject.
+	* As the count is in the object, a raw pointer can be turned back into a TRefCountPtr at any time.
+	*/
+	template<typename T>
+	class TRefCountPtr
+	{
+	public:
+		using ElementType = T;
+
+		/*
+		* Default constructor, Reference = nullptr
+		*/
+		constexpr FORCEINLINE TRefCountPtr() noexcept
+			: Reference(nullptr)
+		{
+		}
+
+		/*
+		* Constructor that takes in nullptr, Reference = nullptr
+		*/
+		constexpr FORCEINLINE TRefCountPtr(NULLPTR_TYPE) noexcept
+			: Reference(nullptr)
+		{
+		}
+
+		/*
+		* Constructor adding a reference to InReference
+		*
+		* @param InReference - Object to reference, can be nullptr
+		* @param bAddRef - false to adopt a reference the caller already added
+		*/
+		FORCEINLINE TRefCountPtr(T* InReference, bool bAddRef = true) noexcept
+			: Reference(InReference)
+		{
+			if (Reference && bAddRef)
+			{
+				Reference->AddRef();
+			}
+		}
+
+		/*
+		* Copy Constructor, adds a reference
+		*/
+		FORCEINLINE TRefCountPtr(const TRefCountPtr& Other) noexcept
+			: TRefCountPtr(Other.Reference)
+		{
+		}
+
+		/*
+		* Move Constructor, takes the reference of Other without touching the count
+		*/
+		FORCEINLINE TRefCountPtr(TRefCountPtr&& Other) noexcept
+			: Reference(Other.Reference)
+		{
+			Other.Reference = nullptr;
+		}
+
+		/*
+		* Templated Copy Constructor from a Ref Count Pointer with Implicitly comvertable U* (e.g. Derived to Base)
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TRefCountPtr(const TRefCountPtr<U>& Other) noexcept
+			: TRefCountPtr(Other.Get())
+		{
+		}
+
+		/*
+		* Templated Move Constructor from a Ref Count Pointer with Implicitly comvertable U* (e.g. Derived to Base)
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TRefCountPtr(TRefCountPtr<U>&& Other) noexcept
+			: Reference(Other.Reference)
+		{
+			Other.Reference = nullptr;
+		}
+
+		/*
+		* Destructor releasing the reference
+		*/
+		FORCEINLINE ~TRefCountPtr() noexcept
+		{
+			if (Reference)
+			{
+				Reference->Release();
+			}
+		}
+
+		/*
+		* Copy Assignment Operator
+		* The new reference is added before the old one is released, so assigning to itself is safe.
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TRefCountPtr& operator=(const TRefCountPtr& Other) noexcept
+		{
+			TRefCountPtr(Other).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Move Assignment Operator
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TRefCountPtr& operator=(TRefCountPtr&& Other) noexcept
+		{
+			TRefCountPtr(Move(Other)).Swap(*this);
+			return *this;
+		}
+
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TRefCountPtr& operator=(const TRefCountPtr<U>& Other) noexcept
+		{
+			TRefCountPtr(Other).Swap(*this);
+			return *this;
+		}
+
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TRefCountPtr& operator=(TRefCountPtr<U>&& Other) noexcept
+		{
+			TRefCountPtr(Move(Other)).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Assignment Operator adding a reference to a raw pointer
+		*/
+		FORCEINLINE TRefCountPtr& operator=(T* InReference) noexcept
+		{
+			TRefCountPtr(InReference).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Assignment Operator for nullptr, same as Reset
+		*/
+		FORCEINLINE TRefCountPtr& operator=(NULLPTR_TYPE) noexcept
+		{
+			Reset();
+			return *this;
+		}
+
+		/*
+		* Releases the reference, Reference = nullptr
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			TRefCountPtr().Swap(*this);
+		}
+
+		/*
+		* Swaps the referenced object with Other
+		*/
+		FORCEINLINE void Swap(TRefCountPtr& Other) noexcept
+		{
+			T* OldReference = Reference;
+			Reference = Other.Reference;
+			Other.Reference = OldReference;
+		}
+
+		/*
+		* Pointer Get function
+		*
+		* @returns Pointer to the object, nullptr if there is none
+		*/
+		FORCEINLINE T* Get() const noexcept
+		{
+			return Reference;
+		}
+
+		/*
+		* INDIRECTION operator
+		*
+		* @returns Pointer to the object
+		*/
+		FORCEINLINE T* operator->() const noexcept
+		{
+			AA_CORE_ASSERT(Reference, "Dereferencing a null TRefCountPtr!");
+			return Reference;
+		}
+
+		/*
+		* DEREFERENCE operator
+		*
+		* @returns Reference to the object
+		*/
+		FORCEINLINE T& operator*() const noexcept
+		{
+			AA_CORE_ASSERT(Reference, "Dereferencing a null TRefCountPtr!");
+			return *Reference;
+		}
+
+		/*
+		* @returns true if the pointer references an object, false otherwise
+		*/
+		FORCEINLINE bool IsValid() const noexcept
+		{
+			return Reference != nullptr;
+		}
+
+		/*
+		* bool cast operator, same as IsValid
+		*/
+		explicit FORCEINLINE operator bool() const noexcept
+		{
+			return IsValid();
+		}
+
+		/*
+		* @returns Number of references to the object, 0 if there is none
+		*/
+		FORCEINLINE uint32_t GetRefCount() const noexcept
+		{
+			return Reference ? Reference->GetRefCount() : 0;
+		}
+
+	private:
+		template<typename U>
+		friend class TRefCountPtr;
+
+	private:
+		/*
+		* Referenced object, nullptr if there is none
+		*/
+		T* Reference;
+	};
+
+	// Non - Member functions for Ref Count Pointer
+
+	template<typename T, typename U>
+	FORCEINLINE bool operator==(const TRefCountPtr<T>& Lhs, const TRefCountPtr<U>& Rhs) noexcept
+	{
+		return Lhs.Get() == Rhs.Get();
+	}
+
+	template<typename T, typename U>
+	FORCEINLINE bool operator!=(const TRefCountPtr<T>& Lhs, const TRefCountPtr<U>& Rhs) noexcept
+	{
+		return Lhs.Get() != Rhs.Get();
+	}
+
+	template<typename T>
+	FORCEINLINE bool operator==(const TRefCountPtr<T>& Lhs, NULLPTR_TYPE) noexcept
+	{
+		return !Lhs.IsValid();
+	}
+
+	template<typename T>
+	FORCEINLINE bool operator==(NULLPTR_TYPE, const TRefCountPtr<T>& Rhs) noexcept
+	{
+		return !Rhs.IsValid();
+	}
+
+	template<typename T>
+	FORCEINLINE bool operator!=(const TRefCountPtr<T>& Lhs, NULLPTR_TYPE) noexcept
+	{
+		return Lhs.IsValid();
+	}
+
+	template<typename T>
+	FORCEINLINE bool operator!=(NULLPTR_TYPE, const TRefCountPtr<T>& Rhs) noexcept
+	{
+		return Rhs.IsValid();
+	}
+
+	/*
+	* Constructs a ref counted object.
+	*
+	* @param Args - Arguments for the constructor of T
+	*
+	* @returns Ref Count Pointer holding the only reference to the new object
+	*/
+	template<typename T, typename... ArgsType>
+	FORCEINLINE TRefCountPtr<T> MakeRefCount(ArgsType&&... Args)
+	{
+		return TRefCountPtr<T>(new T(Forward<ArgsType>(Args)...));
+	}
+}
@@ -1,11 +1,391 @@
 #pragma once
 
-#include <memory>
+#include "Core/Core.h"
+#include "Templates/EnableIf.h"
+#include "Templates/AATemplates.h"
+#include "SharedPointerInternals.h"
+#include "UniquePointer.h"
+
+#include <type_traits>
 
 namespace AAEngine {
 
-	template<typename T>
-	using TSharedPtr = std::shared_ptr<T>;
+	template<typename T, ESPMode Mode>
+	class TWeakPtr;
+
+	template<typename T, ESPMode Mode>
+	class TSharedPtr;
+
+	template<typename T, ESPMode Mode = ESPMode::ThreadSafe, typename... ArgsType>
+	TSharedPtr<T, Mode> MakeShared(ArgsType&&... Args);
+
+	/*
+	* Templated Shared Pointer class
+	* Every copy shares ownership of the object, it is destroyed when the last copy is destroyed or reset.
+	* The reference counts live in a controller block, MakeShared puts the object in that block so only one allocation is made.
+	* Mode picks atomic (ThreadSafe, the default) or plain (NotThreadSafe) reference counting, see ESPMode.
+	*/
+	template<typename T, ESPMode Mode = ESPMode::ThreadSafe>
+	class TSharedPtr
+	{
+		using FReferenceController = SharedPointerInternals::TReferenceControllerBase<Mode>;
+
+	public:
+		using ElementType = T;
+
+		/*
+		* Default constructor, Object = nullptr
+		*/
+		constexpr FORCEINLINE TSharedPtr() noexcept
+			: Object(nullptr), Controller(nullptr)
+		{
+		}
+
+		/*
+		* Constructor that takes in nullptr, Object = nullptr
+		*/
+		constexpr FORCEINLINE TSharedPtr(NULLPTR_TYPE) noexcept
+			: Object(nullptr), Controller(nullptr)
+		{
+		}
+
+		/*
+		* Templated Constructor that takes ownership of an object allocated with new
+		* Prefer MakeShared, this needs a second allocation for the controller.
+		*
+		* @param InObject - Implicitly convertable U* to T*, can be nullptr
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		explicit TSharedPtr(U* InObject)
+			: TSharedPtr(InObject, TDefaultDeleter<U>())
+		{
+		}
+
+		/*
+		* Templated Constructor that takes ownership of an object destroyed by a custom deleter
+		*
+		* @param InObject - Implicitly convertable U* to T*, can be nullptr
+		* @param InDeleter - Callable taking U*, called when the last shared reference is released
+		*/
+		template<typename U, typename DeleterType, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		TSharedPtr(U* InObject, DeleterType&& InDeleter)
+			: Object(InObject), Controller(nullptr)
+		{
+			if (InObject)
+			{
+				using FController = SharedPointerInternals::TPointerReferenceController<U, typename std::decay<DeleterType>::type, Mode>;
+				Controller = SharedPointerInternals::NewReferenceController<FController>(InObject, typename std::decay<DeleterType>::type(Forward<DeleterType>(InDeleter)));
+			}
+		}
+
+		/*
+		* Copy Constructor, adds a shared reference
+		*/
+		FORCEINLINE TSharedPtr(const TSharedPtr& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddSharedReference();
+			}
+		}
+
+		/*
+		* Move Constructor, takes the reference of Other without touching the counts
+		*/
+		FORCEINLINE TSharedPtr(TSharedPtr&& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			Other.Object = nullptr;
+			Other.Controller = nullptr;
+		}
+
+		/*
+		* Templated Copy Constructor from a Shared Pointer with Implicitly comvertable U* (e.g. Derived to Base)
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TSharedPtr(const TSharedPtr<U, Mode>& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddSharedReference();
+			}
+		}
+
+		/*
+		* Templated Move Constructor from a Shared Pointer with Implicitly comvertable U* (e.g. Derived to Base)
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TSharedPtr(TSharedPtr<U, Mode>&& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			Other.Object = nullptr;
+			Other.Controller = nullptr;
+		}
+
+		/*
+		* Aliasing Constructor, shares the ownership of Other but points to InObject (e.g. a member of the owned object)
+		*
+		* @param Other - Shared Pointer owning the memory InObject lives in
+		* @param InObject - Pointer returned by Get
+		*/
+		template<typename U>
+		FORCEINLINE TSharedPtr(const TSharedPtr<U, Mode>& Other, T* InObject) noexcept
+			: Object(InObject), Controller(Other.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddSharedReference();
+			}
+		}
+
+		/*
+		* Destructor releasing the shared reference
+		*/
+		FORCEINLINE ~TSharedPtr() noexcept
+		{
+			if (Controller)
+			{
+				Controller->ReleaseSharedReference();
+			}
+		}
+
+		/*
+		* Copy Assignment Operator
+		* The new reference is added before the old one is released, so assigning to itself is safe.
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TSharedPtr& operator=(const TSharedPtr& Other) noexcept
+		{
+			TSharedPtr(Other).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Move Assignment Operator
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TSharedPtr& operator=(TSharedPtr&& Other) noexcept
+		{
+			TSharedPtr(Move(Other)).Swap(*this);
+			return *this;
+		}
+
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TSharedPtr& operator=(const TSharedPtr<U, Mode>& Other) noexcept
+		{
+			TSharedPtr(Other).Swap(*this);
+			return *this;
+		}
+
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TSharedPtr& operator=(TSharedPtr<U, Mode>&& Other) noexcept
+		{
+			TSharedPtr(Move(Other)).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Assignment Operator for nullptr, same as Reset
+		*/
+		FORCEINLINE TSharedPtr& operator=(NULLPTR_TYPE) noexcept
+		{
+			Reset();
+			return *this;
+		}
+
+		/*
+		* Releases the shared reference, Object = nullptr
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			TSharedPtr().Swap(*this);
+		}
+
+		/*
+		* Releases the shared reference and takes ownership of an object allocated with new
+		*/
+		template<typename U>
+		FORCEINLINE void Reset(U* NewObject)
+		{
+			TSharedPtr(NewObject).Swap(*this);
+		}
+
+		/*
+		* Swaps the object and the reference counts with Other
+		*/
+		FORCEINLINE void Swap(TSharedPtr& Other) noexcept
+		{
+			T* OldObject = Object;
+			Object = Other.Object;
+			Other.Object = OldObject;
+
+			FReferenceController* OldController = Controller;
+			Controller = Other.Controller;
+			Other.Controller = OldController;
+		}
+
+		/*
+		* Pointer Get function
+		*
+		* @returns Pointer to the object, nullptr if there is none
+		*/
+		FORCEINLINE T* Get() const noexcept
+		{
+			return Object;
+		}
+
+		/*
+		* INDIRECTION operator
+		*
+		* @returns Pointer to the object
+		*/
+		FORCEINLINE T* operator->() const noexcept
+		{
+			AA_CORE_ASSERT(Object, "Dereferencing a null TSharedPtr!");
+			return Object;
+		}
+
+		/*
+		* DEREFERENCE operator
+		*
+		* @returns Reference to the object
+		*/
+		FORCEINLINE typename std::add_lvalue_reference<T>::type operator*() const noexcept
+		{
+			AA_CORE_ASSERT(Object, "Dereferencing a null TSharedPtr!");
+			return *Object;
+		}
+
+		/*
+		* @returns true if the pointer references an object, false otherwise
+		*/
+		FORCEINLINE bool IsValid() const noexcept
+		{
+			return Object != nullptr;
+		}
+
+		/*
+		* bool cast operator, same as IsValid
+		*/
+		explicit FORCEINLINE operator bool() const noexcept
+		{
+			return IsValid();
+		}
+
+		/*
+		* @returns Number of Shared Pointers referencing the object, 0 if there is none
+		*/
+		FORCEINLINE int32_t GetSharedReferenceCount() const noexcept
+		{
+			return Controller ? Controller->GetSharedReferenceCount() : 0;
+		}
+
+		/*
+		* @returns true if this is the only Shared Pointer referencing the object
+		*/
+		FORCEINLINE bool IsUnique() const noexcept
+		{
+			return GetSharedReferenceCount() == 1;
+		}
+
+	private:
+		/*
+		* Constructor adopting a shared reference already added to InController, used by MakeShared and TWeakPtr::Pin
+		*/
+		FORCEINLINE TSharedPtr(T* InObject, FReferenceController* InController) noexcept
+			: Object(InObject), Controller(InController)
+		{
+		}
+
+		template<typename U, ESPMode OtherMode>
+		friend class TSharedPtr;
+
+		template<typename U, ESPMode OtherMode>
+		friend class TWeakPtr;
+
+		template<typename U, ESPMode OtherMode, typename... ArgsType>
+		friend TSharedPtr<U, OtherMode> MakeShared(ArgsType&&... Args);
+
+	private:
+		/*
+		* Object returned by Get, can differ from the owned object for aliasing and converted pointers
+		*/
+		T* Object;
+
+		/*
+		* Reference counts of the owned object, nullptr if there is none
+		*/
+		FReferenceController* Controller;
+	};
+
+	// Non - Member functions for Shared Pointer
+
+	template<typename T, typename U, ESPMode Mode>
+	FORCEINLINE bool operator==(const TSharedPtr<T, Mode>& Lhs, const TSharedPtr<U, Mode>& Rhs) noexcept
+	{
+		return Lhs.Get() == Rhs.Get();
+	}
+
+	template<typename T, typename U, ESPMode Mode>
+	FORCEINLINE bool operator!=(const TSharedPtr<T, Mode>& Lhs, const TSharedPtr<U, Mode>& Rhs) noexcept
+	{
+		return Lhs.Get() != Rhs.Get();
+	}
+
+	template<typename T, ESPMode Mode>
+	FORCEINLINE bool operator==(const TSharedPtr<T, Mode>& Lhs, NULLPTR_TYPE) noexcept
+	{
+		return !Lhs.IsValid();
+	}
+
+	template<typename T, ESPMode Mode>
+	FORCEINLINE bool operator==(NULLPTR_TYPE, const TSharedPtr<T, Mode>& Rhs) noexcept
+	{
+		return !Rhs.IsValid();
+	}
+
+	template<typename T, ESPMode Mode>
+	FORCEINLINE bool operator!=(const TSharedPtr<T, Mode>& Lhs, NULLPTR_TYPE) noexcept
+	{
+		return Lhs.IsValid();
+	}
+
+	template<typename T, ESPMode Mode>
+	FORCEINLINE bool operator!=(NULLPTR_TYPE, const TSharedPtr<T, Mode>& Rhs) noexcept
+	{
+		return Rhs.IsValid();
+	}
+
+	/*
+	* Constructs an object and its reference counts in a single allocation.
+	*
+	* @param Args - Arguments for the constructor of T
+	*
+	* @returns Shared Pointer owning the new object
+	*/
+	template<typename T, ESPMode Mode, typename... ArgsType>
+	FORCEINLINE TSharedPtr<T, Mode> MakeShared(ArgsType&&... Args)
+	{
+		using FController = SharedPointerInternals::TInlineReferenceController<T, Mode>;
+		FController* Controller = SharedPointerInternals::NewReferenceController<FController>(Forward<ArgsType>(Args)...);
+		T* Object = Controller->GetStoredObject();
+		return TSharedPtr<T, Mode>(Object, static_cast<SharedPointerInternals::TReferenceControllerBase<Mode>*>(Controller));
+	}
+
+	/*
+	* Casts a Shared Pointer with static_cast, the result shares the ownership of Pointer.
+	*
+	* @returns Shared Pointer to static_cast<To*>(Pointer.Get())
+	*/
+	template<typename To, typename From, ESPMode Mode>
+	FORCEINLINE TSharedPtr<To, Mode> StaticCastSharedPtr(const TSharedPtr<From, Mode>& Pointer) noexcept
+	{
+		return TSharedPtr<To, Mode>(Pointer, static_cast<To*>(Pointer.Get()));
+	}
+}
 
-#define MakeShared std::make_shared 
-}
\ No newline at end of file
+#include "WeakPointer.h"
@@ -0,0 +1,299 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Templates/AATemplates.h"
+#include "Memory.h"
+
+#include <atomic>
+#include <new>
+
+namespace AAEngine {
+
+	/*
+	* How the reference counts of TSharedPtr / TWeakPtr / TRefCountedObject are updated.
+	* - ThreadSafe: Atomic counts, references to the same object can be copied and released on any thread.
+	* - NotThreadSafe: Plain counts, every reference to the object must stay on one thread. Copies are a lot cheaper.
+	*/
+	enum class ESPMode : uint8_t
+	{
+		NotThreadSafe = 0,
+		ThreadSafe
+	};
+
+	/*
+	* Reference count used by the smart pointers, atomic or not depending on Mode.
+	*/
+	template<ESPMode Mode>
+	class TReferenceCount;
+
+	template<>
+	class TReferenceCount<ESPMode::ThreadSafe>
+	{
+	public:
+		explicit constexpr TReferenceCount(int32_t InitialCount) noexcept
+			: Count(InitialCount)
+		{
+		}
+
+		/*
+		* @returns The count, only a hint when other threads hold references.
+		*/
+		FORCEINLINE int32_t Get() const noexcept
+		{
+			return Count.load(std::memory_order_acquire);
+		}
+
+		/*
+		* Adding a reference only needs to be atomic, the caller already holds one.
+		*
+		* @returns The new count.
+		*/
+		FORCEINLINE int32_t Increment() noexcept
+		{
+			return Count.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		/*
+		* Releasing a reference must be ordered, so the thread that drops the last one sees every write made through the others.
+		*
+		* @returns The new count.
+		*/
+		FORCEINLINE int32_t Decrement() noexcept
+		{
+			return Count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		}
+
+		/*
+		* Adds a reference unless the count already dropped to zero.
+		*
+		* @returns True if a reference was added.
+		*/
+		FORCEINLINE bool IncrementIfNotZero() noexcept
+		{
+			int32_t OldCount = Count.load(std::memory_order_relaxed);
+			while (OldCount > 0)
+			{
+				if (Count.compare_exchange_weak(OldCount, OldCount + 1, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		std::atomic<int32_t> Count;
+	};
+
+	template<>
+	class TReferenceCount<ESPMode::NotThreadSafe>
+	{
+	public:
+		explicit constexpr TReferenceCount(int32_t InitialCount) noexcept
+			: Count(InitialCount)
+		{
+		}
+
+		FORCEINLINE int32_t Get() const noexcept { return Count; }
+		FORCEINLINE int32_t Increment() noexcept { return ++Count; }
+		FORCEINLINE int32_t Decrement() noexcept { return --Count; }
+
+		FORCEINLINE bool IncrementIfNotZero() noexcept
+		{
+			if (Count > 0)
+			{
+				++Count;
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		int32_t Count;
+	};
+
+	namespace SharedPointerInternals {
+
+		/*
+		* Block shared by every TSharedPtr / TWeakPtr of an object, holding its reference counts.
+		* The weak count has one extra reference held by all the shared references together,
+		* so the block is freed once the object is destroyed and the last weak reference is gone.
+		*/
+		template<ESPMode Mode>
+		class TReferenceControllerBase
+		{
+		public:
+			TReferenceControllerBase() noexcept
+				: SharedReferenceCount(1), WeakReferenceCount(1)
+			{
+			}
+
+			TReferenceControllerBase(const TReferenceControllerBase&) = delete;
+			TReferenceControllerBase& operator=(const TReferenceControllerBase&) = delete;
+
+			/*
+			* @returns Number of shared references to the object.
+			*/
+			FORCEINLINE int32_t GetSharedReferenceCount() const noexcept
+			{
+				return SharedReferenceCount.Get();
+			}
+
+			FORCEINLINE void AddSharedReference() noexcept
+			{
+				SharedReferenceCount.Increment();
+			}
+
+			/*
+			* Adds a shared reference for TWeakPtr::Pin, fails if the object is already destroyed.
+			*
+			* @returns True if a shared reference was added.
+			*/
+			FORCEINLINE bool ConditionallyAddSharedReference() noexcept
+			{
+				return SharedReferenceCount.IncrementIfNotZero();
+			}
+
+			/*
+			* Destroys the object when the last shared reference is released.
+			*/
+			FORCEINLINE void ReleaseSharedReference() noexcept
+			{
+				if (SharedReferenceCount.Decrement() == 0)
+				{
+					DestroyObject();
+
+					// Without weak references nothing else can reach the block, so the second atomic decrement is skipped
+					if (WeakReferenceCount.Get() == 1)
+					{
+						DeleteThis();
+					}
+					else
+					{
+						ReleaseWeakReference();
+					}
+				}
+			}
+
+			FORCEINLINE void AddWeakReference() noexcept
+			{
+				WeakReferenceCount.Increment();
+			}
+
+			/*
+			* Frees the block when the last weak reference is released.
+			*/
+			FORCEINLINE void ReleaseWeakReference() noexcept
+			{
+				if (WeakReferenceCount.Decrement() == 0)
+				{
+					DeleteThis();
+				}
+			}
+
+		protected:
+			~TReferenceControllerBase() = default;
+
+			/*
+			* Destroys the object, the block stays alive for the weak references.
+			*/
+			virtual void DestroyObject() noexcept = 0;
+
+			/*
+			* Frees the block.
+			*/
+			virtual void DeleteThis() noexcept = 0;
+
+		private:
+			/*
+			* Number of TSharedPtr referencing the object.
+			*/
+			TReferenceCount<Mode> SharedReferenceCount;
+
+			/*
+			* Number of TWeakPtr referencing the object, +1 while there are shared references.
+			*/
+			TReferenceCount<Mode> WeakReferenceCount;
+		};
+
+		/*
+		* Controller of an object allocated on its own, e.g. TSharedPtr<T>(new T()), destroyed with a deleter.
+		*/
+		template<typename ObjectType, typename DeleterType, ESPMode Mode>
+		class TPointerReferenceController final : public TReferenceControllerBase<Mode>, private DeleterType
+		{
+		public:
+			TPointerReferenceController(ObjectType* InObject, DeleterType&& InDeleter) noexcept
+				: DeleterType(Move(InDeleter)), Object(InObject)
+			{
+			}
+
+		private:
+			virtual void DestroyObject() noexcept override
+			{
+				static_cast<DeleterType&>(*this)(Object);
+			}
+
+			virtual void DeleteThis() noexcept override
+			{
+				this->~TPointerReferenceController();
+				FMemory::Free(this);
+			}
+
+			/*
+			* Object owned by the shared references.
+			*/
+			ObjectType* Object;
+		};
+
+		/*
+		* Controller that holds the object itself, so MakeShared needs a single allocation for both.
+		* The memory of the object is only freed with the block, after the last weak reference is gone.
+		*/
+		template<typename ObjectType, ESPMode Mode>
+		class TInlineReferenceController final : public TReferenceControllerBase<Mode>
+		{
+		public:
+			template<typename... ArgsType>
+			explicit TInlineReferenceController(ArgsType&&... Args)
+			{
+				::new ((void*)ObjectStorage) ObjectType(Forward<ArgsType>(Args)...);
+			}
+
+			/*
+			* @returns The object stored in the block.
+			*/
+			FORCEINLINE ObjectType* GetStoredObject() noexcept
+			{
+				return reinterpret_cast<ObjectType*>(ObjectStorage);
+			}
+
+		private:
+			virtual void DestroyObject() noexcept override
+			{
+				GetStoredObject()->~ObjectType();
+			}
+
+			virtual void DeleteThis() noexcept override
+			{
+				this->~TInlineReferenceController();
+				FMemory::Free(this);
+			}
+
+			/*
+			* Storage of the object, constructed in the constructor and destroyed in DestroyObject.
+			*/
+			alignas(ObjectType) uint8_t ObjectStorage[sizeof(ObjectType)];
+		};
+
+		/*
+		* Allocates and constructs a controller from FMemory.
+		*/
+		template<typename ControllerType, typename... ArgsType>
+		FORCEINLINE ControllerType* NewReferenceController(ArgsType&&... Args)
+		{
+			void* Memory = FMemory::Malloc(sizeof(ControllerType), alignof(ControllerType));
+			return ::new (Memory) ControllerType(Forward<ArgsType>(Args)...);
+		}
+	}
+}
@@ -117,10 +117,9 @@ namespace AAEngine {
 		*
 		* @param rvalue reference of another TUniquePtr
 		*/
-		constexpr FORCEINLINE TUniquePtr(TUniquePtr&& OtherPointer)
-			: Deleter(Move(OtherPointer.GetDeleter())), Pointer(OtherPointer) noexcept
+		constexpr FORCEINLINE TUniquePtr(TUniquePtr&& OtherPointer) noexcept
+			: Deleter(Move(OtherPointer.GetDeleter())), Pointer(OtherPointer.Release())
 		{
-			OtherPointer.Pointer = nullptr;
 		}
 
 		/*
@@ -132,9 +131,8 @@ namespace AAEngine {
 		*/
 		template<typename OtherT, typename OtherDeleter>
 		constexpr FORCEINLINE TUniquePtr(TUniquePtr<OtherT, OtherDeleter>&& OtherPointer) noexcept
-			: Deleter(Move(OtherPointer.GetDeleter())), Pointer(OtherPointer)
+			: Deleter(Move(OtherPointer.GetDeleter())), Pointer(OtherPointer.Release())
 		{
-			OtherPointer.Pointer = nullptr;
 		}
 
 		/*
@@ -174,8 +172,7 @@ namespace AAEngine {
 		constexpr FORCEINLINE TUniquePtr& operator=(TUniquePtr<OtherT, OtherDeleter>&& OtherPointer) noexcept
 		{
 			T* OldPointer = Pointer;
-			Pointer = OtherPointer.Pointer;
-			OtherPointer.Pointer = nullptr;
+			Pointer = OtherPointer.Release();
 			GetDeleter()(OldPointer);
 
 			GetDeleter() = Move(OtherPointer.GetDeleter());
@@ -1,9 +1,206 @@
 #pragma once
 
-#include <memory>
+#include "SharedPointer.h"
 
 namespace AAEngine {
 
-	template<typename T>
-	using TWeakPtr = std::weak_ptr<T>;
-}
\ No newline at end of file
+	/*
+	* Templated Weak Pointer class
+	* References an object owned by Shared Pointers without keeping it alive.
+	* Pin it to a TSharedPtr to use the object, the result is null once the object was destroyed.
+	*/
+	template<typename T, ESPMode Mode = ESPMode::ThreadSafe>
+	class TWeakPtr
+	{
+		using FReferenceController = SharedPointerInternals::TReferenceControllerBase<Mode>;
+
+	public:
+		using ElementType = T;
+
+		/*
+		* Default constructor, references nothing
+		*/
+		constexpr FORCEINLINE TWeakPtr() noexcept
+			: Object(nullptr), Controller(nullptr)
+		{
+		}
+
+		/*
+		* Constructor that takes in nullptr, references nothing
+		*/
+		constexpr FORCEINLINE TWeakPtr(NULLPTR_TYPE) noexcept
+			: Object(nullptr), Controller(nullptr)
+		{
+		}
+
+		/*
+		* Templated Constructor referencing the object of a Shared Pointer with Implicitly comvertable U*
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TWeakPtr(const TSharedPtr<U, Mode>& SharedPointer) noexcept
+			: Object(SharedPointer.Object), Controller(SharedPointer.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddWeakReference();
+			}
+		}
+
+		/*
+		* Copy Constructor, adds a weak reference
+		*/
+		FORCEINLINE TWeakPtr(const TWeakPtr& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddWeakReference();
+			}
+		}
+
+		/*
+		* Move Constructor, takes the reference of Other without touching the counts
+		*/
+		FORCEINLINE TWeakPtr(TWeakPtr&& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			Other.Object = nullptr;
+			Other.Controller = nullptr;
+		}
+
+		/*
+		* Templated Copy Constructor from a Weak Pointer with Implicitly comvertable U* (e.g. Derived to Base)
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TWeakPtr(const TWeakPtr<U, Mode>& Other) noexcept
+			: Object(Other.Object), Controller(Other.Controller)
+		{
+			if (Controller)
+			{
+				Controller->AddWeakReference();
+			}
+		}
+
+		/*
+		* Destructor releasing the weak reference
+		*/
+		FORCEINLINE ~TWeakPtr() noexcept
+		{
+			if (Controller)
+			{
+				Controller->ReleaseWeakReference();
+			}
+		}
+
+		/*
+		* Copy Assignment Operator
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TWeakPtr& operator=(const TWeakPtr& Other) noexcept
+		{
+			TWeakPtr(Other).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Move Assignment Operator
+		*
+		* @returns *this - reference to this
+		*/
+		FORCEINLINE TWeakPtr& operator=(TWeakPtr&& Other) noexcept
+		{
+			TWeakPtr(Move(Other)).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Assignment Operator referencing the object of a Shared Pointer
+		*
+		* @returns *this - reference to this
+		*/
+		template<typename U, typename = typename TEnableIf<std::is_convertible<U*, T*>::value>::Type>
+		FORCEINLINE TWeakPtr& operator=(const TSharedPtr<U, Mode>& SharedPointer) noexcept
+		{
+			TWeakPtr(SharedPointer).Swap(*this);
+			return *this;
+		}
+
+		/*
+		* Assignment Operator for nullptr, same as Reset
+		*/
+		FORCEINLINE TWeakPtr& operator=(NULLPTR_TYPE) noexcept
+		{
+			Reset();
+			return *this;
+		}
+
+		/*
+		* Takes a shared reference to the object so it can be used.
+		*
+		* @returns Shared Pointer to the object, null if it was already destroyed
+		*/
+		FORCEINLINE TSharedPtr<T, Mode> Pin() const noexcept
+		{
+			if (Controller && Controller->ConditionallyAddSharedReference())
+			{
+				return TSharedPtr<T, Mode>(Object, Controller);
+			}
+			return TSharedPtr<T, Mode>();
+		}
+
+		/*
+		* @returns true if the object is still alive, it can still be destroyed right after on another thread, use Pin
+		*/
+		FORCEINLINE bool IsValid() const noexcept
+		{
+			return Controller && Controller->GetSharedReferenceCount() > 0;
+		}
+
+		/*
+		* Releases the weak reference, references nothing after
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			TWeakPtr().Swap(*this);
+		}
+
+		/*
+		* Swaps the referenced object with Other
+		*/
+		FORCEINLINE void Swap(TWeakPtr& Other) noexcept
+		{
+			T* OldObject = Object;
+			Object = Other.Object;
+			Other.Object = OldObject;
+
+			FReferenceController* OldController = Controller;
+			Controller = Other.Controller;
+			Other.Controller = OldController;
+		}
+
+		/*
+		* @returns true if both Weak Pointers reference the same object
+		*/
+		template<typename U>
+		FORCEINLINE bool HasSameObject(const TWeakPtr<U, Mode>& Other) const noexcept
+		{
+			return Controller == Other.Controller && Object == Other.Object;
+		}
+
+	private:
+		template<typename U, ESPMode OtherMode>
+		friend class TWeakPtr;
+
+	private:
+		/*
+		* Referenced object, only safe to use through Pin
+		*/
+		T* Object;
+
+		/*
+		* Reference counts of the object, nullptr if nothing is referenced
+		*/
+		FReferenceController* Controller;
+	};
+}
@@ -14,43 +14,46 @@ namespace AAEngine {
 		{ EShaderVarType::SVT_Float2, EVertexInputType::VI_TexCoords },
 	};
 
-	TSharedPtr<IVertexBuffer> IVertexBuffer::Create(float* Vertices, uint32_t Count, uint32_t EnumUsage)
+	TRefCountPtr<IVertexBuffer> IVertexBuffer::Create(TConstArrayView<float> Vertices, uint32_t EnumUsage)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLVertexBuffer>(Vertices, Count, EnumUsage);
+			return MakeRefCount<COpenGLVertexBuffer>(Vertices, EnumUsage);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
 	}
 
-	TSharedPtr<IIndexBuffer> IIndexBuffer::Create(uint32_t* Indices, uint32_t Count, uint32_t EnumUsage)
+	TRefCountPtr<IIndexBuffer> IIndexBuffer::Create(TConstArrayView<uint32_t> Indices, uint32_t EnumUsage)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLIndexBuffer>(Indices, Count, EnumUsage);
+			return MakeRefCount<COpenGLIndexBuffer>(Indices, EnumUsage);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
 	}
 
-	TSharedPtr<IFramebuffer> IFramebuffer::Create(ITexture2D* Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex, EFramebufferMode FramebufferMode)
+	TRefCountPtr<IFramebuffer> IFramebuffer::Create(ITexture2D* Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex, EFramebufferMode FramebufferMode)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLFramebuffer>(Texture, FramebufferAttachmentType, ColorAttachmentIndex, FramebufferMode);
+			return MakeRefCount<COpenGLFramebuffer>(Texture, FramebufferAttachmentType, ColorAttachmentIndex, FramebufferMode);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
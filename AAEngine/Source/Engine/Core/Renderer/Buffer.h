@@ -75,6 +75,9 @@ namespace AAEngine {
 	*									{ EShaderVarType::Float3, "Position" },
 	*									{ EShaderVarType::Float4, "Color" }
 	*								};
+	*
+	* The elements are immutable once the layout is built and shared between copies, copying a layout (e.g. into every
+	* Vertex Buffer using it) only adds a reference instead of copying the elements and their names.
 	*/
 	class CVertexBufferLayout
 	{
@@ -85,13 +88,14 @@ namespace AAEngine {
 		CVertexBufferLayout() = default;
 
 		/*
-		* Constructor that takes in an Array
+		* Constructor that takes in a view of the Elements
 		*
-		* @param const TArray<FVertexBufferElement>& - Array of Elements to be initialied in the Layout
+		* @param TConstArrayView<FVertexBufferElement> - Elements to be initialied in the Layout
 		*/
-		CVertexBufferLayout(const TArray<FVertexBufferElement>& Elements)
-			: VertexBufferElements(Elements)
+		CVertexBufferLayout(TConstArrayView<FVertexBufferElement> Elements)
+			: LayoutData(MakeRefCount<FLayoutData>())
 		{
+			LayoutData->Elements.Append(Elements.Data(), Elements.Num());
 			SetElementOffsetAndStride();
 		}
 
@@ -102,31 +106,31 @@ namespace AAEngine {
 		* @param const std::initializer_list<FVertexBufferElement>& - InitList of Elements to be initialied in the Layout
 		*/
 		CVertexBufferLayout(const std::initializer_list<FVertexBufferElement>& Elements)
-			: VertexBufferElements(Elements)
+			: CVertexBufferLayout(TConstArrayView<FVertexBufferElement>(Elements.begin(), Elements.size()))
 		{
-			SetElementOffsetAndStride();
 		}
 
 		/*
 		* const Getter for the Elements in the Layout.
 		* 
-		* @returns TArray<FVertexBufferElement> - Array of Vertex Buffer Elements.
+		* @returns TConstArrayView<FVertexBufferElement> - View of the Vertex Buffer Elements, valid as long as the layout or a copy of it.
 		*/
-		FORCEINLINE TArray<FVertexBufferElement> GetElements() const { return VertexBufferElements; }
+		FORCEINLINE TConstArrayView<FVertexBufferElement> GetElements() const
+		{
+			return LayoutData ? TConstArrayView<FVertexBufferElement>(LayoutData->Elements) : TConstArrayView<FVertexBufferElement>();
+		}
 		/*
 		* const Getter of the Stride for the Elements in the Layout.
 		*
 		* @returns uint32_t - Stride for the Elements in the Layout.
 		*/
-		FORCEINLINE uint32_t GetStride() const { return Stride; }
+		FORCEINLINE uint32_t GetStride() const { return LayoutData ? LayoutData->Stride : 0; }
 
 		/*
 		* Iterators for easy looping for the Elements in the Layout
 		*/
-		TArray<FVertexBufferElement>::Iterator		begin()			{ return VertexBufferElements.begin(); }
-		TArray<FVertexBufferElement>::Iterator		end()			{ return VertexBufferElements.end(); }
-		TArray<FVertexBufferElement>::ConstIterator	begin() const	{ return VertexBufferElements.begin(); }
-		TArray<FVertexBufferElement>::ConstIterator	end() const		{ return VertexBufferElements.end(); }
+		const FVertexBufferElement* begin() const	{ return GetElements().begin(); }
+		const FVertexBufferElement* end() const		{ return GetElements().end(); }
 
 		static CVertexBufferLayout PhongLayout;
 
@@ -137,32 +141,43 @@ namespace AAEngine {
 		void SetElementOffsetAndStride()
 		{
 			uint32_t CurOffset = 0;
-			for (FVertexBufferElement& Elem : VertexBufferElements)
+			for (FVertexBufferElement& Elem : LayoutData->Elements)
 			{
 				Elem.Offset = CurOffset;
 				CurOffset += Elem.Size;
-				Stride += Elem.Size;
+				LayoutData->Stride += Elem.Size;
 			}
 		}
 
 	private:
 		/*
-		* Array of Vertex Buffer Elements.
+		* Elements and Stride, shared by every copy of the layout.
 		*/
-		TArray<FVertexBufferElement> VertexBufferElements;
+		struct FLayoutData : public TRefCountedObject<ESPMode::ThreadSafe>
+		{
+			/*
+			* Array of Vertex Buffer Elements.
+			*/
+			TArray<FVertexBufferElement> Elements;
+			/*
+			* Stride of All the elements combined.
+			* 
+			* [] = {1,2,3,4,5,6} = 2 vec3s
+			* Stride = 3
+			*/
+			uint32_t Stride{ 0 };
+		};
+
 		/*
-		* Stride of All the elements combined.
-		* 
-		* [] = {1,2,3,4,5,6} = 2 vec3s
-		* Stride = 3
+		* Shared layout data, nullptr for an empty layout.
 		*/
-		uint32_t Stride{ 0 };
+		TRefCountPtr<FLayoutData> LayoutData;
 	};
 
 	/*
 	* Platform and API independent Vertex Buffer Interface to be implemented per platform/API and in the AAEngine.
 	*/
-	class IVertexBuffer
+	class IVertexBuffer : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
@@ -192,7 +207,7 @@ namespace AAEngine {
 		* 
 		* @returns Layout of the Vertex Buffer (CVertexBufferLayout)
 		*/
-		CVertexBufferLayout GetLayout() const { return VertexBufferLayout; }
+		const CVertexBufferLayout& GetLayout() const { return VertexBufferLayout; }
 		/*
 		* Setter for the Layout of the Vertex Buffer
 		*
@@ -203,13 +218,12 @@ namespace AAEngine {
 		/*
 		* Static create method as create method doesn't vary based on instances.
 		* 
-		* @param Vertices - float pointer of Vertices. Array passed in as a pointer.
-		* @param Count - size_t Count of the vertices
+		* @param Vertices - View of the Vertices, uploaded to the GPU and not kept.
 		* @param EnumUsage - Usage of the buffer - Ex: OpenGL - GL_STATIC_DRAW
 		* 
 		* @returns A Platform indepentent Vertex Buffer
 		*/
-		static TSharedPtr<IVertexBuffer> Create(float* Vertices, uint32_t Count, uint32_t EnumUsage);
+		static TRefCountPtr<IVertexBuffer> Create(TConstArrayView<float> Vertices, uint32_t EnumUsage);
 	private:
 		/*
 		* Layout of the Vertex Buffer
@@ -220,7 +234,7 @@ namespace AAEngine {
 	/*
 	* Platform and API independent Index Buffer Interface to be implemented per platform/API and in the AAEngine.
 	*/
-	class IIndexBuffer
+	class IIndexBuffer : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
@@ -248,13 +262,12 @@ namespace AAEngine {
 		/*
 		* Static create method as create method doesn't vary based on instances.
 		*
-		* @param Indices - float pointer of Indices. Array passed in as a pointer.
-		* @param Count - size_t Count of the Indices
+		* @param Indices - View of the Indices, uploaded to the GPU and not kept.
 		* @param EnumUsage - Usage of the buffer - Ex: OpenGL - GL_STATIC_DRAW
 		* 
 		* @returns A Platform indepentent Index Buffer
 		*/
-		static TSharedPtr<IIndexBuffer> Create(uint32_t* Indices, uint32_t Count, uint32_t EnumUsage);
+		static TRefCountPtr<IIndexBuffer> Create(TConstArrayView<uint32_t> Indices, uint32_t EnumUsage);
 	};
 
 	enum class EAttachmentType
@@ -273,7 +286,10 @@ namespace AAEngine {
 	};
 
 	class ITexture2D;
-	class IFramebuffer
+	/*
+	* Platform and API independent Framebuffer Interface to be implemented per platform/API and in the AAEngine.
+	*/
+	class IFramebuffer : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
@@ -300,6 +316,6 @@ namespace AAEngine {
 		*
 		* @returns A Platform indepentent Index Buffer
 		*/
-		static TSharedPtr<IFramebuffer> Create(ITexture2D* Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex = 0, EFramebufferMode FramebufferMode = EFramebufferMode::FM_None);
+		static TRefCountPtr<IFramebuffer> Create(ITexture2D* Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex = 0, EFramebufferMode FramebufferMode = EFramebufferMode::FM_None);
 	};
 }
\ No newline at end of file
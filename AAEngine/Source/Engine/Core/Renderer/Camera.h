@@ -47,7 +47,7 @@ namespace AAEngine {
 			const FVector3f LookAtVector = Location + Rotation.ToVector();
 
 			ViewMatrix = FMatrix44f::LookAt(Location, LookAtVector, FVector3f(0.0f, 1.0f, 0.0f));
-			ViewMatrix.InverseFast();
+			ViewMatrix.InverseAffine();
 
 			bPropertiesDirtied = false;
 		}
@@ -8,6 +8,7 @@ namespace AAEngine {
 
 	void IModelLoader::LoadModel(const std::string& FileName, TArray<float>& OutVertices, TArray<uint32_t>& OutIndices, const CVertexBufferLayout& BufferLayout)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Assets);
 		switch (IRendererAPI::GetModelLoader())
 		{
 		case IRendererAPI::EModelLoader::None:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RendererAPI.h"
+#include "RenderResources.h"
 
 namespace AAEngine {
 
@@ -41,11 +42,14 @@ namespace AAEngine {
 		* Static Renderer API Call
 		* Static DrawIndexed method to Draw Vertices using an Indexed way (Indices).
 		*
-		* @param VertexArray - Vertex Array used to draw stuff
+		* @param VertexArray - Handle of the Vertex Array used to draw stuff, nothing is drawn if it was destroyed
 		*/
-		FORCEINLINE static void DrawIndexed(const TSharedPtr<IVertexArray>& VertexArray)
+		FORCEINLINE static void DrawIndexed(FVertexArrayHandle VertexArray)
 		{
-			RendererAPI->DrawIndexed(VertexArray);
+			if (IVertexArray* VertexArrayObject = CRenderResources::Get(VertexArray))
+			{
+				RendererAPI->DrawIndexed(*VertexArrayObject);
+			}
 		}
 
 	private:
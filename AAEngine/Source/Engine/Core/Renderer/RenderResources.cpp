@@ -0,0 +1,69 @@
+#include "AA_PreCompiledHeaders.h"
+#include "RenderResources.h"
+
+namespace AAEngine {
+
+	CRenderResources::TRenderResourcePool<IVertexBuffer> CRenderResources::VertexBuffers;
+	CRenderResources::TRenderResourcePool<IIndexBuffer> CRenderResources::IndexBuffers;
+	CRenderResources::TRenderResourcePool<IVertexArray> CRenderResources::VertexArrays;
+	CRenderResources::TRenderResourcePool<IFramebuffer> CRenderResources::Framebuffers;
+	CRenderResources::TRenderResourcePool<IShader> CRenderResources::Shaders;
+	CRenderResources::TRenderResourcePool<ITexture2D> CRenderResources::Textures2D;
+
+	FVertexBufferHandle CRenderResources::CreateVertexBuffer(TConstArrayView<float> Vertices, uint32_t EnumUsage)
+	{
+		return AddResource(VertexBuffers, IVertexBuffer::Create(Vertices, EnumUsage));
+	}
+
+	FIndexBufferHandle CRenderResources::CreateIndexBuffer(TConstArrayView<uint32_t> Indices, uint32_t EnumUsage)
+	{
+		return AddResource(IndexBuffers, IIndexBuffer::Create(Indices, EnumUsage));
+	}
+
+	FVertexArrayHandle CRenderResources::CreateVertexArray()
+	{
+		return AddResource(VertexArrays, IVertexArray::Create());
+	}
+
+	FFramebufferHandle CRenderResources::CreateFramebuffer(FTexture2DHandle Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex, EFramebufferMode FramebufferMode)
+	{
+		return AddResource(Framebuffers, IFramebuffer::Create(Get(Texture), FramebufferAttachmentType, ColorAttachmentIndex, FramebufferMode));
+	}
+
+	FShaderHandle CRenderResources::CreateShader(const std::string& ShaderFilePath)
+	{
+		return AddResource(Shaders, IShader::Create(ShaderFilePath));
+	}
+
+	FShaderHandle CRenderResources::CreateShader(const std::string& ShaderName, const std::string& ShaderFilePath)
+	{
+		return AddResource(Shaders, IShader::Create(ShaderName, ShaderFilePath));
+	}
+
+	FShaderHandle CRenderResources::CreateShader(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource)
+	{
+		return AddResource(Shaders, IShader::Create(ShaderName, VertexShaderSource, FragmentShaderSource));
+	}
+
+	FTexture2DHandle CRenderResources::CreateTexture2D(const std::string& FilePath)
+	{
+		return AddResource(Textures2D, ITexture2D::Create(FilePath));
+	}
+
+	void CRenderResources::DestroyAll()
+	{
+		// Vertex arrays first, they destroy the buffers they own themselves
+		VertexArrays.Clear();
+		VertexBuffers.Clear();
+		IndexBuffers.Clear();
+		// Framebuffers before the textures they draw into
+		Framebuffers.Clear();
+		Textures2D.Clear();
+		Shaders.Clear();
+	}
+
+	size_t CRenderResources::GetNumResources()
+	{
+		return VertexBuffers.Num() + IndexBuffers.Num() + VertexArrays.Num() + Framebuffers.Num() + Shaders.Num() + Textures2D.Num();
+	}
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Buffer.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "VertexArray.h"
+
+namespace AAEngine {
+
+	/*
+	* Owner of every GPU resource, handing out generational handles (FVertexBufferHandle, FShaderHandle, ...) instead of pointers.
+	* Each resource type lives in a TResourcePool, so checking or resolving a handle is an array lookup and
+	* destroying everything on unload / shutdown is one Clear per pool.
+	* A destroyed resource leaves its handles stale, Get returns nullptr for them instead of a dangling object.
+	* NOTE: Only used from the thread owning the rendering context.
+	*/
+	class CRenderResources
+	{
+	public:
+		/*
+		* Creates a Vertex Buffer, see IVertexBuffer::Create.
+		*
+		* @returns Handle to the Vertex Buffer, null if it couldn't be created.
+		*/
+		static FVertexBufferHandle CreateVertexBuffer(TConstArrayView<float> Vertices, uint32_t EnumUsage);
+
+		/*
+		* Creates an Index Buffer, see IIndexBuffer::Create.
+		*
+		* @returns Handle to the Index Buffer, null if it couldn't be created.
+		*/
+		static FIndexBufferHandle CreateIndexBuffer(TConstArrayView<uint32_t> Indices, uint32_t EnumUsage);
+
+		/*
+		* Creates a Vertex Array, see IVertexArray::Create.
+		* The buffers added to the Vertex Array are destroyed with it.
+		*
+		* @returns Handle to the Vertex Array, null if it couldn't be created.
+		*/
+		static FVertexArrayHandle CreateVertexArray();
+
+		/*
+		* Creates a Framebuffer drawing into a texture, see IFramebuffer::Create.
+		*
+		* @returns Handle to the Framebuffer, null if it couldn't be created.
+		*/
+		static FFramebufferHandle CreateFramebuffer(FTexture2DHandle Texture, EAttachmentType FramebufferAttachmentType, uint32_t ColorAttachmentIndex = 0, EFramebufferMode FramebufferMode = EFramebufferMode::FM_None);
+
+		/*
+		* Creates a Shader from a file, see IShader::Create.
+		*
+		* @returns Handle to the Shader, null if it couldn't be created.
+		*/
+		static FShaderHandle CreateShader(const std::string& ShaderFilePath);
+		static FShaderHandle CreateShader(const std::string& ShaderName, const std::string& ShaderFilePath);
+
+		/*
+		* Creates a Shader from source code, see IShader::Create.
+		*
+		* @returns Handle to the Shader, null if it couldn't be created.
+		*/
+		static FShaderHandle CreateShader(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource);
+
+		/*
+		* Creates a 2D Texture from an image file, see ITexture2D::Create.
+		*
+		* @returns Handle to the Texture, null if it couldn't be created.
+		*/
+		static FTexture2DHandle CreateTexture2D(const std::string& FilePath);
+
+		/*
+		* Resolves a handle.
+		*
+		* @returns The resource, nullptr if the handle is null or the resource was destroyed.
+		*/
+		template<typename ResourceType>
+		FORCEINLINE static ResourceType* Get(TResourceHandle<ResourceType> Handle)
+		{
+			TRefCountPtr<ResourceType>* Resource = GetPool(Handle).Get(Handle);
+			return Resource ? Resource->Get() : nullptr;
+		}
+
+		/*
+		* @returns true if the resource of a handle is alive.
+		*/
+		template<typename ResourceType>
+		FORCEINLINE static bool IsValid(TResourceHandle<ResourceType> Handle)
+		{
+			return GetPool(Handle).IsValid(Handle);
+		}
+
+		/*
+		* Destroys the resource of a handle, destroying a stale or null handle does nothing.
+		*
+		* @returns true if a resource was destroyed.
+		*/
+		template<typename ResourceType>
+		static bool Destroy(TResourceHandle<ResourceType> Handle)
+		{
+			return GetPool(Handle).Remove(Handle);
+		}
+
+		/*
+		* Destroys every resource, e.g. when a level is unloaded. Every handle is stale after.
+		*/
+		static void DestroyAll();
+
+		/*
+		* @returns Number of resources alive, of every type.
+		*/
+		static size_t GetNumResources();
+
+	private:
+		template<typename ResourceType>
+		using TRenderResourcePool = TResourcePool<TRefCountPtr<ResourceType>, ResourceType>;
+
+		/*
+		* Pool of a resource type, picked by the type of the handle.
+		*/
+		FORCEINLINE static TRenderResourcePool<IVertexBuffer>& GetPool(FVertexBufferHandle)	{ return VertexBuffers; }
+		FORCEINLINE static TRenderResourcePool<IIndexBuffer>& GetPool(FIndexBufferHandle)	{ return IndexBuffers; }
+		FORCEINLINE static TRenderResourcePool<IVertexArray>& GetPool(FVertexArrayHandle)	{ return VertexArrays; }
+		FORCEINLINE static TRenderResourcePool<IFramebuffer>& GetPool(FFramebufferHandle)	{ return Framebuffers; }
+		FORCEINLINE static TRenderResourcePool<IShader>& GetPool(FShaderHandle)				{ return Shaders; }
+		FORCEINLINE static TRenderResourcePool<ITexture2D>& GetPool(FTexture2DHandle)		{ return Textures2D; }
+
+		/*
+		* Adds a resource that was just created to its pool.
+		*
+		* @returns Handle to the resource, null if Resource is null.
+		*/
+		template<typename ResourceType>
+		static TResourceHandle<ResourceType> AddResource(TRenderResourcePool<ResourceType>& Pool, TRefCountPtr<ResourceType>&& Resource)
+		{
+			return Resource ? Pool.Add(Move(Resource)) : TResourceHandle<ResourceType>();
+		}
+
+	private:
+		static TRenderResourcePool<IVertexBuffer> VertexBuffers;
+		static TRenderResourcePool<IIndexBuffer> IndexBuffers;
+		static TRenderResourcePool<IVertexArray> VertexArrays;
+		static TRenderResourcePool<IFramebuffer> Framebuffers;
+		static TRenderResourcePool<IShader> Shaders;
+		static TRenderResourcePool<ITexture2D> Textures2D;
+	};
+}
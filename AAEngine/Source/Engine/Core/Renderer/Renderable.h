@@ -11,12 +11,17 @@ namespace AAEngine {
 		*/
 		virtual void Render() = 0;
 
-		virtual void UpdateModelMatrix() {};
+		const FTransformf& GetTransform() const { return Transform; }
 
-		const FMatrix44f& GetModelMatrix() const { return ModelMatrix; }
+		void SetTransform(const FTransformf& InTransform) { Transform = InTransform; }
+
+		/*
+		* Matrix of the transform, rebuilt only after the transform changed.
+		*/
+		const FMatrix44f& GetModelMatrix() const { return Transform.GetMatrix(); }
 
 	private:
 
-		FMatrix44f ModelMatrix = FMatrix44f::IdentityMatrix;
+		FTransformf Transform;
 	};
 }
\ No newline at end of file
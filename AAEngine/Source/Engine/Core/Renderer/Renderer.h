@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderCommand.h"
+#include "RenderResources.h"
 #include "RendererCommons.h"
 #include "Renderable.h"
 #include "Camera.h"
@@ -35,10 +36,14 @@ namespace AAEngine {
 		/*
 		* Sending Scene Uniforms to the Shader
 		*/
-		static void UploadSceneUniforms(const TSharedPtr<IShader>& Shader)
+		static void UploadSceneUniforms(FShaderHandle ShaderHandle)
 		{
-			Shader->UploadUniformMat4("ViewMatrix", SceneData->FrameShaderData.ViewMatrix);
-			Shader->UploadUniformMat4("ProjectionMatrix", SceneData->FrameShaderData.ProjectionMatrix);
+			static const FName ViewMatrixName("ViewMatrix");
+			static const FName ProjectionMatrixName("ProjectionMatrix");
+			IShader* Shader = CRenderResources::Get(ShaderHandle);
+			AA_CORE_ASSERT(Shader, "Uploading uniforms to a destroyed Shader!");
+			Shader->UploadUniformMat4(ViewMatrixName, SceneData->FrameShaderData.ViewMatrix);
+			Shader->UploadUniformMat4(ProjectionMatrixName, SceneData->FrameShaderData.ProjectionMatrix);
 		}
 
 		/*
@@ -51,10 +56,13 @@ namespace AAEngine {
 		* 
 		* @param Vertex Array
 		*/
-		static void Submit(const TSharedPtr<IShader>& Shader, const TSharedPtr<IRenderable>& RenderableObject)
+		static void Submit(FShaderHandle ShaderHandle, const TSharedPtr<IRenderable>& RenderableObject)
 		{
 			FMatrix44f Transform = FMatrix44f::MakeFromLocation(FVector3f(0.0f, 0.0f, 5.0f)); // FMatrix44f::MakeFromRotationXYZ(Rotation) * FMatrix44f::MakeFromLocation(Position);
-			Shader->UploadUniformMat4("ModelMatrix", RenderableObject->GetModelMatrix());
+			static const FName ModelMatrixName("ModelMatrix");
+			IShader* Shader = CRenderResources::Get(ShaderHandle);
+			AA_CORE_ASSERT(Shader, "Submitting with a destroyed Shader!");
+			Shader->UploadUniformMat4(ModelMatrixName, RenderableObject->GetModelMatrix());
 			RenderableObject->Render();
 		}
 
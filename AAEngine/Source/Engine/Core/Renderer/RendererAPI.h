@@ -46,7 +46,7 @@ namespace AAEngine {
 		* 
 		* @param VertexArray - Vertex Array used to draw stuff
 		*/
-		virtual void DrawIndexed(const TSharedPtr<IVertexArray>& VertexArray) = 0;
+		virtual void DrawIndexed(IVertexArray& VertexArray) = 0;
 
 		/*
 		* Static GetAPI method to get the Currently used Graphics API
@@ -4,16 +4,19 @@
 
 namespace AAEngine {
     
-	TSharedPtr<IVertexArray> CRendererUtils::MakeVertexArray(const TArray<float>& Vertices, const TArray<uint32_t>& Indices, const CVertexBufferLayout& BufferLayout)
+	FVertexArrayHandle CRendererUtils::MakeVertexArray(TConstArrayView<float> Vertices, TConstArrayView<uint32_t> Indices, const CVertexBufferLayout& BufferLayout)
     {
-		TSharedPtr<IVertexArray> VertexArray = IVertexArray::Create();
+		FVertexArrayHandle VertexArray = CRenderResources::CreateVertexArray();
 
-		TSharedPtr<IVertexBuffer> VertexBuffer = IVertexBuffer::Create(const_cast<float*>(Vertices.Data()), static_cast<uint32_t>(Vertices.Num()), 0);
-		TSharedPtr<IIndexBuffer> IndexBuffer = IIndexBuffer::Create(const_cast<uint32_t*>(Indices.Data()), static_cast<uint32_t>(Indices.Num()), 0);
+		FVertexBufferHandle VertexBuffer = CRenderResources::CreateVertexBuffer(Vertices, 0);
+		FIndexBufferHandle IndexBuffer = CRenderResources::CreateIndexBuffer(Indices, 0);
 
-		VertexBuffer->SetLayout(BufferLayout);
-		VertexArray->AddVertexBuffer(VertexBuffer);
-		VertexArray->SetIndexBuffer(IndexBuffer);
+		CRenderResources::Get(VertexBuffer)->SetLayout(BufferLayout);
+
+		// The vertex array owns its buffers from here on
+		IVertexArray* VertexArrayObject = CRenderResources::Get(VertexArray);
+		VertexArrayObject->AddVertexBuffer(VertexBuffer);
+		VertexArrayObject->SetIndexBuffer(IndexBuffer);
 
 		return VertexArray;
     }
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Math/MathIncludes.h"
+#include "Core/Containers/ArrayView.h"
 
 namespace AAEngine {
 
@@ -23,13 +24,34 @@ namespace AAEngine {
 		VI_BiTangent,
 	};
 
+	class IVertexBuffer;
+	class IIndexBuffer;
 	class IVertexArray;
+	class IFramebuffer;
+	class IShader;
+	class ITexture2D;
 	class CVertexBufferLayout;
+
+	/*
+	* Handles to the GPU resources owned by CRenderResources.
+	*/
+	using FVertexBufferHandle	= TResourceHandle<IVertexBuffer>;
+	using FIndexBufferHandle	= TResourceHandle<IIndexBuffer>;
+	using FVertexArrayHandle	= TResourceHandle<IVertexArray>;
+	using FFramebufferHandle	= TResourceHandle<IFramebuffer>;
+	using FShaderHandle			= TResourceHandle<IShader>;
+	using FTexture2DHandle		= TResourceHandle<ITexture2D>;
+
 	class CRendererUtils
 	{
 	public:
 
-		static TSharedPtr<IVertexArray> MakeVertexArray(const TArray<float>& Vertices, const TArray<uint32_t>& Indices, const CVertexBufferLayout& BufferLayout);
+		/*
+		* Uploads vertices and indices into a new Vertex Array, the data is read straight from the views and not kept.
+		*
+		* @returns Handle to the Vertex Array, which owns its Vertex and Index Buffer.
+		*/
+		static FVertexArrayHandle MakeVertexArray(TConstArrayView<float> Vertices, TConstArrayView<uint32_t> Indices, const CVertexBufferLayout& BufferLayout);
 
 		static char* GetVertexInputName(EVertexInputType VertexInput);
 
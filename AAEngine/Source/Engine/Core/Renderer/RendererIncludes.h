@@ -5,6 +5,7 @@
 #include "Core/Renderer/Renderer.h"
 #include "Core/Renderer/RendererAPI.h"
 #include "Core/Renderer/RenderCommand.h"
+#include "Core/Renderer/RenderResources.h"
 #include "Core/Renderer/RenderingContext.h"
 #include "Core/Renderer/Shader.h"
 #include "Core/Renderer/VertexArray.h"
\ No newline at end of file
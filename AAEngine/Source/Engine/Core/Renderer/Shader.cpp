@@ -2,6 +2,7 @@
 #include "Shader.h"
 
 #include "Renderer.h"
+#include "RenderResources.h"
 
 #include "Platform/OpenGL/OpenGLShader.h"
 
@@ -9,57 +10,61 @@ namespace AAEngine {
 
 	// ---------- SHADER ---------------------------
 
-	TSharedPtr<IShader> IShader::Create(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource)
+	TRefCountPtr<IShader> IShader::Create(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLShader>(ShaderName, VertexShaderSource, FragmentShaderSource);
+			return MakeRefCount<COpenGLShader>(ShaderName, VertexShaderSource, FragmentShaderSource);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
 	}
 
-	TSharedPtr<IShader> IShader::Create(const std::string& ShaderFilePath)
+	TRefCountPtr<IShader> IShader::Create(const std::string& ShaderFilePath)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLShader>(ShaderFilePath);
+			return MakeRefCount<COpenGLShader>(ShaderFilePath);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
 	}
 
-	TSharedPtr<IShader> IShader::Create(const std::string& ShaderName, const std::string& ShaderFilePath)
+	TRefCountPtr<IShader> IShader::Create(const std::string& ShaderName, const std::string& ShaderFilePath)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLShader>(ShaderName, ShaderFilePath);
+			return MakeRefCount<COpenGLShader>(ShaderName, ShaderFilePath);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
 	}
 
-	TSharedPtr<IShader> IShader::Create(std::string&& ShaderName, const std::string& ShaderFilePath)
+	TRefCountPtr<IShader> IShader::Create(std::string&& ShaderName, const std::string& ShaderFilePath)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLShader>(Move(ShaderName), ShaderFilePath);
+			return MakeRefCount<COpenGLShader>(Move(ShaderName), ShaderFilePath);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
@@ -67,46 +72,44 @@ namespace AAEngine {
 
 	// ---------- SHADER LIBRARY -------------------
 	
-	void CShaderLibrary::AddShader(const std::string& ShaderName, const TSharedPtr<IShader>& NewShader)
+	void CShaderLibrary::AddShader(FName ShaderName, FShaderHandle NewShader)
 	{
 		AA_CORE_ASSERT(!Exists(ShaderName), "Shader already exists!");
 		ShaderLibrary[ShaderName] = NewShader;
 	}
 
-	void CShaderLibrary::AddShader(const TSharedPtr<IShader>& NewShader)
+	void CShaderLibrary::AddShader(FShaderHandle NewShader)
 	{
-		const std::string& ShaderName = NewShader->GetName();
-		AddShader(ShaderName, NewShader);
+		AddShader(CRenderResources::Get(NewShader)->GetName(), NewShader);
 	}
 
-	TSharedPtr<IShader> CShaderLibrary::LoadShader(const std::string& ShaderName, const std::string& VertexSource, const std::string& FragmentSource)
+	FShaderHandle CShaderLibrary::LoadShader(const std::string& ShaderName, const std::string& VertexSource, const std::string& FragmentSource)
 	{
-		TSharedPtr<IShader> Shader = IShader::Create(ShaderName, VertexSource, FragmentSource);
+		FShaderHandle Shader = CRenderResources::CreateShader(ShaderName, VertexSource, FragmentSource);
 		AddShader(ShaderName, Shader);
 		return Shader;
 	}
 
-	TSharedPtr<IShader> CShaderLibrary::LoadShader(const std::string& ShaderName, const std::string& FilePath)
+	FShaderHandle CShaderLibrary::LoadShader(const std::string& ShaderName, const std::string& FilePath)
 	{
-		TSharedPtr<IShader> Shader = IShader::Create(ShaderName, FilePath);
+		FShaderHandle Shader = CRenderResources::CreateShader(ShaderName, FilePath);
 		AddShader(ShaderName, Shader);
 		return Shader;
 	}
 
-	TSharedPtr<IShader> CShaderLibrary::LoadShader(const std::string& FilePath)
+	FShaderHandle CShaderLibrary::LoadShader(const std::string& FilePath)
 	{
-		TSharedPtr<IShader> Shader = IShader::Create(FilePath);
-		std::string ShaderName = Shader->GetName();
-		AddShader(ShaderName, Shader);
+		FShaderHandle Shader = CRenderResources::CreateShader(FilePath);
+		AddShader(CRenderResources::Get(Shader)->GetName(), Shader);
 		return Shader;
 	}
-	TSharedPtr<IShader> CShaderLibrary::GetShader(const std::string& ShaderName)
+	FShaderHandle CShaderLibrary::GetShader(FName ShaderName)
 	{
 		AA_CORE_ASSERT(Exists(ShaderName), "Shader doesn't exist!");
 		return ShaderLibrary[ShaderName];
 	}
-	bool CShaderLibrary::Exists(const std::string& ShaderName)
+	bool CShaderLibrary::Exists(FName ShaderName)
 	{
-		return ShaderLibrary.find(ShaderName) != ShaderLibrary.end();
+		return ShaderLibrary.Contains(ShaderName);
 	}
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RendererCommons.h"
+
 namespace AAEngine {
 
 #define AA_NUM_SHADER_TYPES 2
@@ -79,8 +81,9 @@ namespace AAEngine {
 
 	/*
 	* Platform and API independent Shader Interface to be implemented per platform/API and in the AAEngine.
+	* Held with TRefCountPtr like every GPU resource, the count isn't atomic as GPU resources only live on the thread owning the rendering context.
 	*/
-	class IShader
+	class IShader : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
@@ -103,18 +106,18 @@ namespace AAEngine {
 		* 
 		* @returns Name of the Shader.
 		*/
-		virtual std::string GetName() = 0;
+		virtual FName GetName() = 0;
 
 		/*
 		* Upload uniform functions with params as uniform name and specified data to the shader.
 		*
-		* @param UniformName - name of the uniform variable.
+		* @param UniformName - name of the uniform variable, keep the FName around instead of building it from a string every upload.
 		* @param DataType - varying from Int to Vec4 to Mat4 - data to be uploaded to the uniform variable
 		*/
-		virtual void UploadUniformInt(const char* UniformName, int Value) = 0;
-		virtual void UploadUniformVec3(const char* UniformName, const FVector3f& Value) = 0;
-		virtual void UploadUniformVec4(const char* UniformName, const FVector4f& Value) = 0;
-		virtual void UploadUniformMat4(const char* UniformName, const FMatrix44f& Value) = 0;
+		virtual void UploadUniformInt(FName UniformName, int Value) = 0;
+		virtual void UploadUniformVec3(FName UniformName, const FVector3f& Value) = 0;
+		virtual void UploadUniformVec4(FName UniformName, const FVector4f& Value) = 0;
+		virtual void UploadUniformMat4(FName UniformName, const FMatrix44f& Value) = 0;
 
 		/*
 		* Static create method as create method doesn't vary based on instances.
@@ -125,7 +128,7 @@ namespace AAEngine {
 		* 
 		* @returns Pointer Ref to the Shader that was created
 		*/
-		static TSharedPtr<IShader> Create(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource);
+		static TRefCountPtr<IShader> Create(const std::string& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource);
 		/*
 		* Static create method as create method doesn't vary based on instances.
 		*
@@ -133,7 +136,7 @@ namespace AAEngine {
 		* 
 		* @returns Pointer Ref to the Shader that was created
 		*/
-		static TSharedPtr<IShader> Create(const std::string& ShaderFilePath);
+		static TRefCountPtr<IShader> Create(const std::string& ShaderFilePath);
 		/*
 		* Static create method as create method doesn't vary based on instances.
 		*
@@ -142,8 +145,8 @@ namespace AAEngine {
 		*
 		* @returns Pointer Ref to the Shader that was created
 		*/
-		static TSharedPtr<IShader> Create(const std::string& ShaderName, const std::string& ShaderFilePath);
-		static TSharedPtr<IShader> Create(std::string&& ShaderName, const std::string& ShaderFilePath);
+		static TRefCountPtr<IShader> Create(const std::string& ShaderName, const std::string& ShaderFilePath);
+		static TRefCountPtr<IShader> Create(std::string&& ShaderName, const std::string& ShaderFilePath);
 
 
 		static std::string ExtractShaderNameFromFilePath(const std::string& ShaderFilePath)
@@ -218,15 +221,15 @@ namespace AAEngine {
 		* Function to add a shader to the Shader Library.
 		* 
 		* @param ShaderName - Name of the Shader to add to the Library.
-		* @param NewShader - Shader Ref to add to the Library.
+		* @param NewShader - Shader Handle to add to the Library.
 		*/
-		void AddShader(const std::string& ShaderName, const TSharedPtr<IShader>& NewShader);
+		void AddShader(FName ShaderName, FShaderHandle NewShader);
 		/*
 		* Function to add a shader to the Shader Library.
 		*
-		* @param NewShader - Shader Ref to add to the Library.
+		* @param NewShader - Shader Handle to add to the Library.
 		*/
-		void AddShader(const TSharedPtr<IShader>& NewShader);
+		void AddShader(FShaderHandle NewShader);
 
 		/*
 		* Function to load a shader into the Shader Library based on Vertex and Fragment Source code as String.
@@ -235,35 +238,35 @@ namespace AAEngine {
 		* @param VertexShaderSource - std::string of the Vertex Shader Code.
 		* @param FragmentShaderSource - std::string of the Fragment Shader Code.
 		* 
-		* @returns Shader Ref to the Loaded shader.
+		* @returns Shader Handle to the Loaded shader.
 		*/
-		TSharedPtr<IShader> LoadShader(const std::string& ShaderName, const std::string& VertexSource, const std::string& FragmentSource);
+		FShaderHandle LoadShader(const std::string& ShaderName, const std::string& VertexSource, const std::string& FragmentSource);
 		/*
 		* Function to load a shader into the Shader Library based on FilePath.
 		*
 		* @param ShaderName - Name of the Shader to add to the Library.
 		* @param FilePath - std::string of the Path to the Shader.
 		*
-		* @returns Shader Ref to the Loaded shader.
+		* @returns Shader Handle to the Loaded shader.
 		*/
-		TSharedPtr<IShader> LoadShader(const std::string& ShaderName, const std::string& FilePath);
+		FShaderHandle LoadShader(const std::string& ShaderName, const std::string& FilePath);
 		/*
 		* Function to load a shader into the Shader Library based on FilePath, Shader Name will be file name.
 		*
 		* @param FilePath - std::string of the Path to the Shader.
 		*
-		* @returns Shader Ref to the Loaded shader.
+		* @returns Shader Handle to the Loaded shader.
 		*/
-		TSharedPtr<IShader> LoadShader(const std::string& FilePath);
+		FShaderHandle LoadShader(const std::string& FilePath);
 
 		/*
 		* Function to get a Shader from the Shader Library by Shader Name
 		*
 		* @param ShaderName - Name of the Shader to get from the Library.
 		*
-		* @returns Shader Ref to the Loaded shader.
+		* @returns Shader Handle to the Loaded shader, stale if the shader was destroyed.
 		*/
-		TSharedPtr<IShader> GetShader(const std::string& ShaderName);
+		FShaderHandle GetShader(FName ShaderName);
 		
 		/*
 		* Function to get a Shader from the Shader Library by Shader Name
@@ -272,13 +275,13 @@ namespace AAEngine {
 		*
 		* @returns true if Shader with Name exists false otherwise 
 		*/
-		bool Exists(const std::string& ShaderName);
+		bool Exists(FName ShaderName);
 
 	private:
 		/*
 		* Hash Map like structure to store Shaders based on their names.
 		*/
-		TMap<std::string, TSharedPtr<IShader>> ShaderLibrary;
+		TMap<FName, FShaderHandle> ShaderLibrary;
 	};
 
 
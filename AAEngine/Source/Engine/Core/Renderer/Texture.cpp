@@ -7,15 +7,16 @@
 
 namespace AAEngine {
 	
-	TSharedPtr<ITexture2D> ITexture2D::Create(const std::string& FilePath)
+	TRefCountPtr<ITexture2D> ITexture2D::Create(const std::string& FilePath)
 	{
+		FMemoryTagScope MemoryTag(EMemoryTag::Assets);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLTexture2D>(FilePath);
+			return MakeRefCount<COpenGLTexture2D>(FilePath);
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
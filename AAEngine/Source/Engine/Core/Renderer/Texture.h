@@ -7,7 +7,7 @@ namespace AAEngine {
 	/*
 	* Platform Independent Texture Class
 	*/
-	class ITexture
+	class ITexture : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
@@ -49,6 +49,6 @@ namespace AAEngine {
 		*
 		* @returns A Platform indepentent Texture 2D Ref
 		*/
-		static TSharedPtr<ITexture2D> Create(const std::string& FilePath);
+		static TRefCountPtr<ITexture2D> Create(const std::string& FilePath);
 	};
 }
\ No newline at end of file
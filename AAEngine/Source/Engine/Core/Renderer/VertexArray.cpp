@@ -1,19 +1,30 @@
 #include "AA_PreCompiledHeaders.h"
 #include "VertexArray.h"
 #include "RendererAPI.h"
+#include "RenderResources.h"
 
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
 namespace AAEngine {
-	TSharedPtr<IVertexArray> IVertexArray::Create()
+	IVertexArray::~IVertexArray()
+	{
+		for (FVertexBufferHandle VertexBuffer : VertexBuffers)
+		{
+			CRenderResources::Destroy(VertexBuffer);
+		}
+		CRenderResources::Destroy(IndexBuffer);
+	}
+
+	TRefCountPtr<IVertexArray> IVertexArray::Create()
     {
+		FMemoryTagScope MemoryTag(EMemoryTag::Renderer);
 		switch (IRendererAPI::GetAPI())
 		{
 		case IRendererAPI::EAPI::None:
 			AA_CORE_ASSERT(false, "None API Specified!");
 			return nullptr;
 		case IRendererAPI::EAPI::OpenGL:
-			return MakeShared<COpenGLVertexArray>();
+			return MakeRefCount<COpenGLVertexArray>();
 		}
 		AA_CORE_ASSERT(false, "Unknown API Specified!");
 		return nullptr;
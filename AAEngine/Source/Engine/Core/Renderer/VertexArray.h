@@ -7,13 +7,14 @@ namespace AAEngine {
 	/*
 	* Platform and API independent Vertex Array Interface to be implemented per platform/API and in the AAEngine.
 	*/
-	class IVertexArray
+	class IVertexArray : public TRefCountedObject<ESPMode::NotThreadSafe>
 	{
 	public:
 		/*
 		* Virtual Destructor as we know we will have derived classes
+		* Destroys the Vertex and Index Buffers attached to the Vertex Array.
 		*/
-		virtual ~IVertexArray() {}
+		virtual ~IVertexArray();
 
 		/*
 		* Pure virtual Bind function to Bind to the Vertex Array.
@@ -27,29 +28,37 @@ namespace AAEngine {
 
 		/*
 		* Pure virtual AddVertexBuffer function to Add a Vertex Buffer to the Vertex Array object.
+		* The Vertex Array takes ownership of the Vertex Buffer.
 		* 
-		* @param VertexBuffer - Shared Pointer of the Vertex Buffer
+		* @param VertexBuffer - Handle of the Vertex Buffer
 		*/
-		virtual void AddVertexBuffer(const TSharedPtr<IVertexBuffer>& VertexBuffer) = 0;
+		virtual void AddVertexBuffer(FVertexBufferHandle VertexBuffer) = 0;
 		/*
 		* Pure virtual SetIndexBuffer function to Set the Index Buffer of the Vertex Array object.
+		* The Vertex Array takes ownership of the Index Buffer.
 		*
-		* @param IndexBuffer - Shared Pointer of the Index Buffer
+		* @param IndexBuffer - Handle of the Index Buffer
 		*/
-		virtual void SetIndexBuffer(const TSharedPtr<IIndexBuffer>& IndexBuffer) = 0;
+		virtual void SetIndexBuffer(FIndexBufferHandle IndexBuffer) = 0;
 
 		/*
 		* Const getter GetVertexBuffers function to get the Vertex Buffers attached to this Vertex Array.
 		*
-		* @returns Array of Vertex Buffers of this Vertex Array
+		* @returns View of the Vertex Buffer handles of this Vertex Array
 		*/
-		const TArray<TSharedPtr<IVertexBuffer>>& GetVertexBuffers() const { return VertexBuffers; }
+		TConstArrayView<FVertexBufferHandle> GetVertexBuffers() const { return VertexBuffers; }
 		/*
 		* Const getter GetIndexBuffer function to get the Index Buffer attached to this Vertex Array.
 		*
-		* @returns Index Buffer of this Vertex Array
+		* @returns Index Buffer handle of this Vertex Array
 		*/
-		const TSharedPtr<IIndexBuffer>& GetIndexBuffer() const { return IndexBuffer; }
+		FIndexBufferHandle GetIndexBuffer() const { return IndexBuffer; }
+		/*
+		* Const getter GetIndexCount function, cached when the Index Buffer is set so drawing doesn't resolve the Index Buffer.
+		*
+		* @returns Number of Indices to draw
+		*/
+		uint32_t GetIndexCount() const { return IndexCount; }
 
 		/*
 		* Static create method as create method doesn't vary based on instances.
@@ -60,15 +69,19 @@ namespace AAEngine {
 		* 
 		* @returns A Platform indepentent Vertex Array
 		*/
-		static TSharedPtr<IVertexArray> Create();
+		static TRefCountPtr<IVertexArray> Create();
 	protected:
 		/*
-		* Pointer to the Index Buffer linked to the vertex Array
+		* Handle to the Index Buffer linked to the vertex Array
+		*/
+		FIndexBufferHandle IndexBuffer;
+		/*
+		* Number of Indices of the Index Buffer
 		*/
-		TSharedPtr<IIndexBuffer> IndexBuffer;
+		uint32_t IndexCount = 0;
 		/*
-		* Array of Pointers to the Vertex Buffers linked to the vertex Array
+		* Array of Handles to the Vertex Buffers linked to the vertex Array
 		*/
-		TArray<TSharedPtr<IVertexBuffer>> VertexBuffers;
+		TArray<FVertexBufferHandle> VertexBuffers;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "AA_PreCompiledHeaders.h"
+#include "Name.h"
+
+#include <mutex>
+#include <shared_mutex>
+
+/*
+* Name entries per chunk of the name table, chunks are never moved so entries can be read without locking.
+*/
+#define NAME_ENTRIES_PER_CHUNK 4096
+#define NAME_MAX_CHUNKS 256
+/*
+* Size of the blocks the characters of the names are copied into.
+*/
+#define NAME_CHARACTER_BLOCK_SIZE (64 * 1024)
+
+namespace AAEngine {
+
+	/*
+	* Global table of every FName string.
+	* Lookups take a shared lock, adding a new name takes an exclusive lock.
+	* Reading the characters of an existing FName takes no lock: entries and characters never move or change once written,
+	* and an FName can only be obtained after its entry was written.
+	*/
+	class CNamePool
+	{
+	public:
+		static CNamePool& Get()
+		{
+			static CNamePool NamePool;
+			return NamePool;
+		}
+
+		/*
+		* @returns Index of InName's entry, adds it when bAdd is true and it isn't in the table yet, 0 if it isn't and bAdd is false.
+		*/
+		uint32_t FindOrAdd(std::string_view InName, bool bAdd)
+		{
+			if (InName.empty())
+			{
+				return 0;
+			}
+
+			{
+				std::shared_lock<std::shared_mutex> Lock(PoolMutex);
+				if (const uint32_t* Found = Lookup.FindValue(InName))
+				{
+					return *Found;
+				}
+			}
+
+			if (!bAdd)
+			{
+				return 0;
+			}
+
+			std::unique_lock<std::shared_mutex> Lock(PoolMutex);
+			// Another thread may have added it between the locks
+			if (const uint32_t* Found = Lookup.FindValue(InName))
+			{
+				return *Found;
+			}
+
+			AA_CORE_ASSERT(NumEntries < NAME_ENTRIES_PER_CHUNK * NAME_MAX_CHUNKS, "Name table is full!");
+			const uint32_t NewIndex = NumEntries;
+			const uint32_t ChunkIndex = NewIndex / NAME_ENTRIES_PER_CHUNK;
+			if (!EntryChunks[ChunkIndex])
+			{
+				EntryChunks[ChunkIndex] = new std::string_view[NAME_ENTRIES_PER_CHUNK];
+			}
+
+			const std::string_view StoredName = CopyCharacters(InName);
+			EntryChunks[ChunkIndex][NewIndex % NAME_ENTRIES_PER_CHUNK] = StoredName;
+			Lookup.Add(StoredName, NewIndex);
+			NumEntries++;
+			return NewIndex;
+		}
+
+		/*
+		* @returns Characters of the entry at Index.
+		*/
+		FORCEINLINE std::string_view GetEntry(uint32_t Index) const noexcept
+		{
+			return EntryChunks[Index / NAME_ENTRIES_PER_CHUNK][Index % NAME_ENTRIES_PER_CHUNK];
+		}
+
+	private:
+		CNamePool()
+		{
+			// Entry 0 is None
+			EntryChunks[0] = new std::string_view[NAME_ENTRIES_PER_CHUNK];
+			EntryChunks[0][0] = std::string_view("", 0);
+			NumEntries = 1;
+		}
+
+		CNamePool(const CNamePool&) = delete;
+		CNamePool& operator=(const CNamePool&) = delete;
+
+		/*
+		* Copies InName (null terminated) into the current character block, starts a new block when it doesn't fit.
+		*/
+		std::string_view CopyCharacters(std::string_view InName)
+		{
+			const size_t Bytes = InName.size() + 1;
+			if (!CurrentBlock || BlockOffset + Bytes > NAME_CHARACTER_BLOCK_SIZE)
+			{
+				const size_t BlockSize = Bytes > NAME_CHARACTER_BLOCK_SIZE ? Bytes : NAME_CHARACTER_BLOCK_SIZE;
+				CurrentBlock = new char[BlockSize];
+				BlockOffset = 0;
+			}
+
+			char* Characters = CurrentBlock + BlockOffset;
+			FMemory::MemCopy(Characters, InName.data(), InName.size());
+			Characters[InName.size()] = '\0';
+			BlockOffset += Bytes;
+			return std::string_view(Characters, InName.size());
+		}
+
+	private:
+		/*
+		* Guards Lookup, adding entries and the character blocks.
+		*/
+		std::shared_mutex PoolMutex;
+
+		/*
+		* String => Index of its entry, the keys point at the stored characters.
+		*/
+		TMap<std::string_view, uint32_t> Lookup;
+
+		/*
+		* Chunks of entries, Index => characters.
+		*/
+		std::string_view* EntryChunks[NAME_MAX_CHUNKS] = {};
+
+		/*
+		* Number of entries, including None.
+		*/
+		uint32_t NumEntries;
+
+		/*
+		* Block the characters of new names are copied into.
+		*/
+		char* CurrentBlock = nullptr;
+
+		/*
+		* Bytes of CurrentBlock already used.
+		*/
+		size_t BlockOffset = 0;
+	};
+
+	FName::FName(std::string_view InName) noexcept
+		: Index(CNamePool::Get().FindOrAdd(InName, true))
+	{
+	}
+
+	FName FName::Find(std::string_view InName) noexcept
+	{
+		return FName(CNamePool::Get().FindOrAdd(InName, false), 0);
+	}
+
+	const char* FName::CStr() const noexcept
+	{
+		return CNamePool::Get().GetEntry(Index).data();
+	}
+
+	std::string_view FName::ToView() const noexcept
+	{
+		return CNamePool::Get().GetEntry(Index);
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "String.h"
+
+#include <string_view>
+
+namespace AAEngine {
+
+	/*
+	* Interned, case sensitive name, e.g. shader, uniform and asset names.
+	* Every distinct string is stored once in a global name table and an FName is only the 32 bit index of its entry,
+	* so copying, comparing and hashing an FName are O(1) and never allocate.
+	* Building an FName from a string looks it up in the table (hash + shared lock), so hot paths should build
+	* their FNames once and keep them (e.g. in a static).
+	* NOTE: Entries are never removed, don't build FNames from unbounded user data.
+	*/
+	class AA_ENGINE_API FName
+	{
+	public:
+		/*
+		* Default constructor for FName, the None name (empty string).
+		*/
+		FORCEINLINE constexpr FName() noexcept
+			: Index(0)
+		{
+		}
+
+		/*
+		* Constructors for FName, find the string in the name table or add it.
+		*/
+		FName(std::string_view InName) noexcept;
+
+		FORCEINLINE FName(const char* InName) noexcept
+			: FName(std::string_view(InName ? InName : ""))
+		{
+		}
+
+		FORCEINLINE FName(const std::string& InName) noexcept
+			: FName(std::string_view(InName))
+		{
+		}
+
+		FORCEINLINE FName(const FString& InName) noexcept
+			: FName(InName.ToView())
+		{
+		}
+
+		/*
+		* Finds a name without adding it to the table.
+		*
+		* @param InName - String to look for.
+		*
+		* @returns The FName of InName, None if it was never added.
+		*/
+		static FName Find(std::string_view InName) noexcept;
+
+		/*
+		* @returns Null terminated characters of the name, valid for the lifetime of the program.
+		*/
+		const char* CStr() const noexcept;
+		FORCEINLINE const char* operator*() const noexcept	{ return CStr(); }
+
+		/*
+		* @returns View of the characters of the name, valid for the lifetime of the program.
+		*/
+		std::string_view ToView() const noexcept;
+
+		/*
+		* @returns Copy of the name as an FString.
+		*/
+		FORCEINLINE FString ToString() const noexcept		{ return FString(ToView()); }
+
+		/*
+		* @returns true for the None name (empty string).
+		*/
+		FORCEINLINE constexpr bool IsNone() const noexcept	{ return Index == 0; }
+
+		/*
+		* @returns Index of the name in the name table, unique per string for the lifetime of the program.
+		*/
+		FORCEINLINE constexpr uint32_t GetIndex() const noexcept	{ return Index; }
+
+		FORCEINLINE constexpr bool operator==(const FName& Other) const noexcept	{ return Index == Other.Index; }
+		FORCEINLINE constexpr bool operator!=(const FName& Other) const noexcept	{ return Index != Other.Index; }
+
+		/*
+		* Orders names by when they were added, NOT alphabetically. Only meant for sorted containers.
+		*/
+		FORCEINLINE constexpr bool operator<(const FName& Other) const noexcept		{ return Index < Other.Index; }
+
+	private:
+		FORCEINLINE constexpr explicit FName(uint32_t InIndex, int) noexcept
+			: Index(InIndex)
+		{
+		}
+
+	private:
+		/*
+		* Index of the entry in the name table, 0 => None.
+		*/
+		uint32_t Index;
+	};
+
+	/*
+	* FName hasher, the index is unique per string so it is the hash.
+	*/
+	template<>
+	struct THash<FName>
+	{
+		FORCEINLINE size_t operator()(const FName& Key) const noexcept
+		{
+			return (size_t)Key.GetIndex();
+		}
+	};
+}
@@ -0,0 +1,424 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Containers/ContainerAllocators.h"
+#include "Containers/Hash.h"
+#include "Memory/Memory.h"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+/*
+* Number of characters (without the null terminator) an FString holds without allocating.
+* Covers most names, uniform names and short paths.
+*/
+#define STRING_INLINE_CAPACITY 23
+
+namespace AAEngine {
+
+	/*
+	* Engine string, a null terminated char array with Small Buffer Optimization.
+	* Strings up to STRING_INLINE_CAPACITY characters live inside the FString itself, longer ones are allocated
+	* through FHeapAllocator (so they show up in FHeapAllocator::GetStats()).
+	* Converts implicitly to std::string_view, so it can be passed to anything taking a view.
+	*/
+	class AA_ENGINE_API FString
+	{
+	public:
+		/*
+		* Returned by the Find functions when nothing is found.
+		*/
+		static constexpr size_t INDEX_NONE = ~(size_t)0;
+
+		/*
+		* Default constructor for FString, empty string.
+		*/
+		FORCEINLINE FString() noexcept
+			: Data(InlineData), Length(0)
+		{
+			InlineData[0] = '\0';
+		}
+
+		/*
+		* Constructors for FString copying the characters of a C string / view / std::string.
+		*/
+		FORCEINLINE FString(const char* InString) noexcept
+			: FString(std::string_view(InString ? InString : ""))
+		{
+		}
+
+		FORCEINLINE FString(const char* InString, size_t InLength) noexcept
+			: FString(std::string_view(InString, InLength))
+		{
+		}
+
+		FORCEINLINE FString(std::string_view InString) noexcept
+			: Data(InlineData), Length(0)
+		{
+			InlineData[0] = '\0';
+			Append(InString);
+		}
+
+		FORCEINLINE FString(const std::string& InString) noexcept
+			: FString(std::string_view(InString))
+		{
+		}
+
+		FORCEINLINE FString(const FString& Other) noexcept
+			: FString(Other.ToView())
+		{
+		}
+
+		/*
+		* Move constructor, steals the heap buffer of long strings, copies short ones.
+		*/
+		FORCEINLINE FString(FString&& Other) noexcept
+			: Data(InlineData), Length(Other.Length)
+		{
+			if (Other.IsInline())
+			{
+				FMemory::MemCopy(InlineData, Other.InlineData, Other.Length + 1);
+			}
+			else
+			{
+				Data = Other.Data;
+				HeapCapacity = Other.HeapCapacity;
+				Other.Data = Other.InlineData;
+			}
+			Other.Length = 0;
+			Other.InlineData[0] = '\0';
+		}
+
+		FORCEINLINE FString& operator=(const FString& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Assign(Other.ToView());
+			}
+			return *this;
+		}
+
+		FORCEINLINE FString& operator=(FString&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				if (Other.IsInline())
+				{
+					Assign(Other.ToView());
+				}
+				else
+				{
+					FreeHeapData();
+					Data = Other.Data;
+					Length = Other.Length;
+					HeapCapacity = Other.HeapCapacity;
+					Other.Data = Other.InlineData;
+				}
+				Other.Length = 0;
+				Other.InlineData[0] = '\0';
+			}
+			return *this;
+		}
+
+		FORCEINLINE FString& operator=(std::string_view InString) noexcept
+		{
+			Assign(InString);
+			return *this;
+		}
+
+		FORCEINLINE FString& operator=(const char* InString) noexcept
+		{
+			Assign(std::string_view(InString ? InString : ""));
+			return *this;
+		}
+
+		FORCEINLINE ~FString()
+		{
+			FreeHeapData();
+		}
+
+		/*
+		* Builds an FString from a printf style format.
+		*
+		* @param Format - printf format string.
+		* @param Args - Arguments for the format.
+		*
+		* @returns The formatted string.
+		*/
+		template<typename... ArgsType>
+		static FString Printf(const char* Format, ArgsType... Args) noexcept
+		{
+			FString Result;
+			const int FormattedLength = std::snprintf(nullptr, 0, Format, Args...);
+			if (FormattedLength > 0)
+			{
+				Result.Reserve((size_t)FormattedLength);
+				std::snprintf(Result.Data, (size_t)FormattedLength + 1, Format, Args...);
+				Result.Length = (size_t)FormattedLength;
+			}
+			return Result;
+		}
+
+		/*
+		* Replaces the contents of the string, reusing the current buffer when it's big enough.
+		*
+		* @param InString - New contents.
+		*/
+		FORCEINLINE void Assign(std::string_view InString) noexcept
+		{
+			Length = 0;
+			Append(InString);
+		}
+
+		/*
+		* Appends characters to the end of the string.
+		*
+		* @param InString - Characters to append, may point into this string.
+		*
+		* @returns Reference to this string.
+		*/
+		FORCEINLINE FString& Append(std::string_view InString) noexcept
+		{
+			if (Length + InString.size() > GetCapacity())
+			{
+				// InString may point into our own buffer, keep it alive until the copy is done
+				GrowAndAppend(InString);
+				return *this;
+			}
+			FMemory::MemMove(Data + Length, InString.data(), InString.size());
+			Length += InString.size();
+			Data[Length] = '\0';
+			return *this;
+		}
+
+		FORCEINLINE FString& Append(char Character) noexcept
+		{
+			return Append(std::string_view(&Character, 1));
+		}
+
+		FORCEINLINE FString& operator+=(std::string_view InString) noexcept	{ return Append(InString); }
+		FORCEINLINE FString& operator+=(const char* InString) noexcept			{ return Append(std::string_view(InString)); }
+		FORCEINLINE FString& operator+=(const FString& InString) noexcept		{ return Append(InString.ToView()); }
+		FORCEINLINE FString& operator+=(char Character) noexcept				{ return Append(Character); }
+
+		/*
+		* Makes sure the string can hold NewCapacity characters (plus the null terminator) without allocating.
+		*
+		* @param NewCapacity - Number of characters to reserve.
+		*/
+		FORCEINLINE void Reserve(size_t NewCapacity) noexcept
+		{
+			if (NewCapacity > GetCapacity())
+			{
+				Reallocate(NewCapacity);
+			}
+		}
+
+		/*
+		* Empties the string, keeps the buffer.
+		*/
+		FORCEINLINE void Clear() noexcept
+		{
+			Length = 0;
+			Data[0] = '\0';
+		}
+
+		/*
+		* @returns Index of the first occurrence of ToFind at or after StartIndex, INDEX_NONE if there is none.
+		*/
+		FORCEINLINE size_t Find(std::string_view ToFind, size_t StartIndex = 0) const noexcept
+		{
+			const size_t Index = ToView().find(ToFind, StartIndex);
+			return Index == std::string_view::npos ? INDEX_NONE : Index;
+		}
+
+		FORCEINLINE size_t Find(char ToFind, size_t StartIndex = 0) const noexcept
+		{
+			const size_t Index = ToView().find(ToFind, StartIndex);
+			return Index == std::string_view::npos ? INDEX_NONE : Index;
+		}
+
+		/*
+		* @returns Index of the last occurrence of ToFind, INDEX_NONE if there is none.
+		*/
+		FORCEINLINE size_t FindLast(char ToFind) const noexcept
+		{
+			const size_t Index = ToView().rfind(ToFind);
+			return Index == std::string_view::npos ? INDEX_NONE : Index;
+		}
+
+		/*
+		* @returns Copy of Count characters starting at StartIndex (clamped to the end of the string).
+		*/
+		FORCEINLINE FString SubStr(size_t StartIndex, size_t Count = INDEX_NONE) const noexcept
+		{
+			return StartIndex < Length ? FString(ToView().substr(StartIndex, Count)) : FString();
+		}
+
+		FORCEINLINE bool StartsWith(std::string_view Prefix) const noexcept
+		{
+			return Length >= Prefix.size() && ToView().compare(0, Prefix.size(), Prefix) == 0;
+		}
+
+		FORCEINLINE bool EndsWith(std::string_view Suffix) const noexcept
+		{
+			return Length >= Suffix.size() && ToView().compare(Length - Suffix.size(), Suffix.size(), Suffix) == 0;
+		}
+
+		/*
+		* @returns Null terminated characters of the string, valid until the string is changed.
+		*/
+		FORCEINLINE const char* CStr() const noexcept			{ return Data; }
+		FORCEINLINE const char* operator*() const noexcept		{ return Data; }
+
+		FORCEINLINE std::string_view ToView() const noexcept	{ return std::string_view(Data, Length); }
+		FORCEINLINE operator std::string_view() const noexcept	{ return ToView(); }
+
+		/*
+		* @returns Copy of the string as a std::string, for APIs that need one.
+		*/
+		FORCEINLINE std::string ToStdString() const noexcept	{ return std::string(Data, Length); }
+
+		/*
+		* @returns Number of characters, without the null terminator.
+		*/
+		FORCEINLINE size_t Len() const noexcept					{ return Length; }
+		FORCEINLINE bool IsEmpty() const noexcept				{ return Length == 0; }
+
+		/*
+		* @returns Number of characters the string holds without allocating.
+		*/
+		FORCEINLINE size_t GetCapacity() const noexcept			{ return IsInline() ? STRING_INLINE_CAPACITY : HeapCapacity; }
+
+		FORCEINLINE char& operator[](size_t Index) noexcept
+		{
+			AA_CORE_ASSERT(Index < Length, "Index Out of Bounds: %d when Length is %d", Index, Length);
+			return Data[Index];
+		}
+
+		FORCEINLINE const char& operator[](size_t Index) const noexcept
+		{
+			AA_CORE_ASSERT(Index < Length, "Index Out of Bounds: %d when Length is %d", Index, Length);
+			return Data[Index];
+		}
+
+		FORCEINLINE char* begin() noexcept				{ return Data; }
+		FORCEINLINE const char* begin() const noexcept	{ return Data; }
+		FORCEINLINE char* end() noexcept				{ return Data + Length; }
+		FORCEINLINE const char* end() const noexcept	{ return Data + Length; }
+
+		friend FORCEINLINE bool operator==(const FString& Left, const FString& Right) noexcept		{ return Left.ToView() == Right.ToView(); }
+		friend FORCEINLINE bool operator==(const FString& Left, std::string_view Right) noexcept	{ return Left.ToView() == Right; }
+		friend FORCEINLINE bool operator==(const FString& Left, const char* Right) noexcept			{ return Left.ToView() == std::string_view(Right); }
+		friend FORCEINLINE bool operator!=(const FString& Left, const FString& Right) noexcept		{ return Left.ToView() != Right.ToView(); }
+		friend FORCEINLINE bool operator!=(const FString& Left, std::string_view Right) noexcept	{ return Left.ToView() != Right; }
+		friend FORCEINLINE bool operator!=(const FString& Left, const char* Right) noexcept			{ return Left.ToView() != std::string_view(Right); }
+		friend FORCEINLINE bool operator<(const FString& Left, const FString& Right) noexcept		{ return Left.ToView() < Right.ToView(); }
+
+		friend FORCEINLINE FString operator+(const FString& Left, std::string_view Right) noexcept
+		{
+			FString Result;
+			Result.Reserve(Left.Len() + Right.size());
+			Result.Append(Left.ToView()).Append(Right);
+			return Result;
+		}
+
+	private:
+		FORCEINLINE bool IsInline() const noexcept		{ return Data == InlineData; }
+
+		/*
+		* Moves the characters into a new heap buffer of NewCapacity characters.
+		*/
+		FORCEINLINE void Reallocate(size_t NewCapacity) noexcept
+		{
+			char* NewData = FHeapAllocator::TForElementType<char>().Allocate(NewCapacity + 1);
+			FMemory::MemCopy(NewData, Data, Length + 1);
+			FreeHeapData();
+			Data = NewData;
+			HeapCapacity = NewCapacity;
+		}
+
+		/*
+		* Appends InString into a grown buffer, InString may point into the current buffer.
+		*/
+		FORCEINLINE void GrowAndAppend(std::string_view InString) noexcept
+		{
+			const size_t NewLength = Length + InString.size();
+			const size_t GrownCapacity = GetCapacity() * 2;
+			const size_t NewCapacity = GrownCapacity > NewLength ? GrownCapacity : NewLength;
+
+			char* NewData = FHeapAllocator::TForElementType<char>().Allocate(NewCapacity + 1);
+			FMemory::MemCopy(NewData, Data, Length);
+			FMemory::MemCopy(NewData + Length, InString.data(), InString.size());
+			NewData[NewLength] = '\0';
+
+			FreeHeapData();
+			Data = NewData;
+			Length = NewLength;
+			HeapCapacity = NewCapacity;
+		}
+
+		FORCEINLINE void FreeHeapData() noexcept
+		{
+			if (!IsInline())
+			{
+				FHeapAllocator::TForElementType<char>().Deallocate(Data, HeapCapacity + 1);
+				Data = InlineData;
+			}
+		}
+
+	private:
+		/*
+		* Characters of the string, points at InlineData for short strings.
+		*/
+		char* Data;
+
+		/*
+		* Number of characters, without the null terminator.
+		*/
+		size_t Length;
+
+		union
+		{
+			/*
+			* Storage of short strings.
+			*/
+			char InlineData[STRING_INLINE_CAPACITY + 1];
+
+			/*
+			* Number of characters the heap buffer holds (without the null terminator), used when Data isn't InlineData.
+			*/
+			size_t HeapCapacity;
+		};
+	};
+
+	/*
+	* FString hasher, hashes anything convertible to std::string_view, so TMap<FString, ...> can be searched with a const char*.
+	*/
+	template<>
+	struct THash<FString>
+	{
+		using is_transparent = void;
+
+		FORCEINLINE size_t operator()(std::string_view Key) const noexcept
+		{
+			return std::hash<std::string_view>()(Key);
+		}
+	};
+
+	/*
+	* FString comparison, compares anything convertible to std::string_view.
+	*/
+	template<>
+	struct TKeyEqual<FString>
+	{
+		using is_transparent = void;
+
+		FORCEINLINE bool operator()(std::string_view Left, std::string_view Right) const noexcept
+		{
+			return Left == Right;
+		}
+	};
+}
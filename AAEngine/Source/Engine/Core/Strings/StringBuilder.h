@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "String.h"
+
+#include <cstdio>
+#include <string_view>
+#include <type_traits>
+
+/*
+* Number of characters FStringBuilder formats without allocating, enough for a log line.
+*/
+#define STRINGBUILDER_DEFAULT_INLINE_CAPACITY 512
+
+namespace AAEngine {
+
+	/*
+	* Builds a string out of pieces and printf style formats into one buffer.
+	* The buffer starts inline (InlineCapacity characters), grows on the heap when needed and is kept by Reset(),
+	* so a builder that is reused (e.g. one per logger / per thread) stops allocating after the first few uses.
+	*
+	* @tparam InlineCapacity - Number of characters (without the null terminator) stored inside the builder.
+	*/
+	template<size_t InlineCapacity>
+	class AA_ENGINE_API TStringBuilder
+	{
+	public:
+		/*
+		* Default constructor for TStringBuilder, empty string.
+		*/
+		FORCEINLINE TStringBuilder() noexcept
+			: Data(InlineData), Length(0), Capacity(InlineCapacity)
+		{
+			InlineData[0] = '\0';
+		}
+
+		TStringBuilder(const TStringBuilder&) = delete;
+		TStringBuilder& operator=(const TStringBuilder&) = delete;
+
+		FORCEINLINE ~TStringBuilder()
+		{
+			if (Data != InlineData)
+			{
+				FHeapAllocator::TForElementType<char>().Deallocate(Data, Capacity + 1);
+			}
+		}
+
+		/*
+		* Appends characters.
+		*
+		* @param InString - Characters to append.
+		*
+		* @returns Reference to this builder.
+		*/
+		FORCEINLINE TStringBuilder& Append(std::string_view InString) noexcept
+		{
+			ReserveForAppend(InString.size());
+			FMemory::MemCopy(Data + Length, InString.data(), InString.size());
+			Length += InString.size();
+			Data[Length] = '\0';
+			return *this;
+		}
+
+		FORCEINLINE TStringBuilder& Append(const char* InString) noexcept	{ return Append(std::string_view(InString)); }
+
+		FORCEINLINE TStringBuilder& Append(char Character) noexcept
+		{
+			ReserveForAppend(1);
+			Data[Length++] = Character;
+			Data[Length] = '\0';
+			return *this;
+		}
+
+		/*
+		* Appends the decimal representation of a number.
+		*
+		* @param Value - Integer or floating point number, floats use %g.
+		*
+		* @returns Reference to this builder.
+		*/
+		template<typename NumberType, typename = std::enable_if_t<std::is_arithmetic<NumberType>::value && !std::is_same<NumberType, char>::value && !std::is_same<NumberType, bool>::value>>
+		FORCEINLINE TStringBuilder& Append(NumberType Value) noexcept
+		{
+			if constexpr (std::is_floating_point<NumberType>::value)
+			{
+				return Appendf("%g", (double)Value);
+			}
+			else if constexpr (std::is_signed<NumberType>::value)
+			{
+				return Appendf("%lld", (long long)Value);
+			}
+			else
+			{
+				return Appendf("%llu", (unsigned long long)Value);
+			}
+		}
+
+		/*
+		* Appends a printf style format.
+		*
+		* @param Format - printf format string.
+		* @param Args - Arguments for the format.
+		*
+		* @returns Reference to this builder.
+		*/
+		template<typename... ArgsType>
+		FORCEINLINE TStringBuilder& Appendf(const char* Format, ArgsType... Args) noexcept
+		{
+			const size_t Available = Capacity - Length;
+			const int FormattedLength = std::snprintf(Data + Length, Available + 1, Format, Args...);
+			if (FormattedLength < 0)
+			{
+				Data[Length] = '\0';
+				return *this;
+			}
+			if ((size_t)FormattedLength > Available)
+			{
+				// Didn't fit, grow and format again
+				ReserveForAppend((size_t)FormattedLength);
+				std::snprintf(Data + Length, (size_t)FormattedLength + 1, Format, Args...);
+			}
+			Length += (size_t)FormattedLength;
+			return *this;
+		}
+
+		template<typename T>
+		FORCEINLINE TStringBuilder& operator<<(const T& Value) noexcept	{ return Append(Value); }
+
+		/*
+		* Empties the builder, keeps the buffer.
+		*/
+		FORCEINLINE void Reset() noexcept
+		{
+			Length = 0;
+			Data[0] = '\0';
+		}
+
+		/*
+		* @returns Null terminated characters built so far, valid until the builder is changed.
+		*/
+		FORCEINLINE const char* CStr() const noexcept			{ return Data; }
+		FORCEINLINE const char* operator*() const noexcept		{ return Data; }
+
+		FORCEINLINE std::string_view ToView() const noexcept	{ return std::string_view(Data, Length); }
+
+		/*
+		* @returns Copy of the characters built so far.
+		*/
+		FORCEINLINE FString ToString() const noexcept			{ return FString(ToView()); }
+
+		/*
+		* @returns Number of characters, without the null terminator.
+		*/
+		FORCEINLINE size_t Len() const noexcept					{ return Length; }
+		FORCEINLINE bool IsEmpty() const noexcept				{ return Length == 0; }
+
+	private:
+		/*
+		* Makes room for Count more characters, at least doubling the buffer when it grows.
+		*/
+		FORCEINLINE void ReserveForAppend(size_t Count) noexcept
+		{
+			if (Length + Count <= Capacity)
+			{
+				return;
+			}
+
+			const size_t NewCapacity = Capacity * 2 > Length + Count ? Capacity * 2 : Length + Count;
+			char* NewData = FHeapAllocator::TForElementType<char>().Allocate(NewCapacity + 1);
+			FMemory::MemCopy(NewData, Data, Length + 1);
+			if (Data != InlineData)
+			{
+				FHeapAllocator::TForElementType<char>().Deallocate(Data, Capacity + 1);
+			}
+			Data = NewData;
+			Capacity = NewCapacity;
+		}
+
+	private:
+		/*
+		* Characters built so far, points at InlineData until the builder outgrows it.
+		*/
+		char* Data;
+
+		/*
+		* Number of characters, without the null terminator.
+		*/
+		size_t Length;
+
+		/*
+		* Number of characters Data holds, without the null terminator.
+		*/
+		size_t Capacity;
+
+		/*
+		* Storage used until the builder outgrows it.
+		*/
+		char InlineData[InlineCapacity + 1];
+	};
+
+	using FStringBuilder = TStringBuilder<STRINGBUILDER_DEFAULT_INLINE_CAPACITY>;
+}
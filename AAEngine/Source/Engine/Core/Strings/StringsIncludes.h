@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Core/Strings/String.h"
+#include "Core/Strings/StringBuilder.h"
+#include "Core/Strings/Name.h"
@@ -2,6 +2,8 @@
 
 #include "Core.h"
 
+#include <type_traits>
+
 // -- REFERENCE ----------------------------------------------------------------------
 /*
 * TIsReference - To check if T is a reference or not
@@ -44,4 +46,24 @@ template<typename T, int N> struct TIsBoundedArray<T[N]>	{ enum { Value = true }
 template<typename T> struct TIsUnBoundedArray				{ enum { Value = false }; };
 template<typename T> struct TIsUnBoundedArray<T[]>			{ enum { Value = true }; };
 
-// -----------------------------------------------------------------------------------
\ No newline at end of file
+// -----------------------------------------------------------------------------------
+// 
+// -- TRIVIAL OPERATIONS -------------------------------------------------------------
+/*
+* TIsTriviallyCopyable - To check if T can be copied with a memcpy
+*/
+template<typename T> struct TIsTriviallyCopyable			{ enum { Value = std::is_trivially_copyable<T>::value }; };
+
+/*
+* TIsTriviallyDestructible - To check if T's destructor does nothing, so destructor loops can be skipped
+*/
+template<typename T> struct TIsTriviallyDestructible		{ enum { Value = std::is_trivially_destructible<T>::value }; };
+
+/*
+* TIsTriviallyRelocatable - To check if a T can be moved to a new address with a memcpy, leaving the old memory as if it was destroyed
+* True for every trivially copyable type.
+* Specialize for types that don't point into themselves (most handles, containers with heap storage etc.)
+*/
+template<typename T> struct TIsTriviallyRelocatable			{ enum { Value = TIsTriviallyCopyable<T>::Value }; };
+
+// -----------------------------------------------------------------------------------
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <atomic>
+#include <thread>
+
+/*
+* Most threads ParallelFor runs on at once.
+*/
+#define PARALLEL_MAX_THREADS 64
+
+namespace AAEngine {
+
+	/*
+	* Number of threads ParallelFor spreads work across => Number of hardware threads.
+	*
+	* @returns Number of threads, between 1 and PARALLEL_MAX_THREADS.
+	*/
+	FORCEINLINE uint32_t GetNumParallelThreads() noexcept
+	{
+		static const uint32_t NumThreads = std::thread::hardware_concurrency() == 0 ? 1
+			: (std::thread::hardware_concurrency() < PARALLEL_MAX_THREADS ? std::thread::hardware_concurrency() : PARALLEL_MAX_THREADS);
+		return NumThreads;
+	}
+
+	/*
+	* Runs Func(TaskIndex) for every TaskIndex in [0, NumTasks) across the hardware threads and waits for all of them.
+	* The calling thread works on tasks too. Tasks are handed out one at a time, so uneven tasks still balance out.
+	* NOTE: Starts threads on every call, only worth it for tasks that take well over the ~10s of microseconds a thread takes to start.
+	*
+	* @param NumTasks - Number of tasks.
+	* @param Func - Callable taking the size_t index of the task, must be safe to call from several threads at once.
+	*/
+	template<typename FuncType>
+	FORCEINLINE void ParallelFor(size_t NumTasks, FuncType&& Func) noexcept
+	{
+		const size_t NumThreads = NumTasks < GetNumParallelThreads() ? NumTasks : GetNumParallelThreads();
+		if (NumThreads <= 1)
+		{
+			for (size_t TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+			{
+				Func(TaskIndex);
+			}
+			return;
+		}
+
+		std::atomic<size_t> NextTask{ 0 };
+		auto Worker = [&]()
+		{
+			for (size_t TaskIndex = NextTask.fetch_add(1); TaskIndex < NumTasks; TaskIndex = NextTask.fetch_add(1))
+			{
+				Func(TaskIndex);
+			}
+		};
+
+		std::thread Threads[PARALLEL_MAX_THREADS - 1];
+		for (size_t i = 0; i < NumThreads - 1; i++)
+		{
+			Threads[i] = std::thread(Worker);
+		}
+		Worker();
+		for (size_t i = 0; i < NumThreads - 1; i++)
+		{
+			Threads[i].join();
+		}
+	}
+}
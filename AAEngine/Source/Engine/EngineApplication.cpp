@@ -86,8 +86,8 @@ namespace AAEngine {
 		)";
 
 		std::string FilePath = "../AAEngine/Source/Engine/Shaders/TestGLShader.glsl";
-		//TSharedPtr<IShader> Shader = IShader::Create("Helol", VertexSource, FragmentSource);
-		TSharedPtr<IShader> Shader = IShader::Create(FilePath);
+		//FShaderHandle Shader = CRenderResources::CreateShader("Helol", VertexSource, FragmentSource);
+		FShaderHandle Shader = CRenderResources::CreateShader(FilePath);
 		
 		//Shader.reset(IShader::Create(VertexSource, FragmentSource));
 		//Shader.reset(IShader::Create("../AAEngine/Source/Engine/Shaders/TestGLShader.glsl"));
@@ -95,7 +95,7 @@ namespace AAEngine {
 		constexpr uint32_t VertexBufferSize = 8 /* Stride */ * 8 /* Num Vertices */;
 		constexpr uint32_t IndexBufferSize = 3 * 12;
 
-		CVertexBufferLayout Layout = CVertexBufferLayout::PhongLayout;
+		const CVertexBufferLayout& Layout = CVertexBufferLayout::PhongLayout;
 
 		TArray<float> Vertices = {
 			-0.5f,	-0.5f, -0.5f,	0.0f, 0.0f, 0.0f,		0.0f, 0.0f,
@@ -136,6 +136,8 @@ namespace AAEngine {
 		//FVector2f CurrMousePos
 		float MouseSensitivity = 1.0f;
 
+		CFrameAllocator& FrameAllocator = CFrameAllocator::Get();
+
 		while(bIsApplicationRunning)
 		{
 			/*
@@ -200,7 +202,7 @@ namespace AAEngine {
 			Camera->RecalculateViewMatrix();
 			
 			CRenderer::BeginScene(*Camera);
-			Shader->Bind();
+			CRenderResources::Get(Shader)->Bind();
 			CRenderer::UploadSceneUniforms(Shader);
 			//CRenderer::Submit(Shader, Mesh);
 			CRenderer::Submit(Shader, Model);
@@ -209,7 +211,7 @@ namespace AAEngine {
 
 			for (CLayer* Layer : LayerStack)
 			{
-				Layer->OnUpdate(DeltaTime);
+				Layer->OnUpdate(DeltaTime, FrameAllocator);
 			}
 
 			ImGuiLayer->Begin();
@@ -220,8 +222,15 @@ namespace AAEngine {
 			ImGuiLayer->End();
 
 			ApplicationWindow->Tick();
+
+			// Everything allocated from the frame allocator this frame is dead now
+			FrameAllocator.EndFrame();
+			FMemoryTracker::EndFrame();
 		}
+		// GPU resources go while the rendering context is still alive, the meshes are left with stale handles
+		CRenderResources::DestroyAll();
 		AA_CORE_LOG(Warning, "Application Closed!");
+		FrameAllocator.LogStats();
 #endif
 
 	}
@@ -7,6 +7,54 @@
 	*/
 	extern AAEngine::CEngineApplication* AAEngine::CreateApplication();
 
+#if AA_OVERRIDE_OPERATOR_NEW
+	/*
+	* Global new / delete go through FMemory so every allocation is counted under the current memory tag.
+	*/
+	void* operator new(size_t Size)
+	{
+		if (void* Pointer = AAEngine::FMemory::Malloc(Size))
+			return Pointer;
+
+		throw std::bad_alloc{};
+	}
+
+	void* operator new[](size_t Size)
+	{
+		return operator new(Size);
+	}
+
+	void* operator new(size_t Size, std::align_val_t Alignment)
+	{
+		if (void* Pointer = AAEngine::FMemory::Malloc(Size, (size_t)Alignment))
+			return Pointer;
+
+		throw std::bad_alloc{};
+	}
+
+	void* operator new[](size_t Size, std::align_val_t Alignment)
+	{
+		return operator new(Size, Alignment);
+	}
+
+	void* operator new(size_t Size, const std::nothrow_t&) noexcept							{ return AAEngine::FMemory::Malloc(Size); }
+	void* operator new[](size_t Size, const std::nothrow_t&) noexcept						{ return AAEngine::FMemory::Malloc(Size); }
+	void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept	{ return AAEngine::FMemory::Malloc(Size, (size_t)Alignment); }
+	void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept	{ return AAEngine::FMemory::Malloc(Size, (size_t)Alignment); }
+
+	void operator delete(void* Pointer) noexcept											{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer) noexcept											{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete(void* Pointer, size_t) noexcept									{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer, size_t) noexcept									{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete(void* Pointer, std::align_val_t) noexcept							{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer, std::align_val_t) noexcept						{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete(void* Pointer, size_t, std::align_val_t) noexcept					{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer, size_t, std::align_val_t) noexcept				{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete(void* Pointer, const std::nothrow_t&) noexcept						{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer, const std::nothrow_t&) noexcept					{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete(void* Pointer, std::align_val_t, const std::nothrow_t&) noexcept	{ AAEngine::FMemory::Free(Pointer); }
+	void operator delete[](void* Pointer, std::align_val_t, const std::nothrow_t&) noexcept	{ AAEngine::FMemory::Free(Pointer); }
+#else
 	void* operator new(size_t sz)
 	{
 		if (sz == 0)
@@ -17,6 +65,8 @@
 
 		throw std::bad_alloc{};
 	}
+#endif
+
 	/*
 	* ENTRY POINT
 	* This is the main entry point for the Client Application into the Engine
@@ -25,9 +75,12 @@
 	{
 		_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 		AA_CORE_LOG(Trace, "Starting AAEngine...");
+		AAEngine::Math::FMathDispatch::Initialize();
 		auto AApplication = AAEngine::CreateApplication();
 		AApplication->Run();
 		delete AApplication;
+		AAEngine::FMemory::DumpStats();
+		AAEngine::FMemoryTracker::WriteLeakReport("AAEngineMemoryLeaks.txt");
 		std::cin.get();
 	}
 #else
@@ -155,12 +155,13 @@ namespace AAEngine {
 		/*
 		* Handle Event function that calls the passed in Event with the EventType argument letting the user define the Event Handling Logic.
 		*
-		* @param EventFunction<TemplateEventType> - Event Function to handle the particular Event
+		* @param Function - Callable taking a TemplateEventType& and returning bool (e.g. an EventFunction<TemplateEventType> or BIND_EVENT_FUNCTION),
+		*	taken as is so handling an event doesn't build a std::function
 		* 
 		* @return true if EventFunctions type matches the EventType => EventFunction was called, return false otherwise
 		*/
-		template<typename TemplateEventType>
-		FORCEINLINE bool HandleEvent(EventFunction<TemplateEventType> Function)
+		template<typename TemplateEventType, typename FunctionType>
+		FORCEINLINE bool HandleEvent(FunctionType&& Function)
 		{
 			if (mEvent.GetEventType() == TemplateEventType::GetStaticType())
 			{
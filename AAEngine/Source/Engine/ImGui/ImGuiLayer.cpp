@@ -16,6 +16,11 @@
 // Temp
 #include <GLFW/glfw3.h>
 
+/*
+* Number of allocation sites listed by the memory panel.
+*/
+#define MEMORY_PANEL_TOP_SITES 10
+
 namespace AAEngine {
 	CImGuiLayer::CImGuiLayer()
 		: CLayer("ImGuiLayer")
@@ -69,6 +74,89 @@ namespace AAEngine {
 	{
 		//static bool bShowDemoWindow = false;
 		//ImGui::ShowDemoWindow(&bShowDemoWindow);
+
+		if (bShowMemoryPanel)
+		{
+			DrawMemoryPanel();
+		}
+	}
+
+	void CImGuiLayer::DrawMemoryPanel()
+	{
+		if (!ImGui::Begin("Memory", &bShowMemoryPanel))
+		{
+			ImGui::End();
+			return;
+		}
+
+		const uint32_t SampleRate = FMemoryTracker::GetSampleRate();
+		ImGui::Text("Backend: %s", FMemory::GetBackend().GetName());
+		ImGui::Text("Tracking 1 in %u allocations per thread", SampleRate);
+
+		if (ImGui::BeginTable("MemoryTags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Tag");
+			ImGui::TableSetupColumn("Live Bytes");
+			ImGui::TableSetupColumn("Live Allocs");
+			ImGui::TableSetupColumn("Peak Bytes");
+			ImGui::TableSetupColumn("Total Allocs");
+			ImGui::TableHeadersRow();
+
+			for (size_t Tag = 0; Tag < (size_t)EMemoryTag::Count; Tag++)
+			{
+				const FAllocatorStats& Stats = FMemory::GetTagStats((EMemoryTag)Tag);
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(FMemory::GetTagName((EMemoryTag)Tag));
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Stats.GetLiveBytes());
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Stats.GetLiveAllocations());
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Stats.GetHighWaterMark());
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Stats.GetTotalAllocations());
+			}
+
+			const FAllocatorStats& FrameArenaStats = CFrameAllocator::Get().GetFrameArena().GetStats();
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::TextUnformatted("Frame Arena");
+			ImGui::TableNextColumn(); ImGui::Text("%zu", FrameArenaStats.GetLiveBytes());
+			ImGui::TableNextColumn(); ImGui::Text("%zu", FrameArenaStats.GetLiveAllocations());
+			ImGui::TableNextColumn(); ImGui::Text("%zu", FrameArenaStats.GetHighWaterMark());
+			ImGui::TableNextColumn(); ImGui::Text("%zu", FrameArenaStats.GetTotalAllocations());
+
+			ImGui::EndTable();
+		}
+
+		ImGui::Separator();
+		ImGui::Text("Allocations last frame: %zu", FMemoryTracker::GetLastFrameAllocations());
+		size_t HistoryOffset;
+		const float* History = FMemoryTracker::GetFrameAllocationHistory(HistoryOffset);
+		ImGui::PlotLines("##AllocationsPerFrame", History, MEMORY_TRACKER_FRAME_HISTORY, (int)HistoryOffset, "Allocations per frame", 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+
+		ImGui::Separator();
+		ImGui::TextUnformatted("Biggest allocation sites (live bytes estimated from the samples)");
+		FAllocationSite Sites[MEMORY_PANEL_TOP_SITES];
+		const size_t NumSites = FMemoryTracker::GetTopSites(Sites, MEMORY_PANEL_TOP_SITES);
+		if (ImGui::BeginTable("MemorySites", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Live Bytes");
+			ImGui::TableSetupColumn("Live Allocs");
+			ImGui::TableSetupColumn("Tag");
+			ImGui::TableSetupColumn("Site");
+			ImGui::TableHeadersRow();
+
+			char Description[256];
+			for (size_t i = 0; i < NumSites; i++)
+			{
+				FMemoryTracker::DescribeSite(Sites[i], Description, sizeof(Description));
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Sites[i].LiveBytes * SampleRate);
+				ImGui::TableNextColumn(); ImGui::Text("%zu", Sites[i].LiveAllocations * SampleRate);
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(FMemory::GetTagName(Sites[i].Tag));
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(Description);
+			}
+
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
 	}
 
 	void CImGuiLayer::Begin()
@@ -125,10 +125,20 @@ namespace AAEngine {
         */
         bool OnWindowResized(CWindowResizeEvent& Event);
 
+        /*
+        * Draws the memory panel: live stats per memory tag, allocations per frame and the biggest allocation sites of FMemoryTracker.
+        */
+        void DrawMemoryPanel();
+
         /*
         * Track the current time
         * TEMP
         */
 		float ImGuiTime{ 0.0f };
+
+        /*
+        * Whether the memory panel is open.
+        */
+        bool bShowMemoryPanel{ true };
 	};
 }
\ No newline at end of file
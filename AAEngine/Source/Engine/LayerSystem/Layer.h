@@ -7,6 +7,7 @@
 namespace AAEngine {
 
     class CEvent;
+    class CFrameAllocator;
 
     /*
     * The base layer class for the engine.
@@ -39,8 +40,9 @@ namespace AAEngine {
         * Function called to update the layer.
         * 
         * @param DeltaSeconds - Time between frames to make sure objects move frame-independently
+        * @param FrameAllocator - Scratch memory for data that only lives for this frame (or the next one), released by the engine.
         */
-        virtual void OnUpdate(float DeltaSeconds) {}
+        virtual void OnUpdate(float DeltaSeconds, CFrameAllocator& FrameAllocator) {}
 
         /*
         * Function called to update the ImGui Rendering.
@@ -3,26 +3,29 @@
 #include "Renderer/Buffer.h"
 #include "Renderer/VertexArray.h"
 #include "Renderer/RenderCommand.h"
+#include "Renderer/RenderResources.h"
 #include "Renderer/RendererCommons.h"
 #include "Renderer/ModelLoader.h"
 
 namespace AAEngine {
 
-	CMesh::CMesh(const TArray<float>& Vertices, const TArray<uint32_t>& Indices, const CVertexBufferLayout& BufferLayout)
-		: Vertices(Vertices), Indices(Indices)
+	CMesh::CMesh(TConstArrayView<float> Vertices, TConstArrayView<uint32_t> Indices, const CVertexBufferLayout& BufferLayout)
+		: VertexArray(CRendererUtils::MakeVertexArray(Vertices, Indices, BufferLayout))
 	{
-		VertexArray = CRendererUtils::MakeVertexArray(Vertices, Indices, BufferLayout);
 	}
 
 	CMesh::CMesh(const std::string& FileName, const CVertexBufferLayout& BufferLayout)
-		: Vertices({}), Indices({})
 	{
+		// Only needed until they are uploaded
+		TArray<float> Vertices;
+		TArray<uint32_t> Indices;
 		IModelLoader::LoadModel(FileName, Vertices, Indices, BufferLayout);
 		VertexArray = CRendererUtils::MakeVertexArray(Vertices, Indices, BufferLayout);
 	}
 
 	CMesh::~CMesh()
 	{
+		CRenderResources::Destroy(VertexArray);
 	}
 
 	void CMesh::Render()
@@ -1,26 +1,34 @@
 #pragma once
 #include "Renderer/Renderable.h"
+#include "Renderer/RendererCommons.h"
 
 namespace AAEngine {
 
-	class IVertexArray;
-	class CVertexBufferLayout;
 	/*
 	* Mesh class that takes in vertices, indices and a vertex layout to create a mesh.
 	*/
 	class CMesh : public IRenderable
 	{
 	public:
-		CMesh(const TArray<float>& Vertices, const TArray<uint32_t>& Indices, const CVertexBufferLayout& BufferLayout);
+		/*
+		* Uploads the vertices and indices to the GPU, the mesh doesn't keep a copy of them.
+		*/
+		CMesh(TConstArrayView<float> Vertices, TConstArrayView<uint32_t> Indices, const CVertexBufferLayout& BufferLayout);
 		CMesh(const std::string& FileName, const CVertexBufferLayout& BufferLayout);
 		~CMesh();
 
+		/*
+		* The mesh destroys its Vertex Array, a copy would destroy the same handle twice.
+		*/
+		CMesh(const CMesh&) = delete;
+		CMesh& operator=(const CMesh&) = delete;
+
 		virtual void Render() override;
 
 	private:
-		TArray<float> Vertices;
-		TArray<uint32_t> Indices;
-
-		TSharedPtr<IVertexArray> VertexArray = nullptr;
+		/*
+		* Owned Vertex Array, destroyed with the mesh.
+		*/
+		FVertexArrayHandle VertexArray;
 	};
 }
\ No newline at end of file
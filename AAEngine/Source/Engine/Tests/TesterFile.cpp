@@ -3,20 +3,44 @@
 #include "Profiling/Timer.h"
 #include "Containers/StaticArray.h"
 #include "Containers/Array.h"
+#include "Containers/SoAArray.h"
+#include "Containers/ResourcePool.h"
+#include "Containers/ArrayView.h"
 #include "Math/MathIncludes.h"
+#include "Math/MathDispatch.h"
+#include "Math/MathBatch.h"
+#include "Threading/ParallelFor.h"
+#include "EventSystem/MouseEvents.h"
+#include "Renderer/Buffer.h"
 
 
 //#define _CRTDBG_MAP_ALLOC
 //#include <crtdbg.h>
 #include "Containers/BinarySearchTree.h"
 #include "Containers/RedBlackTree.h"
+#include "Containers/OrderedMap.h"
+#include "Containers/BTreeMap.h"
+#include "Containers/HashMap.h"
+#include "Containers/HashSet.h"
+#include "Containers/Stack.h"
+#include "Containers/Queue.h"
+#include "Containers/SpscRingBuffer.h"
+#include "Containers/MpmcQueue.h"
+#include "Strings/StringsIncludes.h"
 
 #define GLM_FORCE_ALIGNED
 //#define GLM_FORCE_AVX2
 // Temporary GLM
 #include <deque>
 #include <map>
+#include <mutex>
+#include <queue>
 #include <set>
+#include <stack>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -105,462 +129,3826 @@ namespace AAEngine {
 	void CTester::RunTester()
 	{
 		//DynamicArrayTests();
+		//DynamicArrayRelocationTests();
+		//DynamicArrayBulkTests();
+		//HashMapTests();
+		//QueueTests();
+		//SoAArrayTests();
+		//ResourcePoolTests();
+		//ArrayViewTests();
+		//StringTests();
+		//SharedPtrTests();
+		//MemoryTests();
+		//FrameAllocatorTests();
+		//ObjectPoolTests();
 		//MatrixTests();
+		//MatrixInverseTests();
+		//MathBatchTests();
+		//QuaternionTests();
+		//TransformTests();
+		//VectorTests();
+		//TranscendentalTests();
 		//AlgorithmTests();
 		//TreeTests();
 	}
 
 	void CTester::MatrixTests()
 	{
-		FMatrix44f Mat1({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
+		// Every matrix of an array times one matrix, so the timings measure throughput and not the latency of a chain of products
+		constexpr int NumMatrices = 1024;
+		constexpr int TestIter = 10000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		auto RunMatrixMultiplyTests = [](auto Zero, const char* TypeName)
+		{
+			using T = decltype(Zero);
+			using FMatrix = Math::TMatrix44<T>;
+			using GLMMatrix = std::conditional_t<std::is_same_v<T, float>, glm::mat4, glm::dmat4>;
+			static_assert(sizeof(GLMMatrix) == sizeof(FMatrix), "GLM matrices are copied as raw memory!");
+
+			TArray<FMatrix> Mats;
+			for (int i = 0; i < NumMatrices; i++)
+			{
+				const T Val = T(i % 17) * T(0.125);
+				Mats.PushBack(FMatrix({ 1, Val, 3, 4 }, { 1, 2, -Val, 4 }, { Val, 0, 3, 4 }, { 0, 2, 3, Val }));
+			}
+			const FMatrix Rhs({ 1, 0, 0, 2 }, { 1, 2, 0, 4 }, { 1, 0, 3, 4 }, { 0, 2, 3, 4 });
+
+			TArray<FMatrix> Results;
+			TArray<FMatrix> Reference;
+			Results.SetNumUninitialized(NumMatrices);
+			Reference.SetNumUninitialized(NumMatrices);
+
+			auto GetKernel = [](const Math::FMathKernels& Kernels)
+			{
+				if constexpr (std::is_same_v<T, float>)
+				{
+					return Kernels.MatrixMultiplyFloat;
+				}
+				else
+				{
+					return Kernels.MatrixMultiplyDouble;
+				}
+			};
+
+			auto MaxError = [&](const T* Values)
+			{
+				T Error = 0;
+				for (int i = 0; i < NumMatrices * 16; i++)
+				{
+					const T Diff = Values[i] - Reference[i / 16].MLin[i % 16];
+					Error = Diff > Error ? Diff : (-Diff > Error ? -Diff : Error);
+				}
+				return Error;
+			};
+
+			auto Report = [&](const char* Name, long long Dur, const T* Values)
+			{
+				AA_CORE_LOG(Info, "%s Mat Mult %-12s: %f ns per product, max error %g", TypeName, Name,
+					(double)Dur * 1000.0 / ((double)NumMatrices * TestIter), (double)MaxError(Values));
+			};
+
+			for (int i = 0; i < NumMatrices; i++)
+			{
+				GetKernel(Math::FMathDispatch::GetKernels(Math::EMathBackend::Scalar))(&Reference[i], &Mats[i], &Rhs);
+			}
+
+			for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+			{
+				const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+				const char* BackendName = Math::FMathDispatch::GetBackendName(MathBackend);
+				if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+				{
+					AA_CORE_LOG(Info, "%s Mat Mult %-12s: not supported on this CPU", TypeName, BackendName);
+					continue;
+				}
+
+				auto Kernel = GetKernel(Math::FMathDispatch::GetKernels(MathBackend));
+				TTimer<TestTimeResolution> Timer("Mat Mult", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						Kernel(&Results[i], &Mats[i], &Rhs);
+					}
+				}
+				Report(BackendName, Timer.Reset(), Results[0].MLin);
+			}
+
+			// What FMatrix44 * FMatrix44 costs, the active backend behind the dispatch
+			{
+				TTimer<TestTimeResolution> Timer("Mat Mult", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						Results[i] = Mats[i] * Rhs;
+					}
+				}
+				Report("operator*", Timer.Reset(), Results[0].MLin);
+			}
+
+			// GLM is column major, Rhs * Mat on the same memory is Mat * Rhs of the row major matrices
+			{
+				TArray<GLMMatrix> GLMMats;
+				TArray<GLMMatrix> GLMResults;
+				GLMMats.SetNumUninitialized(NumMatrices);
+				GLMResults.SetNumUninitialized(NumMatrices);
+				FMemory::MemCopy(&GLMMats[0], &Mats[0], NumMatrices * sizeof(GLMMatrix));
+				GLMMatrix GLMRhs;
+				FMemory::MemCopy(&GLMRhs, &Rhs, sizeof(GLMMatrix));
+
+				TTimer<TestTimeResolution> Timer("GLM Mat Mult", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						GLMResults[i] = GLMRhs * GLMMats[i];
+					}
+				}
+				Report("GLM", Timer.Reset(), &GLMResults[0][0][0]);
+			}
+		};
+
+		AA_CORE_LOG(Info, "Active math backend: %s", Math::FMathDispatch::GetBackendName(Math::FMathDispatch::GetBackend()));
+		RunMatrixMultiplyTests(0.0f, "Float");
+		RunMatrixMultiplyTests(0.0, "Double");
+	}
+
+	void CTester::MatrixInverseTests()
+	{
+		constexpr int NumMatrices = 1024;
+		constexpr int TestIter = 10000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		auto RunMatrixInverseTests = [](auto Zero, const char* TypeName)
+		{
+			using T = decltype(Zero);
+			using FMatrix = Math::TMatrix44<T>;
+			using GLMMatrix = std::conditional_t<std::is_same_v<T, float>, glm::mat4, glm::dmat4>;
+			static_assert(sizeof(GLMMatrix) == sizeof(FMatrix), "GLM matrices are copied as raw memory!");
+
+			// Diagonally dominant matrices are always invertible, the affine ones are rotation * scale + translation
+			TArray<FMatrix> Mats;
+			TArray<FMatrix> AffineMats;
+			for (int i = 0; i < NumMatrices; i++)
+			{
+				const T Val = T(i % 17) * T(0.125);
+				Mats.PushBack(FMatrix({ 6 + Val, 1, -2, Val }, { 1, 5, Val, 2 }, { -Val, 2, 7, 1 }, { 3, Val, 1, 8 - Val }));
+
+				FMatrix Affine = FMatrix::MakeFromRotationXYZ(Math::TEuler<T>(Val * 10, Val * 40, Val * 25));
+				for (int Column = 0; Column < 3; Column++)
+				{
+					Affine.M[Column][Column] *= 1 + Val;
+				}
+				Affine.M[3][0] = Val * 10;
+				Affine.M[3][1] = -Val;
+				Affine.M[3][2] = 3;
+				AffineMats.PushBack(Affine);
+			}
+
+			TArray<FMatrix> Results;
+			TArray<FMatrix> Reference;
+			TArray<FMatrix> AffineReference;
+			Results.SetNumUninitialized(NumMatrices);
+			Reference.SetNumUninitialized(NumMatrices);
+			AffineReference.SetNumUninitialized(NumMatrices);
+
+			using FInverseKernel = bool(*)(FMatrix*, const FMatrix*);
+			auto GetInverseKernel = [](const Math::FMathKernels& Kernels) -> FInverseKernel
+			{
+				if constexpr (std::is_same_v<T, float>)
+				{
+					return Kernels.MatrixInverseFloat;
+				}
+				else
+				{
+					return Kernels.MatrixInverseDouble;
+				}
+			};
+			auto GetAffineKernel = [](const Math::FMathKernels& Kernels) -> FInverseKernel
+			{
+				if constexpr (std::is_same_v<T, float>)
+				{
+					return Kernels.MatrixInverseAffineFloat;
+				}
+				else
+				{
+					return Kernels.MatrixInverseAffineDouble;
+				}
+			};
+
+			auto MaxError = [&](const T* Values, const TArray<FMatrix>& Expected)
+			{
+				T Error = 0;
+				for (int i = 0; i < NumMatrices * 16; i++)
+				{
+					const T Diff = Values[i] - Expected[i / 16].MLin[i % 16];
+					Error = Diff > Error ? Diff : (-Diff > Error ? -Diff : Error);
+				}
+				return Error;
+			};
+
+			auto Report = [&](const char* Test, const char* Name, long long Dur, double Error)
+			{
+				AA_CORE_LOG(Info, "%s %-11s %-12s: %f ns per matrix, max error %g", TypeName, Test, Name,
+					(double)Dur * 1000.0 / ((double)NumMatrices * TestIter), Error);
+			};
+
+			const Math::FMathKernels& ScalarKernels = Math::FMathDispatch::GetKernels(Math::EMathBackend::Scalar);
+			for (int i = 0; i < NumMatrices; i++)
+			{
+				GetInverseKernel(ScalarKernels)(&Reference[i], &Mats[i]);
+				GetAffineKernel(ScalarKernels)(&AffineReference[i], &AffineMats[i]);
+			}
+
+			for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+			{
+				const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+				const char* BackendName = Math::FMathDispatch::GetBackendName(MathBackend);
+				if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+				{
+					AA_CORE_LOG(Info, "%s Inverse     %-12s: not supported on this CPU", TypeName, BackendName);
+					continue;
+				}
+
+				const FInverseKernel InverseKernel = GetInverseKernel(Math::FMathDispatch::GetKernels(MathBackend));
+				TTimer<TestTimeResolution> Timer("Mat Inverse", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						InverseKernel(&Results[i], &Mats[i]);
+					}
+				}
+				Report("Inverse", BackendName, Timer.Reset(), (double)MaxError(Results[0].MLin, Reference));
+
+				const FInverseKernel AffineKernel = GetAffineKernel(Math::FMathDispatch::GetKernels(MathBackend));
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						AffineKernel(&Results[i], &AffineMats[i]);
+					}
+				}
+				Report("Affine Inv", BackendName, Timer.Reset(), (double)MaxError(Results[0].MLin, AffineReference));
+			}
+
+			// GLM is column major, the inverse and transpose of the transposed memory are the same memory as ours
+			TArray<GLMMatrix> GLMMats;
+			TArray<GLMMatrix> GLMResults;
+			GLMMats.SetNumUninitialized(NumMatrices);
+			GLMResults.SetNumUninitialized(NumMatrices);
+			FMemory::MemCopy(&GLMMats[0], &Mats[0], NumMatrices * sizeof(GLMMatrix));
+			{
+				TTimer<TestTimeResolution> Timer("GLM Inverse", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						GLMResults[i] = glm::inverse(GLMMats[i]);
+					}
+				}
+				Report("Inverse", "GLM", Timer.Reset(), (double)MaxError(&GLMResults[0][0][0], Reference));
+			}
+
+			// Determinant, the reference is the Laplace expansion the engine used before, errors are relative
+			TArray<T> Dets;
+			TArray<T> ReferenceDets;
+			Dets.SetNumUninitialized(NumMatrices);
+			auto DeterminantError = [&](const T* Values)
+			{
+				T Error = 0;
+				for (int i = 0; i < NumMatrices; i++)
+				{
+					const T Diff = (Values[i] - ReferenceDets[i]) / ReferenceDets[i];
+					Error = Diff > Error ? Diff : (-Diff > Error ? -Diff : Error);
+				}
+				return Error;
+			};
+			{
+				TTimer<TestTimeResolution> Timer("Mat Determinant", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						const T (&M)[4][4] = Mats[i].M;
+						Dets[i] = M[0][0] * ((M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2])) - (M[1][2] * (M[2][1] * M[3][3] - M[2][3] * M[3][1])) + (M[1][3] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]))) -
+								M[0][1] * ((M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2])) - (M[1][2] * (M[2][0] * M[3][3] - M[2][3] * M[3][0])) + (M[1][3] * (M[2][0] * M[3][2] - M[2][2] * M[3][0]))) +
+								M[0][2] * ((M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1])) - (M[1][1] * (M[2][0] * M[3][3] - M[2][3] * M[3][0])) + (M[1][3] * (M[2][0] * M[3][1] - M[2][1] * M[3][0]))) -
+								M[0][3] * ((M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1])) - (M[1][1] * (M[2][0] * M[3][2] - M[2][2] * M[3][0])) + (M[1][2] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])));
+					}
+				}
+				ReferenceDets = Dets;
+				Report("Determinant", "Scalar", Timer.Reset(), 0.0);
+
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						Dets[i] = Mats[i].Determinant();
+					}
+				}
+				Report("Determinant", "SIMD", Timer.Reset(), (double)DeterminantError(&Dets[0]));
+
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						Dets[i] = glm::determinant(GLMMats[i]);
+					}
+				}
+				Report("Determinant", "GLM", Timer.Reset(), (double)DeterminantError(&Dets[0]));
+			}
+
+			// Transpose, checked against an element loop
+			TArray<FMatrix> Transposed;
+			Transposed.SetNumUninitialized(NumMatrices);
+			{
+				TTimer<TestTimeResolution> Timer("Mat Transpose", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						for (int Row = 0; Row < 4; Row++)
+						{
+							for (int Column = 0; Column < 4; Column++)
+							{
+								Transposed[i].M[Column][Row] = Mats[i].M[Row][Column];
+							}
+						}
+					}
+				}
+				Report("Transpose", "Scalar", Timer.Reset(), 0.0);
+
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						Results[i] = Mats[i].GetTranspose();
+					}
+				}
+				Report("Transpose", "SIMD", Timer.Reset(), (double)MaxError(Results[0].MLin, Transposed));
+
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumMatrices; i++)
+					{
+						GLMResults[i] = glm::transpose(GLMMats[i]);
+					}
+				}
+				Report("Transpose", "GLM", Timer.Reset(), (double)MaxError(&GLMResults[0][0][0], Transposed));
+			}
+		};
+
+		AA_CORE_LOG(Info, "Active math backend: %s", Math::FMathDispatch::GetBackendName(Math::FMathDispatch::GetBackend()));
+		RunMatrixInverseTests(0.0f, "Float");
+		RunMatrixInverseTests(0.0, "Double");
+	}
+
+	void CTester::MathBatchTests()
+	{
+		// Large enough that FMathBatch splits every test across threads
+		constexpr int NumElements = 1 << 17;
+		constexpr int TestIter = 100;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		TArray<FVector3f> Points;
+		TArray<FMatrix44f> Mats;
+		TSoAArray<FVector3f, FQuaternionf, FVector3f> Transforms(NumElements);
+		for (int i = 0; i < NumElements; i++)
+		{
+			const float Val = float(i % 17) * 0.125f;
+			Points.PushBack(FVector3f(Val, 1.0f - Val, Val * 3.0f));
+			Mats.PushBack(FMatrix44f({ 1, Val, 3, 0 }, { 1, 2, -Val, 0 }, { Val, 0, 3, 0 }, { 4, 2, 3, 1 }));
+
+			// Normalized quaternion around a varying axis
+			const float Angle = Val * 0.5f;
+			const float Sin = std::sin(Angle);
+			const FVector3f Axis(1.0f, Val, 2.0f - Val);
+			const float AxisScale = Sin / std::sqrt(Axis.X * Axis.X + Axis.Y * Axis.Y + Axis.Z * Axis.Z);
+			Transforms.Add(FVector3f(Val * 10.0f, -Val, 3.0f), FQuaternionf(Axis.X * AxisScale, Axis.Y * AxisScale, Axis.Z * AxisScale, std::cos(Angle)), FVector3f(1.0f + Val, 2.0f, 0.5f + Val));
+		}
+		const FMatrix44f Rhs = FMatrix44f::MakeFromRotationXYZ(Math::TEuler<float>(10, 40, 25)) * FMatrix44f::MakeFromLocation(FVector3f(1, 2, 3));
+		const FVector3f* Locations = Transforms.GetColumn<0>().Data();
+		const FQuaternionf* Rotations = Transforms.GetColumn<1>().Data();
+		const FVector3f* Scales = Transforms.GetColumn<2>().Data();
+
+		TArray<FVector3f> OutPoints;
+		TArray<FVector3f> ReferencePoints;
+		TArray<FMatrix44f> OutMats;
+		TArray<FMatrix44f> ReferenceMats;
+		TArray<FMatrix44f> ReferenceComposed;
+		OutPoints.SetNumUninitialized(NumElements);
+		ReferencePoints.SetNumUninitialized(NumElements);
+		OutMats.SetNumUninitialized(NumElements);
+		ReferenceMats.SetNumUninitialized(NumElements);
+		ReferenceComposed.SetNumUninitialized(NumElements);
+
+		const Math::FMathKernels& ScalarKernels = Math::FMathDispatch::GetKernels(Math::EMathBackend::Scalar);
+		ScalarKernels.TransformPointsFloat(&Points[0], &ReferencePoints[0], NumElements, &Rhs);
+		ScalarKernels.MultiplyMatricesFloat(&Mats[0], &Mats[0], &ReferenceMats[0], NumElements);
+		ScalarKernels.ComposeTransformsFloat(Locations, Rotations, Scales, &ReferenceComposed[0], NumElements);
+
+		auto MaxError = [&](const float* Values, const float* Expected, int NumValues)
+		{
+			float Error = 0;
+			for (int i = 0; i < NumValues; i++)
+			{
+				const float Diff = Values[i] - Expected[i];
+				Error = Diff > Error ? Diff : (-Diff > Error ? -Diff : Error);
+			}
+			return Error;
+		};
+
+		auto Report = [&](const char* Test, const char* Name, long long Dur, float Error)
+		{
+			AA_CORE_LOG(Info, "%-18s %-12s: %f ns per element, max error %g", Test, Name,
+				(double)Dur * 1000.0 / ((double)NumElements * TestIter), (double)Error);
+		};
+
+		auto ReportPoints = [&](const char* Name, long long Dur)
+		{
+			Report("Transform Points", Name, Dur, MaxError(OutPoints[0].XYZ, ReferencePoints[0].XYZ, NumElements * 3));
+		};
+		auto ReportMultiply = [&](const char* Name, long long Dur)
+		{
+			Report("Multiply Matrices", Name, Dur, MaxError(OutMats[0].MLin, ReferenceMats[0].MLin, NumElements * 16));
+		};
+		auto ReportCompose = [&](const char* Name, long long Dur)
+		{
+			Report("Compose Transforms", Name, Dur, MaxError(OutMats[0].MLin, ReferenceComposed[0].MLin, NumElements * 16));
+		};
+
+		// What callers paid before the batch API, one operator call per element
+		{
+			TTimer<TestTimeResolution> Timer("Per Object", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumElements; i++)
+				{
+					const FVector4f Result = FVector4f(Points[i].X, Points[i].Y, Points[i].Z, 1.0f) * Rhs;
+					OutPoints[i] = FVector3f(Result.X, Result.Y, Result.Z);
+				}
+			}
+			ReportPoints("Per Object", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumElements; i++)
+				{
+					OutMats[i] = Mats[i] * Mats[i];
+				}
+			}
+			ReportMultiply("Per Object", Timer.Reset());
+		}
+
+		// Single threaded kernels of every backend
+		for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+		{
+			const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+			const char* BackendName = Math::FMathDispatch::GetBackendName(MathBackend);
+			if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+			{
+				AA_CORE_LOG(Info, "%-18s %-12s: not supported on this CPU", "Batch", BackendName);
+				continue;
+			}
+
+			const Math::FMathKernels& Kernels = Math::FMathDispatch::GetKernels(MathBackend);
+			TTimer<TestTimeResolution> Timer("Batch Kernels", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Kernels.TransformPointsFloat(&Points[0], &OutPoints[0], NumElements, &Rhs);
+			}
+			ReportPoints(BackendName, Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Kernels.MultiplyMatricesFloat(&Mats[0], &Mats[0], &OutMats[0], NumElements);
+			}
+			ReportMultiply(BackendName, Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Kernels.ComposeTransformsFloat(Locations, Rotations, Scales, &OutMats[0], NumElements);
+			}
+			ReportCompose(BackendName, Timer.Reset());
+		}
+
+		// FMathBatch, the active backend split across threads
+		{
+			TTimer<TestTimeResolution> Timer("FMathBatch", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Math::FMathBatch::TransformPoints(&Points[0], &OutPoints[0], NumElements, Rhs);
+			}
+			ReportPoints("FMathBatch", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Math::FMathBatch::MultiplyMatrices(&Mats[0], &Mats[0], &OutMats[0], NumElements);
+			}
+			ReportMultiply("FMathBatch", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Math::FMathBatch::ComposeTransforms(Transforms, &OutMats[0]);
+			}
+			ReportCompose("FMathBatch", Timer.Reset());
+		}
+
+		AA_CORE_LOG(Info, "Active math backend: %s, %u threads", Math::FMathDispatch::GetBackendName(Math::FMathDispatch::GetBackend()), GetNumParallelThreads());
+	}
+
+	void CTester::QuaternionTests()
+	{
+		constexpr int NumRotations = 4096;
+		constexpr int TestIter = 1000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		TArray<FEulerf> Eulers;
+		TArray<FQuaternionf> Quats;
+		TArray<FQuaternionf> OtherQuats;
+		TArray<FMatrix44f> Mats;
+		for (int i = 0; i < NumRotations; i++)
+		{
+			const float Val = float(i % 97);
+			Eulers.PushBack(FEulerf(Val * 3.7f - 180.0f, Val * 1.85f - 89.0f, 180.0f - Val * 2.9f));
+			Quats.PushBack(FQuaternionf::MakeFromEuler(Eulers[i]));
+			OtherQuats.PushBack(FQuaternionf::MakeFromEuler(FEulerf(Val * 0.5f, 90.0f - Val * 2.0f, Val * 3.0f)));
+			Mats.PushBack(FMatrix44f::MakeFromRotationXYZ(Eulers[i]));
+		}
+		const FEulerf RhsEuler(30.0f, -45.0f, 60.0f);
+		const FQuaternionf RhsQuat = FQuaternionf::MakeFromEuler(RhsEuler);
+		const FMatrix44f RhsMat = FMatrix44f::MakeFromRotationXYZ(RhsEuler);
+
+		auto MatrixError = [](const FMatrix44f& Mat1, const FMatrix44f& Mat2)
+		{
+			float Error = 0;
+			for (int i = 0; i < 16; i++)
+			{
+				Error = Math::FMath::Max(Error, Math::FMath::Abs(Mat1.MLin[i] - Mat2.MLin[i]));
+			}
+			return Error;
+		};
+
+		// Conversions against the matrix path, every error should be around float precision
+		{
+			float EulerError = 0, RoundTripError = 0, MatrixRoundTripError = 0, RotateError = 0, ComposeError = 0;
+			for (int i = 0; i < NumRotations; i++)
+			{
+				EulerError = Math::FMath::Max(EulerError, MatrixError(Quats[i].ToMatrix(), Mats[i]));
+				RoundTripError = Math::FMath::Max(RoundTripError, MatrixError(FMatrix44f::MakeFromRotationXYZ(Quats[i].ToEuler()), Mats[i]));
+				MatrixRoundTripError = Math::FMath::Max(MatrixRoundTripError, MatrixError(FQuaternionf::MakeFromMatrix(Mats[i]).ToMatrix(), Mats[i]));
+				ComposeError = Math::FMath::Max(ComposeError, MatrixError((Quats[i] * RhsQuat).ToMatrix(), Mats[i] * RhsMat));
+
+				const FVector3f Vec(1.0f, -2.0f, float(i % 7));
+				const FVector3f Rotated = Quats[i].RotateVector(Vec);
+				const FVector4f Expected = FVector4f(Vec.X, Vec.Y, Vec.Z, 0.0f) * Mats[i];
+				RotateError = Math::FMath::Max(RotateError, Math::FMath::Max(Math::FMath::Abs(Rotated.X - Expected.X), Math::FMath::Max(Math::FMath::Abs(Rotated.Y - Expected.Y), Math::FMath::Abs(Rotated.Z - Expected.Z))));
+			}
+			AA_CORE_LOG(Info, "Quaternion max errors: FromEuler %g, ToEuler %g, FromMatrix %g, Multiply %g, RotateVector %g",
+				(double)EulerError, (double)RoundTripError, (double)MatrixRoundTripError, (double)ComposeError, (double)RotateError);
+		}
+
+		auto Report = [&](const char* Name, long long Dur)
+		{
+			AA_CORE_LOG(Info, "%-24s: %f ns per rotation", Name, (double)Dur * 1000.0 / ((double)NumRotations * TestIter));
+		};
+
+		// Rotation composition, building the matrices from Eulers like the engine did, composing stored matrices and composing quaternions
+		{
+			TArray<FMatrix44f> MatResults;
+			TArray<FQuaternionf> QuatResults;
+			MatResults.SetNumUninitialized(NumRotations);
+			QuatResults.SetNumUninitialized(NumRotations);
+
+			TTimer<TestTimeResolution> Timer("Rotation Compose", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumRotations; i++)
+				{
+					MatResults[i] = FMatrix44f::MakeFromRotationXYZ(Eulers[i]) * FMatrix44f::MakeFromRotationXYZ(RhsEuler);
+				}
+			}
+			Report("Compose Euler Matrices", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumRotations; i++)
+				{
+					MatResults[i] = Mats[i] * RhsMat;
+				}
+			}
+			Report("Compose Matrices", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumRotations; i++)
+				{
+					QuatResults[i] = Quats[i] * RhsQuat;
+				}
+			}
+			Report("Compose Quaternions", Timer.Reset());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumRotations; i++)
+				{
+					QuatResults[i] = FQuaternionf::MakeFromEuler(Eulers[i]) * RhsQuat;
+				}
+			}
+			Report("Compose Euler Quaternions", Timer.Reset());
+		}
+
+		// Interpolation, one call per rotation against the batch kernels of every backend
+		{
+			TArray<FQuaternionf> Results;
+			TArray<FQuaternionf> Reference;
+			Results.SetNumUninitialized(NumRotations);
+			Reference.SetNumUninitialized(NumRotations);
+
+			auto MaxError = [&]()
+			{
+				float Error = 0;
+				for (int i = 0; i < NumRotations; i++)
+				{
+					for (int Element = 0; Element < 4; Element++)
+					{
+						Error = Math::FMath::Max(Error, Math::FMath::Abs(Results[i].XYZW[Element] - Reference[i].XYZW[Element]));
+					}
+				}
+				return Error;
+			};
+
+			auto RunInterpolationTests = [&](const char* Name, auto&& PerObject, auto GetKernel, auto&& Batch)
+			{
+				TTimer<TestTimeResolution> Timer("Quat Interpolation", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					for (int i = 0; i < NumRotations; i++)
+					{
+						Reference[i] = PerObject(Quats[i], OtherQuats[i], 0.3f);
+					}
+				}
+				AA_CORE_LOG(Info, "%s %-12s: %f ns per rotation", Name, "Per Object", (double)Timer.Reset() * 1000.0 / ((double)NumRotations * TestIter));
+
+				for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+				{
+					const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+					const char* BackendName = Math::FMathDispatch::GetBackendName(MathBackend);
+					if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+					{
+						AA_CORE_LOG(Info, "%s %-12s: not supported on this CPU", Name, BackendName);
+						continue;
+					}
+
+					const auto Kernel = GetKernel(Math::FMathDispatch::GetKernels(MathBackend));
+					Timer.Reset();
+					for (int TestNum = 0; TestNum < TestIter; TestNum++)
+					{
+						Kernel(&Quats[0], &OtherQuats[0], &Results[0], NumRotations, 0.3f);
+					}
+					const long long Dur = Timer.Reset();
+					AA_CORE_LOG(Info, "%s %-12s: %f ns per rotation, max error %g", Name, BackendName, (double)Dur * 1000.0 / ((double)NumRotations * TestIter), (double)MaxError());
+				}
+
+				Timer.Reset();
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					Batch(&Quats[0], &OtherQuats[0], &Results[0], NumRotations, 0.3f);
+				}
+				const long long Dur = Timer.Reset();
+				AA_CORE_LOG(Info, "%s %-12s: %f ns per rotation, max error %g", Name, "FMathBatch", (double)Dur * 1000.0 / ((double)NumRotations * TestIter), (double)MaxError());
+			};
+
+			RunInterpolationTests("Nlerp",
+				[](const FQuaternionf& Quat1, const FQuaternionf& Quat2, float Alpha) { return FQuaternionf::Nlerp(Quat1, Quat2, Alpha); },
+				[](const Math::FMathKernels& Kernels) { return Kernels.NlerpQuaternionsFloat; },
+				&Math::FMathBatch::NlerpQuaternions);
+			RunInterpolationTests("Slerp",
+				[](const FQuaternionf& Quat1, const FQuaternionf& Quat2, float Alpha) { return FQuaternionf::Slerp(Quat1, Quat2, Alpha); },
+				[](const Math::FMathKernels& Kernels) { return Kernels.SlerpQuaternionsFloat; },
+				&Math::FMathBatch::SlerpQuaternions);
+		}
+	}
+
+	void CTester::TransformTests()
+	{
+		constexpr int NumNodes = 4096;
+		constexpr int TestIter = 1000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		TArray<FEulerf> Eulers;
+		TArray<FVector3f> Locations;
+		TArray<FTransformf> Locals;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const float Val = float(i % 61);
+			Eulers.PushBack(FEulerf(Val * 5.0f - 150.0f, Val * 2.5f - 75.0f, Val * 3.0f));
+			Locations.PushBack(FVector3f(Val * 0.5f, 2.0f - Val, 1.0f));
+			Locals.PushBack(FTransformf(Locations[i], Eulers[i], FVector3f(1.0f + Val * 0.01f)));
+		}
+
+		auto MatrixError = [](const FMatrix44f& Mat1, const FMatrix44f& Mat2)
+		{
+			float Error = 0;
+			for (int i = 0; i < 16; i++)
+			{
+				Error = Math::FMath::Max(Error, Math::FMath::Abs(Mat1.MLin[i] - Mat2.MLin[i]));
+			}
+			return Error;
+		};
+		auto VectorError = [](const FVector3f& Vec1, const FVector3f& Vec2)
+		{
+			return Math::FMath::Max(Math::FMath::Abs(Vec1.X - Vec2.X), Math::FMath::Max(Math::FMath::Abs(Vec1.Y - Vec2.Y), Math::FMath::Abs(Vec1.Z - Vec2.Z)));
+		};
+
+		// Every operation against the same operation on the matrices, the product and inverse use uniform scales where they are exact
+		{
+			const FTransformf NonUniform(FVector3f(3.0f, -1.0f, 2.0f), FEulerf(20.0f, 35.0f, -60.0f), FVector3f(0.5f, 2.0f, -1.5f));
+			float MatrixErr = 0, ComposeErr = 0, InverseErr = 0, PositionErr = 0, InversePositionErr = 0, FromMatrixErr = 0;
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const FTransformf& Local = Locals[i];
+				const FTransformf& Other = Locals[(i * 7) % NumNodes];
+				const FMatrix44f RotationMatrix = FMatrix44f::MakeFromRotationXYZ(Eulers[i]);
+				FMatrix44f Expected = RotationMatrix;
+				for (int Element = 0; Element < 12; Element++)
+				{
+					Expected.MLin[Element] *= Local.GetScale().X;
+				}
+				Expected = Expected * FMatrix44f::MakeFromLocation(Locations[i]);
+
+				MatrixErr = Math::FMath::Max(MatrixErr, MatrixError(Local.GetMatrix(), Expected));
+				ComposeErr = Math::FMath::Max(ComposeErr, MatrixError((Local * Other).ToMatrix(), Local.ToMatrix() * Other.ToMatrix()));
+				InverseErr = Math::FMath::Max(InverseErr, MatrixError((Local * Local.GetInverse()).ToMatrix(), FMatrix44f::IdentityMatrix));
+
+				const FVector3f Position(float(i % 5), -3.0f, 0.25f);
+				const FVector4f ExpectedPosition = FVector4f(Position.X, Position.Y, Position.Z, 1.0f) * NonUniform.ToMatrix();
+				PositionErr = Math::FMath::Max(PositionErr, VectorError(NonUniform.TransformPosition(Position), FVector3f(ExpectedPosition.X, ExpectedPosition.Y, ExpectedPosition.Z)));
+				InversePositionErr = Math::FMath::Max(InversePositionErr, VectorError(NonUniform.InverseTransformPosition(NonUniform.TransformPosition(Position)), Position));
+				FromMatrixErr = Math::FMath::Max(FromMatrixErr, MatrixError(FTransformf::MakeFromMatrix(Local.ToMatrix()).ToMatrix(), Local.ToMatrix()));
+			}
+			FromMatrixErr = Math::FMath::Max(FromMatrixErr, MatrixError(FTransformf::MakeFromMatrix(NonUniform.ToMatrix()).ToMatrix(), NonUniform.ToMatrix()));
+			AA_CORE_LOG(Info, "Transform max errors: Matrix %g, Multiply %g, Inverse %g, TransformPosition %g, InverseTransformPosition %g, FromMatrix %g",
+				(double)MatrixErr, (double)ComposeErr, (double)InverseErr, (double)PositionErr, (double)InversePositionErr, (double)FromMatrixErr);
+		}
+
+		// Hierarchy update, each node is a child of the node a quarter of its index away like a wide scene tree.
+		// Every frame the local rotations change and the world matrices are rebuilt from the root down.
+		auto GetParent = [](int Index) { return (Index - 1) / 4; };
+		auto Report = [&](const char* Name, long long Dur)
+		{
+			AA_CORE_LOG(Info, "%-28s: %f ns per node", Name, (double)Dur * 1000.0 / ((double)NumNodes * TestIter));
+		};
+
+		TArray<FMatrix44f> WorldMatrices;
+		TArray<FTransformf> WorldTransforms;
+		WorldMatrices.SetNumUninitialized(NumNodes);
+		WorldTransforms.SetNumUninitialized(NumNodes);
+
+		TTimer<TestTimeResolution> Timer("Transform Hierarchy", false);
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			const FEulerf Spin(0.0f, float(TestNum % 360), 0.0f);
+			WorldMatrices[0] = FMatrix44f::MakeFromRotationXYZ(Eulers[0] + Spin) * FMatrix44f::MakeFromLocation(Locations[0]);
+			for (int i = 1; i < NumNodes; i++)
+			{
+				WorldMatrices[i] = FMatrix44f::MakeFromRotationXYZ(Eulers[i] + Spin) * FMatrix44f::MakeFromLocation(Locations[i]) * WorldMatrices[GetParent(i)];
+			}
+		}
+		Report("Euler Matrix Hierarchy", Timer.Reset());
+
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			const FQuaternionf Spin = FQuaternionf::MakeFromAngleAxis(float(TestNum % 360), FVector3f(0.0f, 1.0f, 0.0f));
+			Locals[0].SetRotation(Locals[0].GetRotation() * Spin);
+			WorldTransforms[0] = Locals[0];
+			WorldTransforms[0].GetMatrix();
+			for (int i = 1; i < NumNodes; i++)
+			{
+				Locals[i].SetRotation(Locals[i].GetRotation() * Spin);
+				WorldTransforms[i] = Locals[i] * WorldTransforms[GetParent(i)];
+				WorldTransforms[i].GetMatrix();
+			}
+		}
+		Report("Transform Hierarchy", Timer.Reset());
+
+		// Nothing moved, the cached matrices are handed out as they are
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			for (int i = 0; i < NumNodes; i++)
+			{
+				WorldMatrices[i] = WorldTransforms[i].GetMatrix();
+			}
+		}
+		Report("Cached Transform Matrices", Timer.Reset());
+
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			for (int i = 0; i < NumNodes; i++)
+			{
+				WorldMatrices[i] = WorldTransforms[i].ToMatrix();
+			}
+		}
+		Report("Rebuilt Transform Matrices", Timer.Reset());
+
+		TArray<FVector3f> Points;
+		Points.SetNumUninitialized(NumNodes);
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			for (int i = 0; i < NumNodes; i++)
+			{
+				Points[i] = WorldTransforms[i].TransformPosition(Locations[i]);
+			}
+		}
+		Report("Transform TransformPosition", Timer.Reset());
+
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const FVector4f Point = FVector4f(Locations[i].X, Locations[i].Y, Locations[i].Z, 1.0f) * WorldMatrices[i];
+				Points[i] = FVector3f(Point.X, Point.Y, Point.Z);
+			}
+		}
+		Report("Matrix TransformPosition", Timer.Reset());
+
+		for (int TestNum = 0; TestNum < TestIter; TestNum++)
+		{
+			for (int i = 0; i < NumNodes; i++)
+			{
+				WorldTransforms[i] = WorldTransforms[i].GetInverse();
+			}
+		}
+		Report("Transform Inverse", Timer.Reset());
+	}
+
+	void CTester::VectorTests()
+	{
+		constexpr int NumVectors = 4096;
+		constexpr int TestIter = 2000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		// InvSqrt against 1 / sqrt over a wide range, the error is relative
+		{
+			float MaxRelError = 0.0f;
+			for (float Value = 1e-6f; Value < 1e6f; Value *= 1.0001f)
+			{
+				const double Exact = 1.0 / std::sqrt((double)Value);
+				MaxRelError = Math::FMath::Max(MaxRelError, (float)(Math::FMath::Abs(Math::FMath::InvSqrt(Value) - Exact) / Exact));
+			}
+
+			TArray<float> Values;
+			TArray<float> Outputs;
+			for (int i = 0; i < NumVectors; i++)
+			{
+				Values.PushBack(0.5f + float(i % 101));
+			}
+			Outputs.SetNumUninitialized(NumVectors);
+
+			TTimer<TestTimeResolution> Timer("InvSqrt", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Outputs[i] = 1.0f / std::sqrt(Values[i]);
+				}
+			}
+			const long long ExactDur = Timer.Reset();
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Outputs[i] = Math::FMath::InvSqrt(Values[i]);
+				}
+			}
+			const long long FastDur = Timer.Reset();
+			AA_CORE_LOG(Info, "1 / sqrt        : %f ns", (double)ExactDur * 1000.0 / ((double)NumVectors * TestIter));
+			AA_CORE_LOG(Info, "FMath::InvSqrt  : %f ns, max relative error %g", (double)FastDur * 1000.0 / ((double)NumVectors * TestIter), (double)MaxRelError);
+		}
+
+		TArray<FVector4f> Vecs1;
+		TArray<FVector4f> Vecs2;
+		TArray<glm::vec4> GLMVecs1;
+		TArray<glm::vec4> GLMVecs2;
+		for (int i = 0; i < NumVectors; i++)
+		{
+			const float Val = float(i % 37) * 0.25f;
+			Vecs1.PushBack(FVector4f(Val, 1.0f - Val, 2.0f, Val * 0.5f + 0.1f));
+			Vecs2.PushBack(FVector4f(3.0f, Val, -Val, 1.0f));
+			GLMVecs1.PushBack(glm::vec4(Vecs1[i].X, Vecs1[i].Y, Vecs1[i].Z, Vecs1[i].W));
+			GLMVecs2.PushBack(glm::vec4(Vecs2[i].X, Vecs2[i].Y, Vecs2[i].Z, Vecs2[i].W));
+		}
+
+		TArray<FVector4f> Results;
+		TArray<FVector4f> Reference;
+		TArray<glm::vec4> GLMResults;
+		TArray<float> Scalars;
+		TArray<float> ReferenceScalars;
+		Results.SetNumUninitialized(NumVectors);
+		Reference.SetNumUninitialized(NumVectors);
+		GLMResults.SetNumUninitialized(NumVectors);
+		Scalars.SetNumUninitialized(NumVectors);
+		ReferenceScalars.SetNumUninitialized(NumVectors);
+
+		auto VectorError = [&](const float* Values)
+		{
+			float Error = 0.0f;
+			for (int i = 0; i < NumVectors * 4; i++)
+			{
+				Error = Math::FMath::Max(Error, Math::FMath::Abs(Values[i] - Reference[i / 4].XYZW[i % 4]));
+			}
+			return Error;
+		};
+		auto ScalarError = [&](const float* Values)
+		{
+			float Error = 0.0f;
+			for (int i = 0; i < NumVectors; i++)
+			{
+				Error = Math::FMath::Max(Error, Math::FMath::Abs(Values[i] - ReferenceScalars[i]));
+			}
+			return Error;
+		};
+		auto Report = [&](const char* TestName, const char* Name, long long Dur, float Error)
+		{
+			AA_CORE_LOG(Info, "%-10s %-8s: %f ns per vector, max error %g", TestName, Name, (double)Dur * 1000.0 / ((double)NumVectors * TestIter), (double)Error);
+		};
+
+		// Each test runs the component wise code the vectors had, FVector4f and GLM on the same data
+		auto RunVectorTest = [&](const char* TestName, auto&& ScalarOp, auto&& VectorOp, auto&& GLMOp)
+		{
+			TTimer<TestTimeResolution> Timer(TestName, false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Reference[i] = ScalarOp(Vecs1[i], Vecs2[i]);
+				}
+			}
+			Report(TestName, "Scalar", Timer.Reset(), 0.0f);
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Results[i] = VectorOp(Vecs1[i], Vecs2[i]);
+				}
+			}
+			Report(TestName, "FVector", Timer.Reset(), VectorError(Results[0].XYZW));
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					GLMResults[i] = GLMOp(GLMVecs1[i], GLMVecs2[i]);
+				}
+			}
+			Report(TestName, "GLM", Timer.Reset(), VectorError(&GLMResults[0].x));
+		};
+
+		auto RunScalarTest = [&](const char* TestName, auto&& ScalarOp, auto&& VectorOp, auto&& GLMOp)
+		{
+			TTimer<TestTimeResolution> Timer(TestName, false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					ReferenceScalars[i] = ScalarOp(Vecs1[i], Vecs2[i]);
+				}
+			}
+			Report(TestName, "Scalar", Timer.Reset(), 0.0f);
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Scalars[i] = VectorOp(Vecs1[i], Vecs2[i]);
+				}
+			}
+			Report(TestName, "FVector", Timer.Reset(), ScalarError(&Scalars[0]));
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumVectors; i++)
+				{
+					Scalars[i] = GLMOp(GLMVecs1[i], GLMVecs2[i]);
+				}
+			}
+			Report(TestName, "GLM", Timer.Reset(), ScalarError(&Scalars[0]));
+		};
+
+		RunVectorTest("MulAdd",
+			[](const FVector4f& A, const FVector4f& B) { return FVector4f(A.X * B.X + A.X, A.Y * B.Y + A.Y, A.Z * B.Z + A.Z, A.W * B.W + A.W); },
+			[](const FVector4f& A, const FVector4f& B) { return A * B + A; },
+			[](const glm::vec4& A, const glm::vec4& B) { return A * B + A; });
+
+		RunScalarTest("Dot",
+			[](const FVector4f& A, const FVector4f& B) { return A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W; },
+			[](const FVector4f& A, const FVector4f& B) { return A | B; },
+			[](const glm::vec4& A, const glm::vec4& B) { return glm::dot(A, B); });
+
+		RunScalarTest("Distance",
+			[](const FVector4f& A, const FVector4f& B)
+			{
+				const float DX = A.X - B.X, DY = A.Y - B.Y, DZ = A.Z - B.Z, DW = A.W - B.W;
+				return std::sqrt(DX * DX + DY * DY + DZ * DZ + DW * DW);
+			},
+			[](const FVector4f& A, const FVector4f& B) { return FVector4f::Distance(A, B); },
+			[](const glm::vec4& A, const glm::vec4& B) { return glm::distance(A, B); });
+
+		RunVectorTest("Normalize",
+			[](const FVector4f& A, const FVector4f&)
+			{
+				const float InvSize = 1.0f / std::sqrt(A.X * A.X + A.Y * A.Y + A.Z * A.Z + A.W * A.W);
+				return FVector4f(A.X * InvSize, A.Y * InvSize, A.Z * InvSize, A.W * InvSize);
+			},
+			[](const FVector4f& A, const FVector4f&) { return A.GetSafeNormal(); },
+			[](const glm::vec4& A, const glm::vec4&) { return glm::normalize(A); });
+	}
+
+	void CTester::TranscendentalTests()
+	{
+		// FMathBatch splits arrays this large across threads
+		constexpr int NumValues = 1 << 16;
+		constexpr int TestIter = 200;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		// Sin / Cos / ATan2 are bounded absolutely, Tan and Exp relatively, Log absolutely below 1 and relatively above
+		enum class EErrorKind { Absolute, Relative, Mixed };
+
+		TArray<float> Angles;
+		TArray<float> Ys;
+		TArray<float> Xs;
+		TArray<float> ExpInputs;
+		TArray<float> LogInputs;
+		for (int i = 0; i < NumValues; i++)
+		{
+			// Scrambled but repeatable values in [-1, 1)
+			const float Val1 = float((uint32_t(i) * 2654435761u) % NumValues) / NumValues * 2.0f - 1.0f;
+			const float Val2 = float((uint32_t(i) * 40503u + 12345u) % NumValues) / NumValues * 2.0f - 1.0f;
+
+			Angles.PushBack(Val1 * 8192.0f);
+			ExpInputs.PushBack(Val1 * 80.0f);
+			LogInputs.PushBack(std::exp2(Val1 * 100.0f));
+			// Every 64th pair on an axis, the signed zeros included
+			Ys.PushBack(i % 64 == 0 ? (i % 128 == 0 ? 0.0f : -0.0f) : Val2 * 10.0f);
+			Xs.PushBack(i % 64 == 0 ? Val1 : Val1 * 10.0f);
+		}
+
+		TArray<float> Outputs1;
+		TArray<float> Outputs2;
+		Outputs1.SetNumUninitialized(NumValues);
+		Outputs2.SetNumUninitialized(NumValues);
+
+		auto MaxError = [&](const TArray<float>& Values, const TArray<double>& Expected, EErrorKind Kind)
+		{
+			double Error = 0.0;
+			for (int i = 0; i < NumValues; i++)
+			{
+				const double Diff = std::abs((double)Values[i] - Expected[i]);
+				const double Magnitude = std::abs(Expected[i]);
+				const double Scale = Kind == EErrorKind::Absolute ? 1.0 : (Kind == EErrorKind::Relative ? Magnitude : (Magnitude > 1.0 ? Magnitude : 1.0));
+				Error = Diff / Scale > Error ? Diff / Scale : Error;
+			}
+			return Error;
+		};
+
+		auto Report = [&](const char* Test, const char* Name, long long Dur, double Error)
+		{
+			AA_CORE_LOG(Info, "%-6s %-10s: %f ns per value, max error %g", Test, Name,
+				(double)Dur * 1000.0 / ((double)NumValues * TestIter), Error);
+		};
+
+		// libm one value at a time, then the kernel of every backend single threaded, then FMathBatch across threads
+		auto RunTest = [&](const char* Name, const TArray<float>& Inputs, EErrorKind Kind, float (*LibmFunction)(float), double (*Reference)(double),
+			void (*Math::FMathKernels::*Kernel)(const float*, float*, size_t), void (*BatchFunction)(const float*, float*, size_t))
+		{
+			TArray<double> Expected;
+			for (int i = 0; i < NumValues; i++)
+			{
+				Expected.PushBack(Reference((double)Inputs[i]));
+			}
+
+			TTimer<TestTimeResolution> Timer(Name, false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumValues; i++)
+				{
+					Outputs1[i] = LibmFunction(Inputs[i]);
+				}
+			}
+			Report(Name, "libm", Timer.Reset(), MaxError(Outputs1, Expected, Kind));
+
+			for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+			{
+				const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+				if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+				{
+					continue;
+				}
+
+				const Math::FMathKernels& Kernels = Math::FMathDispatch::GetKernels(MathBackend);
+				Timer.Reset();
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					(Kernels.*Kernel)(&Inputs[0], &Outputs1[0], NumValues);
+				}
+				Report(Name, Math::FMathDispatch::GetBackendName(MathBackend), Timer.Reset(), MaxError(Outputs1, Expected, Kind));
+			}
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				BatchFunction(&Inputs[0], &Outputs1[0], NumValues);
+			}
+			Report(Name, "FMathBatch", Timer.Reset(), MaxError(Outputs1, Expected, Kind));
+		};
+
+		RunTest("Sin", Angles, EErrorKind::Absolute, [](float A) { return std::sin(A); }, [](double A) { return std::sin(A); },
+			&Math::FMathKernels::SinFloat, &Math::FMathBatch::Sin);
+		RunTest("Cos", Angles, EErrorKind::Absolute, [](float A) { return std::cos(A); }, [](double A) { return std::cos(A); },
+			&Math::FMathKernels::CosFloat, &Math::FMathBatch::Cos);
+		RunTest("Tan", Angles, EErrorKind::Relative, [](float A) { return std::tan(A); }, [](double A) { return std::tan(A); },
+			&Math::FMathKernels::TanFloat, &Math::FMathBatch::Tan);
+		RunTest("Exp", ExpInputs, EErrorKind::Relative, [](float A) { return std::exp(A); }, [](double A) { return std::exp(A); },
+			&Math::FMathKernels::ExpFloat, &Math::FMathBatch::Exp);
+		RunTest("Log", LogInputs, EErrorKind::Mixed, [](float A) { return std::log(A); }, [](double A) { return std::log(A); },
+			&Math::FMathKernels::LogFloat, &Math::FMathBatch::Log);
+
+		// SinCos against a Sin and a Cos call, the error is the larger one of the two
+		{
+			TArray<double> ExpectedSin;
+			TArray<double> ExpectedCos;
+			for (int i = 0; i < NumValues; i++)
+			{
+				ExpectedSin.PushBack(std::sin((double)Angles[i]));
+				ExpectedCos.PushBack(std::cos((double)Angles[i]));
+			}
+			auto SinCosError = [&]()
+			{
+				const double SinError = MaxError(Outputs1, ExpectedSin, EErrorKind::Absolute);
+				const double CosError = MaxError(Outputs2, ExpectedCos, EErrorKind::Absolute);
+				return SinError > CosError ? SinError : CosError;
+			};
+
+			TTimer<TestTimeResolution> Timer("SinCos", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumValues; i++)
+				{
+					Outputs1[i] = std::sin(Angles[i]);
+					Outputs2[i] = std::cos(Angles[i]);
+				}
+			}
+			Report("SinCos", "libm", Timer.Reset(), SinCosError());
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumValues; i++)
+				{
+					Math::FMath::SinCos(Angles[i], Outputs1[i], Outputs2[i]);
+				}
+			}
+			Report("SinCos", "FMath", Timer.Reset(), SinCosError());
+
+			for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+			{
+				const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+				if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+				{
+					continue;
+				}
+
+				const Math::FMathKernels& Kernels = Math::FMathDispatch::GetKernels(MathBackend);
+				Timer.Reset();
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					Kernels.SinCosFloat(&Angles[0], &Outputs1[0], &Outputs2[0], NumValues);
+				}
+				Report("SinCos", Math::FMathDispatch::GetBackendName(MathBackend), Timer.Reset(), SinCosError());
+			}
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Math::FMathBatch::SinCos(&Angles[0], &Outputs1[0], &Outputs2[0], NumValues);
+			}
+			Report("SinCos", "FMathBatch", Timer.Reset(), SinCosError());
+		}
+
+		// ATan2, and the signs of the results on the axes, where atan2 tells the signed zeros apart
+		{
+			TArray<double> Expected;
+			for (int i = 0; i < NumValues; i++)
+			{
+				Expected.PushBack(std::atan2((double)Ys[i], (double)Xs[i]));
+			}
+
+			TTimer<TestTimeResolution> Timer("ATan2", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				for (int i = 0; i < NumValues; i++)
+				{
+					Outputs1[i] = std::atan2(Ys[i], Xs[i]);
+				}
+			}
+			Report("ATan2", "libm", Timer.Reset(), MaxError(Outputs1, Expected, EErrorKind::Absolute));
+
+			for (uint8_t Backend = 0; Backend < (uint8_t)Math::EMathBackend::Count; Backend++)
+			{
+				const Math::EMathBackend MathBackend = (Math::EMathBackend)Backend;
+				if (!Math::FMathDispatch::IsBackendSupported(MathBackend))
+				{
+					continue;
+				}
+
+				const Math::FMathKernels& Kernels = Math::FMathDispatch::GetKernels(MathBackend);
+				Timer.Reset();
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					Kernels.ATan2Float(&Ys[0], &Xs[0], &Outputs1[0], NumValues);
+				}
+				Report("ATan2", Math::FMathDispatch::GetBackendName(MathBackend), Timer.Reset(), MaxError(Outputs1, Expected, EErrorKind::Absolute));
+
+				int NumWrongSigns = 0;
+				for (int i = 0; i < NumValues; i++)
+				{
+					NumWrongSigns += std::signbit(Outputs1[i]) != std::signbit(Expected[i]) ? 1 : 0;
+				}
+				if (NumWrongSigns > 0)
+				{
+					AA_CORE_LOG(Error, "ATan2 %s: %d results with the wrong sign", Math::FMathDispatch::GetBackendName(MathBackend), NumWrongSigns);
+				}
+			}
+
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Math::FMathBatch::ATan2(&Ys[0], &Xs[0], &Outputs1[0], NumValues);
+			}
+			Report("ATan2", "FMathBatch", Timer.Reset(), MaxError(Outputs1, Expected, EErrorKind::Absolute));
+		}
+	}
+
+	void CTester::MatrixGLMTests()
+	{
+		FMatrix44f Mat({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
+		//AA_CORE_LOG(Info, "Mat: \n%s\n", (Mat.GetInverseFast()).ToString().c_str());
 		glm::mat4 GMat({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
-		FMatrix44f Mat2({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
+		//PrintGLMMat(glm::inverse(GMat));
+		glm::mat4 GNewMat({ 1,0,0,2 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
+		
+		glm::mat4 X = glm::mat4(1.0f);
+		glm::mat4 Y = glm::mat4(1.0f);
+		glm::mat4 Z = glm::mat4(1.0f);
+
+		X = glm::rotate(X, 45.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+		Y = glm::rotate(Y, 45.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+		Z = glm::rotate(Z, 45.0f, glm::vec3(0.0f, 0.0f, 1.0f));
+
+		glm::mat4 FinalRot = X * Y * Z;
+		FMatrix44f Rot = FMatrix44f::MakeFromRotationXYZ({ 45.f, 45.f, 45.f });
+		FMatrix44f NewMat({ 1,0,0,2 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
+		FMatrix44f Result;
+		FVector4f NewVec(1.0f);
+		FVector4f ResVec = NewVec * Mat * NewMat;
+		glm::vec4 GNewVec(1.0f);
+		glm::vec4 GResVec = GNewMat * GMat * GNewVec;
+		glm::mat4 GProj = glm::perspective(1.5f, 1.0f, 0.01f, 100.f);
+		FMatrix44f Proj = FMatrix44f::MakePerspective(1.5f, 1.0f, 0.01f, 100.f);
+		TArray<FMatrix44f> MyArray;
+		TArray<glm::mat4> GLMArray;
+		AA_CORE_LOG(Info, "Mat: \n%s\n", (Proj).ToString().c_str());
+		PrintGLMMat(GProj);
+
 		constexpr int TestSize = 10000000;
 		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+		/*{
+			TTimer<TestTimeResolution> Timer("Mat Mult");
+			for (int i = 0; i < TestSize; i++)
+			{
+				MyArray.PushBack(Mat.GetInverseFast());
+			}
+		}*/
+		NewMat *= Mat;
+		//AA_CORE_LOG(Info, "Mat: \n%s\n", (ResVec).ToString().c_str());
+		//std::cout << FMatrix44f({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 }).Determinant3x3() << std::endl;
+		//std::cout << glm::determinant(glm::mat4({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 })) << std::endl;
+		//glm::mat4 GResult;
+		/*{
+			TTimer<TestTimeResolution> Timer("GLM Mat Mult");
+			for (int i = 0; i < TestSize; i++)
+			{
+				GLMArray.PushBack(glm::inverse(GMat));
+			}
+		}*/
+		/*for (int i = 0; i < 16; i++)
+		{
+			std::cout << Mat.MLin[i] << " ";
+		}
+		std::cout << "\n";
+		PrintGLMMat(GResVec);*/
+	}
+
+	void CTester::AlgorithmTests()
+	{
+		constexpr int TestSize = 10;
+		constexpr int TestIter = 1;
+		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Sort", false);
+			for (int i = 0; i < TestIter; i++)
+			{
+				TArray<float> ToSortAA(TestSize);
+				for (int i = 0; i < TestSize; i++)
+				{
+					ToSortAA.EmplaceBack(/*float(TestSize - i)); */ float(rand()) / RAND_MAX);
+				}
+				Timer.Reset();
+				ToSortAA.Sort();
+				Dur += Timer.Reset();
+				AA_CORE_LOG(Info, "SortedArray: %s", (ToSortAA).ToString().c_str());
+			}
+			AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Sort", false);
+			for (int i = 0; i < TestIter; i++)
+			{
+				std::vector<float> ToSort;
+				for (int i = 0; i < TestSize; i++)
+				{
+					ToSort.emplace_back(float(rand()) / RAND_MAX);
+				}
+				Timer.Reset();
+				std::sort(ToSort.begin(), ToSort.end());
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur / TestIter);
+		}
+
+		constexpr int LargeTestSize = 1000000;
+		constexpr int LargeTestIter = 10;
+		TArray<float> Floats(LargeTestSize);
+		for (int i = 0; i < LargeTestSize; i++)
+		{
+			Floats.EmplaceBack(float(rand()) / RAND_MAX - 0.5f);
+		}
+
+		// Draw call sorted by its Render Key, e.g. { Layer, Shader, Material, Depth } packed into 64 bits
+		struct FRenderItem
+		{
+			uint64_t RenderKey;
+			uint32_t MeshIndex;
+		};
+		TArray<FRenderItem> RenderItems(LargeTestSize);
+		for (int i = 0; i < LargeTestSize; i++)
+		{
+			RenderItems.PushBack({ (uint64_t(rand() % 8) << 56) | (uint64_t(rand() % 64) << 40) | uint64_t(rand()), uint32_t(i) });
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Intro Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				TArray<float> ToSortAA = Floats;
+				Timer.Reset();
+				ToSortAA.Sort();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Intro Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				std::vector<float> ToSort(Floats.Data(), Floats.Data() + Floats.Num());
+				Timer.Reset();
+				std::sort(ToSort.begin(), ToSort.end());
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Stable Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				TArray<float> ToSortAA = Floats;
+				Timer.Reset();
+				ToSortAA.StableSort();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Stable Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Stable Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				std::vector<float> ToSort(Floats.Data(), Floats.Data() + Floats.Num());
+				Timer.Reset();
+				std::stable_sort(ToSort.begin(), ToSort.end());
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Stable Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Radix Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				TArray<float> ToSortAA = Floats;
+				Timer.Reset();
+				ToSortAA.RadixSort();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Radix Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Parallel Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				TArray<float> ToSortAA = Floats;
+				Timer.Reset();
+				ToSortAA.ParallelSort();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Parallel Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Render Key Radix Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				TArray<FRenderItem> ToSortAA = RenderItems;
+				Timer.Reset();
+				ToSortAA.RadixSort([](const FRenderItem& Item) { return Item.RenderKey; });
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Render Key Radix Sort: %f", (float)Dur / LargeTestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Render Key Stable Sort", false);
+			for (int i = 0; i < LargeTestIter; i++)
+			{
+				std::vector<FRenderItem> ToSort(RenderItems.Data(), RenderItems.Data() + RenderItems.Num());
+				Timer.Reset();
+				std::stable_sort(ToSort.begin(), ToSort.end(), [](const FRenderItem& A, const FRenderItem& B) { return A.RenderKey < B.RenderKey; });
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Render Key Stable Sort: %f", (float)Dur / LargeTestIter);
+		}
+	}
+
+	void CTester::TreeTests()
+	{
+		std::deque<float> Temp;
+		std::map<float, float> Temp2;
+		std::set<float> Temp3;
+
+
+
+		// BinarySearchTree tests
+		TBinarySearchTree<float> Tree;
+		TRedBlackTree<float> RBTree;
+		RBTree.Insert(5.0f);
+		if (Tree.Search(15.f))
+		{
+			AA_CORE_LOG(Info, "Found 15");
+		}
+		else
+		{
+			AA_CORE_LOG(Info, "NO Found 15");
+		}
+		Temp3.insert(5.0f);
+		Temp3.insert(24.0f);
+		Temp3.insert(4.0f);
+		Temp3.insert(15.0f);
+		Temp3.insert(14.0f);
+		Temp3.insert(7.0f);
+		Temp3.insert(17.0f);
+		Temp3.insert(13.0f);
+		Temp3.insert(25.0f);
+		Temp3.insert(3.0f);
+		Temp3.insert(27.0f);
+		Temp3.insert(23.0f);
+
+		for (auto& T : Temp3)
+		{
+			std::cout << T << "\n";
+		}
+		std::cout <<"\n";
+
+		RBTree.Insert(5.0f);
+		RBTree.Insert(24.0f);
+		RBTree.Insert(4.0f);
+		RBTree.Insert(15.0f);
+		RBTree.Insert(14.0f);
+		RBTree.Insert(7.0f);
+		RBTree.Insert(17.0f);
+		RBTree.Insert(13.0f);
+		RBTree.Insert(25.0f);
+		RBTree.Insert(3.0f);
+		RBTree.Insert(27.0f);
+		RBTree.Insert(23.0f);
+
+		RBTree.InOrderPrint();
+		AA_CORE_LOG(Info, "Size AA: %d", sizeof(RBTree));
+		AA_CORE_LOG(Info, "Size AA: %d", sizeof(Temp3));
+		RBTree.Remove(15.0f);
+
+		//RBTree.InOrderPrint();
+		RBTree.Remove(17.0f);
+
+		//RBTree.InOrderPrint();
+		RBTree.Remove(14.0f);
+
+		//RBTree.InOrderPrint();
+		RBTree.Remove(25.0f);
+
+		//RBTree.InOrderPrint();
+		//return;
+
+		if (Tree.Search(15.f))
+		{
+			AA_CORE_LOG(Info, "Found 15");
+		}
+		else
+		{
+			AA_CORE_LOG(Info, "NO Found 15");
+		}
+		AA_CORE_LOG(Info, "No of Elemts AA: %d", Tree.Num());
+		Tree.Clear();
+		Tree.Insert(13.0f);
+		Tree.Insert(25.0f);
+		Tree.Insert(3.0f);
+		AA_CORE_LOG(Info, "No of Elemts AA: %d", Tree.Num());
+		Tree.Insert(27.0f);
+		//Tree.InOrderPrint();
+
+
+		//constexpr int TestSize = 1000000;
+		//constexpr int TestIter = 10;
+		//constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+		//{
+		//	long long Dur = 0;
+		//	TTimer<TestTimeResolution> Timer("AA Tree", false);
+		//	for (int testNum = 0; testNum < TestIter; testNum++)
+		//	{
+		//		TRedBlackTree<float> VectorOfUnique;
+		//		Dur += Timer.Reset();
+		//		for (int i = 0; i < TestSize; i++)
+		//		{
+		//			VectorOfUnique.Insert(float(rand()) / RAND_MAX);
+		//		}
+		//		//AA_CORE_LOG(Info, "No of Elemts AA: %d", VectorOfUnique.Num());
+		//		for (auto it = VectorOfUnique.begin(); it != VectorOfUnique.end();)
+		//		{
+		//			float ValToDel = it->Value;
+		//			it++;
+		//			//VectorOfUnique.InOrderPrint();
+		//			VectorOfUnique.Remove(ValToDel);
+		//			//VectorOfUnique.InOrderPrint();
+		//		}
+		//		//AA_CORE_LOG(Info, "No of Elemts AA After: %d", VectorOfUnique.Num());
+		//	}
+		//	AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur / TestIter);
+		//	//VectorOfUnique.ShrinkToFit();
+		//	/*while (!VectorOfUnique.IsEmpty())
+		//	{
+		//		VectorOfUnique.PopBack();
+		//	}*/
+		//}
+		//{
+		//	long long Dur = 0;
+		//	TTimer<TestTimeResolution> Timer("STD set", false);
+		//	for (int testNum = 0; testNum < TestIter; testNum++)
+		//	{
+		//		std::set<float> VectorOfUnique;
+		//		Dur += Timer.Reset();
+		//		for (int i = 0; i < TestSize; i++)
+		//		{
+		//			VectorOfUnique.emplace(float(rand()) / RAND_MAX);
+		//		}
+		//		//AA_CORE_LOG(Info, "No of Elemts AA: %d", VectorOfUnique.size());
+		//		for (auto it = VectorOfUnique.begin(); it != VectorOfUnique.end();)
+		//		{
+		//			float ValToDel = *it;
+		//			it++;
+		//			VectorOfUnique.erase(ValToDel);
+		//		}
+		//	}
+		//	AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur / TestIter);
+		//	//VectorOfUnique.ShrinkToFit();
+		//	/*while (!VectorOfUnique.IsEmpty())
+		//	{
+		//		VectorOfUnique.PopBack();
+		//	}*/
+		//}
+
+		// Copies and moves of a TBTreeSet keep ordering by the Predicate of the source
+		{
+			struct FDirectionalLess
+			{
+				bool bDescending = false;
+				bool operator()(int A, int B) const { return bDescending ? B < A : A < B; }
+			};
+
+			auto IsOrdered = [](const TBTreeSet<int, FDirectionalLess>& Set, size_t ExpectedNum)
+			{
+				size_t Count = 0;
+				int Previous = 0;
+				for (const auto& Entry : Set)
+				{
+					if (Count > 0 && Entry.Value >= Previous)
+					{
+						return false;
+					}
+					Previous = Entry.Value;
+					Count++;
+				}
+				return Count == ExpectedNum;
+			};
+
+			TBTreeSet<int, FDirectionalLess> Descending(FDirectionalLess{ true });
+			for (int i = 0; i < 500; i++)
+			{
+				Descending.Insert(i);
+			}
+
+			TBTreeSet<int, FDirectionalLess> Copy(Descending);
+			Copy.Insert(1000);
+			AA_CORE_ASSERT(IsOrdered(Copy, 501) && Copy.Find(250) != Copy.end(), "TBTreeSet copy constructor lost the Predicate!");
+
+			TBTreeSet<int, FDirectionalLess> CopyAssigned;
+			CopyAssigned = Descending;
+			CopyAssigned.Insert(-1);
+			AA_CORE_ASSERT(IsOrdered(CopyAssigned, 501) && CopyAssigned.Find(250) != CopyAssigned.end(), "TBTreeSet copy assignment lost the Predicate!");
+
+			TBTreeSet<int, FDirectionalLess> Moved(Move(Copy));
+			Moved.Insert(2000);
+			AA_CORE_ASSERT(IsOrdered(Moved, 502) && Moved.Find(250) != Moved.end(), "TBTreeSet move constructor lost the Predicate!");
+
+			TBTreeSet<int, FDirectionalLess> MoveAssigned;
+			MoveAssigned = Move(CopyAssigned);
+			MoveAssigned.Insert(-2);
+			AA_CORE_ASSERT(IsOrdered(MoveAssigned, 502) && MoveAssigned.Find(250) != MoveAssigned.end(), "TBTreeSet move assignment lost the Predicate!");
+		}
+
+		// Ordered map benchmarks, TOrderedMap / TBTreeMap vs std::map
+		constexpr int OrderedTestIter = 3;
+		constexpr size_t OrderedTestSizes[] = { 1000, 10000, 100000, 1000000 };
+		constexpr ETimeResolution OrderedTestTimeResolution = MicroSeconds;
+
+		for (size_t OrderedTestSize : OrderedTestSizes)
+		{
+			AA_CORE_LOG(Info, "---------- Ordered Map Tests: %zu Elements ----------", OrderedTestSize);
+
+			// Random keys, the second half is only used for missed lookups
+			TArray<uint64_t> Keys;
+			Keys.AddUninitialized(OrderedTestSize * 2);
+			for (size_t i = 0; i < OrderedTestSize * 2; i++)
+			{
+				Keys[i] = ((uint64_t)rand() << 48) ^ ((uint64_t)rand() << 32) ^ ((uint64_t)rand() << 16) ^ (uint64_t)rand() ^ (i << 1);
+			}
+			// Each range lookup visits about 16 elements
+			const uint64_t RangeWidth = (UINT64_MAX / OrderedTestSize) * 16;
+
+			{
+				long long InsertDur = 0, FindDur = 0, MissDur = 0, RangeDur = 0, IterateDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<OrderedTestTimeResolution> Timer("AA TOrderedMap", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					TOrderedMap<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map.Add(Keys[i], i);
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Found += Map.FindValue(Keys[i]) != nullptr;
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i++)
+					{
+						Found += Map.Contains(Keys[i]);
+					}
+					MissDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i += 16)
+					{
+						const uint64_t RangeEnd = Keys[i] > UINT64_MAX - RangeWidth ? UINT64_MAX : Keys[i] + RangeWidth;
+						for (auto It = Map.LowerBound(Keys[i]), End = Map.UpperBound(RangeEnd); It != End; ++It)
+						{
+							Found += It->Value & 1;
+						}
+					}
+					RangeDur += Timer.Reset();
+					for (auto& Pair : Map)
+					{
+						Found += Pair.Value & 1;
+					}
+					IterateDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map.Remove(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Find: %f", (float)FindDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Find (Missing): %f", (float)MissDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Range: %f", (float)RangeDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Iterate: %f", (float)IterateDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TOrderedMap Erase: %f (%zu found)", (float)EraseDur / OrderedTestIter, Found);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, MissDur = 0, RangeDur = 0, IterateDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<OrderedTestTimeResolution> Timer("AA TBTreeMap", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					TBTreeMap<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map.Add(Keys[i], i);
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Found += Map.FindValue(Keys[i]) != nullptr;
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i++)
+					{
+						Found += Map.Contains(Keys[i]);
+					}
+					MissDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i += 16)
+					{
+						const uint64_t RangeEnd = Keys[i] > UINT64_MAX - RangeWidth ? UINT64_MAX : Keys[i] + RangeWidth;
+						for (auto It = Map.LowerBound(Keys[i]), End = Map.UpperBound(RangeEnd); It != End; ++It)
+						{
+							Found += It->Value & 1;
+						}
+					}
+					RangeDur += Timer.Reset();
+					for (auto& Pair : Map)
+					{
+						Found += Pair.Value & 1;
+					}
+					IterateDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map.Remove(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Find: %f", (float)FindDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Find (Missing): %f", (float)MissDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Range: %f", (float)RangeDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Iterate: %f", (float)IterateDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeMap Erase: %f (%zu found)", (float)EraseDur / OrderedTestIter, Found);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, MissDur = 0, RangeDur = 0, IterateDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<OrderedTestTimeResolution> Timer("STD map", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					std::map<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map[Keys[i]] = i;
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Found += Map.find(Keys[i]) != Map.end();
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i++)
+					{
+						Found += Map.count(Keys[i]);
+					}
+					MissDur += Timer.Reset();
+					for (size_t i = OrderedTestSize; i < OrderedTestSize * 2; i += 16)
+					{
+						const uint64_t RangeEnd = Keys[i] > UINT64_MAX - RangeWidth ? UINT64_MAX : Keys[i] + RangeWidth;
+						for (auto It = Map.lower_bound(Keys[i]), End = Map.upper_bound(RangeEnd); It != End; ++It)
+						{
+							Found += It->second & 1;
+						}
+					}
+					RangeDur += Timer.Reset();
+					for (auto& Pair : Map)
+					{
+						Found += Pair.second & 1;
+					}
+					IterateDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Map.erase(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD map Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD map Find: %f", (float)FindDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD map Find (Missing): %f", (float)MissDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD map Range: %f", (float)RangeDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD map Iterate: %f", (float)IterateDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD map Erase: %f (%zu found)", (float)EraseDur / OrderedTestIter, Found);
+			}
+
+			{
+				long long InsertDur = 0, EraseDur = 0;
+				TTimer<OrderedTestTimeResolution> Timer("AA TRedBlackTree", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					TRedBlackTree<uint64_t> Set;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Set.Insert(Keys[i]);
+					}
+					InsertDur += Timer.Reset();
+					for (auto It = Set.begin(); It != Set.end();)
+					{
+						It = Set.Remove(It);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TRedBlackTree Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TRedBlackTree Erase (In Order): %f", (float)EraseDur / OrderedTestIter);
+			}
+
+			{
+				long long InsertDur = 0, EraseDur = 0;
+				TTimer<OrderedTestTimeResolution> Timer("STD set", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					std::set<uint64_t> Set;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Set.insert(Keys[i]);
+					}
+					InsertDur += Timer.Reset();
+					for (auto It = Set.begin(); It != Set.end();)
+					{
+						It = Set.erase(It);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD set Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time STD set Erase (In Order): %f", (float)EraseDur / OrderedTestIter);
+			}
+
+			{
+				long long InsertDur = 0, EraseDur = 0;
+				TTimer<OrderedTestTimeResolution> Timer("AA TBTreeSet", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					TBTreeSet<uint64_t> Set;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Set.Insert(Keys[i]);
+					}
+					InsertDur += Timer.Reset();
+					for (auto It = Set.begin(); It != Set.end();)
+					{
+						It = Set.Remove(It);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TBTreeSet Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeSet Erase (In Order): %f", (float)EraseDur / OrderedTestIter);
+			}
+
+			{
+				// Sorted input, one by one vs bulk load
+				TArray<uint64_t> SortedKeys;
+				SortedKeys.AddUninitialized(OrderedTestSize);
+				for (size_t i = 0; i < OrderedTestSize; i++)
+				{
+					SortedKeys[i] = Keys[i];
+				}
+				SortedKeys.Sort();
+
+				long long InsertDur = 0, BulkDur = 0, RBInsertDur = 0;
+				TTimer<OrderedTestTimeResolution> Timer("AA Sorted Insert", false);
+				for (int TestNum = 0; TestNum < OrderedTestIter; TestNum++)
+				{
+					TBTreeSet<uint64_t> Set;
+					TBTreeSet<uint64_t> BulkSet;
+					TRedBlackTree<uint64_t> RBSet;
+					Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						Set.Insert(SortedKeys[i]);
+					}
+					InsertDur += Timer.Reset();
+					BulkSet.BulkLoad(SortedKeys.Data(), SortedKeys.Num());
+					BulkDur += Timer.Reset();
+					for (size_t i = 0; i < OrderedTestSize; i++)
+					{
+						RBSet.Insert(SortedKeys[i]);
+					}
+					RBInsertDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TBTreeSet Sorted Insert: %f", (float)InsertDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TBTreeSet Bulk Load: %f", (float)BulkDur / OrderedTestIter);
+				AA_CORE_LOG(Info, "Average Time AA TRedBlackTree Sorted Insert: %f", (float)RBInsertDur / OrderedTestIter);
+			}
+		}
+	}
+
+	void CTester::StaticArrayTests()
+	{
+		constexpr int TestSize = 1;
+		constexpr ETimeResolution TestTimeResolution = NanoSeconds;
+		/*{
+			std::array<int, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("STD Array");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = 100;
+				size_t temp = VectorOfUnique.size();
+				VectorOfUnique[i] = temp;
+			}
+		}
+
+		{
+			TStaticArray<int, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("AA Array");
+			for (auto i = VectorOfUnique.begin(); i != VectorOfUnique.end(); i++)
+			{
+				*i = 100;
+				size_t temp = VectorOfUnique.Num();
+				*i = temp;
+
+			}
+		}*/
+
+		/*{
+			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("STD Make Unique");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = MakeUnique<int>();
+			}
+		}
+
+		{
+			TStaticArray<TUniquePtr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("STD New");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = MakeUnique<int>();
+			}
+		}*/
+	}
+
+	void CTester::DynamicArrayTests()
+	{
+		/* Faster */
+		constexpr int TestSize = 100000;
+		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Array", false);
+			for (int testNum = 0; testNum < 10; testNum++)
+			{
+				std::vector<float> VectorOfUnique;
+				Dur += Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					VectorOfUnique.emplace(VectorOfUnique.begin(), float(rand())/RAND_MAX);
+				}
+			}
+			AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur * 0.01);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Array", false);
+			for (int testNum = 0; testNum < 10; testNum++)
+			{
+				TArray<float> VectorOfUnique;
+				Dur += Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					VectorOfUnique.Emplace(VectorOfUnique.begin(), float(rand()) / RAND_MAX);
+				}
+			}
+			AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur * 0.01);
+			//VectorOfUnique.ShrinkToFit();
+			/*while (!VectorOfUnique.IsEmpty())
+			{
+				VectorOfUnique.PopBack();
+			}*/
+		}
+
+		//TArray<Vector> VectorOfUnique;
+		//VectorOfUnique.RemoveAt(0);
+		//VectorOfUnique.EmplaceBack("Hello");
+		////VectorOfUnique.EmplaceBack(1.f, 1.f, 3.f);
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.begin(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
+		////VectorOfUnique.PushBack("Helloasdasd");
+
+		////TArray<Vector> NewArray;
+
+
+		//std::cout << "Old Array\n";
+		//PrintArray(VectorOfUnique);
+
+		//std::cout << "New Array\n";
+		//PrintArray(NewArray);
+		
+	}
+
+	void CTester::DynamicArrayRelocationTests()
+	{
+		/*
+		* Growth / front insert / front erase of trivially relocatable types (MemCopy / MemMove path)
+		* against std::vector. Vector is the non-trivial struct above, which still goes element by element.
+		*/
+		constexpr int TestSize = 100000;
+		constexpr int TestIter = 10;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Growth", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				std::vector<uint32_t> Indices;
+				for (int i = 0; i < TestSize * 10; i++)
+				{
+					Indices.push_back(i);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Growth: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Growth", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				TArray<uint32_t> Indices;
+				for (int i = 0; i < TestSize * 10; i++)
+				{
+					Indices.PushBack(i);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Growth: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Insert / Erase Front", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				std::vector<FVector3f> Positions;
+				Timer.Reset();
+				for (int i = 0; i < TestSize / 10; i++)
+				{
+					Positions.insert(Positions.begin(), FVector3f(float(i)));
+				}
+				while (!Positions.empty())
+				{
+					Positions.erase(Positions.begin());
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Insert / Erase Front: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Insert / Erase Front", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				TArray<FVector3f> Positions;
+				Timer.Reset();
+				for (int i = 0; i < TestSize / 10; i++)
+				{
+					Positions.InsertAt(0, FVector3f(float(i)));
+				}
+				while (!Positions.IsEmpty())
+				{
+					Positions.RemoveAt(0);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Insert / Erase Front: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Non Trivial Growth", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				std::vector<Vector> Vectors;
+				for (int i = 0; i < TestSize; i++)
+				{
+					Vectors.emplace_back(1.0f, 2.0f, 3.0f);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Non Trivial Growth: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Non Trivial Growth", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				TArray<Vector> Vectors;
+				for (int i = 0; i < TestSize; i++)
+				{
+					Vectors.EmplaceBack(1.0f, 2.0f, 3.0f);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Non Trivial Growth: %f", (float)Dur / TestIter);
+		}
+	}
+
+	void CTester::DynamicArrayBulkTests()
+	{
+		/*
+		* Building an interleaved vertex array the way a model loader does:
+		* PushBack per float vs Append of a whole vertex vs AddUninitialized + writing into Data()
+		*/
+		constexpr int NumVertices = 1000000;
+		constexpr int FloatsPerVertex = 8;
+		constexpr int TestIter = 10;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		TArray<float> Source;
+		Source.AddUninitialized(NumVertices * FloatsPerVertex);
+		for (int i = 0; i < NumVertices * FloatsPerVertex; i++)
+		{
+			Source[i] = float(rand()) / RAND_MAX;
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA PushBack", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				TArray<float> Vertices;
+				for (int i = 0; i < NumVertices * FloatsPerVertex; i++)
+				{
+					Vertices.PushBack(Source[i]);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA PushBack: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Append", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				TArray<float> Vertices;
+				for (int i = 0; i < NumVertices; i++)
+				{
+					Vertices.Append(Source.Data() + i * FloatsPerVertex, FloatsPerVertex);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Append: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA AddUninitialized", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				TArray<float> Vertices;
+				const size_t FirstIndex = Vertices.AddUninitialized(NumVertices * FloatsPerVertex);
+				float* Dest = Vertices.Data() + FirstIndex;
+				for (int i = 0; i < NumVertices * FloatsPerVertex; i++)
+				{
+					Dest[i] = Source[i];
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA AddUninitialized: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD insert", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				std::vector<float> Vertices;
+				Vertices.insert(Vertices.end(), Source.Data(), Source.Data() + NumVertices * FloatsPerVertex);
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD insert: %f", (float)Dur / TestIter);
+		}
+	}
+
+	void CTester::UniquePtrTests()
+	{
+		/*
+		* TEST RESULTS
+		* 
+		* 1) std::make_unique
+		* Size = 1000
+		* Speed (Avg) = 68 ns
+		* Speed (Fastest) = 62 ns
+		* 
+		* 2) AA - MakeUnique
+		* Size = 1000
+		* Speed (Avg) = 47 ns
+		* Speed (Fastest) = 45 ns
+		* 
+		* 3) AA - new TUniquePtr
+		* Size = 1000
+		* Speed (Avg) = 49 ns
+		* Speed (Fastest) = 47 ns
+		* 
+		* 4) Raw new
+		* Size = 1000
+		* Speed (Avg) = 46 ns
+		* Speed (Fastest) = 45 ns
+		* 
+		* 10000 size, similar results
+		* 100000 size, similar results
+		*/
+		constexpr int TestSize = 1;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+		{
+			std::array<std::unique_ptr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("STD Make Unique");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = std::make_unique<int>();
+			}
+		}
+
+		/*{
+			std::array<std::unique_ptr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("STD New");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = std::unique_ptr<int>(new int);
+			}
+		}*/
+
+		{
+			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("AA Make Unique");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = MakeUnique<int>();
+			}
+		}
+
+		/*{
+			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("AA New");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = TUniquePtr<int>(new int);
+			}
+		}*/
+
+		/*{
+			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
+			TTimer<TestTimeResolution> Timer("Raw New");
+			for (int i = 0; i < TestSize; i++)
+			{
+				VectorOfUnique[i] = new int;
+			}
+		}*/
+	}
+
+	void CTester::HashMapTests()
+	{
+		constexpr int TestIter = 3;
+		constexpr size_t TestSizes[] = { 1000, 10000, 100000, 1000000, 10000000 };
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		for (size_t TestSize : TestSizes)
+		{
+			AA_CORE_LOG(Info, "---------- Hash Map Tests: %zu Elements ----------", TestSize);
+
+			// Random keys, the second half is only used for missed lookups
+			TArray<uint64_t> Keys;
+			Keys.AddUninitialized(TestSize * 2);
+			for (size_t i = 0; i < TestSize * 2; i++)
+			{
+				Keys[i] = ((uint64_t)rand() << 48) ^ ((uint64_t)rand() << 32) ^ ((uint64_t)rand() << 16) ^ (uint64_t)rand() ^ (i << 1);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, MissDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<TestTimeResolution> Timer("AA TMap", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					TMap<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map.Add(Keys[i], i);
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Found += Map.FindValue(Keys[i]) != nullptr;
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = TestSize; i < TestSize * 2; i++)
+					{
+						Found += Map.Contains(Keys[i]);
+					}
+					MissDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map.Remove(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TMap Insert: %f", (float)InsertDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time AA TMap Find: %f", (float)FindDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time AA TMap Find (Missing): %f", (float)MissDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time AA TMap Erase: %f (%zu found)", (float)EraseDur / TestIter, Found);
+			}
+
+			{
+				long long Dur = 0;
+				TTimer<TestTimeResolution> Timer("AA TMap Reserved Insert", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					TMap<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					Map.Reserve(TestSize);
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map.Add(Keys[i], i);
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TMap Reserved Insert: %f", (float)Dur / TestIter);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, MissDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<TestTimeResolution> Timer("STD unordered_map", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					std::unordered_map<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map[Keys[i]] = i;
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Found += Map.find(Keys[i]) != Map.end();
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = TestSize; i < TestSize * 2; i++)
+					{
+						Found += Map.count(Keys[i]);
+					}
+					MissDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map.erase(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD unordered_map Insert: %f", (float)InsertDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time STD unordered_map Find: %f", (float)FindDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time STD unordered_map Find (Missing): %f", (float)MissDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time STD unordered_map Erase: %f (%zu found)", (float)EraseDur / TestIter, Found);
+			}
+
+			{
+				long long Dur = 0;
+				TTimer<TestTimeResolution> Timer("STD unordered_map Reserved Insert", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					std::unordered_map<uint64_t, uint64_t> Map;
+					Timer.Reset();
+					Map.reserve(TestSize);
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Map[Keys[i]] = i;
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD unordered_map Reserved Insert: %f", (float)Dur / TestIter);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<TestTimeResolution> Timer("AA TSet", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					TSet<uint64_t> Set;
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Set.Add(Keys[i]);
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize * 2; i++)
+					{
+						Found += Set.Contains(Keys[i]);
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Set.Remove(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TSet Insert: %f", (float)InsertDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time AA TSet Find (Half Missing): %f", (float)FindDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time AA TSet Erase: %f (%zu found)", (float)EraseDur / TestIter, Found);
+			}
+
+			{
+				long long InsertDur = 0, FindDur = 0, EraseDur = 0;
+				size_t Found = 0;
+				TTimer<TestTimeResolution> Timer("STD unordered_set", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					std::unordered_set<uint64_t> Set;
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Set.insert(Keys[i]);
+					}
+					InsertDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize * 2; i++)
+					{
+						Found += Set.count(Keys[i]);
+					}
+					FindDur += Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Set.erase(Keys[i]);
+					}
+					EraseDur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD unordered_set Insert: %f", (float)InsertDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time STD unordered_set Find (Half Missing): %f", (float)FindDur / TestIter);
+				AA_CORE_LOG(Info, "Average Time STD unordered_set Erase: %f (%zu found)", (float)EraseDur / TestIter, Found);
+			}
+		}
+
+		// String keys, AA looks up with const char* without building a std::string (heterogeneous lookup)
+		{
+			constexpr size_t TestSize = 100000;
+			AA_CORE_LOG(Info, "---------- Hash Map String Key Tests: %zu Elements ----------", TestSize);
+
+			TArray<std::string> Names;
+			Names.Reserve(TestSize);
+			for (size_t i = 0; i < TestSize; i++)
+			{
+				Names.EmplaceBack("Assets/Shaders/Shader_" + std::to_string(i) + ".glsl");
+			}
+
+			{
+				long long Dur = 0;
+				size_t Found = 0;
+				TMap<std::string, int> Map(TestSize);
+				for (size_t i = 0; i < TestSize; i++)
+				{
+					Map.Add(Names[i], (int)i);
+				}
+				TTimer<TestTimeResolution> Timer("AA TMap String Find", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Found += Map.Contains(Names[i].c_str());
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TMap String Find: %f (%zu found)", (float)Dur / TestIter, Found);
+			}
+
+			{
+				long long Dur = 0;
+				size_t Found = 0;
+				std::unordered_map<std::string, int> Map(TestSize);
+				for (size_t i = 0; i < TestSize; i++)
+				{
+					Map[Names[i]] = (int)i;
+				}
+				TTimer<TestTimeResolution> Timer("STD unordered_map String Find", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					Timer.Reset();
+					for (size_t i = 0; i < TestSize; i++)
+					{
+						Found += Map.count(Names[i].c_str());
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD unordered_map String Find: %f (%zu found)", (float)Dur / TestIter, Found);
+			}
+		}
+	}
+
+	void CTester::QueueTests()
+	{
+		constexpr int TestSize = 1000000;
+		constexpr int TestIter = 10;
+		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+
+		// Popped elements are destroyed right away, not when the storage is compacted
+		{
+			TSharedPtr<int> Element = MakeShared<int>(7);
+			{
+				TQueue<TSharedPtr<int>> Queue;
+				for (int i = 0; i < 100; i++)
+				{
+					Queue.Enqueue(Element);
+				}
+				AA_CORE_ASSERT(Element.GetSharedReferenceCount() == 101, "TQueue Enqueue didn't copy the element!");
+
+				Queue.Pop();
+				AA_CORE_ASSERT(Element.GetSharedReferenceCount() == 100, "TQueue Pop didn't destroy the element!");
+
+				TSharedPtr<int> Out;
+				Queue.Dequeue(Out);
+				Out.Reset();
+				AA_CORE_ASSERT(Element.GetSharedReferenceCount() == 99, "TQueue Dequeue didn't destroy the element!");
+
+				for (int i = 0; i < 48; i++)
+				{
+					Queue.Pop();
+				}
+				AA_CORE_ASSERT(Queue.Num() == 50 && Element.GetSharedReferenceCount() == 51, "TQueue compaction destroyed the wrong elements!");
+
+				TQueue<TSharedPtr<int>> Copy(Queue);
+				AA_CORE_ASSERT(Copy.Num() == 50 && Element.GetSharedReferenceCount() == 101, "TQueue copy didn't copy only the queued elements!");
+
+				TQueue<TSharedPtr<int>> Moved(Move(Queue));
+				AA_CORE_ASSERT(Moved.Num() == 50 && Queue.IsEmpty() && Element.GetSharedReferenceCount() == 101, "TQueue move didn't take the elements!");
+
+				Copy.Clear();
+				AA_CORE_ASSERT(Element.GetSharedReferenceCount() == 51, "TQueue Clear didn't destroy the elements!");
+			}
+			AA_CORE_ASSERT(Element.GetSharedReferenceCount() == 1, "TQueue destructor didn't destroy the elements!");
+		}
+
+		// Growing the storage after a Pop must not touch the destroyed slots again
 		{
-			TTimer<TestTimeResolution> Timer("Mat Add");
-			for (int i = 0; i < TestSize; i++)
+			struct FDestructCounts
+			{
+				int NumDestructed = 0;
+				int NumDeadTouched = 0;
+			};
+
+			// Remembers being destroyed, so moving from it or destroying it again is counted
+			struct FDestructCounter
+			{
+				explicit FDestructCounter(FDestructCounts* InCounts) : Counts(InCounts) {}
+				FDestructCounter(FDestructCounter&& Other) noexcept : Counts(Other.Counts)
+				{
+					Counts->NumDeadTouched += Other.bDestroyed;
+					Other.bMovedFrom = true;
+				}
+				~FDestructCounter()
+				{
+					if (bDestroyed)
+					{
+						Counts->NumDeadTouched++;
+					}
+					else if (!bMovedFrom)
+					{
+						Counts->NumDestructed++;
+					}
+					bDestroyed = true;
+				}
+				FDestructCounts* Counts;
+				bool bDestroyed = false;
+				bool bMovedFrom = false;
+			};
+
+			FDestructCounts Counts;
+			{
+				TQueue<FDestructCounter> Queue;
+				for (int i = 0; i < 4; i++)
+				{
+					Queue.Emplace(&Counts);
+				}
+				Queue.Pop();
+				AA_CORE_ASSERT(Counts.NumDestructed == 1, "TQueue Pop didn't destroy the element!");
+
+				for (int i = 0; i < 40; i++)
+				{
+					Queue.Emplace(&Counts);
+				}
+				AA_CORE_ASSERT(Counts.NumDestructed == 1 && Counts.NumDeadTouched == 0, "TQueue growth touched a popped element!");
+
+				Queue.Pop();
+				Queue.Reserve(1000);
+				AA_CORE_ASSERT(Queue.Num() == 42 && Counts.NumDestructed == 2 && Counts.NumDeadTouched == 0, "TQueue Reserve touched a popped element!");
+			}
+			AA_CORE_ASSERT(Counts.NumDestructed == 44 && Counts.NumDeadTouched == 0, "TQueue destroyed %d elements instead of 44!", Counts.NumDestructed);
+		}
+
+		// Single thread containers
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TStack", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				GMat *= glm::mat4(float(rand()) / RAND_MAX);
-				//Mat1 *= FMatrix44f(float(rand())/RAND_MAX);
+				TStack<int> Stack;
+				int Out = 0;
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Stack.Push(i);
+				}
+				while (Stack.Pop(Out))
+				{
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TStack Push/Pop: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD stack", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				std::stack<int> Stack;
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Stack.push(i);
+				}
+				while (!Stack.empty())
+				{
+					Stack.pop();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD stack Push/Pop: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TQueue", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				TQueue<int> Queue;
+				int Out = 0;
+				Timer.Reset();
+				// Keeps ~1000 elements queued, like a per frame event queue
+				for (int i = 0; i < TestSize; i++)
+				{
+					Queue.Enqueue(i);
+					if (i >= 1000)
+					{
+						Queue.Dequeue(Out);
+					}
+				}
+				while (Queue.Dequeue(Out))
+				{
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TQueue Enqueue/Dequeue: %f", (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD queue", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				std::queue<int> Queue;
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Queue.push(i);
+					if (i >= 1000)
+					{
+						Queue.pop();
+					}
+				}
+				while (!Queue.empty())
+				{
+					Queue.pop();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD queue Enqueue/Dequeue: %f", (float)Dur / TestIter);
+		}
+
+		// Game thread -> Worker thread
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TSpscRingBuffer", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				TSpscRingBuffer<int> Buffer(1024);
+				Timer.Reset();
+				std::thread Consumer([&Buffer]()
+				{
+					int Out = 0;
+					for (int i = 0; i < TestSize; i++)
+					{
+						while (!Buffer.TryPop(Out))
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+				for (int i = 0; i < TestSize; i++)
+				{
+					while (!Buffer.TryPush(i))
+					{
+						std::this_thread::yield();
+					}
+				}
+				Consumer.join();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TSpscRingBuffer 1 Producer 1 Consumer: %f", (float)Dur / TestIter);
+		}
+
+		// N Producers -> N Consumers, same total number of elements
+		const uint32_t MaxThreads = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() / 2 : 1;
+		for (uint32_t NumProducers = 1; NumProducers <= MaxThreads; NumProducers *= 2)
+		{
+			const int PerProducer = TestSize / NumProducers;
+
+			{
+				long long Dur = 0;
+				TTimer<TestTimeResolution> Timer("AA TMpmcQueue", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					TMpmcQueue<int> Queue(1024);
+					TArray<std::thread> Threads;
+					Timer.Reset();
+					for (uint32_t ThreadIndex = 0; ThreadIndex < NumProducers; ThreadIndex++)
+					{
+						Threads.EmplaceBack([&Queue, PerProducer]()
+						{
+							for (int i = 0; i < PerProducer; i++)
+							{
+								while (!Queue.TryPush(i))
+								{
+									std::this_thread::yield();
+								}
+							}
+						});
+						Threads.EmplaceBack([&Queue, PerProducer]()
+						{
+							int Out = 0;
+							for (int i = 0; i < PerProducer; i++)
+							{
+								while (!Queue.TryPop(Out))
+								{
+									std::this_thread::yield();
+								}
+							}
+						});
+					}
+					for (std::thread& Thread : Threads)
+					{
+						Thread.join();
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time AA TMpmcQueue %u Producers %u Consumers: %f", NumProducers, NumProducers, (float)Dur / TestIter);
+			}
+
+			{
+				long long Dur = 0;
+				TTimer<TestTimeResolution> Timer("STD queue + mutex", false);
+				for (int TestNum = 0; TestNum < TestIter; TestNum++)
+				{
+					std::queue<int> Queue;
+					std::mutex Mutex;
+					TArray<std::thread> Threads;
+					Timer.Reset();
+					for (uint32_t ThreadIndex = 0; ThreadIndex < NumProducers; ThreadIndex++)
+					{
+						Threads.EmplaceBack([&Queue, &Mutex, PerProducer]()
+						{
+							for (int i = 0; i < PerProducer; i++)
+							{
+								std::lock_guard<std::mutex> Lock(Mutex);
+								Queue.push(i);
+							}
+						});
+						Threads.EmplaceBack([&Queue, &Mutex, PerProducer]()
+						{
+							for (int i = 0; i < PerProducer; )
+							{
+								std::lock_guard<std::mutex> Lock(Mutex);
+								if (!Queue.empty())
+								{
+									Queue.pop();
+									i++;
+								}
+							}
+						});
+					}
+					for (std::thread& Thread : Threads)
+					{
+						Thread.join();
+					}
+					Dur += Timer.Reset();
+				}
+				AA_CORE_LOG(Info, "Average Time STD queue + mutex %u Producers %u Consumers: %f", NumProducers, NumProducers, (float)Dur / TestIter);
 			}
 		}
-		AA_CORE_LOG(Info, "Mat: \n%s\n", (Mat1 * Mat2).ToString().c_str());
-		
 	}
 
-	void CTester::MatrixGLMTests()
+	void CTester::SoAArrayTests()
 	{
-		FMatrix44f Mat({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
-		//AA_CORE_LOG(Info, "Mat: \n%s\n", (Mat.GetInverseFast()).ToString().c_str());
-		glm::mat4 GMat({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
-		//PrintGLMMat(glm::inverse(GMat));
-		glm::mat4 GNewMat({ 1,0,0,2 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
-		
-		glm::mat4 X = glm::mat4(1.0f);
-		glm::mat4 Y = glm::mat4(1.0f);
-		glm::mat4 Z = glm::mat4(1.0f);
+		constexpr size_t TestSize = 1000000;
+		constexpr int TestIter = 100;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+		constexpr float DeltaTime = 1.0f / 60.0f;
 
-		X = glm::rotate(X, 45.0f, glm::vec3(1.0f, 0.0f, 0.0f));
-		Y = glm::rotate(Y, 45.0f, glm::vec3(0.0f, 1.0f, 0.0f));
-		Z = glm::rotate(Z, 45.0f, glm::vec3(0.0f, 0.0f, 1.0f));
+		// Typical object: the update only touches Position and Velocity, the rest is cold
+		struct FObjectAoS
+		{
+			float Position[3];
+			float Velocity[3];
+			float WorldMatrix[16];
+			uint32_t MeshIndex;
+			uint32_t MaterialIndex;
+		};
 
-		glm::mat4 FinalRot = X * Y * Z;
-		FMatrix44f Rot = FMatrix44f::MakeFromRotationXYZ({ 45.f, 45.f, 45.f });
-		FMatrix44f NewMat({ 1,0,0,2 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 });
-		FMatrix44f Result;
-		FVector4f NewVec(1.0f);
-		FVector4f ResVec = NewVec * Mat * NewMat;
-		glm::vec4 GNewVec(1.0f);
-		glm::vec4 GResVec = GNewMat * GMat * GNewVec;
-		glm::mat4 GProj = glm::perspective(1.5f, 1.0f, 0.01f, 100.f);
-		FMatrix44f Proj = FMatrix44f::MakePerspective(1.5f, 1.0f, 0.01f, 100.f);
-		TArray<FMatrix44f> MyArray;
-		TArray<glm::mat4> GLMArray;
-		AA_CORE_LOG(Info, "Mat: \n%s\n", (Proj).ToString().c_str());
-		PrintGLMMat(GProj);
+		{
+			TArray<FObjectAoS> Objects(TestSize);
+			for (size_t i = 0; i < TestSize; i++)
+			{
+				Objects.PushBack({ { 0.0f, 0.0f, 0.0f }, { float(i % 7), float(i % 11), float(i % 13) }, {}, uint32_t(i), uint32_t(i) });
+			}
 
-		constexpr int TestSize = 10000000;
-		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
-		/*{
-			TTimer<TestTimeResolution> Timer("Mat Mult");
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA AoS Update", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (FObjectAoS& Object : Objects)
+				{
+					Object.Position[0] += Object.Velocity[0] * DeltaTime;
+					Object.Position[1] += Object.Velocity[1] * DeltaTime;
+					Object.Position[2] += Object.Velocity[2] * DeltaTime;
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TArray AoS Position Update: %f (%f)", (float)Dur / TestIter, Objects[TestSize - 1].Position[1]);
+		}
+
+		{
+			// PositionX, PositionY, PositionZ, VelocityX, VelocityY, VelocityZ, WorldMatrix, MeshIndex, MaterialIndex
+			using FWorldMatrix = TStaticArray<float, 16>;
+			TSoAArray<float, float, float, float, float, float, FWorldMatrix, uint32_t, uint32_t> Objects(TestSize);
+			for (size_t i = 0; i < TestSize; i++)
+			{
+				Objects.Add(0.0f, 0.0f, 0.0f, float(i % 7), float(i % 11), float(i % 13), FWorldMatrix(), uint32_t(i), uint32_t(i));
+			}
+
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA SoA Update", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				float* PositionX = Objects.GetColumn<0>().Data();
+				float* PositionY = Objects.GetColumn<1>().Data();
+				float* PositionZ = Objects.GetColumn<2>().Data();
+				const float* VelocityX = Objects.GetColumn<3>().Data();
+				const float* VelocityY = Objects.GetColumn<4>().Data();
+				const float* VelocityZ = Objects.GetColumn<5>().Data();
+				for (size_t i = 0; i < TestSize; i++)
+				{
+					PositionX[i] += VelocityX[i] * DeltaTime;
+					PositionY[i] += VelocityY[i] * DeltaTime;
+					PositionZ[i] += VelocityZ[i] * DeltaTime;
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TSoAArray Position Update: %f (%f)", (float)Dur / TestIter, Objects.Get<1>(TestSize - 1));
+		}
+	}
+
+	void CTester::ResourcePoolTests()
+	{
+		constexpr size_t TestSize = 100000;
+		constexpr int TestIter = 100;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		struct FResource
+		{
+			uint32_t Id;
+			float Data[7];
+		};
+
+		// Resources referenced through shared pointers, every user holds a shared_ptr
+		{
+			std::vector<std::shared_ptr<FResource>> Resources;
+			for (size_t i = 0; i < TestSize; i++)
+			{
+				Resources.push_back(std::make_shared<FResource>(FResource{ uint32_t(i), {} }));
+			}
+			std::vector<std::shared_ptr<FResource>> Users(Resources.rbegin(), Resources.rend());
+
+			long long Dur = 0;
+			uint64_t Total = 0;
+			TTimer<TestTimeResolution> Timer("STD shared_ptr Lookup", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (const std::shared_ptr<FResource>& User : Users)
+				{
+					Total += User->Id;
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD shared_ptr Lookup: %f (%llu)", (float)Dur / TestIter, Total);
+		}
+
+		// Resources referenced through handles, every user holds a 32 bit handle
+		{
+			TResourcePool<FResource> Resources(TestSize);
+			TArray<TResourceHandle<FResource>> Users(TestSize);
+			for (size_t i = 0; i < TestSize; i++)
+			{
+				Users.PushBack(Resources.Add(FResource{ uint32_t(i), {} }));
+			}
+
+			long long Dur = 0;
+			uint64_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA TResourcePool Lookup", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (size_t i = TestSize; i-- > 0;)
+				{
+					Total += Resources.Get(Users[i])->Id;
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TResourcePool Lookup: %f (%llu)", (float)Dur / TestIter, Total);
+		}
+
+		// Creating and destroying resources, e.g. streaming
+		{
+			std::vector<std::shared_ptr<FResource>> Resources;
+			Resources.reserve(TestSize);
+
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD shared_ptr Create Destroy", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (size_t i = 0; i < TestSize; i++)
+				{
+					Resources.push_back(std::make_shared<FResource>(FResource{ uint32_t(i), {} }));
+				}
+				Resources.clear();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD shared_ptr Create Destroy: %f", (float)Dur / TestIter);
+		}
+
+		{
+			TResourcePool<FResource> Resources(TestSize);
+			TArray<TResourceHandle<FResource>> Handles(TestSize);
+
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TResourcePool Create Destroy", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (size_t i = 0; i < TestSize; i++)
+				{
+					Handles.PushBack(Resources.Add(FResource{ uint32_t(i), {} }));
+				}
+				for (TResourceHandle<FResource> Handle : Handles)
+				{
+					Resources.Remove(Handle);
+				}
+				Handles.Clear();
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TResourcePool Create Destroy: %f (%zu)", (float)Dur / TestIter, Resources.Num());
+		}
+	}
+
+	void CTester::ArrayViewTests()
+	{
+		constexpr int TestSize = 100000;
+		constexpr int TestIter = 100;
+		constexpr size_t MeshFloats = 8 * 100000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		auto CountAllocations = []()
+		{
+			size_t Total = 0;
+			for (size_t Tag = 0; Tag < (size_t)EMemoryTag::Count; Tag++)
+			{
+				Total += FMemory::GetTagStats((EMemoryTag)Tag).GetTotalAllocations();
+			}
+			return Total;
+		};
+
+		// What every Vertex Buffer / Vertex Array setup does with the layout: copy it, then walk its elements
+		{
+			const CVertexBufferLayout& Layout = CVertexBufferLayout::PhongLayout;
+			const size_t AllocationsBefore = CountAllocations();
+
+			uint64_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA Layout Copy And View");
 			for (int i = 0; i < TestSize; i++)
 			{
-				MyArray.PushBack(Mat.GetInverseFast());
+				CVertexBufferLayout LayoutCopy = Layout;
+				for (const FVertexBufferElement& Elem : LayoutCopy.GetElements())
+				{
+					Total += Elem.Offset + Elem.Name.size();
+				}
 			}
-		}*/
-		NewMat *= Mat;
-		//AA_CORE_LOG(Info, "Mat: \n%s\n", (ResVec).ToString().c_str());
-		//std::cout << FMatrix44f({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 }).Determinant3x3() << std::endl;
-		//std::cout << glm::determinant(glm::mat4({ 1,2,3,4 }, { 1,2,0,4 }, { 1,0,3,4 }, { 0,2,3,4 })) << std::endl;
-		//glm::mat4 GResult;
-		/*{
-			TTimer<TestTimeResolution> Timer("GLM Mat Mult");
+			AA_CORE_LOG(Info, "AA Layout Copy And View: %zu allocations, expected 0 (%llu)", CountAllocations() - AllocationsBefore, Total);
+		}
+
+		// The same walk when the elements are returned by value, as GetElements used to
+		{
+			const CVertexBufferLayout& Layout = CVertexBufferLayout::PhongLayout;
+			const size_t AllocationsBefore = CountAllocations();
+
+			uint64_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA Layout Elements By Value");
 			for (int i = 0; i < TestSize; i++)
 			{
-				GLMArray.PushBack(glm::inverse(GMat));
+				TArray<FVertexBufferElement> Elements;
+				Elements.Append(Layout.GetElements().Data(), Layout.GetElements().Num());
+				for (const FVertexBufferElement& Elem : Elements)
+				{
+					Total += Elem.Offset + Elem.Name.size();
+				}
+			}
+			AA_CORE_LOG(Info, "AA Layout Elements By Value: %zu allocations (%llu)", CountAllocations() - AllocationsBefore, Total);
+		}
+
+		// Handing mesh data to a function that only reads it, by value and by view
+		TArray<float> Vertices(MeshFloats);
+		for (size_t i = 0; i < MeshFloats; i++)
+		{
+			Vertices.PushBack(float(i % 64));
+		}
+
+		auto SumByValue = [](TArray<float> Data)
+		{
+			float Sum = 0.0f;
+			for (float Value : Data)
+			{
+				Sum += Value;
+			}
+			return Sum;
+		};
+
+		auto SumByView = [](TConstArrayView<float> Data)
+		{
+			float Sum = 0.0f;
+			for (float Value : Data)
+			{
+				Sum += Value;
+			}
+			return Sum;
+		};
+
+		{
+			const size_t AllocationsBefore = CountAllocations();
+			long long Dur = 0;
+			float Total = 0.0f;
+			TTimer<TestTimeResolution> Timer("AA Mesh Data By Value", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				Total += SumByValue(Vertices);
+				Dur += Timer.Reset();
 			}
-		}*/
-		/*for (int i = 0; i < 16; i++)
+			AA_CORE_LOG(Info, "Average Time AA Mesh Data By Value: %f, %zu allocations (%f)", (float)Dur / TestIter, CountAllocations() - AllocationsBefore, Total);
+		}
+
 		{
-			std::cout << Mat.MLin[i] << " ";
+			const size_t AllocationsBefore = CountAllocations();
+			long long Dur = 0;
+			float Total = 0.0f;
+			TTimer<TestTimeResolution> Timer("AA Mesh Data By View", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				Total += SumByView(Vertices);
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Mesh Data By View: %f, %zu allocations, expected 0 (%f)", (float)Dur / TestIter, CountAllocations() - AllocationsBefore, Total);
 		}
-		std::cout << "\n";
-		PrintGLMMat(GResVec);*/
 	}
 
-	void CTester::AlgorithmTests()
+	void CTester::StringTests()
 	{
-		constexpr int TestSize = 10;
-		constexpr int TestIter = 1;
-		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+		constexpr int TestSize = 1000000;
+		constexpr int TestIter = 10;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+		const FAllocatorStats& Stats = FHeapAllocator::GetStats();
+
+		// Short strings fit in FString's inline buffer, std::string's SSO is smaller on some standard libraries
 		{
 			long long Dur = 0;
-			TTimer<TestTimeResolution> Timer("AA Sort", false);
-			for (int i = 0; i < TestIter; i++)
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("STD Short String", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				TArray<float> ToSortAA(TestSize);
+				Timer.Reset();
 				for (int i = 0; i < TestSize; i++)
 				{
-					ToSortAA.EmplaceBack(/*float(TestSize - i)); */ float(rand()) / RAND_MAX);
+					std::string Path("Assets/Tex/");
+					Path += "Grass.png";
+					Total += Path.size();
 				}
-				Timer.Reset();
-				ToSortAA.Sort();
 				Dur += Timer.Reset();
-				AA_CORE_LOG(Info, "SortedArray: %s", (ToSortAA).ToString().c_str());
 			}
-			AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur / TestIter);
+			AA_CORE_LOG(Info, "Average Time STD Short String: %f (%zu)", (float)Dur / TestIter, Total);
 		}
 
 		{
 			long long Dur = 0;
-			TTimer<TestTimeResolution> Timer("STD Sort", false);
-			for (int i = 0; i < TestIter; i++)
+			size_t Total = 0;
+			const size_t AllocationsBefore = Stats.GetTotalAllocations();
+			TTimer<TestTimeResolution> Timer("AA Short String", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				std::vector<float> ToSort;
+				Timer.Reset();
 				for (int i = 0; i < TestSize; i++)
 				{
-					ToSort.emplace_back(float(rand()) / RAND_MAX);
+					FString Path("Assets/Tex/");
+					Path += "Grass.png";
+					Total += Path.Len();
 				}
-				Timer.Reset();
-				std::sort(ToSort.begin(), ToSort.end());
 				Dur += Timer.Reset();
 			}
-			AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur / TestIter);
+			AA_CORE_LOG(Info, "Average Time AA Short String: %f (%zu), Allocations: %zu", (float)Dur / TestIter, Total, Stats.GetTotalAllocations() - AllocationsBefore);
 		}
-	}
-
-	void CTester::TreeTests()
-	{
-		std::deque<float> Temp;
-		std::map<float, float> Temp2;
-		std::set<float> Temp3;
-
 
-
-		// BinarySearchTree tests
-		TBinarySearchTree<float> Tree;
-		TRedBlackTree<float> RBTree;
-		RBTree.Insert(5.0f);
-		if (Tree.Search(15.f))
 		{
-			AA_CORE_LOG(Info, "Found 15");
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("STD Long String", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					std::string Path("Assets/Meshes/Environment/Forest/");
+					Path += "PineTree_LOD0.fbx";
+					Total += Path.size();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Long String: %f (%zu)", (float)Dur / TestIter, Total);
 		}
-		else
+
 		{
-			AA_CORE_LOG(Info, "NO Found 15");
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA Long String", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					FString Path("Assets/Meshes/Environment/Forest/");
+					Path += "PineTree_LOD0.fbx";
+					Total += Path.Len();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Long String: %f (%zu)", (float)Dur / TestIter, Total);
 		}
-		Temp3.insert(5.0f);
-		Temp3.insert(24.0f);
-		Temp3.insert(4.0f);
-		Temp3.insert(15.0f);
-		Temp3.insert(14.0f);
-		Temp3.insert(7.0f);
-		Temp3.insert(17.0f);
-		Temp3.insert(13.0f);
-		Temp3.insert(25.0f);
-		Temp3.insert(3.0f);
-		Temp3.insert(27.0f);
-		Temp3.insert(23.0f);
 
-		for (auto& T : Temp3)
+		// Log line style formatting
 		{
-			std::cout << T << "\n";
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("STD Log Formatting", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					std::string Line = "[Info] ";
+					Line += "Loaded mesh ";
+					Line += std::to_string(i);
+					Line += " with ";
+					Line += std::to_string(i * 3);
+					Line += " vertices\n";
+					Total += Line.size();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD Log Formatting: %f (%zu)", (float)Dur / TestIter, Total);
 		}
-		std::cout <<"\n";
 
-		RBTree.Insert(5.0f);
-		RBTree.Insert(24.0f);
-		RBTree.Insert(4.0f);
-		RBTree.Insert(15.0f);
-		RBTree.Insert(14.0f);
-		RBTree.Insert(7.0f);
-		RBTree.Insert(17.0f);
-		RBTree.Insert(13.0f);
-		RBTree.Insert(25.0f);
-		RBTree.Insert(3.0f);
-		RBTree.Insert(27.0f);
-		RBTree.Insert(23.0f);
+		{
+			long long Dur = 0;
+			size_t Total = 0;
+			FStringBuilder Builder;
+			const size_t AllocationsBefore = Stats.GetTotalAllocations();
+			TTimer<TestTimeResolution> Timer("AA Log Formatting", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Builder.Reset();
+					Builder << "[Info] " << "Loaded mesh " << i << " with " << i * 3 << " vertices\n";
+					Total += Builder.Len();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Log Formatting: %f (%zu), Allocations: %zu", (float)Dur / TestIter, Total, Stats.GetTotalAllocations() - AllocationsBefore);
+		}
 
-		RBTree.InOrderPrint();
-		AA_CORE_LOG(Info, "Size AA: %d", sizeof(RBTree));
-		AA_CORE_LOG(Info, "Size AA: %d", sizeof(Temp3));
-		RBTree.Remove(15.0f);
+		// Uniform style lookups
+		constexpr int NumNames = 64;
+		TArray<std::string> Strings;
+		TArray<FName> Names;
+		for (int i = 0; i < NumNames; i++)
+		{
+			Strings.PushBack("u_Uniform" + std::to_string(i));
+			Names.PushBack(FName(Strings[i]));
+		}
 
-		//RBTree.InOrderPrint();
-		RBTree.Remove(17.0f);
+		{
+			TMap<std::string, int> Map;
+			for (int i = 0; i < NumNames; i++)
+			{
+				Map.Add(Strings[i], i);
+			}
 
-		//RBTree.InOrderPrint();
-		RBTree.Remove(14.0f);
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA String Map Lookup", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Total += *Map.FindValue(Strings[i % NumNames]);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TMap<std::string> Lookup: %f (%zu)", (float)Dur / TestIter, Total);
+		}
 
-		//RBTree.InOrderPrint();
-		RBTree.Remove(25.0f);
+		{
+			TMap<FName, int> Map;
+			for (int i = 0; i < NumNames; i++)
+			{
+				Map.Add(Names[i], i);
+			}
 
-		//RBTree.InOrderPrint();
-		//return;
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA Name Map Lookup", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Total += *Map.FindValue(Names[i % NumNames]);
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TMap<FName> Lookup: %f (%zu)", (float)Dur / TestIter, Total);
+		}
 
-		if (Tree.Search(15.f))
 		{
-			AA_CORE_LOG(Info, "Found 15");
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("STD String Compare", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Total += Strings[i % NumNames] == Strings[(i + 1) % NumNames];
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time STD String Compare: %f (%zu)", (float)Dur / TestIter, Total);
 		}
-		else
+
 		{
-			AA_CORE_LOG(Info, "NO Found 15");
+			long long Dur = 0;
+			size_t Total = 0;
+			TTimer<TestTimeResolution> Timer("AA Name Compare", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				for (int i = 0; i < TestSize; i++)
+				{
+					Total += Names[i % NumNames] == Names[(i + 1) % NumNames];
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA Name Compare: %f (%zu)", (float)Dur / TestIter, Total);
 		}
-		AA_CORE_LOG(Info, "No of Elemts AA: %d", Tree.Num());
-		Tree.Clear();
-		Tree.Insert(13.0f);
-		Tree.Insert(25.0f);
-		Tree.Insert(3.0f);
-		AA_CORE_LOG(Info, "No of Elemts AA: %d", Tree.Num());
-		Tree.Insert(27.0f);
-		//Tree.InOrderPrint();
-
-
-		//constexpr int TestSize = 1000000;
-		//constexpr int TestIter = 10;
-		//constexpr ETimeResolution TestTimeResolution = MilliSeconds;
-		//{
-		//	long long Dur = 0;
-		//	TTimer<TestTimeResolution> Timer("AA Tree", false);
-		//	for (int testNum = 0; testNum < TestIter; testNum++)
-		//	{
-		//		TRedBlackTree<float> VectorOfUnique;
-		//		Dur += Timer.Reset();
-		//		for (int i = 0; i < TestSize; i++)
-		//		{
-		//			VectorOfUnique.Insert(float(rand()) / RAND_MAX);
-		//		}
-		//		//AA_CORE_LOG(Info, "No of Elemts AA: %d", VectorOfUnique.Num());
-		//		for (auto it = VectorOfUnique.begin(); it != VectorOfUnique.end();)
-		//		{
-		//			float ValToDel = it->Value;
-		//			it++;
-		//			//VectorOfUnique.InOrderPrint();
-		//			VectorOfUnique.Remove(ValToDel);
-		//			//VectorOfUnique.InOrderPrint();
-		//		}
-		//		//AA_CORE_LOG(Info, "No of Elemts AA After: %d", VectorOfUnique.Num());
-		//	}
-		//	AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur / TestIter);
-		//	//VectorOfUnique.ShrinkToFit();
-		//	/*while (!VectorOfUnique.IsEmpty())
-		//	{
-		//		VectorOfUnique.PopBack();
-		//	}*/
-		//}
-		//{
-		//	long long Dur = 0;
-		//	TTimer<TestTimeResolution> Timer("STD set", false);
-		//	for (int testNum = 0; testNum < TestIter; testNum++)
-		//	{
-		//		std::set<float> VectorOfUnique;
-		//		Dur += Timer.Reset();
-		//		for (int i = 0; i < TestSize; i++)
-		//		{
-		//			VectorOfUnique.emplace(float(rand()) / RAND_MAX);
-		//		}
-		//		//AA_CORE_LOG(Info, "No of Elemts AA: %d", VectorOfUnique.size());
-		//		for (auto it = VectorOfUnique.begin(); it != VectorOfUnique.end();)
-		//		{
-		//			float ValToDel = *it;
-		//			it++;
-		//			VectorOfUnique.erase(ValToDel);
-		//		}
-		//	}
-		//	AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur / TestIter);
-		//	//VectorOfUnique.ShrinkToFit();
-		//	/*while (!VectorOfUnique.IsEmpty())
-		//	{
-		//		VectorOfUnique.PopBack();
-		//	}*/
-		//}
 	}
 
-	void CTester::StaticArrayTests()
+	void CTester::MemoryTests()
 	{
-		constexpr int TestSize = 1;
-		constexpr ETimeResolution TestTimeResolution = NanoSeconds;
-		/*{
-			std::array<int, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("STD Array");
+		constexpr int TestSize = 1000000;
+		constexpr int TestIter = 10;
+		constexpr int NumThreads = 4;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		// Small allocations in a churn pattern: keep a window of live allocations and replace them in order
+		constexpr int WindowSize = 1024;
+		TArray<size_t> Sizes(TestSize);
+		for (int i = 0; i < TestSize; i++)
+		{
+			Sizes.PushBack(16 + (rand() % 240));
+		}
+
+		auto RunSystem = [&Sizes]()
+		{
+			void* Window[WindowSize] = {};
 			for (int i = 0; i < TestSize; i++)
 			{
-				VectorOfUnique[i] = 100;
-				size_t temp = VectorOfUnique.size();
-				VectorOfUnique[i] = temp;
+				::operator delete(Window[i % WindowSize]);
+				Window[i % WindowSize] = ::operator new(Sizes[i]);
+			}
+			for (void* Pointer : Window)
+			{
+				::operator delete(Pointer);
 			}
-		}
+		};
 
+		auto RunEngine = [&Sizes]()
 		{
-			TStaticArray<int, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("AA Array");
-			for (auto i = VectorOfUnique.begin(); i != VectorOfUnique.end(); i++)
+			void* Window[WindowSize] = {};
+			for (int i = 0; i < TestSize; i++)
 			{
-				*i = 100;
-				size_t temp = VectorOfUnique.Num();
-				*i = temp;
-
+				FMemory::Free(Window[i % WindowSize]);
+				Window[i % WindowSize] = FMemory::Malloc(Sizes[i]);
 			}
-		}*/
+			for (void* Pointer : Window)
+			{
+				FMemory::Free(Pointer);
+			}
+		};
 
-		/*{
-			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("STD Make Unique");
-			for (int i = 0; i < TestSize; i++)
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD Small Allocations", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				VectorOfUnique[i] = MakeUnique<int>();
+				Timer.Reset();
+				RunSystem();
+				Dur += Timer.Reset();
 			}
+			AA_CORE_LOG(Info, "Average Time STD operator new Small Allocations: %f", (float)Dur / TestIter);
 		}
 
 		{
-			TStaticArray<TUniquePtr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("STD New");
-			for (int i = 0; i < TestSize; i++)
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA Small Allocations", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				VectorOfUnique[i] = MakeUnique<int>();
+				Timer.Reset();
+				RunEngine();
+				Dur += Timer.Reset();
 			}
-		}*/
-	}
-
-	void CTester::DynamicArrayTests()
-	{
-		/* Faster */
-		constexpr int TestSize = 100000;
-		constexpr ETimeResolution TestTimeResolution = MilliSeconds;
+			AA_CORE_LOG(Info, "Average Time AA FMemory (%s) Small Allocations: %f", FMemory::GetBackend().GetName(), (float)Dur / TestIter);
+		}
 
 		{
 			long long Dur = 0;
-			TTimer<TestTimeResolution> Timer("STD Array", false);
-			for (int testNum = 0; testNum < 10; testNum++)
+			TTimer<TestTimeResolution> Timer("STD Small Allocations MT", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				std::vector<float> VectorOfUnique;
-				Dur += Timer.Reset();
-				for (int i = 0; i < TestSize; i++)
+				Timer.Reset();
+				std::vector<std::thread> Threads;
+				for (int ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
 				{
-					VectorOfUnique.emplace(VectorOfUnique.begin(), float(rand())/RAND_MAX);
+					Threads.emplace_back(RunSystem);
+				}
+				for (std::thread& Thread : Threads)
+				{
+					Thread.join();
 				}
+				Dur += Timer.Reset();
 			}
-			AA_CORE_LOG(Info, "Average Time STD: %f", (float)Dur * 0.01);
+			AA_CORE_LOG(Info, "Average Time STD operator new Small Allocations (%d Threads): %f", NumThreads, (float)Dur / TestIter);
 		}
 
 		{
 			long long Dur = 0;
-			TTimer<TestTimeResolution> Timer("AA Array", false);
-			for (int testNum = 0; testNum < 10; testNum++)
+			TTimer<TestTimeResolution> Timer("AA Small Allocations MT", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				TArray<float> VectorOfUnique;
-				Dur += Timer.Reset();
-				for (int i = 0; i < TestSize; i++)
+				Timer.Reset();
+				std::vector<std::thread> Threads;
+				for (int ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
 				{
-					VectorOfUnique.Emplace(VectorOfUnique.begin(), float(rand()) / RAND_MAX);
+					Threads.emplace_back(RunEngine);
+				}
+				for (std::thread& Thread : Threads)
+				{
+					Thread.join();
 				}
+				Dur += Timer.Reset();
 			}
-			AA_CORE_LOG(Info, "Average Time AA: %f", (float)Dur * 0.01);
-			//VectorOfUnique.ShrinkToFit();
-			/*while (!VectorOfUnique.IsEmpty())
-			{
-				VectorOfUnique.PopBack();
-			}*/
+			AA_CORE_LOG(Info, "Average Time AA FMemory (%s) Small Allocations (%d Threads): %f", FMemory::GetBackend().GetName(), NumThreads, (float)Dur / TestIter);
 		}
 
-		//TArray<Vector> VectorOfUnique;
-		//VectorOfUnique.RemoveAt(0);
-		//VectorOfUnique.EmplaceBack("Hello");
-		////VectorOfUnique.EmplaceBack(1.f, 1.f, 3.f);
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.begin(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		//VectorOfUnique.Emplace(VectorOfUnique.end(), "Hello Sar cvaddu");
-		////VectorOfUnique.PushBack("Helloasdasd");
+#if AA_TRACK_ALLOCATOR_STATS
+		// A frame going over the allocation budget has to warn, a frame under it must not
+		{
+			constexpr size_t TestBudget = 64;
+			const size_t Budget = FMemoryTracker::GetFrameAllocationBudget();
 
-		////TArray<Vector> NewArray;
+			// Close the frame of the tests above without a budget, the first frame is never held against one anyway
+			FMemoryTracker::SetFrameAllocationBudget(0);
+			FMemoryTracker::EndFrame();
+			FMemoryTracker::EndFrame();
+			FMemoryTracker::SetFrameAllocationBudget(TestBudget);
 
+			void* Allocations[TestBudget * 2];
+			for (void*& Allocation : Allocations)
+			{
+				Allocation = FMemory::Malloc(32);
+			}
+			for (void* Allocation : Allocations)
+			{
+				FMemory::Free(Allocation);
+			}
+			const bool bWarnedOverBudget = FMemoryTracker::EndFrame();
+			const bool bWarnedUnderBudget = FMemoryTracker::EndFrame();
 
-		//std::cout << "Old Array\n";
-		//PrintArray(VectorOfUnique);
+			AA_CORE_ASSERT(bWarnedOverBudget, "FMemoryTracker did not warn about a frame over the allocation budget!");
+			AA_CORE_ASSERT(!bWarnedUnderBudget, "FMemoryTracker warned about a frame under the allocation budget!");
+			AA_CORE_LOG(Info, "AA FMemoryTracker Frame Budget (Over %d, Under %d)", bWarnedOverBudget, bWarnedUnderBudget);
 
-		//std::cout << "New Array\n";
-		//PrintArray(NewArray);
-		
+			FMemoryTracker::SetFrameAllocationBudget(Budget);
+		}
+#endif
+
+		FMemory::DumpStats();
 	}
 
-	void CTester::UniquePtrTests()
+	void CTester::FrameAllocatorTests()
 	{
-		/*
-		* TEST RESULTS
-		* 
-		* 1) std::make_unique
-		* Size = 1000
-		* Speed (Avg) = 68 ns
-		* Speed (Fastest) = 62 ns
-		* 
-		* 2) AA - MakeUnique
-		* Size = 1000
-		* Speed (Avg) = 47 ns
-		* Speed (Fastest) = 45 ns
-		* 
-		* 3) AA - new TUniquePtr
-		* Size = 1000
-		* Speed (Avg) = 49 ns
-		* Speed (Fastest) = 47 ns
-		* 
-		* 4) Raw new
-		* Size = 1000
-		* Speed (Avg) = 46 ns
-		* Speed (Fastest) = 45 ns
-		* 
-		* 10000 size, similar results
-		* 100000 size, similar results
-		*/
-		constexpr int TestSize = 1;
+		constexpr int NumFrames = 1000;
+		constexpr int TempsPerFrame = 1000;
+		constexpr int TempSize = 64;
 		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+		CFrameAllocator& FrameAllocator = CFrameAllocator::Get();
+
+		// Every frame builds TempsPerFrame short lived arrays, e.g. per object scratch data
 		{
-			std::array<std::unique_ptr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("STD Make Unique");
-			for (int i = 0; i < TestSize; i++)
+			float Total = 0.0f;
+			TTimer<TestTimeResolution> Timer("AA Heap Temporaries");
+			for (int Frame = 0; Frame < NumFrames; Frame++)
 			{
-				VectorOfUnique[i] = std::make_unique<int>();
+				for (int TempIndex = 0; TempIndex < TempsPerFrame; TempIndex++)
+				{
+					TArray<float> Temp(TempSize);
+					for (int i = 0; i < TempSize; i++)
+					{
+						Temp.PushBack(float(i + TempIndex));
+					}
+					Total += Temp[TempIndex % TempSize];
+				}
 			}
+			AA_CORE_LOG(Info, "AA Heap Temporaries (%f)", Total);
 		}
 
-		/*{
-			std::array<std::unique_ptr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("STD New");
+		{
+			float Total = 0.0f;
+			TTimer<TestTimeResolution> Timer("AA Frame Allocator Temporaries");
+			for (int Frame = 0; Frame < NumFrames; Frame++)
+			{
+				for (int TempIndex = 0; TempIndex < TempsPerFrame; TempIndex++)
+				{
+					float* Temp = (float*)FrameAllocator.Allocate(TempSize * sizeof(float), alignof(float));
+					for (int i = 0; i < TempSize; i++)
+					{
+						Temp[i] = float(i + TempIndex);
+					}
+					Total += Temp[TempIndex % TempSize];
+				}
+				FrameAllocator.EndFrame();
+			}
+			AA_CORE_LOG(Info, "AA Frame Allocator Temporaries (%f)", Total);
+		}
+
+		FrameAllocator.LogStats();
+	}
+
+	void CTester::ObjectPoolTests()
+	{
+		constexpr int TestSize = 1000000;
+		constexpr int TestIter = 10;
+		constexpr int NumThreads = 4;
+		constexpr int NumFrames = 1000;
+		constexpr int EventsPerFrame = 1000;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		// Events in a churn pattern: keep a window of queued events and replace them in order
+		constexpr int WindowSize = 1024;
+
+		auto RunNewDelete = []()
+		{
+			CMouseMovedEvent* Window[WindowSize] = {};
 			for (int i = 0; i < TestSize; i++)
 			{
-				VectorOfUnique[i] = std::unique_ptr<int>(new int);
+				delete Window[i % WindowSize];
+				Window[i % WindowSize] = new CMouseMovedEvent(double(i), double(i));
 			}
-		}*/
+			for (CMouseMovedEvent* Event : Window)
+			{
+				delete Event;
+			}
+		};
 
+		auto RunObjectPool = []()
 		{
-			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("AA Make Unique");
+			CMouseMovedEvent* Window[WindowSize] = {};
 			for (int i = 0; i < TestSize; i++)
 			{
-				VectorOfUnique[i] = MakeUnique<int>();
+				TObjectPool<CMouseMovedEvent>::Destroy(Window[i % WindowSize]);
+				Window[i % WindowSize] = TObjectPool<CMouseMovedEvent>::Construct(double(i), double(i));
+			}
+			for (CMouseMovedEvent* Event : Window)
+			{
+				TObjectPool<CMouseMovedEvent>::Destroy(Event);
+			}
+		};
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD new delete Churn", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				RunNewDelete();
+				Dur += Timer.Reset();
 			}
+			AA_CORE_LOG(Info, "Average Time STD new / delete Event Churn: %f", (float)Dur / TestIter);
 		}
 
-		/*{
-			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("AA New");
-			for (int i = 0; i < TestSize; i++)
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TObjectPool Churn", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				VectorOfUnique[i] = TUniquePtr<int>(new int);
+				Timer.Reset();
+				RunObjectPool();
+				Dur += Timer.Reset();
 			}
-		}*/
+			AA_CORE_LOG(Info, "Average Time AA TObjectPool Event Churn: %f", (float)Dur / TestIter);
+		}
 
-		/*{
-			std::array<TUniquePtr<int>, TestSize> VectorOfUnique;
-			TTimer<TestTimeResolution> Timer("Raw New");
-			for (int i = 0; i < TestSize; i++)
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("STD new delete Churn MT", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
 			{
-				VectorOfUnique[i] = new int;
+				Timer.Reset();
+				std::vector<std::thread> Threads;
+				for (int ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
+				{
+					Threads.emplace_back(RunNewDelete);
+				}
+				for (std::thread& Thread : Threads)
+				{
+					Thread.join();
+				}
+				Dur += Timer.Reset();
 			}
-		}*/
+			AA_CORE_LOG(Info, "Average Time STD new / delete Event Churn (%d Threads): %f", NumThreads, (float)Dur / TestIter);
+		}
+
+		{
+			long long Dur = 0;
+			TTimer<TestTimeResolution> Timer("AA TObjectPool Churn MT", false);
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				Timer.Reset();
+				std::vector<std::thread> Threads;
+				for (int ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
+				{
+					Threads.emplace_back(RunObjectPool);
+				}
+				for (std::thread& Thread : Threads)
+				{
+					Thread.join();
+				}
+				Dur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "Average Time AA TObjectPool Event Churn (%d Threads): %f", NumThreads, (float)Dur / TestIter);
+		}
+
+		// Every frame queues EventsPerFrame events and drops them all once they are dispatched
+		{
+			std::vector<CMouseMovedEvent*> Queue;
+			Queue.reserve(EventsPerFrame);
+			double Total = 0.0;
+			TTimer<TestTimeResolution> Timer("STD new delete Frame Events");
+			for (int Frame = 0; Frame < NumFrames; Frame++)
+			{
+				for (int i = 0; i < EventsPerFrame; i++)
+				{
+					Queue.push_back(new CMouseMovedEvent(double(i), double(Frame)));
+				}
+				for (CMouseMovedEvent* Event : Queue)
+				{
+					Total += Event->GetXPos();
+					delete Event;
+				}
+				Queue.clear();
+			}
+			AA_CORE_LOG(Info, "STD new / delete Frame Events (%f)", Total);
+		}
+
+		{
+			TTypedSlab<CMouseMovedEvent> Slab;
+			TArray<CMouseMovedEvent*> Queue(EventsPerFrame);
+			double Total = 0.0;
+			TTimer<TestTimeResolution> Timer("AA TTypedSlab Reset Frame Events");
+			for (int Frame = 0; Frame < NumFrames; Frame++)
+			{
+				for (int i = 0; i < EventsPerFrame; i++)
+				{
+					Queue.PushBack(Slab.Construct(double(i), double(Frame)));
+				}
+				for (CMouseMovedEvent* Event : Queue)
+				{
+					Total += Event->GetXPos();
+				}
+				Queue.Clear();
+				Slab.Reset();
+			}
+			AA_CORE_LOG(Info, "AA TTypedSlab Reset Frame Events (%f)", Total);
+		}
+
+		// A pooled pointer has to survive moves and give its object back to the pool when it dies
+		{
+			TTypedSlab<CMouseMovedEvent>& Slab = TObjectPool<CMouseMovedEvent>::GetThreadSlab();
+			const size_t NumLiveBefore = Slab.Num();
+			{
+				TPooledPtr<CMouseMovedEvent> Pooled = MakePooled<CMouseMovedEvent>(1.0, 2.0);
+				const CMouseMovedEvent* Object = Pooled.Get();
+				TPooledPtr<CMouseMovedEvent> Moved(Move(Pooled));
+				TPooledPtr<CMouseMovedEvent> Assigned;
+				Assigned = Move(Moved);
+
+				AA_CORE_ASSERT(!Pooled.IsValid() && !Moved.IsValid() && Assigned.Get() == Object, "TPooledPtr move did not transfer ownership!");
+				AA_CORE_ASSERT(Slab.Num() == NumLiveBefore + 1, "TPooledPtr move constructed or destroyed an object!");
+			}
+			AA_CORE_ASSERT(Slab.Num() == NumLiveBefore, "TPooledPtr did not give its object back to the pool!");
+			AA_CORE_LOG(Info, "AA TPooledPtr Moves (Live Objects %zu)", Slab.Num());
+		}
+	}
+
+	void CTester::SharedPtrTests()
+	{
+		constexpr int TestSize = 100000;
+		constexpr int TestIter = 10;
+		constexpr ETimeResolution TestTimeResolution = MicroSeconds;
+
+		struct FTestObject
+		{
+			explicit FTestObject(int InValue) : Value(InValue) {}
+			int Value;
+		};
+
+		struct FRefCountedTestObject : public TRefCountedObject<ESPMode::ThreadSafe>
+		{
+			explicit FRefCountedTestObject(int InValue) : Value(InValue) {}
+			int Value;
+		};
+
+		struct FRefCountedTestObjectNotThreadSafe : public TRefCountedObject<ESPMode::NotThreadSafe>
+		{
+			explicit FRefCountedTestObjectNotThreadSafe(int InValue) : Value(InValue) {}
+			int Value;
+		};
+
+		// Make TestSize pointers, copy them all, move the copies, then destroy everything, timing every step
+		auto RunPointerTests = [](const char* PointerName, auto MakePointer)
+		{
+			using PointerType = decltype(MakePointer(0));
+			long long MakeDur = 0, CopyDur = 0, MoveDur = 0, DestructDur = 0;
+			int Total = 0;
+			for (int TestNum = 0; TestNum < TestIter; TestNum++)
+			{
+				TArray<PointerType> Pointers(TestSize);
+				TArray<PointerType> Copies(TestSize);
+				TArray<PointerType> Moved(TestSize);
+				TTimer<TestTimeResolution> Timer(PointerName, false);
+
+				for (int i = 0; i < TestSize; i++)
+				{
+					Pointers.PushBack(MakePointer(i));
+				}
+				MakeDur += Timer.Reset();
+
+				for (int i = 0; i < TestSize; i++)
+				{
+					Copies.PushBack(Pointers[i]);
+				}
+				CopyDur += Timer.Reset();
+
+				for (int i = 0; i < TestSize; i++)
+				{
+					Moved.PushBack(Move(Copies[i]));
+				}
+				MoveDur += Timer.Reset();
+
+				for (int i = 0; i < TestSize; i++)
+				{
+					Total += Moved[i]->Value;
+				}
+				Timer.Reset();
+
+				// Releases a reference, then destroys the objects with the last one
+				Moved.Clear();
+				Copies.Clear();
+				Pointers.Clear();
+				DestructDur += Timer.Reset();
+			}
+			AA_CORE_LOG(Info, "%s (%d) Average Time - Make: %f, Copy: %f, Move: %f, Destruct: %f", PointerName, Total,
+				(float)MakeDur / TestIter, (float)CopyDur / TestIter, (float)MoveDur / TestIter, (float)DestructDur / TestIter);
+		};
+
+		RunPointerTests("STD shared_ptr make_shared", [](int Value) { return std::make_shared<FTestObject>(Value); });
+		RunPointerTests("AA TSharedPtr MakeShared", [](int Value) { return MakeShared<FTestObject>(Value); });
+		RunPointerTests("AA TSharedPtr NotThreadSafe MakeShared", [](int Value) { return MakeShared<FTestObject, ESPMode::NotThreadSafe>(Value); });
+		RunPointerTests("STD shared_ptr new", [](int Value) { return std::shared_ptr<FTestObject>(new FTestObject(Value)); });
+		RunPointerTests("AA TSharedPtr new", [](int Value) { return TSharedPtr<FTestObject>(new FTestObject(Value)); });
+		RunPointerTests("AA TRefCountPtr", [](int Value) { return MakeRefCount<FRefCountedTestObject>(Value); });
+		RunPointerTests("AA TRefCountPtr NotThreadSafe", [](int Value) { return MakeRefCount<FRefCountedTestObjectNotThreadSafe>(Value); });
 	}
 }
\ No newline at end of file
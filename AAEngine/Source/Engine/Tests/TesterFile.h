@@ -9,6 +9,12 @@ namespace AAEngine {
 	private:
 		// Math Lib tests
 		static void MatrixTests();
+		static void MatrixInverseTests();
+		static void MathBatchTests();
+		static void QuaternionTests();
+		static void TransformTests();
+		static void VectorTests();
+		static void TranscendentalTests();
 		static void MatrixGLMTests();
 
 		// Container Tests
@@ -16,8 +22,22 @@ namespace AAEngine {
 		static void TreeTests();
 		static void StaticArrayTests();
 		static void DynamicArrayTests();
+		static void DynamicArrayRelocationTests();
+		static void DynamicArrayBulkTests();
+		static void HashMapTests();
+		static void QueueTests();
+		static void SoAArrayTests();
+		static void ResourcePoolTests();
+		static void ArrayViewTests();
+
+		// String Tests
+		static void StringTests();
 
 		// Memory Tests
 		static void UniquePtrTests();
+		static void SharedPtrTests();
+		static void MemoryTests();
+		static void FrameAllocatorTests();
+		static void ObjectPoolTests();
 	};
 }
\ No newline at end of file
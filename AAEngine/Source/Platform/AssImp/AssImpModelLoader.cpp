@@ -40,84 +40,76 @@ namespace AAEngine {
 
 	void CAssImpModelLoader::ProcessMesh(aiMesh* Mesh, const aiScene* Scene, TArray<float>& OutVertices, TArray<uint32_t>& OutIndices, const CVertexBufferLayout& BufferLayout)
 	{
-		OutVertices.Reserve(Mesh->mNumVertices * BufferLayout.GetStride());
+		// Stride and Offsets are in bytes, the vertex array is in floats
+		const uint32_t FloatsPerVertex = BufferLayout.GetStride() / sizeof(float);
+		const size_t FirstVertexFloat = OutVertices.AddUninitialized((size_t)Mesh->mNumVertices * FloatsPerVertex);
+		float* VertexData = OutVertices.Data() + FirstVertexFloat;
 
-		for (unsigned int i = 0; i < Mesh->mNumVertices; i++)
+		// Fill in one layout element at a time for all vertices, straight into the array's storage
+		for (const FVertexBufferElement& Elem : BufferLayout)
 		{
-			for (const FVertexBufferElement& Elem : BufferLayout)
+			const aiVector3D* Source = nullptr;
+			switch (Elem.VertexInputType)
 			{
-				switch (Elem.VertexInputType)
+			case EVertexInputType::VI_Position:
+				Source = Mesh->mVertices;
+				break;
+			case EVertexInputType::VI_Normal:
+				Source = Mesh->HasNormals() ? Mesh->mNormals : nullptr;
+				break;
+			case EVertexInputType::VI_TexCoords:
+				Source = Mesh->mTextureCoords[0];
+				break;
+			case EVertexInputType::VI_Tangent:
+				Source = Mesh->mTextureCoords[0] ? Mesh->mTangents : nullptr;
+				break;
+			case EVertexInputType::VI_BiTangent:
+				Source = Mesh->mTextureCoords[0] ? Mesh->mBitangents : nullptr;
+				break;
+			default:
+				AA_CORE_LOG(Error, "Invalid Input Type.");
+				break;
+			}
+
+			const uint32_t ComponentCount = Elem.GetComponentCount();
+			float* Dest = VertexData + Elem.Offset / sizeof(float);
+
+			if (Source)
+			{
+				for (unsigned int i = 0; i < Mesh->mNumVertices; i++, Dest += FloatsPerVertex)
 				{
-				case EVertexInputType::VI_Position:
-					for (uint32_t j = 0; j < Elem.GetComponentCount(); j++)
-					{
-						OutVertices.PushBack(Mesh->mVertices[i][j]);
-					}
-					break;
-				case EVertexInputType::VI_Normal:
-					if (Mesh->HasNormals())
+					for (uint32_t j = 0; j < ComponentCount; j++)
 					{
-						for (uint32_t j = 0; j < Elem.GetComponentCount(); j++)
-						{
-							OutVertices.PushBack(Mesh->mNormals[i][j]);
-						}
-						break;
+						Dest[j] = Source[i][j];
 					}
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					break;
-				case EVertexInputType::VI_TexCoords:
-					if (Mesh->mTextureCoords[0])
-					{
-						for (uint32_t j = 0; j < Elem.GetComponentCount(); j++)
-						{
-							OutVertices.PushBack(Mesh->mTextureCoords[0][i][j]);
-						}
-						break;
-					}
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					break;
-				case EVertexInputType::VI_Tangent:
-					if (Mesh->mTextureCoords[0] && Mesh->mTangents)
-					{
-						for (uint32_t j = 0; j < Elem.GetComponentCount(); j++)
-						{
-							OutVertices.PushBack(Mesh->mTangents[i][j]);
-						}
-						break;
-					}
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					break;
-				case EVertexInputType::VI_BiTangent:
-					if (Mesh->mTextureCoords[0] && Mesh->mBitangents)
-					{
-						for (uint32_t j = 0; j < Elem.GetComponentCount(); j++)
-						{
-							OutVertices.PushBack(Mesh->mBitangents[i][j]);
-						}
-						break;
-					}
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					OutVertices.PushBack(0.0f);
-					break;
-				default:
-					AA_CORE_LOG(Error, "Invalid Input Type.");
-					break;
 				}
 			}
+			else
+			{
+				for (unsigned int i = 0; i < Mesh->mNumVertices; i++, Dest += FloatsPerVertex)
+				{
+					FMemory::MemSet(Dest, 0, ComponentCount * sizeof(float));
+				}
+			}
+		}
+
+		// Indices are local to the mesh, offset them to where its vertices start in OutVertices
+		const uint32_t BaseVertex = FloatsPerVertex > 0 ? (uint32_t)(FirstVertexFloat / FloatsPerVertex) : 0;
+
+		size_t NumIndices = 0;
+		for (unsigned int i = 0; i < Mesh->mNumFaces; i++)
+		{
+			NumIndices += Mesh->mFaces[i].mNumIndices;
 		}
 
+		const size_t FirstIndex = OutIndices.AddUninitialized(NumIndices);
+		uint32_t* IndexData = OutIndices.Data() + FirstIndex;
 		for (unsigned int i = 0; i < Mesh->mNumFaces; i++)
 		{
-			aiFace Face = Mesh->mFaces[i];
+			const aiFace& Face = Mesh->mFaces[i];
 			for (unsigned int j = 0; j < Face.mNumIndices; j++)
 			{
-				OutIndices.PushBack(Face.mIndices[j]);
+				*IndexData++ = Face.mIndices[j] + BaseVertex;
 			}
 		}
 	}
@@ -133,8 +133,10 @@
 #endif
 
 // SIMD 256-bit Start
+// NOTE: The 256-bit flags are only set if the compiler targets them too (/arch:AVX2), PlatformProcessorDefines.h describes the build machine
+// and a binary built on an AVX2 machine must still run on SSE only CPUs. Without them the AVX2 kernels are picked at runtime, see FMathDispatch.
 // AVX
-#if AA_PROCESSOR_SUPPORT_AVX
+#if AA_PROCESSOR_SUPPORT_AVX && defined(__AVX__)
 	#define AA_AVX_SUPPORT					0x00000400
 #else
 	#define AA_AVX_SUPPORT					0x00000000
@@ -146,7 +148,7 @@
 	#define AA_XOP_SUPPORT					0x00000000
 #endif
 // FMA3
-#if AA_PROCESSOR_SUPPORT_FMA3
+#if AA_PROCESSOR_SUPPORT_FMA3 && (defined(__FMA__) || defined(__AVX2__))
 	#define AA_FMA3_SUPPORT					0x00001000
 #else
 	#define AA_FMA3_SUPPORT					0x00000000
@@ -158,7 +160,7 @@
 	#define AA_FMA4_SUPPORT					0x00000000
 #endif
 // AVX2
-#if AA_PROCESSOR_SUPPORT_AVX2
+#if AA_PROCESSOR_SUPPORT_AVX2 && defined(__AVX2__)
 	#define AA_AVX2_SUPPORT					0x00004000
 #else
 	#define AA_AVX2_SUPPORT					0x00000000
@@ -264,4 +266,16 @@
 	#else
 		#define AA_PLATFORM_USING_SIMD 0
 	#endif
-#endif
\ No newline at end of file
+#endif
+
+/*
+* Lets one function use AVX2 / FMA intrinsics while the rest of its file is compiled for the SSE2 baseline.
+* Callers must check FPlatformCPU::HasAVX2() first. MSVC accepts the intrinsics without /arch:AVX2.
+*/
+#ifndef AA_TARGET_AVX2
+	#if PLATFORM_COMPILER_MSVC
+		#define AA_TARGET_AVX2
+	#else
+		#define AA_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#endif
+#endif
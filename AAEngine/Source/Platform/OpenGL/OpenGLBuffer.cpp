@@ -6,13 +6,13 @@
 
 namespace AAEngine {
 
-	COpenGLVertexBuffer::COpenGLVertexBuffer(float* Vertices, uint32_t Count, unsigned int GLEnumUsage)
+	COpenGLVertexBuffer::COpenGLVertexBuffer(TConstArrayView<float> Vertices, unsigned int GLEnumUsage)
 	{
-		VertexCount = Count;
+		VertexCount = static_cast<uint32_t>(Vertices.Num());
 
 		glCreateBuffers(1, &VertexBuffer);
 		glBindBuffer(GL_ARRAY_BUFFER, VertexBuffer);
-		glBufferData(GL_ARRAY_BUFFER, Count * sizeof(float), Vertices, GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, Vertices.NumBytes(), Vertices.Data(), GL_STATIC_DRAW);
 	}
 
 	COpenGLVertexBuffer::~COpenGLVertexBuffer()
@@ -31,13 +31,13 @@ namespace AAEngine {
 	}
 
 
-	COpenGLIndexBuffer::COpenGLIndexBuffer(uint32_t* Indices, uint32_t Count, unsigned int GLEnumUsage)
+	COpenGLIndexBuffer::COpenGLIndexBuffer(TConstArrayView<uint32_t> Indices, unsigned int GLEnumUsage)
 	{
-		IndexCount = Count;
+		IndexCount = static_cast<uint32_t>(Indices.Num());
 
 		glCreateBuffers(1, &IndexBuffer);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBuffer);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, Count * sizeof(uint32_t), Indices, GL_STATIC_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, Indices.NumBytes(), Indices.Data(), GL_STATIC_DRAW);
 	}
 
 	COpenGLIndexBuffer::~COpenGLIndexBuffer()
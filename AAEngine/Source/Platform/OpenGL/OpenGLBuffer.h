@@ -11,13 +11,12 @@ namespace AAEngine {
 	{
 	public:
 		/*
-		* Constructor that takes in Vertices, Count and the Usage type (Currently useful for OpenGL)
+		* Constructor that takes in Vertices and the Usage type (Currently useful for OpenGL)
 		* 
-		* @param Vertices - float pointer of Vertices. Array passed in as a pointer.
-		* @param Count - size_t Count of the vertices
+		* @param Vertices - View of the Vertices, uploaded straight from the caller's memory.
 		* @param EnumUsage - Usage of the buffer - Ex: OpenGL - GL_STATIC_DRAW
 		*/
-		COpenGLVertexBuffer(float* Vertices, uint32_t Count, unsigned int GLEnumUsage);
+		COpenGLVertexBuffer(TConstArrayView<float> Vertices, unsigned int GLEnumUsage);
 
 		/*
 		* Overriden Virtual destructor to delete Vertex Buffers
@@ -57,13 +56,12 @@ namespace AAEngine {
 	{
 	public:
 		/*
-		* Constructor that takes in Vertices, Count and the Usage type (Currently useful for OpenGL)
+		* Constructor that takes in Indices and the Usage type (Currently useful for OpenGL)
 		*
-		* @param Indices - float pointer of Indices. Array passed in as a pointer.
-		* @param Count - size_t Count of the vertices
+		* @param Indices - View of the Indices, uploaded straight from the caller's memory.
 		* @param EnumUsage - Usage of the buffer - Ex: OpenGL - GL_STATIC_DRAW
 		*/
-		COpenGLIndexBuffer(uint32_t* Indices, uint32_t Count, unsigned int GLEnumUsage);
+		COpenGLIndexBuffer(TConstArrayView<uint32_t> Indices, unsigned int GLEnumUsage);
 
 		/*
 		* Overriden Virtual destructor to delete Index Buffers
@@ -20,10 +20,10 @@ namespace AAEngine {
 		glClearColor(Color.R, Color.G, Color.B, Color.A);
 	}
 
-	void COpenGLRendererAPI::DrawIndexed(const TSharedPtr<IVertexArray>& VertexArray)
+	void COpenGLRendererAPI::DrawIndexed(IVertexArray& VertexArray)
 	{
-		VertexArray->Bind();
-		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(VertexArray->GetIndexBuffer()->GetIndexCount()), GL_UNSIGNED_INT, nullptr);
+		VertexArray.Bind();
+		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(VertexArray.GetIndexCount()), GL_UNSIGNED_INT, nullptr);
 	}
 
 }
@@ -29,6 +29,6 @@ namespace AAEngine {
 		*
 		* @param VertexArray - Vertex Array used to draw stuff
 		*/
-		virtual void DrawIndexed(const TSharedPtr<IVertexArray>& VertexArray) override;
+		virtual void DrawIndexed(IVertexArray& VertexArray) override;
 	};
 }
\ No newline at end of file
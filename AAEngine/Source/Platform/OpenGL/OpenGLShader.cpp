@@ -15,7 +15,7 @@ namespace AAEngine {
 	}
 
 	COpenGLShader::COpenGLShader(std::string&& ShaderName, const std::string& VertexShaderSource, const std::string& FragmentShaderSource)
-		: ShaderName(Move(ShaderName))
+		: ShaderName(ShaderName)
 	{
 		TMap<EShaderType, std::string> ShaderData;
 		ShaderData[EShaderType::SHT_Vertex] = VertexShaderSource;
@@ -39,7 +39,7 @@ namespace AAEngine {
 	}
 
 	COpenGLShader::COpenGLShader(std::string&& ShaderName, const std::string& ShaderFilePath)
-		: ShaderName(Move(ShaderName))
+		: ShaderName(ShaderName)
 	{
 		TMap<EShaderType, std::string> ShaderData = ParseShaderSourceIntoShaderData(ReadShaderSourceFromFile(ShaderFilePath));
 		CompileShaders(ShaderData);
@@ -60,30 +60,41 @@ namespace AAEngine {
 		glUseProgram(0);
 	}
 
-	void COpenGLShader::UploadUniformInt(const char* UniformName, int Value)
+	void COpenGLShader::UploadUniformInt(FName UniformName, int Value)
 	{
-		GLuint Location = glGetUniformLocation(ShaderProgram, UniformName);
+		GLint Location = GetUniformLocation(UniformName);
 		glUniform1i(Location, Value);
 	}
 
-	void COpenGLShader::UploadUniformVec3(const char* UniformName, const FVector3f& Value)
+	void COpenGLShader::UploadUniformVec3(FName UniformName, const FVector3f& Value)
 	{
-		GLuint Location = glGetUniformLocation(ShaderProgram, UniformName);
+		GLint Location = GetUniformLocation(UniformName);
 		glUniform3f(Location, Value.X, Value.Y, Value.Z);
 	}
 
-	void COpenGLShader::UploadUniformVec4(const char* UniformName, const FVector4f& Value)
+	void COpenGLShader::UploadUniformVec4(FName UniformName, const FVector4f& Value)
 	{
-		GLuint Location = glGetUniformLocation(ShaderProgram, UniformName);
+		GLint Location = GetUniformLocation(UniformName);
 		glUniform4f(Location, Value.X, Value.Y, Value.Z, Value.W);
 	}
 
-	void COpenGLShader::UploadUniformMat4(const char* UniformName, const FMatrix44f& Value)
+	void COpenGLShader::UploadUniformMat4(FName UniformName, const FMatrix44f& Value)
 	{
-		GLuint Location = glGetUniformLocation(ShaderProgram, UniformName);
+		GLint Location = GetUniformLocation(UniformName);
 		glUniformMatrix4fv(Location, 1, GL_FALSE, Value.MLin);
 	}
 
+	int COpenGLShader::GetUniformLocation(FName UniformName)
+	{
+		if (const int* Location = UniformLocations.FindValue(UniformName))
+		{
+			return *Location;
+		}
+		GLint Location = glGetUniformLocation(ShaderProgram, UniformName.CStr());
+		UniformLocations.Add(UniformName, Location);
+		return Location;
+	}
+
 	std::string COpenGLShader::ReadShaderSourceFromFile(const std::string& ShaderFilePath)
 	{
 		std::ifstream FileToRead(ShaderFilePath, std::ios::in | std::ios::binary);
@@ -147,7 +158,7 @@ namespace AAEngine {
 
 	void COpenGLShader::CompileShaders(const TMap<EShaderType, std::string>& ShaderDataArray)
 	{
-		if (ShaderDataArray.size() == 0)
+		if (ShaderDataArray.IsEmpty())
 		{
 			AA_CORE_LOG(Error, "Compile Error! No Shader Sources present in the Shader Map!");
 			return;
@@ -159,9 +170,9 @@ namespace AAEngine {
 		int CurrShaderNum = 0;
 		for (const auto& ShaderData : ShaderDataArray)
 		{
-			uint32_t ShaderCode = glCreateShader(AAShaderEnumToAPIEnum(ShaderData.first));
+			uint32_t ShaderCode = glCreateShader(AAShaderEnumToAPIEnum(ShaderData.Key));
 
-			const GLchar* Source = ShaderData.second.c_str();
+			const GLchar* Source = ShaderData.Value.c_str();
 			glShaderSource(ShaderCode, 1, &Source, 0);
 
 			glCompileShader(ShaderCode);
@@ -181,7 +192,7 @@ namespace AAEngine {
 				glDeleteShader(ShaderCode);
 
 				AA_CORE_LOG(Error, "Shader Info: %s", Message.Data());
-				AA_CORE_ASSERT(false, AAShaderEnumToString(ShaderData.first).append("Shader Compilation Error!").c_str());
+				AA_CORE_ASSERT(false, AAShaderEnumToString(ShaderData.Key).append("Shader Compilation Error!").c_str());
 				break;
 			}
 			glAttachShader(Program, ShaderCode);
@@ -56,7 +56,7 @@ namespace AAEngine {
 		*
 		* @returns Name of the Shader.
 		*/
-		virtual std::string GetName() override
+		virtual FName GetName() override
 		{
 			return ShaderName;
 		}
@@ -67,11 +67,20 @@ namespace AAEngine {
 		* @param UniformName - name of the uniform variable.
 		* @param DataType - varying from Int to Vec4 to Mat4 - data to be uploaded to the uniform variable
 		*/
-		virtual void UploadUniformInt(const char* UniformName, int Value) override;
-		virtual void UploadUniformVec3(const char* UniformName, const FVector3f& Value) override;
-		virtual void UploadUniformVec4(const char* UniformName, const FVector4f& Value) override;
-		virtual void UploadUniformMat4(const char* UniformName, const FMatrix44f& Value) override;
+		virtual void UploadUniformInt(FName UniformName, int Value) override;
+		virtual void UploadUniformVec3(FName UniformName, const FVector3f& Value) override;
+		virtual void UploadUniformVec4(FName UniformName, const FVector4f& Value) override;
+		virtual void UploadUniformMat4(FName UniformName, const FMatrix44f& Value) override;
 	private:
+		/*
+		* Function to get the location of a uniform, asks OpenGL only the first time and caches it.
+		*
+		* @param UniformName - name of the uniform variable.
+		*
+		* @returns Location of the uniform, -1 if the program has no such uniform.
+		*/
+		int GetUniformLocation(FName UniformName);
+
 		/*
 		* Function to read shader code from a file.
 		* 
@@ -118,6 +127,11 @@ namespace AAEngine {
 		/*
 		* Name of the Shader
 		*/
-		std::string ShaderName;
+		FName ShaderName;
+
+		/*
+		* Uniform Name => Location cache, saves a glGetUniformLocation string lookup per upload.
+		*/
+		TMap<FName, int> UniformLocations;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "AA_PreCompiledHeaders.h"
 #include "OpenGLVertexArray.h"
 #include "OpenGLBuffer.h"
+#include "Engine/Core/Renderer/RenderResources.h"
 
 #include <glad/glad.h>
 
@@ -26,12 +27,15 @@ namespace AAEngine {
 		glBindVertexArray(0);
 	}
 
-	void COpenGLVertexArray::AddVertexBuffer(const TSharedPtr<IVertexBuffer>& VertexBuffer)
+	void COpenGLVertexArray::AddVertexBuffer(FVertexBufferHandle VertexBuffer)
 	{
+		IVertexBuffer* VertexBufferObject = CRenderResources::Get(VertexBuffer);
+		AA_CORE_ASSERT(VertexBufferObject, "Adding a Vertex Buffer that was destroyed!");
+
 		Bind();
-		VertexBuffer->Bind();
+		VertexBufferObject->Bind();
 
-		const CVertexBufferLayout& Layout = VertexBuffer->GetLayout();
+		const CVertexBufferLayout& Layout = VertexBufferObject->GetLayout();
 
 		uint32_t Index = 0;
 		for (const FVertexBufferElement& Elem : Layout)
@@ -51,11 +55,20 @@ namespace AAEngine {
 		VertexBuffers.EmplaceBack(VertexBuffer);
 	}
 
-	void COpenGLVertexArray::SetIndexBuffer(const TSharedPtr<IIndexBuffer>& InIndexBuffer)
+	void COpenGLVertexArray::SetIndexBuffer(FIndexBufferHandle InIndexBuffer)
 	{
+		IIndexBuffer* IndexBufferObject = CRenderResources::Get(InIndexBuffer);
+		AA_CORE_ASSERT(IndexBufferObject, "Setting an Index Buffer that was destroyed!");
+
 		glBindVertexArray(VertexArray);
-		InIndexBuffer->Bind();
+		IndexBufferObject->Bind();
 
+		// The previous Index Buffer is owned by this Vertex Array too
+		if (IndexBuffer != InIndexBuffer)
+		{
+			CRenderResources::Destroy(IndexBuffer);
+		}
 		IndexBuffer = InIndexBuffer;
+		IndexCount = IndexBufferObject->GetIndexCount();
 	}
 }
\ No newline at end of file
@@ -32,15 +32,15 @@ namespace AAEngine {
 		/*
 		* Overriden virtual AddVertexBuffer function to Add a Vertex Buffer to the Vertex Array object.
 		*
-		* @param VertexBuffer - Shared Pointer of the Vertex Buffer
+		* @param VertexBuffer - Handle of the Vertex Buffer
 		*/
-		virtual void AddVertexBuffer(const TSharedPtr<IVertexBuffer>& VertexBuffer) override;
+		virtual void AddVertexBuffer(FVertexBufferHandle VertexBuffer) override;
 		/*
 		* Overriden virtual SetIndexBuffer function to Set the Index Buffer of the Vertex Array object.
 		*
-		* @param IndexBuffer - Shared Pointer of the Index Buffer
+		* @param IndexBuffer - Handle of the Index Buffer
 		*/
-		virtual void SetIndexBuffer(const TSharedPtr<IIndexBuffer>& IndexBuffer) override;
+		virtual void SetIndexBuffer(FIndexBufferHandle IndexBuffer) override;
 	private:
 		/*
 		* Vertex Array Index for the Shader
@@ -0,0 +1,120 @@
+#include "AA_PreCompiledHeaders.h"
+#include "PlatformCPU.h"
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#else
+	#include <cpuid.h>
+#endif
+
+namespace AAEngine {
+
+	namespace {
+		/*
+		* Runs CPUID for a leaf / subleaf, Registers receives EAX, EBX, ECX, EDX.
+		*/
+		void CPUID(uint32_t Registers[4], uint32_t Leaf, uint32_t SubLeaf = 0) noexcept
+		{
+#ifdef _MSC_VER
+			__cpuidex((int*)Registers, (int)Leaf, (int)SubLeaf);
+#else
+			__cpuid_count(Leaf, SubLeaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+#endif
+		}
+
+		/*
+		* @returns The XCR0 register, which register states the OS saves on a context switch.
+		*/
+		uint64_t ReadXCR0() noexcept
+		{
+#ifdef _MSC_VER
+			return _xgetbv(0);
+#else
+			uint32_t Low, High;
+			__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+			return ((uint64_t)High << 32) | Low;
+#endif
+		}
+
+		FORCEINLINE bool HasBit(uint32_t Register, uint32_t Bit) noexcept
+		{
+			return (Register & (1u << Bit)) != 0;
+		}
+
+		FCPUFeatures DetectFeatures() noexcept
+		{
+			FCPUFeatures Features;
+			uint32_t Registers[4];
+
+			CPUID(Registers, 0);
+			const uint32_t MaxLeaf = Registers[0];
+			FMemory::MemCopy(Features.Vendor, &Registers[1], 4);
+			FMemory::MemCopy(Features.Vendor + 4, &Registers[3], 4);
+			FMemory::MemCopy(Features.Vendor + 8, &Registers[2], 4);
+
+			bool bOSSavesYMM = false;
+			bool bOSSavesZMM = false;
+			if (MaxLeaf >= 1)
+			{
+				CPUID(Registers, 1);
+				const uint32_t ECX = Registers[2];
+				const uint32_t EDX = Registers[3];
+				Features.bSSE2 = HasBit(EDX, 26);
+				Features.bSSE3 = HasBit(ECX, 0);
+				Features.bSSSE3 = HasBit(ECX, 9);
+				Features.bSSE41 = HasBit(ECX, 19);
+				Features.bSSE42 = HasBit(ECX, 20);
+
+				// The OS must save the upper halves of the registers, or the first context switch corrupts them
+				if (HasBit(ECX, 27))
+				{
+					const uint64_t XCR0 = ReadXCR0();
+					bOSSavesYMM = (XCR0 & 0x06) == 0x06;
+					bOSSavesZMM = (XCR0 & 0xE6) == 0xE6;
+				}
+				Features.bAVX = bOSSavesYMM && HasBit(ECX, 28);
+				Features.bFMA3 = bOSSavesYMM && HasBit(ECX, 12);
+			}
+
+			if (MaxLeaf >= 7)
+			{
+				CPUID(Registers, 7, 0);
+				Features.bAVX2 = Features.bAVX && HasBit(Registers[1], 5);
+				Features.bAVX512F = bOSSavesZMM && HasBit(Registers[1], 16);
+			}
+
+			CPUID(Registers, 0x80000000);
+			if (Registers[0] >= 0x80000004)
+			{
+				for (uint32_t Leaf = 0; Leaf < 3; Leaf++)
+				{
+					CPUID(Registers, 0x80000002 + Leaf);
+					FMemory::MemCopy(Features.Brand + Leaf * 16, Registers, 16);
+				}
+			}
+
+			return Features;
+		}
+	}
+
+	const FCPUFeatures& FPlatformCPU::GetFeatures() noexcept
+	{
+		static const FCPUFeatures Features = DetectFeatures();
+		return Features;
+	}
+
+	bool FPlatformCPU::HasAVX2() noexcept
+	{
+		const FCPUFeatures& Features = GetFeatures();
+		return Features.bAVX2 && Features.bFMA3;
+	}
+
+	void FPlatformCPU::LogFeatures()
+	{
+		const FCPUFeatures& Features = GetFeatures();
+		AA_CORE_LOG(Info, "CPU: %s (%s)", Features.Brand, Features.Vendor);
+		AA_CORE_LOG(Info, "\tSSE2 %d, SSE3 %d, SSSE3 %d, SSE4.1 %d, SSE4.2 %d, AVX %d, AVX2 %d, FMA3 %d, AVX-512F %d",
+			Features.bSSE2, Features.bSSE3, Features.bSSSE3, Features.bSSE41, Features.bSSE42,
+			Features.bAVX, Features.bAVX2, Features.bFMA3, Features.bAVX512F);
+	}
+}
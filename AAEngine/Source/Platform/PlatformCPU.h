@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace AAEngine {
+
+	/*
+	* Instruction sets of the CPU the engine is running on, read with CPUID.
+	* A feature that needs OS support to save its registers (AVX, AVX2, AVX-512) is only set if the OS enabled it.
+	*/
+	struct FCPUFeatures
+	{
+		bool bSSE2 = false;
+		bool bSSE3 = false;
+		bool bSSSE3 = false;
+		bool bSSE41 = false;
+		bool bSSE42 = false;
+		bool bAVX = false;
+		bool bAVX2 = false;
+		bool bFMA3 = false;
+		bool bAVX512F = false;
+
+		/*
+		* Vendor string, e.g. "GenuineIntel".
+		*/
+		char Vendor[13] = {};
+
+		/*
+		* Brand string, e.g. "Intel(R) Core(TM) i7-...".
+		*/
+		char Brand[49] = {};
+	};
+
+	/*
+	* Runtime CPU feature detection.
+	* The AA_PROCESSOR_SUPPORT_* defines only say what the build machine had, code that picks a wider instruction set
+	* than the compile time baseline must ask FPlatformCPU first (see FMathDispatch).
+	*/
+	struct AA_ENGINE_API FPlatformCPU
+	{
+	public:
+		/*
+		* @returns Features of the CPU, detected on the first call.
+		*/
+		static const FCPUFeatures& GetFeatures() noexcept;
+
+		/*
+		* @returns true if the CPU and OS support AVX2 and FMA3, what the AVX2 math kernels need.
+		*/
+		static bool HasAVX2() noexcept;
+
+		/*
+		* Logs the CPU brand and its SIMD instruction sets.
+		*/
+		static void LogFeatures();
+	};
+}
@@ -10,7 +10,7 @@ public:
 
 	}
 
-	virtual void OnUpdate(float DeltaSeconds) override
+	virtual void OnUpdate(float DeltaSeconds, AAEngine::CFrameAllocator& FrameAllocator) override
 	{
 		//AA_LOG(Info, "App Update");
 	}
@@ -69,6 +69,7 @@ project "AAEngine"
 		"ImGui",
 		"opengl32.lib",
 		"assimp.lib",
+		"Dbghelp.lib",
 	}
 
 	libdirs 